@@ -0,0 +1,191 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+
+#include <benchmark/benchmark.h>
+
+#include "finalmq/remoteentity/RemoteEntityContainer.h"
+#include "test.fmq.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace finalmq;
+using namespace test;
+
+static const std::string DATA_REQUEST = "Hello";
+static const std::string DATA_REPLY = "World";
+
+class EntityServer : public RemoteEntity
+{
+public:
+    EntityServer()
+    {
+        registerCommand<TestRequest>([](const RequestContextPtr& requestContext, const std::shared_ptr<TestRequest>& /*request*/) {
+            requestContext->reply(TestReply(DATA_REPLY));
+        });
+    }
+};
+
+// counts the replies and lets the benchmark thread wait for them
+class ReplyCounter
+{
+public:
+    void reset()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_count = 0;
+    }
+    void increment()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        ++m_count;
+        m_cv.notify_one();
+    }
+    bool waitFor(int count)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_cv.wait_for(lock, std::chrono::seconds(10), [this, count]() { return m_count >= count; });
+    }
+
+private:
+    std::mutex m_mutex{};
+    std::condition_variable m_cv{};
+    int m_count{0};
+};
+
+// server and client container, connected over the given endpoint
+class Loopback
+{
+public:
+    Loopback(const std::string& endpointBind, const std::string& endpointConnect)
+    {
+        m_containerServer.init(nullptr, 1, nullptr, false, 1);
+        m_containerClient.init(nullptr, 1, nullptr, false, 1);
+        m_threadServer = std::thread([this]() {
+            m_containerServer.run();
+        });
+        m_threadClient = std::thread([this]() {
+            m_containerClient.run();
+        });
+        m_containerServer.registerEntity(&m_entityServer, "MyServer");
+        m_containerClient.registerEntity(&m_entityClient);
+        m_containerServer.bind(endpointBind);
+        SessionInfo session = m_containerClient.connect(endpointConnect);
+        m_peerId = m_entityClient.connect(session, "MyServer");
+    }
+
+    ~Loopback()
+    {
+        m_containerServer.terminatePollerLoop();
+        m_containerClient.terminatePollerLoop();
+        m_threadServer.join();
+        m_threadClient.join();
+    }
+
+    // sends count requests without waiting in between and waits for all replies
+    bool requests(int count)
+    {
+        m_counter.reset();
+        for (int i = 0; i < count; ++i)
+        {
+            m_entityClient.requestReply<TestReply>(m_peerId, TestRequest{DATA_REQUEST}, [this](PeerId /*peerId*/, Status /*status*/, const std::shared_ptr<TestReply>& /*reply*/) {
+                m_counter.increment();
+            });
+        }
+        return m_counter.waitFor(count);
+    }
+
+private:
+    RemoteEntityContainer m_containerServer{};
+    RemoteEntityContainer m_containerClient{};
+    EntityServer m_entityServer{};
+    RemoteEntity m_entityClient{};
+    std::thread m_threadServer{};
+    std::thread m_threadClient{};
+    PeerId m_peerId{PEERID_INVALID};
+    ReplyCounter m_counter{};
+};
+
+static void runLatency(benchmark::State& state, const std::string& endpointBind, const std::string& endpointConnect)
+{
+    Loopback loopback(endpointBind, endpointConnect);
+    // the first request waits for the connection
+    if (!loopback.requests(1))
+    {
+        state.SkipWithError("no reply");
+        return;
+    }
+    for (auto _ : state)
+    {
+        if (!loopback.requests(1))
+        {
+            state.SkipWithError("no reply");
+            break;
+        }
+    }
+}
+
+static void runThroughput(benchmark::State& state, const std::string& endpointBind, const std::string& endpointConnect)
+{
+    const int count = static_cast<int>(state.range(0));
+    Loopback loopback(endpointBind, endpointConnect);
+    if (!loopback.requests(1))
+    {
+        state.SkipWithError("no reply");
+        return;
+    }
+    for (auto _ : state)
+    {
+        if (!loopback.requests(count))
+        {
+            state.SkipWithError("no reply");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_RemoteEntityLatencyTcp(benchmark::State& state)
+{
+    runLatency(state, "tcp://*:7790:headersize:protobuf", "tcp://localhost:7790:headersize:protobuf");
+}
+BENCHMARK(BM_RemoteEntityLatencyTcp)->UseRealTime();
+
+static void BM_RemoteEntityThroughputTcp(benchmark::State& state)
+{
+    runThroughput(state, "tcp://*:7791:headersize:protobuf", "tcp://localhost:7791:headersize:protobuf");
+}
+BENCHMARK(BM_RemoteEntityThroughputTcp)->Arg(1000)->UseRealTime();
+
+static void BM_RemoteEntityLatencyIpc(benchmark::State& state)
+{
+    runLatency(state, "ipc://benchmark_latency:headersize:protobuf", "ipc://benchmark_latency:headersize:protobuf");
+}
+BENCHMARK(BM_RemoteEntityLatencyIpc)->UseRealTime();
+
+static void BM_RemoteEntityThroughputIpc(benchmark::State& state)
+{
+    runThroughput(state, "ipc://benchmark_throughput:headersize:protobuf", "ipc://benchmark_throughput:headersize:protobuf");
+}
+BENCHMARK(BM_RemoteEntityThroughputIpc)->Arg(1000)->UseRealTime();
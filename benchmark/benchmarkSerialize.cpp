@@ -0,0 +1,308 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+
+#include <benchmark/benchmark.h>
+
+#include "finalmq/helpers/ZeroCopyBuffer.h"
+#include "finalmq/serializehl7/ParserHl7.h"
+#include "finalmq/serializehl7/SerializerHl7.h"
+#include "finalmq/serializejson/ParserJson.h"
+#include "finalmq/serializejson/SerializerJson.h"
+#include "finalmq/serializeproto/ParserProto.h"
+#include "finalmq/serializeproto/SerializerProto.h"
+#include "finalmq/serializeproto/SerializerProtoSized.h"
+#include "finalmq/serializestruct/ParserStruct.h"
+#include "finalmq/serializestruct/SerializerStruct.h"
+#include "finalmq/serializevariant/ParserVariant.h"
+#include "finalmq/serializevariant/SerializerVariant.h"
+#include "finalmq/variant/Variant.h"
+#include "finalmq/variant/VariantValues.h"
+#include "test.fmq.h"
+#include "testhl7.fmq.h"
+
+using namespace finalmq;
+
+static const int BLOCKSIZE = 1024;
+
+// array of structs with a mix of ints and strings, the number of entries is the benchmark argument
+static test::TestArrayStruct createArrayStruct(int size)
+{
+    test::TestArrayStruct msg;
+    msg.value.resize(size);
+    for (int i = 0; i < size; ++i)
+    {
+        test::TestStruct& entry = msg.value[i];
+        entry.struct_int32.value = i * 1000;
+        entry.struct_string.value = "entry number " + std::to_string(i);
+        entry.last_value = i;
+    }
+    msg.last_value = size;
+    return msg;
+}
+
+static testhl7::SSU_U03 createHl7Message()
+{
+    testhl7::SSU_U03 msg;
+    msg.msh.countryCode = "de";
+    msg.uac = std::make_shared<testhl7::UAC>();
+    msg.uac->userAuthenticationCredential.typeOfData = testhl7::MimeTypes::MimeMultipartPackage;
+    msg.sft.resize(3);
+    msg.sft[0].softwareBinaryId = "world";
+    msg.specimen_container.resize(4);
+    for (size_t i = 0; i < msg.specimen_container.size(); ++i)
+    {
+        msg.specimen_container[i].sac.positionInTray.value1 = "hey";
+        msg.specimen_container[i].sac.specimenSource = "hh";
+        msg.specimen_container[i].sac.carrierIdentifier.entityIdentifier = "uu";
+        msg.specimen_container[i].sac.carrierIdentifier.universalId = "bbb";
+        msg.specimen_container[i].obx.resize(2);
+        msg.specimen_container[i].specimen.resize(3);
+        msg.specimen_container[i].specimen[0].spm.accessionId.resize(1);
+        msg.specimen_container[i].specimen[0].spm.accessionId[0].idNumber = "ggg";
+        msg.specimen_container[i].specimen[0].spm.containerCondition.alternateText = "tt";
+        msg.specimen_container[i].specimen[0].obx.resize(5);
+    }
+    return msg;
+}
+
+template<class TSerializer>
+static std::string serialize(const StructBase& structBase)
+{
+    ZeroCopyBuffer buffer;
+    TSerializer serializer(buffer, BLOCKSIZE);
+    ParserStruct parser(serializer, structBase);
+    parser.parseStruct();
+    return buffer.getData();
+}
+
+static void setBytesProcessed(benchmark::State& state, size_t size)
+{
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * size));
+}
+
+//////////////////////////////////////////////
+// proto
+
+static void BM_SerializerProto(benchmark::State& state)
+{
+    const test::TestArrayStruct msg = createArrayStruct(static_cast<int>(state.range(0)));
+    size_t size = 0;
+    for (auto _ : state)
+    {
+        ZeroCopyBuffer buffer;
+        SerializerProto serializer(buffer, BLOCKSIZE);
+        ParserStruct parser(serializer, msg);
+        parser.parseStruct();
+        size = buffer.size();
+        benchmark::DoNotOptimize(size);
+    }
+    setBytesProcessed(state, size);
+}
+BENCHMARK(BM_SerializerProto)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_SerializerProtoSized(benchmark::State& state)
+{
+    const test::TestArrayStruct msg = createArrayStruct(static_cast<int>(state.range(0)));
+    size_t size = 0;
+    for (auto _ : state)
+    {
+        ZeroCopyBuffer buffer;
+        SerializerProtoSized serializer(buffer);
+        serializer.serializeStruct(msg);
+        size = buffer.size();
+        benchmark::DoNotOptimize(size);
+    }
+    setBytesProcessed(state, size);
+}
+BENCHMARK(BM_SerializerProtoSized)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_ParserProto(benchmark::State& state)
+{
+    const std::string data = serialize<SerializerProto>(createArrayStruct(static_cast<int>(state.range(0))));
+    for (auto _ : state)
+    {
+        test::TestArrayStruct msg;
+        SerializerStruct serializer(msg);
+        ParserProto parser(serializer, data.data(), data.size());
+        bool res = parser.parseStruct(test::TestArrayStruct::structInfo().getTypeName());
+        benchmark::DoNotOptimize(res);
+    }
+    setBytesProcessed(state, data.size());
+}
+BENCHMARK(BM_ParserProto)->Arg(1)->Arg(100)->Arg(10000);
+
+//////////////////////////////////////////////
+// json
+
+static void BM_SerializerJson(benchmark::State& state)
+{
+    const test::TestArrayStruct msg = createArrayStruct(static_cast<int>(state.range(0)));
+    size_t size = 0;
+    for (auto _ : state)
+    {
+        ZeroCopyBuffer buffer;
+        SerializerJson serializer(buffer, BLOCKSIZE);
+        ParserStruct parser(serializer, msg);
+        parser.parseStruct();
+        size = buffer.size();
+        benchmark::DoNotOptimize(size);
+    }
+    setBytesProcessed(state, size);
+}
+BENCHMARK(BM_SerializerJson)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_ParserJson(benchmark::State& state)
+{
+    const std::string data = serialize<SerializerJson>(createArrayStruct(static_cast<int>(state.range(0))));
+    for (auto _ : state)
+    {
+        test::TestArrayStruct msg;
+        SerializerStruct serializer(msg);
+        ParserJson parser(serializer, data.data(), data.size());
+        const char* res = parser.parseStruct(test::TestArrayStruct::structInfo().getTypeName());
+        benchmark::DoNotOptimize(res);
+    }
+    setBytesProcessed(state, data.size());
+}
+BENCHMARK(BM_ParserJson)->Arg(1)->Arg(100)->Arg(10000);
+
+//////////////////////////////////////////////
+// hl7
+
+static void BM_SerializerHl7(benchmark::State& state)
+{
+    const testhl7::SSU_U03 msg = createHl7Message();
+    size_t size = 0;
+    for (auto _ : state)
+    {
+        ZeroCopyBuffer buffer;
+        SerializerHl7 serializer(buffer, BLOCKSIZE);
+        ParserStruct parser(serializer, msg);
+        parser.parseStruct();
+        size = buffer.size();
+        benchmark::DoNotOptimize(size);
+    }
+    setBytesProcessed(state, size);
+}
+BENCHMARK(BM_SerializerHl7);
+
+static void BM_ParserHl7(benchmark::State& state)
+{
+    const std::string data = serialize<SerializerHl7>(createHl7Message());
+    for (auto _ : state)
+    {
+        testhl7::SSU_U03 msg;
+        SerializerStruct serializer(msg);
+        ParserHl7 parser(serializer, data.data(), data.size());
+        const char* res = parser.parseStruct(testhl7::SSU_U03::structInfo().getTypeName());
+        benchmark::DoNotOptimize(res);
+    }
+    setBytesProcessed(state, data.size());
+}
+BENCHMARK(BM_ParserHl7);
+
+//////////////////////////////////////////////
+// struct
+
+static void BM_StructCopy(benchmark::State& state)
+{
+    const test::TestArrayStruct msg = createArrayStruct(static_cast<int>(state.range(0)));
+    for (auto _ : state)
+    {
+        // ParserStruct -> SerializerStruct
+        test::TestArrayStruct msgCopy;
+        SerializerStruct serializer(msgCopy);
+        ParserStruct parser(serializer, msg);
+        bool res = parser.parseStruct();
+        benchmark::DoNotOptimize(res);
+    }
+}
+BENCHMARK(BM_StructCopy)->Arg(1)->Arg(100)->Arg(10000);
+
+//////////////////////////////////////////////
+// variant
+
+static void BM_StructToVariant(benchmark::State& state)
+{
+    const test::TestArrayStruct msg = createArrayStruct(static_cast<int>(state.range(0)));
+    for (auto _ : state)
+    {
+        Variant variant;
+        SerializerVariant serializer(variant);
+        ParserStruct parser(serializer, msg);
+        bool res = parser.parseStruct();
+        benchmark::DoNotOptimize(res);
+    }
+}
+BENCHMARK(BM_StructToVariant)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_VariantToStruct(benchmark::State& state)
+{
+    const test::TestArrayStruct msgSource = createArrayStruct(static_cast<int>(state.range(0)));
+    Variant variant;
+    SerializerVariant serializerVariant(variant);
+    ParserStruct parserStruct(serializerVariant, msgSource);
+    parserStruct.parseStruct();
+    for (auto _ : state)
+    {
+        test::TestArrayStruct msg;
+        SerializerStruct serializer(msg);
+        ParserVariant parser(serializer, variant);
+        bool res = parser.parseStruct(test::TestArrayStruct::structInfo().getTypeName());
+        benchmark::DoNotOptimize(res);
+    }
+}
+BENCHMARK(BM_VariantToStruct)->Arg(1)->Arg(100)->Arg(10000);
+
+static void BM_VariantConvertIntToString(benchmark::State& state)
+{
+    const Variant variant = static_cast<std::int32_t>(1234567);
+    for (auto _ : state)
+    {
+        std::string value = variant;
+        benchmark::DoNotOptimize(value);
+    }
+}
+BENCHMARK(BM_VariantConvertIntToString);
+
+static void BM_VariantConvertStringToDouble(benchmark::State& state)
+{
+    const Variant variant = std::string("1234.5678");
+    for (auto _ : state)
+    {
+        double value = variant;
+        benchmark::DoNotOptimize(value);
+    }
+}
+BENCHMARK(BM_VariantConvertStringToDouble);
+
+static void BM_VariantStructAccess(benchmark::State& state)
+{
+    Variant variant = VariantStruct{{"a", 1}, {"b", std::string("hello")}, {"c", VariantStruct{{"d", 2.5}}}};
+    for (auto _ : state)
+    {
+        double value = variant.getDataValue<double>("c.d");
+        benchmark::DoNotOptimize(value);
+    }
+}
+BENCHMARK(BM_VariantStructAccess);
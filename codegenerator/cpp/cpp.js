@@ -6,6 +6,7 @@ var argv = require('minimist')(process.argv.slice(2));
 var fileData = argv['input']
 var pathOutput = argv['outpath']
 var exportMacro = argv['exportmacro']
+var directSerializers = argv['directserializers'] ? true : false
 
 var fileTemplateCpp = __dirname + '/cpp_cpp.ejs'
 var fileTemplateH = __dirname + '/cpp_h.ejs'
@@ -37,7 +38,7 @@ catch (err)
 }
 
 helper.convertTypeId(data)
-var options = {data:data, exportMacro:exportMacro, helper:helper, fileOutputH:fileOutputH}
+var options = {data:data, exportMacro:exportMacro, directSerializers:directSerializers, helper:helper, fileOutputH:fileOutputH}
 var strCpp = ejs.render(strTemplateCpp, options)
 var strH = ejs.render(strTemplateH, options)
 
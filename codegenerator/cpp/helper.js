@@ -138,9 +138,9 @@ module.exports = {
             case 'double':
             case 'TYPE_DOUBLE': return 'double'
             case 'string':
-            case 'TYPE_STRING': return 'std::string'
+            case 'TYPE_STRING': return this.hasFlag(field, 'METAFLAG_ZEROCOPY') ? 'finalmq::BytesView' : 'std::string'
             case 'bytes':
-            case 'TYPE_BYTES': return 'finalmq::Bytes'
+            case 'TYPE_BYTES': return this.hasFlag(field, 'METAFLAG_ZEROCOPY') ? 'finalmq::BytesView' : 'finalmq::Bytes'
             case 'struct':
             case 'TYPE_STRUCT': 
 				if (!nullable)
@@ -255,6 +255,341 @@ module.exports = {
         return entries[0]
     },
 
+    hasFlag : function(field, flag)
+    {
+        var flagArray = field.flags;
+        if (flagArray)
+        {
+            for (var i = 0; i < flagArray.length; i++)
+            {
+                if (flagArray[i] == flag)
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    },
+
+    getStruct : function(data, type)
+    {
+        for (var i = 0; i < data.structs.length; i++)
+        {
+            var stru = data.structs[i];
+            if (stru.type == type || (data.namespace && (data.namespace + '.' + stru.type) == type))
+            {
+                return stru;
+            }
+        }
+        return null;
+    },
+
+    // The direct serializers cover the structs that the reflective serializers handle without
+    // special processing (variants, index/abort attributes, fixed arrays) and whose sub structs
+    // are generated in the same file.
+    isDirectSerializable : function(data, stru, visiting)
+    {
+        visiting = visiting || [];
+        if (visiting.indexOf(stru) != -1)
+        {
+            return true;
+        }
+        visiting.push(stru);
+        var result = true;
+        for (var n = 0; n < stru.fields.length && result; n++)
+        {
+            var field = stru.fields[n];
+            if (field.tid == 'TYPE_VARIANT' || field.tid == 'TYPE_JSON' || this.hasFlag(field, 'METAFLAG_INDEX') || this.hasFlag(field, 'METAFLAG_ZEROCOPY'))
+            {
+                result = false;
+            }
+            if (field.attrs)
+            {
+                for (var i = 0; i < field.attrs.length; i++)
+                {
+                    if (field.attrs[i].indexOf('abortstruct') != -1 || field.attrs[i].indexOf('fixedarray') != -1)
+                    {
+                        result = false;
+                    }
+                }
+            }
+            if (result && (field.tid == 'TYPE_STRUCT' || field.tid == 'TYPE_ARRAY_STRUCT'))
+            {
+                var sub = this.getStruct(data, field.type);
+                result = (sub != null) && this.isDirectSerializable(data, sub, visiting);
+            }
+        }
+        visiting.pop();
+        return result;
+    },
+
+    protoTag : function(n, wireType)
+    {
+        return (((n + 1) << 3) | wireType) >>> 0;
+    },
+
+    // wire types
+    //  0: varint, 1: fixed64, 2: length delimited, 5: fixed32
+    protoIntEncoding : function(field, signed)
+    {
+        if (this.hasFlag(field, 'METAFLAG_PROTO_VARINT'))
+        {
+            return 'varint';
+        }
+        if (signed && this.hasFlag(field, 'METAFLAG_PROTO_ZIGZAG'))
+        {
+            return 'zigzag';
+        }
+        return 'fixed';
+    },
+
+    protoIntInfo : function(tid)
+    {
+        switch (tid)
+        {
+            case 'TYPE_INT8':
+            case 'TYPE_INT16':
+            case 'TYPE_INT32':
+            case 'TYPE_ARRAY_INT8':
+            case 'TYPE_ARRAY_INT16':
+            case 'TYPE_ARRAY_INT32': return {type: 'std::int32_t', signed: true, wireFixed: 5}
+            case 'TYPE_UINT8':
+            case 'TYPE_UINT16':
+            case 'TYPE_UINT32':
+            case 'TYPE_ARRAY_UINT16':
+            case 'TYPE_ARRAY_UINT32': return {type: 'std::uint32_t', signed: false, wireFixed: 5}
+            case 'TYPE_INT64':
+            case 'TYPE_ARRAY_INT64': return {type: 'std::int64_t', signed: true, wireFixed: 1}
+            case 'TYPE_UINT64':
+            case 'TYPE_ARRAY_UINT64': return {type: 'std::uint64_t', signed: false, wireFixed: 1}
+        }
+        return null
+    },
+
+    directProtoSize : function(field, n)
+    {
+        var name = this.avoidCppKeyWords(field.name);
+        var nullable = this.isNullable(field);
+        var intInfo = this.protoIntInfo(field.tid);
+        switch (field.tid)
+        {
+            case 'TYPE_BOOL':
+            case 'TYPE_ENUM': return 'writer.sizeVarintField(' + this.protoTag(n, 0) + ', static_cast<std::int32_t>(' + name + '))'
+            case 'TYPE_INT8':
+            case 'TYPE_UINT8':
+            case 'TYPE_INT16':
+            case 'TYPE_UINT16':
+            case 'TYPE_INT32':
+            case 'TYPE_UINT32':
+            case 'TYPE_INT64':
+            case 'TYPE_UINT64':
+                switch (this.protoIntEncoding(field, intInfo.signed))
+                {
+                    case 'varint': return 'writer.sizeVarintField(' + this.protoTag(n, 0) + ', static_cast<' + intInfo.type + '>(' + name + '))'
+                    case 'zigzag': return 'writer.sizeZigZagField(' + this.protoTag(n, 0) + ', ' + name + ')'
+                }
+                return 'writer.sizeFixedField<' + intInfo.type + '>(' + this.protoTag(n, intInfo.wireFixed) + ', ' + name + ')'
+            case 'TYPE_FLOAT': return 'writer.sizeFixedField<float>(' + this.protoTag(n, 5) + ', ' + name + ')'
+            case 'TYPE_DOUBLE': return 'writer.sizeFixedField<double>(' + this.protoTag(n, 1) + ', ' + name + ')'
+            case 'TYPE_STRING':
+            case 'TYPE_BYTES': return 'writer.sizeStringField(' + this.protoTag(n, 2) + ', ' + name + '.size())'
+            case 'TYPE_STRUCT': return 'writer.' + (nullable ? 'sizeStructNullable(' : 'sizeStruct(') + this.protoTag(n, 2) + ', ' + name + (nullable ? ')' : ', false)')
+            case 'TYPE_ARRAY_BOOL': return 'writer.sizeArrayBool(' + this.protoTag(n, 2) + ', ' + name + '.size())'
+            case 'TYPE_ARRAY_INT8':
+            case 'TYPE_ARRAY_INT16':
+            case 'TYPE_ARRAY_UINT16':
+            case 'TYPE_ARRAY_INT32':
+            case 'TYPE_ARRAY_UINT32':
+            case 'TYPE_ARRAY_INT64':
+            case 'TYPE_ARRAY_UINT64':
+                switch (this.protoIntEncoding(field, intInfo.signed))
+                {
+                    case 'varint': return 'writer.sizeArrayVarint(' + this.protoTag(n, 0) + ', ' + name + ')'
+                    case 'zigzag': return 'writer.sizeArrayZigZag(' + this.protoTag(n, 0) + ', ' + name + ')'
+                }
+                return 'writer.sizeArrayFixed<' + intInfo.type + '>(' + this.protoTag(n, 2) + ', ' + name + '.size())'
+            case 'TYPE_ARRAY_FLOAT': return 'writer.sizeArrayFixed<float>(' + this.protoTag(n, 2) + ', ' + name + '.size())'
+            case 'TYPE_ARRAY_DOUBLE': return 'writer.sizeArrayFixed<double>(' + this.protoTag(n, 2) + ', ' + name + '.size())'
+            case 'TYPE_ARRAY_STRING':
+            case 'TYPE_ARRAY_BYTES': return 'writer.sizeArrayString(' + this.protoTag(n, 2) + ', ' + name + ')'
+            case 'TYPE_ARRAY_STRUCT': return 'writer.sizeArrayStruct(' + this.protoTag(n, 2) + ', ' + name + ')'
+            case 'TYPE_ARRAY_ENUM': return 'writer.sizeArrayEnum(' + this.protoTag(n, 0) + ', ' + name + ')'
+        }
+    },
+
+    directProtoWrite : function(field, n)
+    {
+        var name = this.avoidCppKeyWords(field.name);
+        var nullable = this.isNullable(field);
+        var intInfo = this.protoIntInfo(field.tid);
+        switch (field.tid)
+        {
+            case 'TYPE_BOOL':
+            case 'TYPE_ENUM': return 'writer.writeVarintField(' + this.protoTag(n, 0) + ', static_cast<std::int32_t>(' + name + '));'
+            case 'TYPE_INT8':
+            case 'TYPE_UINT8':
+            case 'TYPE_INT16':
+            case 'TYPE_UINT16':
+            case 'TYPE_INT32':
+            case 'TYPE_UINT32':
+            case 'TYPE_INT64':
+            case 'TYPE_UINT64':
+                switch (this.protoIntEncoding(field, intInfo.signed))
+                {
+                    case 'varint': return 'writer.writeVarintField(' + this.protoTag(n, 0) + ', static_cast<' + intInfo.type + '>(' + name + '));'
+                    case 'zigzag': return 'writer.writeZigZagField(' + this.protoTag(n, 0) + ', ' + name + ');'
+                }
+                return 'writer.writeFixedField<' + intInfo.type + '>(' + this.protoTag(n, intInfo.wireFixed) + ', ' + name + ');'
+            case 'TYPE_FLOAT': return 'writer.writeFixedField<float>(' + this.protoTag(n, 5) + ', ' + name + ');'
+            case 'TYPE_DOUBLE': return 'writer.writeFixedField<double>(' + this.protoTag(n, 1) + ', ' + name + ');'
+            case 'TYPE_STRING':
+            case 'TYPE_BYTES': return 'writer.writeStringField(' + this.protoTag(n, 2) + ', ' + name + '.data(), ' + name + '.size());'
+            case 'TYPE_STRUCT': return 'writer.' + (nullable ? 'writeStructNullable(' : 'writeStruct(') + this.protoTag(n, 2) + ', ' + name + (nullable ? ');' : ', false);')
+            case 'TYPE_ARRAY_BOOL': return 'writer.writeArrayBool(' + this.protoTag(n, 2) + ', ' + name + ');'
+            case 'TYPE_ARRAY_INT8':
+            case 'TYPE_ARRAY_INT16':
+            case 'TYPE_ARRAY_UINT16':
+            case 'TYPE_ARRAY_INT32':
+            case 'TYPE_ARRAY_UINT32':
+            case 'TYPE_ARRAY_INT64':
+            case 'TYPE_ARRAY_UINT64':
+                switch (this.protoIntEncoding(field, intInfo.signed))
+                {
+                    case 'varint': return 'writer.writeArrayVarint(' + this.protoTag(n, 0) + ', ' + name + ');'
+                    case 'zigzag': return 'writer.writeArrayZigZag(' + this.protoTag(n, 0) + ', ' + name + ');'
+                }
+                return 'writer.writeArrayFixed<' + intInfo.type + '>(' + this.protoTag(n, 2) + ', ' + name + ');'
+            case 'TYPE_ARRAY_FLOAT': return 'writer.writeArrayFixed<float>(' + this.protoTag(n, 2) + ', ' + name + ');'
+            case 'TYPE_ARRAY_DOUBLE': return 'writer.writeArrayFixed<double>(' + this.protoTag(n, 2) + ', ' + name + ');'
+            case 'TYPE_ARRAY_STRING':
+            case 'TYPE_ARRAY_BYTES': return 'writer.writeArrayString(' + this.protoTag(n, 2) + ', ' + name + ');'
+            case 'TYPE_ARRAY_STRUCT': return 'writer.writeArrayStruct(' + this.protoTag(n, 2) + ', ' + name + ');'
+            case 'TYPE_ARRAY_ENUM': return 'writer.writeArrayEnum(' + this.protoTag(n, 0) + ', ' + name + ');'
+        }
+    },
+
+    directProtoRead : function(field)
+    {
+        var name = this.avoidCppKeyWords(field.name);
+        var nullable = this.isNullable(field);
+        var intInfo = this.protoIntInfo(field.tid);
+        var zigzag = this.hasFlag(field, 'METAFLAG_PROTO_ZIGZAG') ? 'true' : 'false';
+        switch (field.tid)
+        {
+            case 'TYPE_BOOL': return 'reader.readValue<bool>(tag, ' + name + ', false)'
+            case 'TYPE_ENUM': return 'reader.readEnum(tag, ' + name + ')'
+            case 'TYPE_INT8':
+            case 'TYPE_INT16':
+            case 'TYPE_INT32':
+            case 'TYPE_INT64': return 'reader.readValue<' + intInfo.type + '>(tag, ' + name + ', ' + zigzag + ')'
+            case 'TYPE_UINT8':
+            case 'TYPE_UINT16':
+            case 'TYPE_UINT32':
+            case 'TYPE_UINT64': return 'reader.readValue<' + intInfo.type + '>(tag, ' + name + ', false)'
+            case 'TYPE_FLOAT':
+            case 'TYPE_DOUBLE': return 'reader.readFixed(tag, ' + name + ')'
+            case 'TYPE_STRING':
+            case 'TYPE_BYTES': return 'reader.readString(tag, ' + name + ')'
+            case 'TYPE_STRUCT': return 'reader.' + (nullable ? 'readStructNullable' : 'readStruct') + '(tag, ' + name + ')'
+            case 'TYPE_ARRAY_BOOL': return 'reader.readArrayVarint<bool>(tag, ' + name + ', false)'
+            case 'TYPE_ARRAY_INT8':
+            case 'TYPE_ARRAY_INT16':
+            case 'TYPE_ARRAY_UINT16':
+            case 'TYPE_ARRAY_INT32':
+            case 'TYPE_ARRAY_UINT32':
+            case 'TYPE_ARRAY_INT64':
+            case 'TYPE_ARRAY_UINT64':
+                switch (this.protoIntEncoding(field, intInfo.signed))
+                {
+                    case 'varint': return 'reader.readArrayVarint<' + intInfo.type + '>(tag, ' + name + ', false)'
+                    case 'zigzag': return 'reader.readArrayVarint<' + intInfo.type + '>(tag, ' + name + ', true)'
+                }
+                return 'reader.readArrayFixed<' + intInfo.type + '>(tag, ' + name + ')'
+            case 'TYPE_ARRAY_FLOAT': return 'reader.readArrayFixed<float>(tag, ' + name + ')'
+            case 'TYPE_ARRAY_DOUBLE': return 'reader.readArrayFixed<double>(tag, ' + name + ')'
+            case 'TYPE_ARRAY_STRING':
+            case 'TYPE_ARRAY_BYTES': return 'reader.readArrayString(tag, ' + name + ')'
+            case 'TYPE_ARRAY_STRUCT': return 'reader.readArrayStruct(tag, ' + name + ')'
+            case 'TYPE_ARRAY_ENUM': return 'reader.readArrayEnum(tag, ' + name + ')'
+        }
+    },
+
+    directJsonWrite : function(field)
+    {
+        var name = this.avoidCppKeyWords(field.name);
+        var nullable = this.isNullable(field);
+        switch (field.tid)
+        {
+            case 'TYPE_BOOL': return 'writer.writeBool(' + name + ');'
+            case 'TYPE_INT8':
+            case 'TYPE_INT16':
+            case 'TYPE_INT32': return 'writer.writeInt32(' + name + ');'
+            case 'TYPE_UINT8':
+            case 'TYPE_UINT16':
+            case 'TYPE_UINT32': return 'writer.writeUInt32(' + name + ');'
+            case 'TYPE_INT64': return 'writer.writeInt64(' + name + ');'
+            case 'TYPE_UINT64': return 'writer.writeUInt64(' + name + ');'
+            case 'TYPE_FLOAT':
+            case 'TYPE_DOUBLE': return 'writer.writeDouble(' + name + ');'
+            case 'TYPE_STRING': return 'writer.writeString(' + name + ');'
+            case 'TYPE_BYTES': return 'writer.writeBytes(' + name + ');'
+            case 'TYPE_STRUCT': return 'writer.' + (nullable ? 'writeStructNullable(' : 'writeStruct(') + name + ');'
+            case 'TYPE_ENUM': return 'writer.writeEnum(' + name + ');'
+            case 'TYPE_ARRAY_BOOL': return 'writer.writeArrayBool(' + name + ');'
+            case 'TYPE_ARRAY_INT8':
+            case 'TYPE_ARRAY_INT16':
+            case 'TYPE_ARRAY_INT32': return 'writer.writeArrayInt32(' + name + ');'
+            case 'TYPE_ARRAY_UINT16':
+            case 'TYPE_ARRAY_UINT32': return 'writer.writeArrayUInt32(' + name + ');'
+            case 'TYPE_ARRAY_INT64':
+            case 'TYPE_ARRAY_UINT64': return 'writer.writeArrayInt64(' + name + ');'
+            case 'TYPE_ARRAY_FLOAT':
+            case 'TYPE_ARRAY_DOUBLE': return 'writer.writeArrayDouble(' + name + ');'
+            case 'TYPE_ARRAY_STRING': return 'writer.writeArrayString(' + name + ');'
+            case 'TYPE_ARRAY_BYTES': return 'writer.writeArrayBytes(' + name + ');'
+            case 'TYPE_ARRAY_STRUCT': return 'writer.writeArrayStruct(' + name + ');'
+            case 'TYPE_ARRAY_ENUM': return 'writer.writeArrayEnum(' + name + ');'
+        }
+    },
+
+    directJsonRead : function(field)
+    {
+        var name = this.avoidCppKeyWords(field.name);
+        var nullable = this.isNullable(field);
+        switch (field.tid)
+        {
+            case 'TYPE_BOOL': return 'reader.readBool(' + name + ')'
+            case 'TYPE_INT8':
+            case 'TYPE_UINT8':
+            case 'TYPE_INT16':
+            case 'TYPE_UINT16':
+            case 'TYPE_INT32':
+            case 'TYPE_UINT32':
+            case 'TYPE_INT64':
+            case 'TYPE_UINT64': return 'reader.readInteger(' + name + ')'
+            case 'TYPE_FLOAT':
+            case 'TYPE_DOUBLE': return 'reader.readFloat(' + name + ')'
+            case 'TYPE_STRING': return 'reader.readString(' + name + ')'
+            case 'TYPE_BYTES': return 'reader.readBytes(' + name + ')'
+            case 'TYPE_STRUCT': return 'reader.' + (nullable ? 'readStructNullable(' : 'readStruct(') + name + ')'
+            case 'TYPE_ENUM': return 'reader.readEnum(' + name + ')'
+            case 'TYPE_ARRAY_BOOL': return 'reader.readArrayBool(' + name + ')'
+            case 'TYPE_ARRAY_INT8':
+            case 'TYPE_ARRAY_INT16':
+            case 'TYPE_ARRAY_UINT16':
+            case 'TYPE_ARRAY_INT32':
+            case 'TYPE_ARRAY_UINT32':
+            case 'TYPE_ARRAY_INT64':
+            case 'TYPE_ARRAY_UINT64': return 'reader.readArrayInteger(' + name + ')'
+            case 'TYPE_ARRAY_FLOAT':
+            case 'TYPE_ARRAY_DOUBLE': return 'reader.readArrayFloat(' + name + ')'
+            case 'TYPE_ARRAY_STRING': return 'reader.readArrayString(' + name + ')'
+            case 'TYPE_ARRAY_BYTES': return 'reader.readArrayBytes(' + name + ')'
+            case 'TYPE_ARRAY_STRUCT': return 'reader.readArrayStruct(' + name + ')'
+            case 'TYPE_ARRAY_ENUM': return 'reader.readArrayEnum(' + name + ')'
+        }
+    },
+
     avoidCppKeyWords: function (name)
     {
         if (name == 'namespace') {
@@ -32,6 +32,7 @@ namespace finalmq
         METAFLAG_NULLABLE = 4,
         METAFLAG_ONE_REQUIRED = 8,    // only for array of struct
         METAFLAG_INDEX = 16,
+        METAFLAG_ZEROCOPY = 32,       // only for string and bytes
     };
 
     public class MetaField
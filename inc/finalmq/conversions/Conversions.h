@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <string>
 
+#include "finalmq/conversions/NumberParser.h"
 #include "finalmq/helpers/FmqDefines.h"
 
 template<class T>
@@ -35,59 +36,59 @@ void string2Number(const std::string& str, bool& number)
 template<>
 void string2Number(const std::string& str, std::int8_t& number)
 {
-    number = static_cast<std::int8_t>(strtol(str.c_str(), nullptr, 10));
+    number = finalmq::NumberParser::toNumber<std::int8_t>(str.data(), str.data() + str.size());
 }
 
 template<>
 void string2Number(const std::string& str, std::uint8_t& number)
 {
-    number = static_cast<std::uint8_t>(strtoul(str.c_str(), nullptr, 10));
+    number = finalmq::NumberParser::toNumber<std::uint8_t>(str.data(), str.data() + str.size());
 }
 
 template<>
 void string2Number(const std::string& str, std::int16_t& number)
 {
-    number = static_cast<std::int16_t>(strtol(str.c_str(), nullptr, 10));
+    number = finalmq::NumberParser::toNumber<std::int16_t>(str.data(), str.data() + str.size());
 }
 
 template<>
 void string2Number(const std::string& str, std::uint16_t& number)
 {
-    number = static_cast<std::uint16_t>(strtoul(str.c_str(), nullptr, 10));
+    number = finalmq::NumberParser::toNumber<std::uint16_t>(str.data(), str.data() + str.size());
 }
 
 template<>
 void string2Number(const std::string& str, std::int32_t& number)
 {
-    number = static_cast<std::int32_t>(strtol(str.c_str(), nullptr, 10));
+    number = finalmq::NumberParser::toNumber<std::int32_t>(str.data(), str.data() + str.size());
 }
 
 template<>
 void string2Number(const std::string& str, std::uint32_t& number)
 {
-    number = static_cast<std::uint32_t>(strtoul(str.c_str(), nullptr, 10));
+    number = finalmq::NumberParser::toNumber<std::uint32_t>(str.data(), str.data() + str.size());
 }
 
 template<>
 void string2Number(const std::string& str, std::int64_t& number)
 {
-    number = strtoll(str.c_str(), nullptr, 10);
+    number = finalmq::NumberParser::toNumber<std::int64_t>(str.data(), str.data() + str.size());
 }
 
 template<>
 void string2Number(const std::string& str, std::uint64_t& number)
 {
-    number = strtoull(str.c_str(), nullptr, 10);
+    number = finalmq::NumberParser::toNumber<std::uint64_t>(str.data(), str.data() + str.size());
 }
 
 template<>
 void string2Number(const std::string& str, float& number)
 {
-    number = strtof32(str.c_str(), nullptr);
+    number = finalmq::NumberParser::toNumber<float>(str.data(), str.data() + str.size());
 }
 
 template<>
 void string2Number(const std::string& str, double& number)
 {
-    number = strtof64(str.c_str(), nullptr);
+    number = finalmq::NumberParser::toNumber<double>(str.data(), str.data() + str.size());
 }
@@ -0,0 +1,322 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#include <stdlib.h>
+
+#include "finalmq/helpers/FmqDefines.h"
+
+namespace finalmq
+{
+/**
+ * Locale independent conversion of decimal numbers. Doubles and floats are converted
+ * with the Clinger fast path and the Eisel-Lemire algorithm, both are exact (like
+ * strtod) for up to 19 significant digits. Longer mantissas are truncated to 19 digits,
+ * only if the truncation changes the result, which is rare, the number is converted
+ * by strtod/strtof.
+ */
+class SYMBOLEXP NumberParser
+{
+public:
+    /**
+     * Parses a number in [str, end): optional '-', digits, optional fraction and
+     * optional exponent. Returns the position after the number or nullptr, if there
+     * are no digits.
+     */
+    static const char* parseDouble(const char* str, const char* end, double& value)
+    {
+        Decimal decimal;
+        const char* res = scanDecimal(str, end, decimal);
+        if (res)
+        {
+            value = decimalToDouble(str, res, decimal);
+        }
+        return res;
+    }
+
+    /**
+     * Like parseDouble(), but rounds directly to float.
+     */
+    static const char* parseFloat(const char* str, const char* end, float& value)
+    {
+        Decimal decimal;
+        const char* res = scanDecimal(str, end, decimal);
+        if (res)
+        {
+            value = decimalToFloat(str, res, decimal);
+        }
+        return res;
+    }
+
+    /**
+     * Parses an optional '-' and digits in [str, end). Saturates on overflow like strtoll.
+     * Returns the position after the number or nullptr, if there are no digits.
+     */
+    static const char* parseInt64(const char* str, const char* end, std::int64_t& value)
+    {
+        const bool negative = (str < end && *str == '-');
+        std::uint64_t magnitude = 0;
+        const char* res = parseUInt64(negative ? str + 1 : str, end, magnitude);
+        value = toSigned(magnitude, negative);
+        return res;
+    }
+
+    /**
+     * Parses digits in [str, end). Saturates on overflow like strtoull.
+     * Returns the position after the number or nullptr, if there are no digits.
+     */
+    static const char* parseUInt64(const char* str, const char* end, std::uint64_t& value)
+    {
+        const char* p = str;
+        std::uint64_t v = 0;
+        // 19 digits do not overflow
+        const char* endNoOverflow = (end - p > 19) ? p + 19 : end;
+        while (p < endNoOverflow && isDigit(*p))
+        {
+            v = v * 10 + static_cast<std::uint64_t>(*p - '0');
+            ++p;
+        }
+        if (p == str)
+        {
+            value = 0;
+            return nullptr;
+        }
+        bool overflow = false;
+        while (p < end && isDigit(*p))
+        {
+            const std::uint64_t digit = static_cast<std::uint64_t>(*p - '0');
+            if (v > (std::numeric_limits<std::uint64_t>::max() - digit) / 10)
+            {
+                overflow = true;
+            }
+            v = v * 10 + digit;
+            ++p;
+        }
+        value = overflow ? std::numeric_limits<std::uint64_t>::max() : v;
+        return p;
+    }
+
+    /**
+     * Converts a string like strtol/strtoul/strtoll/strtoull/strtof/strtod: leading
+     * white spaces and a sign are skipped, the conversion stops at the first character
+     * that does not belong to the number. Returns 0, if there is no number.
+     */
+    template<class T>
+    static T toNumber(const char* str, const char* end)
+    {
+        return convertLenient(str, end, static_cast<T*>(nullptr));
+    }
+
+private:
+    struct Decimal
+    {
+        std::uint64_t mantissa = 0;
+        std::int64_t exponent = 0;
+        std::int64_t digits = 0; ///< significant digits, only the first 19 are in the mantissa
+        bool negative = false;
+    };
+
+    static inline bool isDigit(char c)
+    {
+        return (c >= '0' && c <= '9');
+    }
+
+    static inline std::int64_t toSigned(std::uint64_t magnitude, bool negative)
+    {
+        if (negative)
+        {
+            if (magnitude > static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()) + 1)
+            {
+                return std::numeric_limits<std::int64_t>::min();
+            }
+            return static_cast<std::int64_t>(0 - magnitude);
+        }
+        if (magnitude > static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()))
+        {
+            return std::numeric_limits<std::int64_t>::max();
+        }
+        return static_cast<std::int64_t>(magnitude);
+    }
+
+    static const char* scanDecimal(const char* str, const char* end, Decimal& decimal)
+    {
+        const char* p = str;
+        if (p < end && *p == '-')
+        {
+            decimal.negative = true;
+            ++p;
+        }
+        const char* digitsBegin = p;
+        while (p < end && *p == '0')
+        {
+            ++p;
+        }
+        while (p < end && isDigit(*p))
+        {
+            if (decimal.digits < MAX_MANTISSA_DIGITS)
+            {
+                decimal.mantissa = decimal.mantissa * 10 + static_cast<std::uint64_t>(*p - '0');
+            }
+            else
+            {
+                ++decimal.exponent;
+            }
+            ++decimal.digits;
+            ++p;
+        }
+        bool hasDigits = (p != digitsBegin);
+        if (p < end && *p == '.')
+        {
+            ++p;
+            const char* fractionBegin = p;
+            if (decimal.digits == 0)
+            {
+                // zeros after the point are not significant, if the integer part is 0
+                while (p < end && *p == '0')
+                {
+                    --decimal.exponent;
+                    ++p;
+                }
+            }
+            while (p < end && isDigit(*p))
+            {
+                if (decimal.digits < MAX_MANTISSA_DIGITS)
+                {
+                    decimal.mantissa = decimal.mantissa * 10 + static_cast<std::uint64_t>(*p - '0');
+                    --decimal.exponent;
+                }
+                ++decimal.digits;
+                ++p;
+            }
+            hasDigits = hasDigits || (p != fractionBegin);
+        }
+        if (!hasDigits)
+        {
+            return nullptr;
+        }
+        if (p < end && (*p == 'e' || *p == 'E'))
+        {
+            const char* e = p + 1;
+            bool negativeExponent = false;
+            if (e < end && (*e == '+' || *e == '-'))
+            {
+                negativeExponent = (*e == '-');
+                ++e;
+            }
+            if (e < end && isDigit(*e))
+            {
+                std::int64_t exponent = 0;
+                while (e < end && isDigit(*e))
+                {
+                    // larger exponents are 0 or infinity anyway
+                    if (exponent < 0x10000000)
+                    {
+                        exponent = exponent * 10 + (*e - '0');
+                    }
+                    ++e;
+                }
+                decimal.exponent += negativeExponent ? -exponent : exponent;
+                p = e;
+            }
+        }
+        return p;
+    }
+
+    static double decimalToDouble(const char* str, const char* end, const Decimal& decimal);
+    static float decimalToFloat(const char* str, const char* end, const Decimal& decimal);
+    static double strtodLocaleIndependent(const char* str, const char* end);
+    static float strtofLocaleIndependent(const char* str, const char* end);
+
+    template<class T>
+    static T convertLenient(const char* str, const char* end, T*)
+    {
+        static_assert(std::is_integral<T>::value, "integral type expected");
+        const char* p = skipSpaces(str, end);
+        bool negative = false;
+        if (p < end && (*p == '+' || *p == '-'))
+        {
+            negative = (*p == '-');
+            ++p;
+        }
+        std::uint64_t magnitude = 0;
+        parseUInt64(p, end, magnitude);
+        if (std::is_signed<T>::value)
+        {
+            return static_cast<T>(toSigned(magnitude, negative));
+        }
+        // strtoull negates the value
+        return static_cast<T>(negative ? (0 - magnitude) : magnitude);
+    }
+
+    static double convertLenient(const char* str, const char* end, double*)
+    {
+        double value = 0;
+        const char* p = skipSpaces(str, end);
+        const char* number = (p < end && *p == '+') ? p + 1 : p;
+        if (number < end && (isDigit(*number) || (*number == '-' && number == p)))
+        {
+            const char* res = parseDouble(number, end, value);
+            if (res && !(res < end && (*res == 'x' || *res == 'X')))
+            {
+                return value;
+            }
+        }
+        // e.g. "inf", "nan", hex numbers
+        return (str < end) ? strtodLocaleIndependent(str, end) : 0;
+    }
+
+    static float convertLenient(const char* str, const char* end, float*)
+    {
+        float value = 0;
+        const char* p = skipSpaces(str, end);
+        const char* number = (p < end && *p == '+') ? p + 1 : p;
+        if (number < end && (isDigit(*number) || (*number == '-' && number == p)))
+        {
+            const char* res = parseFloat(number, end, value);
+            if (res && !(res < end && (*res == 'x' || *res == 'X')))
+            {
+                return value;
+            }
+        }
+        return (str < end) ? strtofLocaleIndependent(str, end) : 0;
+    }
+
+    static const char* skipSpaces(const char* str, const char* end)
+    {
+        while (str < end && (*str == ' ' || (*str >= '\t' && *str <= '\r')))
+        {
+            ++str;
+        }
+        return str;
+    }
+
+    static const std::int64_t MAX_MANTISSA_DIGITS = 19;
+};
+
+} // namespace finalmq
@@ -0,0 +1,81 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "finalmq/helpers/FmqDefines.h"
+
+namespace finalmq
+{
+/**
+ * An interned key. All atoms with the same name share the ID and one process-wide instance of
+ * the name. Atoms are meant for well-known keys like the keys of the control data. They are
+ * created once (e.g. as static constants), the table never shrinks, so the IDs stay small.
+ * A struct variant remembers the position of an entry by the atom ID, if the entry is added or
+ * looked up by the atom, further lookups by the atom are O(1) (see Variant::getVariant(const Atom&)).
+ * A lookup by an atom takes the key as it is, it is not parsed as a path.
+ */
+class SYMBOLEXP Atom
+{
+public:
+    explicit Atom(const char* name);
+    explicit Atom(const std::string& name);
+
+    inline std::uint32_t getId() const
+    {
+        return m_id;
+    }
+
+    inline const std::string& getName() const
+    {
+        return *m_name;
+    }
+
+    inline operator const std::string&() const
+    {
+        return *m_name;
+    }
+
+    inline bool operator==(const Atom& rhs) const
+    {
+        return (m_id == rhs.m_id);
+    }
+
+    inline bool operator!=(const Atom& rhs) const
+    {
+        return (m_id != rhs.m_id);
+    }
+
+    /**
+     * Number of interned atoms, the IDs are 0 .. getNumberOfAtoms() - 1.
+     */
+    static std::uint32_t getNumberOfAtoms();
+
+private:
+    std::uint32_t m_id = 0;
+    const std::string* m_name = nullptr;
+};
+
+} // namespace finalmq
@@ -0,0 +1,88 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <utility>
+
+#include "finalmq/helpers/FmqDefines.h"
+
+namespace finalmq
+{
+/**
+ * Thread local pool of buffer chunks and buffer reference nodes. The chunks are strings
+ * with a capacity of a size class (64 bytes ... 64 kbytes). Buffers and references are
+ * taken out of the pool and given back by splicing the list nodes, so that a list node
+ * and its chunk are only allocated, if the pool of the thread is empty (miss).
+ * Chunks that are given back by another thread are kept by the pool of that thread.
+ */
+class SYMBOLEXP BufferPool
+{
+public:
+    typedef std::pair<char*, ssize_t> Ref;
+
+    struct Statistics
+    {
+        std::uint64_t hits = 0;     ///< buffers/references that were taken from the pool
+        std::uint64_t misses = 0;   ///< buffers/references that had to be allocated
+    };
+
+    /**
+     * Appends a chunk with the given size at the end of buffers.
+     * @return pointer to the data of the new chunk.
+     */
+    static char* addBuffer(std::list<std::string>& buffers, ssize_t size);
+
+    /**
+     * Gives the last chunk of buffers back to the pool.
+     */
+    static void removeLastBuffer(std::list<std::string>& buffers);
+
+    /**
+     * Gives all chunks of buffers back to the pool. buffers is empty, afterwards.
+     */
+    static void releaseBuffers(std::list<std::string>& buffers);
+
+    /**
+     * Inserts a reference before pos.
+     * @return iterator to the inserted reference.
+     */
+    static std::list<Ref>::iterator addRef(std::list<Ref>& refs, std::list<Ref>::iterator pos, const Ref& ref);
+
+    /**
+     * Gives the reference at pos back to the pool.
+     */
+    static void removeRef(std::list<Ref>& refs, std::list<Ref>::iterator pos);
+
+    /**
+     * Gives all references back to the pool. refs is empty, afterwards.
+     */
+    static void releaseRefs(std::list<Ref>& refs);
+
+    static Statistics getStatistics();
+    static void resetStatistics();
+};
+
+} // namespace finalmq
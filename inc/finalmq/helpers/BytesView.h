@@ -0,0 +1,119 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <string.h>
+
+#include "finalmq/helpers/FmqDefines.h"
+
+namespace finalmq
+{
+/**
+ * Read-only view on string or bytes data. It is the type of the struct fields with the flag
+ * METAFLAG_ZEROCOPY. A parsed view references the buffer of the received message and keeps
+ * it alive, so the data is not copied. A view that is created from a string owns a copy of
+ * the string.
+ */
+class BytesView
+{
+public:
+    BytesView() = default;
+
+    BytesView(const std::shared_ptr<const std::string>& buffer, const char* data, ssize_t size)
+        : m_buffer(buffer), m_data(data), m_size(size)
+    {
+    }
+
+    BytesView(const char* data, ssize_t size)
+    {
+        assign(data, size);
+    }
+
+    BytesView(const std::string& value)
+    {
+        assign(value.data(), value.size());
+    }
+
+    BytesView(const char* value)
+    {
+        assign(value, strlen(value));
+    }
+
+    inline const char* data() const
+    {
+        return m_data;
+    }
+
+    inline ssize_t size() const
+    {
+        return m_size;
+    }
+
+    inline bool empty() const
+    {
+        return (m_size == 0);
+    }
+
+    inline std::string str() const
+    {
+        return std::string(m_data, m_size);
+    }
+
+    /**
+     * The buffer, which is referenced by the view. The buffer is nullptr for an empty view.
+     */
+    inline const std::shared_ptr<const std::string>& getBuffer() const
+    {
+        return m_buffer;
+    }
+
+    bool operator==(const BytesView& rhs) const
+    {
+        return (m_size == rhs.m_size) && (m_size == 0 || memcmp(m_data, rhs.m_data, m_size) == 0);
+    }
+
+    bool operator!=(const BytesView& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+private:
+    void assign(const char* data, ssize_t size)
+    {
+        if (size > 0)
+        {
+            m_buffer = std::make_shared<const std::string>(data, size);
+            m_data = m_buffer->data();
+            m_size = size;
+        }
+    }
+
+    std::shared_ptr<const std::string> m_buffer{};
+    const char* m_data = "";
+    ssize_t m_size = 0;
+};
+
+} // namespace finalmq
@@ -121,6 +121,12 @@ public:
     }
 };
 
+enum class ExecutorWorkerType
+{
+    EXECUTORWORKER_DEFAULT,         ///< ExecutorWorker<Executor>, all worker threads share one queue
+    EXECUTORWORKER_WORKSTEALING,    ///< ExecutorWorker<ExecutorWorkStealing>, every worker thread has its own lock-free queue
+};
+
 class SYMBOLEXP GlobalExecutorWorker
 {
 public:
@@ -142,11 +148,26 @@ public:
     */
     static void setInstance(std::unique_ptr<IExecutorWorker>&& instance);
 
+    /**
+    * Selects the implementation of the instance, which is created at the first call of instance().
+    * Call this method before the instance is used, an existing instance is not replaced.
+    */
+    static void setConfig(ExecutorWorkerType type, int numberOfWorkerThreads = 4);
+
+    static std::unique_ptr<IExecutorWorker> createExecutorWorker(ExecutorWorkerType type, int numberOfWorkerThreads = 4);
+
 private:
     GlobalExecutorWorker() = delete;
     ~GlobalExecutorWorker() = delete;
     static IExecutorWorker* createInstance();
 
+    struct Config
+    {
+        ExecutorWorkerType type = ExecutorWorkerType::EXECUTORWORKER_DEFAULT;
+        int numberOfWorkerThreads = 4;
+    };
+    static Config& getStaticConfigRef();
+
     static std::atomic<IExecutorWorker*>& getStaticInstanceRef();
     static std::unique_ptr<IExecutorWorker>& getStaticUniquePtrRef();
 };
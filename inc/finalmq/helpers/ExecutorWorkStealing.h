@@ -0,0 +1,275 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "finalmq/helpers/Executor.h"
+
+namespace finalmq
+{
+/**
+ * Callable that is stored inside the queue entries of ExecutorWorkStealing. Callables
+ * up to SIZE_INLINE bytes (e.g. lambdas with a few captures or a std::function) are
+ * stored inline, larger ones are allocated on the heap.
+ */
+class SYMBOLEXP ExecutorTask
+{
+public:
+    static constexpr size_t SIZE_INLINE = 48;
+
+    ExecutorTask() = default;
+    ~ExecutorTask()
+    {
+        reset();
+    }
+    ExecutorTask(ExecutorTask&& rhs) noexcept
+    {
+        moveFrom(rhs);
+    }
+    ExecutorTask& operator=(ExecutorTask&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            reset();
+            moveFrom(rhs);
+        }
+        return *this;
+    }
+
+    template<class F>
+    void set(F&& func)
+    {
+        typedef typename std::decay<F>::type Func;
+        reset();
+        setIntern<Func>(std::forward<F>(func), std::integral_constant < bool, sizeof(Func) <= SIZE_INLINE && alignof(Func) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible<Func>::value > ());
+    }
+
+    void reset()
+    {
+        if (m_ops)
+        {
+            m_ops->destroy(m_storage);
+            m_ops = nullptr;
+        }
+    }
+
+    explicit operator bool() const
+    {
+        return (m_ops != nullptr);
+    }
+
+    void operator()()
+    {
+        m_ops->invoke(m_storage);
+    }
+
+private:
+    ExecutorTask(const ExecutorTask&) = delete;
+    ExecutorTask& operator=(const ExecutorTask&) = delete;
+
+    struct Ops
+    {
+        void (*invoke)(void* storage);
+        void (*move)(void* storageDestination, void* storageSource);
+        void (*destroy)(void* storage);
+    };
+
+    template<class Func>
+    struct OpsInline
+    {
+        static void invoke(void* storage)
+        {
+            (*static_cast<Func*>(storage))();
+        }
+        static void move(void* storageDestination, void* storageSource)
+        {
+            new (storageDestination) Func(std::move(*static_cast<Func*>(storageSource)));
+            static_cast<Func*>(storageSource)->~Func();
+        }
+        static void destroy(void* storage)
+        {
+            static_cast<Func*>(storage)->~Func();
+        }
+        static const Ops ops;
+    };
+
+    template<class Func>
+    struct OpsHeap
+    {
+        static void invoke(void* storage)
+        {
+            (**static_cast<Func**>(storage))();
+        }
+        static void move(void* storageDestination, void* storageSource)
+        {
+            *static_cast<Func**>(storageDestination) = *static_cast<Func**>(storageSource);
+        }
+        static void destroy(void* storage)
+        {
+            delete *static_cast<Func**>(storage);
+        }
+        static const Ops ops;
+    };
+
+    template<class Func, class F>
+    void setIntern(F&& func, std::true_type /*inline*/)
+    {
+        new (m_storage) Func(std::forward<F>(func));
+        m_ops = &OpsInline<Func>::ops;
+    }
+
+    template<class Func, class F>
+    void setIntern(F&& func, std::false_type /*inline*/)
+    {
+        *reinterpret_cast<Func**>(m_storage) = new Func(std::forward<F>(func));
+        m_ops = &OpsHeap<Func>::ops;
+    }
+
+    void moveFrom(ExecutorTask& rhs)
+    {
+        if (rhs.m_ops)
+        {
+            rhs.m_ops->move(m_storage, rhs.m_storage);
+            m_ops = rhs.m_ops;
+            rhs.m_ops = nullptr;
+        }
+    }
+
+    const Ops* m_ops{nullptr};
+    alignas(std::max_align_t) unsigned char m_storage[SIZE_INLINE];
+};
+
+template<class Func>
+const ExecutorTask::Ops ExecutorTask::OpsInline<Func>::ops = {&OpsInline<Func>::invoke, &OpsInline<Func>::move, &OpsInline<Func>::destroy};
+
+template<class Func>
+const ExecutorTask::Ops ExecutorTask::OpsHeap<Func>::ops = {&OpsHeap<Func>::invoke, &OpsHeap<Func>::move, &OpsHeap<Func>::destroy};
+
+/**
+ * Executor for many worker threads. Every worker thread has its own lock-free queue, the
+ * actions are distributed over the queues and an idle worker steals actions from the queues
+ * of the other workers. The actions of the same instanceId are executed in the order they
+ * were added and never in parallel: they are queued in a strand (lock-free queue) that is
+ * executed by one worker at a time. The instanceIds are hashed to a fixed number of strands,
+ * so two instanceIds may share a strand, which serializes them, but keeps the order.
+ */
+class SYMBOLEXP ExecutorWorkStealing : public ExecutorBase
+{
+public:
+    ExecutorWorkStealing();
+    ~ExecutorWorkStealing();
+
+    /**
+     * Adds an action without wrapping it into a std::function. A small callable does not
+     * need a heap allocation.
+     */
+    template<class F>
+    void addAction(F&& func, std::int64_t instanceId = 0)
+    {
+        ExecutorTask task;
+        task.set(std::forward<F>(func));
+        addTask(std::move(task), instanceId);
+    }
+
+    virtual void addAction(std::function<void()> func, std::int64_t instanceId = 0) override;
+
+private:
+    ExecutorWorkStealing(const ExecutorWorkStealing&) = delete;
+    const ExecutorWorkStealing& operator=(const ExecutorWorkStealing&) = delete;
+
+    virtual void run() override;
+    virtual bool runAvailableActions(const FuncIsAbort& funcIsAbort = nullptr) override;
+    virtual bool runAvailableActionBatch(const FuncIsAbort& funcIsAbort = nullptr) override;
+
+    struct StrandNode
+    {
+        std::atomic<StrandNode*> next{nullptr};
+        ExecutorTask task{};
+    };
+
+    // multiple producer, single consumer queue of the actions of one instanceId
+    struct Strand
+    {
+        Strand();
+        void push(StrandNode* node);
+        StrandNode* pop();
+
+        std::atomic<StrandNode*> head{nullptr};
+        StrandNode* tail{nullptr};
+        StrandNode stub{};
+        std::atomic<std::int32_t> count{0}; ///< number of actions, the strand is queued if count > 0
+    };
+
+    struct Item
+    {
+        Strand* strand{nullptr}; ///< if not null, the actions of the strand shall be executed
+        ExecutorTask task{};
+    };
+
+    // bounded multiple producer, multiple consumer queue
+    class WorkQueue
+    {
+    public:
+        WorkQueue();
+        bool push(Item& item);
+        bool pop(Item& item);
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence{0};
+            Item item{};
+        };
+        std::unique_ptr<Cell[]> m_cells{};
+        char m_padding0[64]{};
+        std::atomic<size_t> m_posPush{0};
+        char m_padding1[64]{};
+        std::atomic<size_t> m_posPop{0};
+        char m_padding2[64]{};
+    };
+
+    void addTask(ExecutorTask&& task, std::int64_t instanceId);
+    void pushItem(Item&& item);
+    bool popItem(Item& item);
+    void runStrand(Strand& strand, const FuncIsAbort& funcIsAbort);
+    void registerWorker();
+
+    static constexpr int MAX_QUEUES = 64;
+    std::unique_ptr<WorkQueue> m_queues[MAX_QUEUES]{};
+    std::atomic<int> m_numberOfQueues{0};
+    int m_numberOfWorkers{0};
+    std::unique_ptr<Strand[]> m_strands{};
+    std::deque<Item> m_overflow{}; ///< if all queues are full, protected by m_mutex
+    std::atomic<std::int64_t> m_overflowSize{0};
+    std::atomic<std::int64_t> m_pending{0};
+    std::atomic<int> m_sleeping{0};
+};
+
+} // namespace finalmq
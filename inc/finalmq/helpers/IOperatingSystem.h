@@ -26,6 +26,10 @@
 
 
 struct stat;
+#if !defined(WIN32) && !defined(__MINGW32__)
+struct msghdr;
+#endif
+struct io_uring_params;
 
 namespace finalmq {
 
@@ -51,6 +55,9 @@ namespace finalmq {
         virtual int read(int fd, char* buffer, int len) = 0;
         virtual int send(SOCKET fd, const char* buffer, int len, int flags) = 0;
         virtual int recv(SOCKET fd, char* buffer, int len, int flags) = 0;
+#if !defined(WIN32) && !defined(__MINGW32__)
+        virtual int sendmsg(SOCKET fd, const struct msghdr* msg, int flags) = 0;
+#endif
         virtual int getLastError() = 0;
         virtual int select(int nfds, fd_set* readfds, fd_set* writefds, fd_set* exceptfds, struct timeval* timeout) = 0;
 #if !defined(WIN32) && !defined(__MINGW32__) && !defined(__QNX__)
@@ -58,6 +65,11 @@ namespace finalmq {
         virtual int epoll_ctl(int epfd, int op, int fd, struct epoll_event* event) = 0;
         virtual int epoll_pwait(int epfd, struct epoll_event* events, int maxevents, int timeout, const sigset_t* sigmask) = 0;
 #endif
+        // the io_uring system calls are declared independent of USE_IO_URING, so that the interface does not
+        // depend on the build options. Without io_uring support, they fail with ENOSYS.
+        virtual int io_uring_setup(unsigned int entries, struct io_uring_params* params) = 0;
+        virtual int io_uring_enter(int fd, unsigned int toSubmit, unsigned int minComplete, unsigned int flags, const void* arg, size_t argsz) = 0;
+        virtual int io_uring_register(int fd, unsigned int opcode, void* arg, unsigned int nrArgs) = 0;
         virtual int makeSocketPair(SocketDescriptorPtr& socket1, SocketDescriptorPtr& socket2) = 0;
         virtual int ioctlInt(SOCKET fd, unsigned long int request, int* value) = 0;
         virtual int setNoDelay(SOCKET fd, bool noDelay) = 0;
@@ -0,0 +1,199 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "finalmq/helpers/FmqDefines.h"
+
+namespace finalmq
+{
+/**
+ * Monotonic buffer for the objects that are created while parsing one message. Allocations
+ * bump a pointer in the current block, deallocations do nothing. All blocks are released
+ * at once, when the arena is destroyed. The first block is part of the arena object, so that
+ * a small message needs only one heap allocation for the arena and all of its structs.
+ * An arena is filled by one thread, but it can be released by any thread.
+ */
+class SYMBOLEXP MonotonicArena
+{
+public:
+    MonotonicArena();
+    ~MonotonicArena();
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    inline void* allocate(std::size_t size, std::size_t alignment)
+    {
+        char* pos = align(m_pos, alignment);
+        if (pos > m_end || static_cast<std::size_t>(m_end - pos) < size)
+        {
+            return allocateBlock(size, alignment);
+        }
+        m_pos = pos + size;
+        m_bytesAllocated += size;
+        return pos;
+    }
+
+    /**
+     * Bytes that were handed out by allocate().
+     */
+    inline std::size_t getBytesAllocated() const
+    {
+        return m_bytesAllocated;
+    }
+
+    /**
+     * Number of blocks that had to be allocated from the heap.
+     */
+    inline int getNumberOfBlocks() const
+    {
+        return m_numberOfBlocks;
+    }
+
+    /**
+     * The arena of the current ArenaScope of this thread, nullptr if there is no scope.
+     */
+    static const std::shared_ptr<MonotonicArena>& current();
+
+private:
+    struct BlockHeader
+    {
+        BlockHeader* next;
+    };
+
+    static inline char* align(char* pos, std::size_t alignment)
+    {
+        return reinterpret_cast<char*>((reinterpret_cast<std::uintptr_t>(pos) + alignment - 1) & ~(alignment - 1));
+    }
+
+    void* allocateBlock(std::size_t size, std::size_t alignment);
+
+    static const std::size_t INITIAL_BUFFER_SIZE = 1024;
+
+    char* m_pos = nullptr;
+    char* m_end = nullptr;
+    BlockHeader* m_blocks = nullptr;
+    std::size_t m_nextBlockSize = 4096;
+    std::size_t m_bytesAllocated = 0;
+    int m_numberOfBlocks = 0;
+    alignas(std::max_align_t) char m_initialBuffer[INITIAL_BUFFER_SIZE];
+
+    friend class ArenaScope;
+};
+
+/**
+ * Installs an arena as the current arena of the thread (MonotonicArena::current()) for the
+ * lifetime of the scope. The previous arena is restored, afterwards. makeSharedInArena()
+ * allocates from the current arena.
+ */
+class SYMBOLEXP ArenaScope
+{
+public:
+    /**
+     * The arena is created with the first allocation inside the scope.
+     */
+    ArenaScope();
+    explicit ArenaScope(const std::shared_ptr<MonotonicArena>& arena);
+    ~ArenaScope();
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+private:
+    std::shared_ptr<MonotonicArena> m_previous;
+    bool m_previousLazy = false;
+};
+
+/**
+ * STL allocator on top of a MonotonicArena. The allocator keeps the arena alive, so that an
+ * object that was created with std::allocate_shared releases the arena together with the
+ * last object of the arena.
+ */
+template<class T>
+class ArenaAllocator
+{
+public:
+    typedef T value_type;
+
+    explicit ArenaAllocator(const std::shared_ptr<MonotonicArena>& arena)
+        : m_arena(arena)
+    {
+    }
+
+    template<class U>
+    ArenaAllocator(const ArenaAllocator<U>& rhs)
+        : m_arena(rhs.getArena())
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* /*p*/, std::size_t /*n*/)
+    {
+    }
+
+    const std::shared_ptr<MonotonicArena>& getArena() const
+    {
+        return m_arena;
+    }
+
+    template<class U>
+    bool operator==(const ArenaAllocator<U>& rhs) const
+    {
+        return m_arena == rhs.getArena();
+    }
+
+    template<class U>
+    bool operator!=(const ArenaAllocator<U>& rhs) const
+    {
+        return m_arena != rhs.getArena();
+    }
+
+private:
+    std::shared_ptr<MonotonicArena> m_arena;
+};
+
+/**
+ * Creates a shared object in the current arena of the thread (see ArenaScope). Without arena,
+ * the object is created with std::make_shared.
+ */
+template<class T, class... Args>
+std::shared_ptr<T> makeSharedInArena(Args&&... args)
+{
+    const std::shared_ptr<MonotonicArena>& arena = MonotonicArena::current();
+    if (arena)
+    {
+        return std::allocate_shared<T>(ArenaAllocator<T>(arena), std::forward<Args>(args)...);
+    }
+    return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
+} // namespace finalmq
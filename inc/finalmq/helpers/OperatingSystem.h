@@ -86,6 +86,9 @@ namespace finalmq
         virtual int read(int fd, char* buffer, int len) override;
         virtual int send(SOCKET fd, const char* buffer, int len, int flags) override;
         virtual int recv(SOCKET fd, char* buffer, int len, int flags) override;
+#if !defined(WIN32) && !defined(__MINGW32__)
+        virtual int sendmsg(SOCKET fd, const struct msghdr* msg, int flags) override;
+#endif
         virtual int getLastError() override;
         virtual int select(int nfds, fd_set* readfds, fd_set* writefds, fd_set* exceptfds, struct timeval* timeout) override;
 #if !defined(WIN32) && !defined(__MINGW32__) && !defined(__QNX__)
@@ -93,6 +96,9 @@ namespace finalmq
         virtual int epoll_ctl(int epfd, int op, int fd, struct epoll_event* event) override;
         virtual int epoll_pwait(int epfd, struct epoll_event* events, int maxevents, int timeout, const sigset_t* sigmask) override;
 #endif
+        virtual int io_uring_setup(unsigned int entries, struct io_uring_params* params) override;
+        virtual int io_uring_enter(int fd, unsigned int toSubmit, unsigned int minComplete, unsigned int flags, const void* arg, size_t argsz) override;
+        virtual int io_uring_register(int fd, unsigned int opcode, void* arg, unsigned int nrArgs) override;
         virtual int makeSocketPair(SocketDescriptorPtr& socket1, SocketDescriptorPtr& socket2) override;
         virtual int ioctlInt(SOCKET fd, unsigned long int request, int* value) override;
         virtual int setNoDelay(SOCKET fd, bool noDelay) override;
@@ -0,0 +1,87 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__))
+#define FINALMQ_SIMD_SSE2
+#include <emmintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define FINALMQ_SIMD_AVX2
+#define FINALMQ_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * Selects the implementation for the CPU: AVX2, if the CPU supports it, SSE2 on all other x86 CPUs
+ * and the scalar one on other platforms. Only the names of the available implementations are used,
+ * so the SSE2 and AVX2 functions need only exist if FINALMQ_SIMD_SSE2/FINALMQ_SIMD_AVX2 are defined.
+ */
+#if defined(FINALMQ_SIMD_AVX2)
+#define FINALMQ_SIMD_SELECT(scalar, sse2, avx2) (::finalmq::Simd::hasAvx2() ? (avx2) : (sse2))
+#elif defined(FINALMQ_SIMD_SSE2)
+#define FINALMQ_SIMD_SELECT(scalar, sse2, avx2) (sse2)
+#else
+#define FINALMQ_SIMD_SELECT(scalar, sse2, avx2) (scalar)
+#endif
+
+namespace finalmq
+{
+class Simd
+{
+public:
+    static inline bool hasAvx2()
+    {
+#if defined(FINALMQ_SIMD_AVX2)
+        static const bool avx2 = []() {
+            __builtin_cpu_init();
+            return (__builtin_cpu_supports("avx2") != 0);
+        }();
+        return avx2;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * Index of the lowest set bit, mask must not be 0.
+     */
+    static inline int countTrailingZeros(std::uint32_t mask)
+    {
+#if defined(_MSC_VER)
+        unsigned long index = 0;
+        _BitScanForward(&index, mask);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+};
+
+} // namespace finalmq
@@ -0,0 +1,100 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <vector>
+
+#include "finalmq/helpers/FmqDefines.h"
+
+namespace finalmq
+{
+/**
+ * Hierarchical timer wheel (4 levels with 64 slots each). Adding, removing and expiring
+ * a timer is O(1). The time is given by the caller in [ms], e.g. of the steady clock, and
+ * is rounded to ticks of the given resolution. A timer never expires before its deadline,
+ * but it can expire up to one tick (plus the interval in which advance() is called) later.
+ * Deadlines beyond the range of the wheel (64^4 ticks) are clamped.
+ * The timer wheel is not thread safe.
+ */
+class SYMBOLEXP TimerWheel
+{
+public:
+    struct Entry
+    {
+        std::uint64_t id = 0;
+        std::int64_t expires = 0; ///< tick
+        int level = 0;
+        int slot = 0;
+    };
+    typedef std::list<Entry>::iterator Handle;
+
+    /**
+     * @param now is the current time in [ms].
+     * @param resolution is the duration of a tick in [ms].
+     */
+    TimerWheel(std::int64_t now, int resolution = 10);
+
+    /**
+     * Adds a timer.
+     * @param deadline is the time in [ms] at which the timer shall expire.
+     * @param id is returned by advance(), if the timer expires.
+     * @return handle to remove the timer. The handle is valid until the timer expired or was removed.
+     */
+    Handle add(std::int64_t deadline, std::uint64_t id);
+
+    /**
+     * Removes a timer that has not expired, yet.
+     */
+    void remove(Handle handle);
+
+    /**
+     * Advances the wheel to the current time.
+     * @param now is the current time in [ms].
+     * @param expired the ids of the expired timers are appended.
+     */
+    void advance(std::int64_t now, std::vector<std::uint64_t>& expired);
+
+    /**
+     * @return number of timers that have not expired, yet.
+     */
+    size_t size() const;
+
+private:
+    static constexpr int LEVELS = 4;
+    static constexpr int SLOT_BITS = 6;
+    static constexpr int SLOTS = (1 << SLOT_BITS);
+
+    void insert(std::list<Entry>& from, Handle handle);
+    void cascade(int level, int slot);
+    void step(std::vector<std::uint64_t>& expired);
+
+    const int m_resolution;
+    std::int64_t m_tick = 0;
+    size_t m_size = 0;
+    std::list<Entry> m_slots[LEVELS][SLOTS]{};
+    std::list<Entry> m_free{}; ///< nodes for reuse, so that adding a timer does not allocate
+};
+
+} // namespace finalmq
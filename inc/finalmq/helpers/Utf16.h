@@ -0,0 +1,52 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <string>
+
+#include "finalmq/helpers/FmqDefines.h"
+
+namespace finalmq
+{
+/**
+ * Conversion between UTF-8 and UTF-16 big endian, the wire format of a QString. Runs of ASCII
+ * characters are converted 16 at a time with SSE2. Invalid UTF-8 sequences and unpaired
+ * surrogates are replaced by U+FFFD.
+ */
+class SYMBOLEXP Utf16
+{
+public:
+    /**
+     * Converts count UTF-16 big endian code units at src to UTF-8. The result is written to dest.
+     */
+    static void utf16BeToUtf8(const char* src, ssize_t count, std::string& dest);
+
+    /**
+     * Converts size bytes of UTF-8 at src to UTF-16 big endian. At most maxCount code units are
+     * written to dest. The number of code units is never larger than the number of UTF-8 bytes,
+     * so 2 * size bytes at dest are always enough. Returns the number of written code units.
+     */
+    static ssize_t utf8ToUtf16Be(const char* src, ssize_t size, char* dest, ssize_t maxCount);
+};
+
+} // namespace finalmq
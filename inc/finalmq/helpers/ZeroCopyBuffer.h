@@ -32,6 +32,13 @@ namespace finalmq
 class SYMBOLEXP ZeroCopyBuffer : public IZeroCopyBuffer
 {
 public:
+    ZeroCopyBuffer() = default;
+    ZeroCopyBuffer(const ZeroCopyBuffer&) = default;
+    ZeroCopyBuffer(ZeroCopyBuffer&&) = default;
+    ZeroCopyBuffer& operator=(const ZeroCopyBuffer&) = default;
+    ZeroCopyBuffer& operator=(ZeroCopyBuffer&&) = default;
+    ~ZeroCopyBuffer();
+
     std::string getData() const;
     size_t size() const;
     const std::list<std::string>& chunks() const;
@@ -27,6 +27,7 @@
 #include <vector>
 
 #include "finalmq/helpers/FmqDefines.h"
+#include "finalmq/hl7/Hl7Scan.h"
 
 namespace finalmq
 {
@@ -56,6 +57,12 @@ public:
     virtual int isNextFieldFilled(int level, bool& filled) override;
     virtual const char* getCurrentPosition() const override;
 
+    /**
+     * Like parseToken(), but the token is not copied. It points into the parsed text, or into
+     * buffer, if the token contains an escape sequence.
+     */
+    int parseToken(int level, const char*& token, ssize_t& size, std::string& buffer, bool& isarray);
+
 private:
     Hl7Parser(const Hl7Parser&) = delete;
     Hl7Parser(Hl7Parser&&) = delete;
@@ -66,7 +73,8 @@ private:
     void skipControlCharacters();
     int isDelimiter(char c) const;
     int parseTillEndOfStructIntern(int level, bool stopOnArray, bool& isarray);
-    std::string deEscape(const char* start, const char* end) const;
+    void getToken(const char* start, const char* end, const char*& token, ssize_t& size, std::string& buffer) const;
+    void deEscape(const char* start, const char* end, std::string& dest) const;
 
     const char* m_end = nullptr;
     const char* m_str = nullptr;
@@ -78,6 +86,7 @@ private:
     char m_escape = 0;
 
     int m_waitForDeleimiterField = 0;
+    Hl7Scan m_scan{};
 };
 
 } // namespace finalmq
@@ -0,0 +1,78 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include "finalmq/helpers/FmqDefines.h"
+
+namespace finalmq
+{
+/**
+ * Block wise search for the delimiters of an HL7 message. The delimiters are taken from the
+ * MSH segment, so they are set at runtime. The characters are compared 16 (SSE2) or 32 (AVX2)
+ * at a time. AVX2 is selected at runtime, if the CPU supports it. On other platforms a lookup
+ * table is used.
+ */
+class SYMBOLEXP Hl7Scan
+{
+public:
+    static const int NUMBER_OF_DELIMITERS = 5;
+
+    Hl7Scan();
+
+    /**
+     * Sets the characters to search for: segment ('\r'), field ('|'), component ('^'),
+     * subcomponent ('&') and repeat ('~') delimiter. '\0' is always found.
+     */
+    void setDelimiters(const char (&delimiters)[NUMBER_OF_DELIMITERS]);
+
+    /**
+     * Returns the position of the first delimiter or '\0' in [str, end) or end, if there is none.
+     */
+    inline const char* findDelimiter(const char* str, const char* end) const
+    {
+        // many HL7 fields are empty or short
+        if (str >= end || isDelimiter(*str))
+        {
+            return str;
+        }
+        return findDelimiterBlocks(str + 1, end);
+    }
+
+    inline bool isDelimiter(char c) const
+    {
+        return m_isDelimiter[static_cast<unsigned char>(c)];
+    }
+
+    inline const char* getDelimiters() const
+    {
+        return m_delimiters;
+    }
+
+private:
+    const char* findDelimiterBlocks(const char* str, const char* end) const;
+
+    char m_delimiters[NUMBER_OF_DELIMITERS] = {};
+    bool m_isDelimiter[256] = {};
+};
+
+} // namespace finalmq
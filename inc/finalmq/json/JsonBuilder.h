@@ -54,6 +54,18 @@ public:
     virtual void enterKey(std::string&& key) override;
     virtual void finished() override;
 
+    /**
+     * Write a whole array of numbers. The space for a chunk of entries is reserved at once
+     * and the entries are written in a tight loop. The 64 bit integers can be written as
+     * strings (quoted), the doubles NaN, Infinity and -Infinity are written as strings.
+     */
+    void enterArrayInt32(const std::int32_t* value, ssize_t size);
+    void enterArrayUInt32(const std::uint32_t* value, ssize_t size);
+    void enterArrayInt64(const std::int64_t* value, ssize_t size, bool quoted);
+    void enterArrayUInt64(const std::uint64_t* value, ssize_t size, bool quoted);
+    void enterArrayFloat(const float* value, ssize_t size);
+    void enterArrayDouble(const double* value, ssize_t size);
+
 private:
     JsonBuilder(const JsonBuilder&) = delete;
     JsonBuilder(JsonBuilder&&) = delete;
@@ -64,6 +76,8 @@ private:
     void resizeBuffer();
     void correctComma();
     void escapeString(const char* str, ssize_t size);
+    template<class T, class F>
+    void enterArrayNumbers(const T* value, ssize_t size, ssize_t maxSizeEntry, F funcWrite);
 
     IZeroCopyBuffer& m_zeroCopybuffer;
     ssize_t m_maxBlockSize = 512;
@@ -0,0 +1,65 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include "finalmq/helpers/FmqDefines.h"
+
+namespace finalmq
+{
+/**
+ * Block wise classification of json text for the parsers. The characters are compared
+ * 16 (SSE2) or 32 (AVX2) at a time. AVX2 is selected at runtime, if the CPU supports it.
+ * On other platforms a scalar loop is used.
+ */
+class SYMBOLEXP JsonScan
+{
+public:
+    /**
+     * Returns the position of the first '"', '\\' or '\0' in [str, end) or end, if there is none.
+     */
+    static const char* findStringSpecial(const char* str, const char* end);
+
+    /**
+     * Returns the position of the first character in [str, end) that is not a json white
+     * space (' ', '\t', '\n', '\r') or end, if there is none.
+     */
+    static inline const char* skipWhiteSpace(const char* str, const char* end)
+    {
+        // most values are not preceded by white spaces
+        if (str < end && !isWhiteSpace(*str))
+        {
+            return str;
+        }
+        return skipWhiteSpaceBlocks(str, end);
+    }
+
+    static inline bool isWhiteSpace(char c)
+    {
+        return (c == ' ' || c == '\t' || c == '\n' || c == '\r');
+    }
+
+private:
+    static const char* skipWhiteSpaceBlocks(const char* str, const char* end);
+};
+
+} // namespace finalmq
@@ -49,6 +49,7 @@ enum MetaFieldFlags : std::int32_t
     METAFLAG_NULLABLE       = 4,    // only for struct
     METAFLAG_ONE_REQUIRED   = 8,    // only for array of struct
     METAFLAG_INDEX          = 16,
+    METAFLAG_ZEROCOPY       = 32,   // only for string and bytes, the field is a BytesView
 };
 
 
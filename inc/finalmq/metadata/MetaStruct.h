@@ -54,6 +54,11 @@ public:
 
     const MetaField* getFieldByIndex(ssize_t index) const;
     const MetaField* getFieldByName(const std::string& name) const;
+    /**
+     * Looks up the field with a perfect hash over the field names, the key does not
+     * need to be copied into a std::string.
+     */
+    const MetaField* getFieldByName(const char* name, ssize_t size) const;
 
     void addField(const MetaField& field);
 
@@ -84,6 +89,8 @@ public:
 
 private:
     static std::unordered_map<std::string, std::string> generateProperties(const std::vector<std::string>& attrs);
+    void addFieldIntern(const MetaField& field);
+    void buildFieldTable();
 
     const std::string m_typeName{};
     const std::string m_typeNameWithoutNamespace{};
@@ -92,7 +99,13 @@ private:
     const int m_flags{};
     const std::vector<std::string> m_attrs{};
     const std::unordered_map<std::string, std::string> m_properties{};
-    std::unordered_map<std::string, std::shared_ptr<const MetaField>> m_name2Field{};
+    // perfect hash (hash and displace): the hash of the name selects the seed for the
+    // second hash, which selects the slot in m_fieldTable.
+    std::vector<const MetaField*> m_fieldTable{};
+    std::vector<std::uint32_t> m_fieldTableSeeds{};
+    // the fields m_fields[m_fieldsInTable ...] were added later, they are searched linearly
+    size_t m_fieldsInTable = 0;
+    static const size_t FIELDS_NOT_IN_TABLE_MIN = 8;
     const std::string EMPTY_STRING{};
 };
 
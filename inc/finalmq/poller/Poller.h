@@ -30,6 +30,13 @@
 
 namespace finalmq
 {
+enum class ReceiveMode
+{
+    RECEIVEMODE_PENDINGREAD,        ///< the poller reports the number of readable bytes (FIONREAD)
+    RECEIVEMODE_READUNTILWOULDBLOCK,///< the poller reports readability only (bytesToRead = -1), the receiver reads until the socket would block
+    RECEIVEMODE_EDGETRIGGERED,      ///< like RECEIVEMODE_READUNTILWOULDBLOCK, but the sockets are edge triggered (EPOLLET), if the poller supports it
+};
+
 struct DescriptorInfo
 {
     void clear()
@@ -44,7 +51,7 @@ struct DescriptorInfo
     bool readable = false;
     bool writable = false;
     bool disconnected = false;
-    std::int32_t bytesToRead = 0;
+    std::int32_t bytesToRead = 0; ///< -1, if the number of bytes is unknown (see ReceiveMode)
 };
 
 class DescriptorInfos
@@ -109,7 +116,7 @@ struct IPoller
 {
     virtual ~IPoller()
     {}
-    virtual void init() = 0;
+    virtual void init(ReceiveMode receiveMode = ReceiveMode::RECEIVEMODE_PENDINGREAD) = 0;
     virtual void addSocket(const SocketDescriptorPtr& fd) = 0;
     virtual void addSocketEnableRead(const SocketDescriptorPtr& fd) = 0;
     virtual void removeSocket(const SocketDescriptorPtr& fd) = 0;
@@ -119,6 +126,8 @@ struct IPoller
     virtual void disableWrite(const SocketDescriptorPtr& fd) = 0;
     virtual const PollerResult& wait(std::int32_t timeout) = 0;
     virtual void releaseWait(std::uint32_t info) = 0;
+    virtual ReceiveMode getReceiveMode() const = 0;
+    virtual std::uint64_t getSyscallsSaved() const = 0; ///< number of FIONREAD calls that were not done because of the ReceiveMode
 };
 
 typedef std::shared_ptr<IPoller> IPollerPtr;
@@ -47,7 +47,7 @@ private:
     PollerImplEpoll(const PollerImplEpoll&&) = delete;
     const PollerImplEpoll& operator=(PollerImplEpoll&&) = delete;
 
-    virtual void init() override;
+    virtual void init(ReceiveMode receiveMode = ReceiveMode::RECEIVEMODE_PENDINGREAD) override;
     virtual void addSocket(const SocketDescriptorPtr& fd) override;
     virtual void addSocketEnableRead(const SocketDescriptorPtr& fd) override;
     virtual void removeSocket(const SocketDescriptorPtr& fd) override;
@@ -57,6 +57,8 @@ private:
     virtual void disableWrite(const SocketDescriptorPtr& fd) override;
     virtual const PollerResult& wait(std::int32_t timeout) override;
     virtual void releaseWait(std::uint32_t info) override;
+    virtual ReceiveMode getReceiveMode() const override;
+    virtual std::uint64_t getSyscallsSaved() const override;
 
 private:
     void updateSocketDescriptors();
@@ -74,6 +76,9 @@ private:
     std::atomic_flag m_socketDescriptorsStable{ATOMIC_FLAG_INIT};
     std::atomic_uint32_t m_releaseFlags{};
     std::array<epoll_event, 32> m_events{};
+    ReceiveMode m_receiveMode{ReceiveMode::RECEIVEMODE_PENDINGREAD};
+    int m_eventFlags{0};
+    std::atomic_uint64_t m_syscallsSaved{};
 
     std::vector<SocketDescriptorPtr> m_socketDescriptorsConstForEpoll{};
 
@@ -0,0 +1,136 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#if defined(USE_IO_URING)
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <linux/io_uring.h>
+
+#include "Poller.h"
+
+namespace finalmq
+{
+/**
+ * Poller that uses io_uring poll requests instead of epoll. The poll requests are one shot,
+ * they are rearmed at the next wait(), after the events were handled. So, the sockets behave
+ * level triggered. The rearm and modify submissions are done by the thread that calls wait()
+ * together with waiting for the completions in one io_uring_enter call. Other threads only
+ * register their changes and wake up the waiting thread. Removals are submitted immediately,
+ * because an armed poll request keeps the socket open.
+ */
+class SYMBOLEXP PollerImplIoUring : public IPoller
+{
+public:
+    PollerImplIoUring();
+    ~PollerImplIoUring();
+
+    /**
+     * Checks at runtime, if the kernel supports all io_uring features that this poller needs.
+     */
+    static bool isAvailable();
+
+private:
+    PollerImplIoUring(const PollerImplIoUring&) = delete;
+    const PollerImplIoUring& operator=(const PollerImplIoUring&) = delete;
+    PollerImplIoUring(const PollerImplIoUring&&) = delete;
+    const PollerImplIoUring& operator=(PollerImplIoUring&&) = delete;
+
+    virtual void init(ReceiveMode receiveMode = ReceiveMode::RECEIVEMODE_PENDINGREAD) override;
+    virtual void addSocket(const SocketDescriptorPtr& fd) override;
+    virtual void addSocketEnableRead(const SocketDescriptorPtr& fd) override;
+    virtual void removeSocket(const SocketDescriptorPtr& fd) override;
+    virtual void enableRead(const SocketDescriptorPtr& fd) override;
+    virtual void disableRead(const SocketDescriptorPtr& fd) override;
+    virtual void enableWrite(const SocketDescriptorPtr& fd) override;
+    virtual void disableWrite(const SocketDescriptorPtr& fd) override;
+    virtual const PollerResult& wait(std::int32_t timeout) override;
+    virtual void releaseWait(std::uint32_t info) override;
+    virtual ReceiveMode getReceiveMode() const override;
+    virtual std::uint64_t getSyscallsSaved() const override;
+
+private:
+    struct SocketState
+    {
+        SocketDescriptorPtr sd{};
+        std::uint32_t events = 0;     ///< POLLIN / POLLOUT that shall be polled
+        std::uint32_t armedEvents = 0;
+        std::uint32_t sequence = 0;   ///< sequence of the armed poll request, 0 = not armed
+    };
+
+    bool setupRing();
+    void releaseRing();
+    void addSocketIntern(const SocketDescriptorPtr& fd, std::uint32_t events);
+    void modifyEvents(const SocketDescriptorPtr& fd, std::uint32_t eventsSet, std::uint32_t eventsClear);
+    void socketHasChanged(SOCKET sd);
+    void wakeUp();
+    void submitChanges();
+    io_uring_sqe* getSqe();
+    void publishSqes();
+    void submit();
+    void removePoll(std::uint64_t userData);
+    void collectSockets();
+    void handleCompletion(const io_uring_cqe& cqe);
+
+    SocketDescriptorPtr m_controlSocketRead{};
+    SocketDescriptorPtr m_controlSocketWrite{};
+
+    std::unordered_map<SOCKET, SocketState> m_socketDescriptors{};
+    std::vector<SOCKET> m_changedSockets{};
+    std::uint32_t m_nextSequence = 1;
+    std::atomic_bool m_waiting{false};
+
+    PollerResult m_result{};
+    std::atomic_uint32_t m_releaseFlags{};
+    ReceiveMode m_receiveMode{ReceiveMode::RECEIVEMODE_PENDINGREAD};
+    std::atomic_uint64_t m_syscallsSaved{};
+
+    // the ring, the submission queue is protected by m_mutex, the completion queue is only used by wait()
+    int m_fdRing{-1};
+    void* m_ringSq{nullptr};
+    size_t m_ringSqSize{0};
+    void* m_ringCq{nullptr};
+    size_t m_ringCqSize{0};
+    io_uring_sqe* m_sqes{nullptr};
+    size_t m_sqesSize{0};
+    unsigned int* m_sqHead{nullptr};
+    unsigned int* m_sqTail{nullptr};
+    unsigned int* m_sqMask{nullptr};
+    unsigned int* m_sqArray{nullptr};
+    unsigned int m_sqEntries{0};
+    unsigned int m_sqPending{0};
+    unsigned int* m_cqHead{nullptr};
+    unsigned int* m_cqTail{nullptr};
+    unsigned int* m_cqMask{nullptr};
+    io_uring_cqe* m_cqes{nullptr};
+
+    std::mutex m_mutex{};
+};
+
+} // namespace finalmq
+
+#endif
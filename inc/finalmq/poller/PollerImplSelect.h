@@ -45,7 +45,7 @@ private:
     PollerImplSelect(const PollerImplSelect&&) = delete;
     const PollerImplSelect& operator=(PollerImplSelect&&) = delete;
 
-    virtual void init() override;
+    virtual void init(ReceiveMode receiveMode = ReceiveMode::RECEIVEMODE_PENDINGREAD) override;
     virtual void addSocket(const SocketDescriptorPtr& fd) override;
     virtual void addSocketEnableRead(const SocketDescriptorPtr& fd) override;
     virtual void removeSocket(const SocketDescriptorPtr& fd) override;
@@ -55,6 +55,8 @@ private:
     virtual void disableWrite(const SocketDescriptorPtr& fd) override;
     virtual const PollerResult& wait(std::int32_t timeout) override;
     virtual void releaseWait(std::uint32_t info) override;
+    virtual ReceiveMode getReceiveMode() const override;
+    virtual std::uint64_t getSyscallsSaved() const override;
 
 private:
     inline static void copyFds(fd_set& dest, fd_set& source);
@@ -89,6 +91,8 @@ private:
     std::atomic_flag m_fdsReadStable{};
     std::atomic_flag m_fdsWriteStable{};
     std::atomic_uint32_t m_releaseFlags{};
+    ReceiveMode m_receiveMode{ReceiveMode::RECEIVEMODE_PENDINGREAD};
+    std::atomic_uint64_t m_syscallsSaved{};
 
     // parameters that are const during select and collect.
     int m_sdMax = 0;
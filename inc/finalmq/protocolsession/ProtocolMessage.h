@@ -39,6 +39,7 @@ public:
     static const std::string FMQ_PROTOCOLDATA;
 
     ProtocolMessage(std::uint32_t protocolId, ssize_t sizeHeader = 0, ssize_t sizeTrailer = 0);
+    ~ProtocolMessage();
 
 private:
     virtual char* addBuffer(ssize_t size, ssize_t reserve = 0) override;
@@ -74,6 +75,7 @@ private:
     virtual char* resizeReceiveBuffer(ssize_t size) override;
     virtual void setReceiveBuffer(const std::shared_ptr<std::string>& receiveBuffer, ssize_t offset, ssize_t size) override;
     virtual void setHeaderSize(ssize_t header) override;
+    virtual const std::shared_ptr<std::string>& getReceiveBuffer() const override;
 
     // for the framework
     virtual const std::list<BufferRef>& getAllSendBuffers() const override;
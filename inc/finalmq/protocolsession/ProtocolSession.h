@@ -133,7 +133,7 @@ private:
 
     const hybrid_ptr<IProtocolSessionCallback> m_callback;
     const IExecutorPtr m_executor;
-    const IExecutorPtr m_executorPollerThread;
+    IExecutorPtr m_executorPollerThread{};     // the poller loop of the connection
     IProtocolPtr m_protocol{};
     std::atomic<std::int64_t> m_connectionId{0};
     std::unordered_map<std::int64_t, IProtocolPtr> m_multiProtocols{};
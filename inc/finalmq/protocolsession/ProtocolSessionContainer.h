@@ -38,7 +38,7 @@ struct IProtocolSessionContainer
     virtual ~IProtocolSessionContainer()
     {}
 
-    virtual void init(const IExecutorPtr& executor = nullptr, int cycleTime = 100, FuncTimer funcTimer = {}, int checkReconnectInterval = 1000) = 0;
+    virtual void init(const IExecutorPtr& executor = nullptr, int cycleTime = 100, FuncTimer funcTimer = {}, int checkReconnectInterval = 1000, int numberOfPollerLoops = 1, ReceiveMode receiveMode = ReceiveMode::RECEIVEMODE_PENDINGREAD) = 0;
     virtual int bind(const std::string& endpoint, hybrid_ptr<IProtocolSessionCallback> callback, const BindProperties& bindProperties = {}, int contentType = 0) = 0;
     virtual void unbind(const std::string& endpoint) = 0;
     virtual IProtocolSessionPtr connect(const std::string& endpoint, hybrid_ptr<IProtocolSessionCallback> callback, const ConnectProperties& connectProperties = {}, int contentType = 0) = 0;
@@ -58,7 +58,7 @@ struct IStreamConnectionContainer;
 class ProtocolBind : public IStreamConnectionCallback
 {
 public:
-    ProtocolBind(hybrid_ptr<IProtocolSessionCallback> callback, const IExecutorPtr& executor, const IExecutorPtr& executorPollerThread, IProtocolFactoryPtr protocolFactory, const std::weak_ptr<IProtocolSessionList>& protocolSessionList, const BindProperties& bindProperties = {}, int contentType = 0);
+    ProtocolBind(hybrid_ptr<IProtocolSessionCallback> callback, const IExecutorPtr& executor, const std::weak_ptr<IStreamConnectionContainer>& streamConnectionContainer, IProtocolFactoryPtr protocolFactory, const std::weak_ptr<IProtocolSessionList>& protocolSessionList, const BindProperties& bindProperties = {}, int contentType = 0);
 
 private:
     // IStreamConnectionCallback
@@ -68,7 +68,7 @@ private:
 
     const hybrid_ptr<IProtocolSessionCallback> m_callback;
     const IExecutorPtr m_executor;
-    const IExecutorPtr m_executorPollerThread;
+    const std::weak_ptr<IStreamConnectionContainer> m_streamConnectionContainer;
     const IProtocolFactoryPtr m_protocolFactory;
     const std::weak_ptr<IProtocolSessionList> m_protocolSessionList;
     const BindProperties m_bindProperties;
@@ -84,7 +84,7 @@ public:
     virtual ~ProtocolSessionContainer();
 
     // IProtocolSessionContainer
-    virtual void init(const IExecutorPtr& executor = nullptr, int cycleTime = 100, FuncTimer funcTimer = {}, int checkReconnectInterval = 1000) override;
+    virtual void init(const IExecutorPtr& executor = nullptr, int cycleTime = 100, FuncTimer funcTimer = {}, int checkReconnectInterval = 1000, int numberOfPollerLoops = 1, ReceiveMode receiveMode = ReceiveMode::RECEIVEMODE_PENDINGREAD) override;
     virtual int bind(const std::string& endpoint, hybrid_ptr<IProtocolSessionCallback> callback, const BindProperties& bindProperties = {}, int contentType = 0) override;
     virtual void unbind(const std::string& endpoint) override;
     virtual IProtocolSessionPtr connect(const std::string& endpoint, hybrid_ptr<IProtocolSessionCallback> callback, const ConnectProperties& connectProperties = {}, int contentType = 0) override;
@@ -0,0 +1,95 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "finalmq/streamconnection/IMessage.h"
+
+namespace finalmq
+{
+/**
+ * Radix tree of the command paths with variable entries. The paths are split into entries at '/'.
+ * An entry "{name}" matches exactly one entry of a path, an entry "*name*" matches any number of
+ * path entries up to the first occurrence of the following entry of the route (or all remaining
+ * entries, if it is the last entry of the route). The values of the variable entries are stored
+ * as "PATH_name" in the metainfo.
+ * Routes with "{name}" entries take precedence over routes with only "*name*" entries. Inside these
+ * groups, the route that was added first wins.
+ * The router is not thread safe.
+ */
+class SYMBOLEXP CommandRouter
+{
+public:
+    CommandRouter();
+    ~CommandRouter();
+
+    /**
+     * @return true, if the path contains variable entries and shall be added to the router.
+     */
+    static bool isVariablePath(const std::string& path);
+
+    /**
+     * Adds a route with variable entries.
+     * @param routeId is returned by findRoute(), if the route matches.
+     */
+    void addRoute(const std::string& path, std::uint32_t routeId);
+
+    /**
+     * Finds the route of a path in one walk through the tree.
+     * @param keys if not null, the values of the variable entries are set as "PATH_name".
+     * @param routeId the ID of the matching route.
+     * @return true, if a route matches.
+     */
+    bool findRoute(const std::string& path, IMessage::Metainfo* keys, std::uint32_t& routeId) const;
+
+private:
+    CommandRouter(const CommandRouter&) = delete;
+    const CommandRouter& operator=(const CommandRouter&) = delete;
+
+    typedef std::pair<std::uint32_t, std::uint32_t> Range; ///< offset and size inside the path
+
+    struct Node;
+    struct Route
+    {
+        std::uint32_t routeId = 0;
+        std::vector<std::string> keys{}; ///< "PATH_name" of the variable entries, empty if the entry has no name
+    };
+    struct Search;
+
+    static Node* getLiteralChild(Node& node, const std::string& entry);
+    static const Node* findLiteralChild(const Node& node, const char* entry, std::uint32_t size);
+    static void walk(const Node& node, std::uint32_t index, Search& search);
+    static void walkStar(const Node& node, std::uint32_t index, Search& search);
+    static void updateMatch(const Node& node, Search& search);
+
+    std::unique_ptr<Node> m_root;
+    std::vector<Route> m_routes{};
+};
+
+} // namespace finalmq
@@ -0,0 +1,90 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include "finalmq/helpers/FmqDefines.h"
+#include "finalmq/helpers/IZeroCopyBuffer.h"
+#include "finalmq/remoteentity/entitydata.fmq.h"
+
+namespace finalmq
+{
+/**
+ * Cache of serialized headers of one peer (see PeerManager). Consecutive messages to the same peer
+ * and path have the same header, only the correlation ID changes. The cache keeps the serialized
+ * header as a template (the bytes before and after the correlation ID field) and patches the
+ * correlation ID field in. A header is serialized only, if it is not in the cache.
+ * Each peer has its own cache, so the hit rate of a peer does not depend on the number of peers.
+ * The cache is thread-safe, a peer can be used by several threads.
+ */
+class SYMBOLEXP HeaderTemplateCache
+{
+public:
+    /**
+     * Serializes the complete header.
+     */
+    typedef void (*FuncSerializeHeader)(IZeroCopyBuffer& buffer, const Header& header);
+
+    /**
+     * Serializes the correlation ID field exactly as FuncSerializeHeader does. The field has to be
+     * empty, if FuncSerializeHeader skips the correlation ID.
+     */
+    typedef void (*FuncSerializeCorrid)(std::uint64_t corrid, std::string& field);
+
+    /**
+     * Serializes the header with the functions of a format. The templates are kept per format.
+     */
+    void serialize(IZeroCopyBuffer& buffer, const Header& header, FuncSerializeHeader funcSerializeHeader, FuncSerializeCorrid funcSerializeCorrid);
+
+    std::uint64_t getHits() const;
+    std::uint64_t getMisses() const;
+
+private:
+    struct Entry
+    {
+        FuncSerializeHeader funcSerializeHeader = nullptr;
+        Header header{};
+        std::string prefix{};
+        std::string suffix{};
+        bool patchable = false;
+    };
+
+    Entry& createEntry(const Header& header, FuncSerializeHeader funcSerializeHeader, FuncSerializeCorrid funcSerializeCorrid);
+
+    // different paths and types of one peer
+    static const int NUMBER_OF_ENTRIES = 8;
+
+    std::array<Entry, NUMBER_OF_ENTRIES> m_entries{};
+    int m_numberOfEntries = 0;
+    int m_nextEntry = 0;
+    std::string m_corrid{};
+    std::uint64_t m_hits = 0;
+    std::uint64_t m_misses = 0;
+    mutable std::mutex m_mutex{};
+};
+
+} // namespace finalmq
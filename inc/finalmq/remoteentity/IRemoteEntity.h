@@ -34,6 +34,7 @@ namespace finalmq
     class PeerEvent;
     class StructBase;
     class RequestContext;
+    class LazyPayload;
     typedef std::shared_ptr<RequestContext> RequestContextPtr;
 
     using CorrelationId = std::uint64_t;
@@ -119,6 +120,7 @@ namespace finalmq
         Header header{};
         bool automaticConnect = false;
         std::shared_ptr<StructBase> structBase{};
+        std::shared_ptr<LazyPayload> payload{};     ///< the data, before it is parsed into structBase
     };
 
     typedef std::function<void(PeerId peerId, Status status, const StructBasePtr& structBase)> FuncReply;
@@ -288,6 +290,88 @@ namespace finalmq
             return correlationId;
         }
 
+        /**
+         * @brief requestReply sends a request to the peer and the funcReply is triggered when
+         * the reply is available or when the timeout expired. The template parameter is the message type of the reply (generated code of fmq file).
+         * @param peerId is the id of the peer. You can get it when you connect() to a peer, when you
+         * call getAllPeers(), inside a peer event or by calling requestContext->peerId() inside a
+         * command execution. The peerId belongs to this entity. Because an entity can have multiple
+         * connections to remote entities, a remote entity must be identified by the peerId.
+         * @param path is the path that shall be called at the remote entity
+         * @param structBase is the request message to send (generated code of fmq file).
+         * @param timeout in [ms]. If no reply was received within the timeout, funcReply is called with Status::STATUS_REQUEST_TIMEOUT.
+         * @param funcReply is the reply callback.
+         * @return if successful, valid correlation ID.
+         */
+        template<class R>
+        CorrelationId requestReply(const PeerId& peerId,
+            const std::string& path,
+            const StructBase& structBase,
+            int timeout,
+            std::function<void(PeerId peerId, Status status, const std::shared_ptr<R>& reply)> funcReply)
+        {
+            assert(funcReply);
+            CorrelationId correlationId = sendRequest(peerId, path, structBase, timeout, [funcReply{ std::move(funcReply) }](PeerId peerId1, Status status, const StructBasePtr& structBase1) {
+                std::shared_ptr<R> reply;
+                if (status == Status::STATUS_OK && structBase1 != nullptr)
+                {
+                    if (structBase1->getStructInfo().getTypeName() == R::structInfo().getTypeName())
+                    {
+                        reply = std::static_pointer_cast<R>(structBase1);
+                    }
+                    if (reply == nullptr)
+                    {
+                        status = Status::STATUS_WRONG_REPLY_TYPE;
+                    }
+                }
+                funcReply(peerId1, status, reply);
+            });
+            return correlationId;
+        }
+
+        /**
+         * @brief requestReply sends a request to the peer and the funcReply is triggered when
+         * the reply is available or when the timeout expired. The template parameter is the message type of the reply (generated code of fmq file).
+         * This method allows message exchange with metainfo. Metainfo is very similar to HTTP headers. You can use it
+         * to exchange additional data besides the message data.
+         * @param peerId is the id of the peer. You can get it when you connect() to a peer, when you
+         * call getAllPeers(), inside a peer event or by calling requestContext->peerId() inside a
+         * command execution. The peerId belongs to this entity. Because an entity can have multiple
+         * connections to remote entities, a remote entity must be identified by the peerId.
+         * @param path is the path that shall be called at the remote entity
+         * @param metainfo is a key/value map of additional data besides the request data. Metainfo is very similar to HTTP headers.
+         * @param structBase is the request message to send (generated code of fmq file).
+         * @param timeout in [ms]. If no reply was received within the timeout, funcReply is called with Status::STATUS_REQUEST_TIMEOUT.
+         * @param funcReply is the reply callback.
+         * @return if successful, valid correlation ID.
+         */
+        template<class R>
+        CorrelationId requestReply(const PeerId& peerId,
+            const std::string& path,
+            IMessage::Metainfo&& metainfo,
+            const StructBase& structBase,
+            int timeout,
+            std::function<void(PeerId peerId, Status status, IMessage::Metainfo& metainfo, const std::shared_ptr<R>& reply)> funcReply)
+        {
+            assert(funcReply);
+            CorrelationId correlationId = sendRequest(peerId, path, std::move(metainfo), structBase, timeout, [funcReply{ std::move(funcReply) }](PeerId peerId1, Status status, IMessage::Metainfo& metainfo1, const StructBasePtr& structBase1) {
+                std::shared_ptr<R> reply;
+                if (status == Status::STATUS_OK && structBase1 != nullptr)
+                {
+                    if (structBase1->getStructInfo().getTypeName() == R::structInfo().getTypeName())
+                    {
+                        reply = std::static_pointer_cast<R>(structBase1);
+                    }
+                    if (reply == nullptr)
+                    {
+                        status = Status::STATUS_WRONG_REPLY_TYPE;
+                    }
+                }
+                funcReply(peerId1, status, metainfo1, reply);
+            });
+            return correlationId;
+        }
+
         /**
          * @brief sendEvent sends a request to the peer and does not expect a reply.
          * @param peerId is the id of the peer. You can get it when you connect() to a peer, when you
@@ -403,6 +487,25 @@ namespace finalmq
             registerCommandFunction(path, R::structInfo().getTypeName(), reinterpret_cast<FuncCommand&>(funcCommand));
         }
 
+        /**
+         * @brief registerCommandLazy registers a callback function for executing a request or event, which
+         * parses the request data on demand. The callback is called before the request data is parsed, so that
+         * a request, which is only forwarded or rejected, does not pay for parsing its data.
+         * Use requestContext->getData<R>() to parse and access the request, requestContext->getDataAs<P>()
+         * to parse only the fields of another (reduced) type P, or requestContext->getRawData() to access
+         * the serialized data. For protobuf, P must keep the fields at the same positions as R (same field numbers).
+         * The template parameter is the message type of the request/event (generated code of fmq file).
+         * @param path is the path how to access the command.
+         * @param funcCommand is the callback function.
+         */
+        template<class R>
+        void registerCommandLazy(const std::string& path, std::function<void(const RequestContextPtr& requestContext)> funcCommand)
+        {
+            registerCommandFunctionLazy(path, R::structInfo().getTypeName(), [funcCommand](const RequestContextPtr& requestContext, const StructBasePtr& /*structBase*/) {
+                funcCommand(requestContext);
+            });
+        }
+
         /**
          * @brief connect the entity with a remote entity. This entity-to-entity connection is represented by a peer ID.
          * You can connect an entity with multiple remote entities. For each connection you will get a peer ID.
@@ -513,6 +616,17 @@ namespace finalmq
          */
         virtual void registerCommandFunction(const std::string& path, const std::string& type, FuncCommand funcCommand) = 0;
 
+        /**
+         * @brief registerCommandFunctionLazy registers a callback function for executing a request or event.
+         * The request data is not parsed before the callback is called, structBase is nullptr. Use the
+         * data access methods of the requestContext to parse the data on demand. Use registerCommandLazy()
+         * to have the concrete request type.
+         * @param path is the path of the function.
+         * @param type is the name of the concrete request type.
+         * @param funcCommand is the callback function.
+         */
+        virtual void registerCommandFunctionLazy(const std::string& path, const std::string& type, FuncCommand funcCommand) = 0;
+
         /**
          * @brief gets the type of the function, which is defined at path.
          * @param path is the path of the function. Can be adjusted by the call, if the method is relevant for the function.
@@ -603,6 +717,45 @@ namespace finalmq
          */
         virtual CorrelationId sendRequest(const PeerId& peerId, IMessage::Metainfo&& metainfo, const StructBase& structBase, FuncReplyMeta funcReply) = 0;
 
+        /**
+         * @brief sendRequest sends a request to the peer and the funcReply is triggered when
+         * the reply is available or when the timeout expired. A reply that is received after the
+         * timeout, is not passed to funcReply. The timeouts are checked every cycleTime of the
+         * RemoteEntityContainer, so a timeout can expire up to one cycleTime later.
+         * @param peerId is the id of the peer. You can get it when you connect() to a peer, when you
+         * call getAllPeers(), inside a peer event or by calling requestContext->peerId() inside a
+         * command execution. The peerId belongs to this entity. Because an entity can have multiple
+         * connections to remote entities, a remote entity must be identified by the peerId.
+         * @param path is the path that shall be called at the remote entity
+         * @param structBase is the request message to send (generated code of fmq file).
+         * @param timeout in [ms]. If no reply was received within the timeout, funcReply is called with
+         * Status::STATUS_REQUEST_TIMEOUT. A timeout <= 0 means no timeout.
+         * @param funcReply is the reply callback.
+         * @return if successful, valid correlation ID.
+         */
+        virtual CorrelationId sendRequest(const PeerId& peerId, const std::string& path, const StructBase& structBase, int timeout, FuncReply funcReply) = 0;
+
+        /**
+         * @brief sendRequest sends a request to the peer and the funcReply is triggered when
+         * the reply is available or when the timeout expired. A reply that is received after the
+         * timeout, is not passed to funcReply. The timeouts are checked every cycleTime of the
+         * RemoteEntityContainer, so a timeout can expire up to one cycleTime later.
+         * This method allows message exchange with metainfo. Metainfo is very similar to HTTP headers. You can use it
+         * to exchange additional data besides the message data.
+         * @param peerId is the id of the peer. You can get it when you connect() to a peer, when you
+         * call getAllPeers(), inside a peer event or by calling requestContext->peerId() inside a
+         * command execution. The peerId belongs to this entity. Because an entity can have multiple
+         * connections to remote entities, a remote entity must be identified by the peerId.
+         * @param path is the path that shall be called at the remote entity
+         * @param metainfo is a key/value map of additional data besides the request data. Metainfo is very similar to HTTP headers.
+         * @param structBase is the request message to send (generated code of fmq file).
+         * @param timeout in [ms]. If no reply was received within the timeout, funcReply is called with
+         * Status::STATUS_REQUEST_TIMEOUT. A timeout <= 0 means no timeout.
+         * @param funcReply is the reply callback.
+         * @return if successful, valid correlation ID.
+         */
+        virtual CorrelationId sendRequest(const PeerId& peerId, const std::string& path, IMessage::Metainfo&& metainfo, const StructBase& structBase, int timeout, FuncReplyMeta funcReply) = 0;
+
         /**
         * @brief cancels a reply callback. After calling this function, the expected reply callback will not be called, anymore.
         * Call this function, if e.g. a timeout happened, and you are not interested in the reply, anymore.
@@ -659,6 +812,7 @@ namespace finalmq
         virtual void virtualSessionDisconnected(const IProtocolSessionPtr& session, const std::string& virtualSessionId) = 0;
         virtual void receivedRequest(ReceiveData& receiveData) = 0;
         virtual void receivedReply(const ReceiveData& receiveData) = 0;
+        virtual void cycleTime() = 0;
         virtual void deinit() = 0;
         friend class RemoteEntityContainer;
     };
@@ -23,12 +23,16 @@
 #pragma once
 
 #include <atomic>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
 
+#include "finalmq/helpers/TimerWheel.h"
 #include "finalmq/protocolsession/ProtocolSessionContainer.h"
+#include "finalmq/remoteentity/CommandRouter.h"
+#include "finalmq/remoteentity/HeaderTemplateCache.h"
 #include "finalmq/remoteentity/IRemoteEntity.h"
 #include "finalmq/remoteentity/RemoteEntityFormatRegistry.h"
 
@@ -91,7 +95,12 @@ public:
     void updatePeer(PeerId peerId, const std::string& virtualSessionId, EntityId entityId, const std::string& entityName);
     bool removePeer(PeerId peerId, bool& incoming);
     PeerId getPeerId(std::int64_t sessionId, const std::string& virtualSessionId, EntityId entityId, const std::string& entityName) const;
-    ReadyToSend getRequestHeader(const PeerId& peerId, const std::string& path, const StructBase& structBase, CorrelationId correlationId, Header& header, IProtocolSessionPtr& session, std::string& virtualSessionId);
+    ReadyToSend getRequestHeader(const PeerId& peerId, const std::string& path, const StructBase& structBase, CorrelationId correlationId, Header& header, IProtocolSessionPtr& session, std::string& virtualSessionId, std::shared_ptr<HeaderTemplateCache>& headerCache);
+    /**
+     * The header templates of the peer, they are created with the first message to the peer.
+     * @return nullptr, if the peer does not exist.
+     */
+    std::shared_ptr<HeaderTemplateCache> getHeaderCache(const PeerId& peerId);
     std::string getEntityName(const PeerId& peerId);
     PeerId addPeer(const SessionInfo& session, const std::string& virtualSessionId, EntityId entityId, const std::string& entityName, bool incoming, bool& added, const std::function<void()>& funcBeforeFirePeerEvent, bool triggerPeerEvent = true);
     PeerId addPeer();
@@ -109,6 +118,7 @@ private:
         std::string entityName{};
         bool incoming = false;
         std::deque<Request> requests{};
+        std::shared_ptr<HeaderTemplateCache> headerCache{};
     };
 
     void removePeerFromSessionEntityToPeerId(std::int64_t sessionId, const std::string& virtualSessionId, EntityId entityId, const std::string& entityName);
@@ -128,7 +138,7 @@ class RequestContext : public std::enable_shared_from_this<RequestContext>
 {
 public:
     inline RequestContext(const PeerManagerPtr& sessionIdEntityIdToPeerId, EntityId entityIdSrc, ReceiveData& receiveData)
-        : m_peerManager(sessionIdEntityIdToPeerId), m_session(receiveData.session), m_virtualSessionId(std::move(receiveData.virtualSessionId)), m_entityIdDest(receiveData.header.srcid), m_entityIdSrc(entityIdSrc), m_correlationId(receiveData.header.corrid), m_replySent(false), m_metainfo(std::move(receiveData.message->getAllMetainfo())), m_echoData(std::move(receiveData.message->getEchoData()))
+        : m_peerManager(sessionIdEntityIdToPeerId), m_session(receiveData.session), m_virtualSessionId(std::move(receiveData.virtualSessionId)), m_entityIdDest(receiveData.header.srcid), m_entityIdSrc(entityIdSrc), m_correlationId(receiveData.header.corrid), m_replySent(false), m_metainfo(std::move(receiveData.message->getAllMetainfo())), m_echoData(std::move(receiveData.message->getEchoData())), m_payload(receiveData.payload)
     {
     }
 
@@ -157,7 +167,8 @@ public:
         if (!m_replySent)
         {
             Header header{m_entityIdDest, "", m_entityIdSrc, MsgMode::MSG_REPLY, Status::STATUS_OK, {}, structBase.getStructInfo().getTypeName(), m_correlationId, {}};
-            RemoteEntityFormatRegistry::instance().send(m_session.getSession(), m_virtualSessionId, header, std::move(m_echoData), &structBase, metainfo);
+            const std::shared_ptr<HeaderTemplateCache> headerCache = getHeaderCache();
+            RemoteEntityFormatRegistry::instance().send(m_session.getSession(), m_virtualSessionId, header, std::move(m_echoData), &structBase, metainfo, nullptr, headerCache.get());
             m_replySent = true;
         }
     }
@@ -167,7 +178,8 @@ public:
         if (!m_replySent)
         {
             Header header{m_entityIdDest, "", m_entityIdSrc, MsgMode::MSG_REPLY, Status::STATUS_OK, {}, {}, m_correlationId, {}};
-            RemoteEntityFormatRegistry::instance().send(m_session.getSession(), m_virtualSessionId, header, std::move(m_echoData), nullptr, metainfo, &controlData);
+            const std::shared_ptr<HeaderTemplateCache> headerCache = getHeaderCache();
+            RemoteEntityFormatRegistry::instance().send(m_session.getSession(), m_virtualSessionId, header, std::move(m_echoData), nullptr, metainfo, &controlData, headerCache.get());
             m_replySent = true;
         }
     }
@@ -177,7 +189,8 @@ public:
         if (!m_replySent)
         {
             Header header{m_entityIdDest, "", m_entityIdSrc, MsgMode::MSG_REPLY, status, {}, {}, m_correlationId, {}};
-            RemoteEntityFormatRegistry::instance().send(m_session.getSession(), m_virtualSessionId, header, std::move(m_echoData));
+            const std::shared_ptr<HeaderTemplateCache> headerCache = getHeaderCache();
+            RemoteEntityFormatRegistry::instance().send(m_session.getSession(), m_virtualSessionId, header, std::move(m_echoData), nullptr, nullptr, nullptr, headerCache.get());
             m_replySent = true;
         }
     }
@@ -235,12 +248,80 @@ public:
         return m_entityIdDest;
     }
 
+    /**
+     * The request data, it is parsed with the first call (see IRemoteEntity::registerCommandLazy()).
+     * @return nullptr, if the data could not be parsed.
+     */
+    const StructBasePtr& getData()
+    {
+        static const StructBasePtr DATA_NONE;
+        if (m_payload)
+        {
+            return m_payload->getData();
+        }
+        return DATA_NONE;
+    }
+
+    template<class R>
+    std::shared_ptr<R> getData()
+    {
+        const StructBasePtr& data = getData();
+        if (data && data->getStructInfo().getTypeName() == R::structInfo().getTypeName())
+        {
+            return std::static_pointer_cast<R>(data);
+        }
+        return nullptr;
+    }
+
+    /**
+     * Parses the request data into the type P, e.g. a type with only the fields of interest.
+     * Fields, which are not part of P, are skipped by the parser.
+     * Note: json matches the fields by name, but protobuf matches them by field number, which is
+     * the field's index + 1. So, P must keep the fields of interest at the same positions as the
+     * request type, e.g. P consists of the leading fields of the request type.
+     */
+    template<class P>
+    std::shared_ptr<P> getDataAs()
+    {
+        if (m_payload)
+        {
+            StructBasePtr data = m_payload->getDataAs(P::structInfo().getTypeName());
+            if (data && data->getStructInfo().getTypeName() == P::structInfo().getTypeName())
+            {
+                return std::static_pointer_cast<P>(data);
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * The serialized request data, e.g. to forward the request without parsing it.
+     */
+    BufferRef getRawData() const
+    {
+        if (m_payload)
+        {
+            return m_payload->getRawData();
+        }
+        return {nullptr, 0};
+    }
+
 private:
     RequestContext(const RequestContext&) = delete;
     const RequestContext& operator=(const RequestContext&) = delete;
     RequestContext(const RequestContext&&) = delete;
     const RequestContext& operator=(const RequestContext&&) = delete;
 
+    // the header templates of the peer, if the requester is a peer of the entity
+    std::shared_ptr<HeaderTemplateCache> getHeaderCache()
+    {
+        if (!m_peerManager || !m_session)
+        {
+            return nullptr;
+        }
+        return m_peerManager->getHeaderCache(peerId());
+    }
+
 private:
     PeerManagerPtr m_peerManager;
     SessionInfo m_session;
@@ -252,6 +333,7 @@ private:
     bool m_replySent = false;
     IMessage::Metainfo m_metainfo;
     Variant m_echoData;
+    std::shared_ptr<LazyPayload> m_payload;
 
     friend class RemoteEntity;
 };
@@ -284,6 +366,7 @@ public:
     virtual void connect(PeerId peerId, const SessionInfo& session, EntityId entityId) override;
     virtual void connect(PeerId peerId, const SessionInfo& session, const std::string& entityName, EntityId entityId) override;
     virtual void registerCommandFunction(const std::string& path, const std::string& type, FuncCommand funcCommand) override;
+    virtual void registerCommandFunctionLazy(const std::string& path, const std::string& type, FuncCommand funcCommand) override;
     virtual std::string getTypeOfCommandFunction(std::string& path, std::string& typeOfGeneralMessage, const std::string* method = nullptr) override;
     virtual CorrelationId getNextCorrelationId() const override;
     virtual void sendRequest(const PeerId& peerId, const std::string& path, const StructBase& structBase, CorrelationId correlationId, IMessage::Metainfo* metainfo = nullptr) override;
@@ -291,6 +374,8 @@ public:
     virtual CorrelationId sendRequest(const PeerId& peerId, const std::string& path, IMessage::Metainfo&& metainfo, const StructBase& structBase, FuncReplyMeta funcReply) override;
     virtual CorrelationId sendRequest(const PeerId& peerId, const StructBase& structBase, FuncReply funcReply) override;
     virtual CorrelationId sendRequest(const PeerId& peerId, IMessage::Metainfo&& metainfo, const StructBase& structBase, FuncReplyMeta funcReply) override;
+    virtual CorrelationId sendRequest(const PeerId& peerId, const std::string& path, const StructBase& structBase, int timeout, FuncReply funcReply) override;
+    virtual CorrelationId sendRequest(const PeerId& peerId, const std::string& path, IMessage::Metainfo&& metainfo, const StructBase& structBase, int timeout, FuncReplyMeta funcReply) override;
     virtual bool cancelReply(CorrelationId correlationId) override;
     virtual void registerReplyEvent(FuncReplyEvent funcReplyEvent) override;
     virtual PeerId createPublishPeer(const SessionInfo& session, const std::string& entityName, bool triggerPeerEvent = true) override;
@@ -303,6 +388,7 @@ private:
     virtual void virtualSessionDisconnected(const IProtocolSessionPtr& session, const std::string& virtualSessionId) override;
     virtual void receivedRequest(ReceiveData& receiveData) override;
     virtual void receivedReply(const ReceiveData& receiveData) override;
+    virtual void cycleTime() override;
     virtual void deinit() override;
 
 protected:
@@ -315,17 +401,19 @@ private:
     void replyReceived(const ReceiveData& receiveData);
     void sendConnectEntity(PeerId peerId, IRemoteEntityContainer& entityContainer, const std::shared_ptr<FuncReplyConnect>& funcReplyConnect);
 
+    class FanOut;
+    void sendRequestIntern(const PeerId& peerId, const std::string& path, const StructBase& structBase, CorrelationId correlationId, IMessage::Metainfo* metainfo, FanOut* fanOut);
+    void sendEventToAllPeersIntern(const std::string& path, IMessage::Metainfo* metainfo, const StructBase& structBase);
+
     struct Function
     {
         std::string type{};
         std::shared_ptr<FuncCommand> func{};
-    };
-    struct FunctionVar : public Function
-    {
-        std::vector<std::string> pathEntries{};
+        bool lazy = false;
     };
 
     const Function* getFunction(const std::string& path, IMessage::Metainfo* keys = nullptr) const;
+    void registerCommandFunction(const std::string& path, const std::string& type, FuncCommand funcCommand, bool lazy);
 
     struct Request
     {
@@ -340,17 +428,24 @@ private:
         PeerId peerId = PEERID_INVALID;
         std::shared_ptr<FuncReply> func{};
         std::shared_ptr<FuncReplyMeta> funcMeta{};
+        bool hasTimer = false;
+        TimerWheel::Handle timer{};
     };
 
+    void addRequest(CorrelationId correlationId, std::unique_ptr<Request>&& request, int timeout);
+    std::unique_ptr<Request> takeRequest(std::unordered_map<CorrelationId, std::unique_ptr<Request>>::iterator it);
+    static void releaseRequests(std::vector<std::unique_ptr<Request>>& requests, Status status);
+
     const EntityId m_entityId{ENTITYID_INVALID};
     static std::atomic<EntityId> m_entityIdNext;
 
     std::vector<FuncReplyEvent> m_funcsReplyEvent{};
     std::atomic_int64_t m_funcsReplyEventChanged = {};
     std::unordered_map<CorrelationId, std::unique_ptr<Request>> m_requests{};
+    TimerWheel m_timerWheel; ///< timeouts of m_requests, protected by m_mutexRequests
     std::unordered_map<std::string, Function> m_funcCommandsStatic{};
-    std::list<FunctionVar> m_funcCommandsVar{};
-    std::list<FunctionVar> m_funcCommandsVarStar{};
+    std::deque<Function> m_funcCommandsVar{}; ///< index is the route ID of m_routerCommandsVar
+    CommandRouter m_routerCommandsVar{};
     const std::shared_ptr<PeerManager> m_peerManager{};
     mutable std::atomic_uint64_t m_nextCorrelationId{1};
     mutable std::mutex m_mutex{};
@@ -66,11 +66,13 @@ struct IRemoteEntityContainer
      * @brief init initializes the instance. Call it once after constructing the object.
      * @param executor decouples the callback thread context from the polling thread.
      * @param cycleTime is a timer interval in [ms] in which the poller thread will trigger a timer callback (see parameter funcTimer).
-     * @param funcTimer is a callback that is been called every cycleTime.
+     * @param funcTimer is a callback that is been called every cycleTime. The request timeouts of the entities are checked every cycleTime, as well.
      * @param storeRawDataInReceiveStruct is a flag. It is usually false. But if you wish to have the raw data inside a message struct, then you can set this flag to true.
      * @param checkReconnectInterval is the timer interval in [ms] in which the reconnect timers will be checked (the reconnect timers are not checked every cycleTime). Unit tests which test reconnection, set this parameter to 1ms to have faster tests.
+     * @param numberOfPollerLoops is the number of poller threads. The connections are distributed over the poller threads. Without an executor, the callbacks of different connections can be called concurrently, if numberOfPollerLoops is greater than 1.
+     * @param receiveMode defines how the poller reports readable sockets. With RECEIVEMODE_READUNTILWOULDBLOCK or RECEIVEMODE_EDGETRIGGERED the poller does not ask for the number of readable bytes, the sockets are read until they would block.
      */
-    virtual void init(const IExecutorPtr& executor = nullptr, int cycleTime = 100, FuncTimer funcTimer = nullptr, bool storeRawDataInReceiveStruct = false, int checkReconnectInterval = 1000) = 0;
+    virtual void init(const IExecutorPtr& executor = nullptr, int cycleTime = 100, FuncTimer funcTimer = nullptr, bool storeRawDataInReceiveStruct = false, int checkReconnectInterval = 1000, int numberOfPollerLoops = 1, ReceiveMode receiveMode = ReceiveMode::RECEIVEMODE_PENDINGREAD) = 0;
 
     ///
     /// @brief bind opens a listener socket.
@@ -183,7 +185,7 @@ public:
     virtual ~RemoteEntityContainer();
 
     // IRemoteEntityContainer
-    virtual void init(const IExecutorPtr& executor = nullptr, int cycleTime = 100, FuncTimer funcTimer = {}, bool storeRawDataInReceiveStruct = false, int checkReconnectInterval = 1000) override;
+    virtual void init(const IExecutorPtr& executor = nullptr, int cycleTime = 100, FuncTimer funcTimer = {}, bool storeRawDataInReceiveStruct = false, int checkReconnectInterval = 1000, int numberOfPollerLoops = 1, ReceiveMode receiveMode = ReceiveMode::RECEIVEMODE_PENDINGREAD) override;
     virtual int bind(const std::string& endpoint, const BindProperties& bindProperties = {}) override;
     virtual void unbind(const std::string& endpoint) override;
     virtual SessionInfo connect(const std::string& endpoint, const ConnectProperties& connectProperties = {}) override;
@@ -212,6 +214,7 @@ private:
     SessionInfo createSessionInfo(const IProtocolSessionPtr& session);
     inline void triggerConnectionEvent(const SessionInfo& session, ConnectionEvent connectionEvent) const;
     void deinit();
+    void cycleTimeEntities();
     //    bool isPureDataPath(const std::string& path);
     void subscribeEntityNames(const IProtocolSessionPtr& session);
     void subscribeSessions(std::string name);
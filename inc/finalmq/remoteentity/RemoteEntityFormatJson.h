@@ -38,10 +38,13 @@ public:
     static const std::string PROPERTY_SERIALIZE_SKIP_DEFAULT_VALUES;    // skipDefVal
 
 private:
-    virtual std::shared_ptr<StructBase> parse(const IProtocolSessionPtr& session, const BufferRef& bufferRef, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus) override;
-    virtual std::shared_ptr<StructBase> parseData(const IProtocolSessionPtr& session, const BufferRef& bufferRef, bool storeRawData, std::string& type, int& formatStatus, const std::string& typeOfGeneralMessage) override;
-    virtual void serialize(const IProtocolSessionPtr& session, IMessage& message, const Header& header, const StructBase* structBase = nullptr) override;
+    virtual std::shared_ptr<StructBase> parse(const IProtocolSessionPtr& session, const BufferRef& bufferRef, const std::shared_ptr<const std::string>& receiveBuffer, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus) override;
+    virtual std::shared_ptr<StructBase> parseData(const IProtocolSessionPtr& session, const BufferRef& bufferRef, const std::shared_ptr<const std::string>& receiveBuffer, bool storeRawData, std::string& type, int& formatStatus, const std::string& typeOfGeneralMessage) override;
+    virtual bool parseHeader(const IProtocolSessionPtr& session, const BufferRef& bufferRef, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, std::string& typeOfGeneralMessage, BufferRef& bufferRefData) override;
+    virtual bool isDataParsedOnDemand() const override;
+    virtual void serialize(const IProtocolSessionPtr& session, IMessage& message, const Header& header, const StructBase* structBase = nullptr, HeaderTemplateCache* headerCache = nullptr) override;
     virtual void serializeData(const IProtocolSessionPtr& session, IMessage& message, const StructBase* structBase = nullptr) override;
+    virtual bool serializeRawData(const IProtocolSessionPtr& session, const StructBase& structBase, std::string& rawData) override;
 };
 
 
@@ -33,6 +33,7 @@ namespace finalmq
 typedef std::shared_ptr<IProtocolSession> IProtocolSessionPtr;
 
 class Header;
+class HeaderTemplateCache;
 
 enum FormatStatus
 {
@@ -46,19 +47,117 @@ struct IRemoteEntityFormat
 {
     virtual ~IRemoteEntityFormat()
     {}
-    virtual std::shared_ptr<StructBase> parse(const IProtocolSessionPtr& session, const BufferRef& bufferRef, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus) = 0;
-    virtual std::shared_ptr<StructBase> parseData(const IProtocolSessionPtr& session, const BufferRef& bufferRef, bool storeRawData, std::string& type, int& formatStatus, const std::string& typeOfGeneralMessage) = 0;
-    virtual void serialize(const IProtocolSessionPtr& session, IMessage& message, const Header& header, const StructBase* structBase = nullptr) = 0;
+    virtual std::shared_ptr<StructBase> parse(const IProtocolSessionPtr& session, const BufferRef& bufferRef, const std::shared_ptr<const std::string>& receiveBuffer, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus) = 0;
+    virtual std::shared_ptr<StructBase> parseData(const IProtocolSessionPtr& session, const BufferRef& bufferRef, const std::shared_ptr<const std::string>& receiveBuffer, bool storeRawData, std::string& type, int& formatStatus, const std::string& typeOfGeneralMessage) = 0;
+
+    /**
+     * Parses only the header of a message. The data can be parsed later with parseData().
+     * @param bufferRefData is the data part of the message, which has to be passed to parseData().
+     * @return false, if the header could not be parsed.
+     */
+    virtual bool parseHeader(const IProtocolSessionPtr& /*session*/, const BufferRef& /*bufferRef*/, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& /*name2Entity*/, Header& /*header*/, std::string& /*typeOfGeneralMessage*/, BufferRef& /*bufferRefData*/)
+    {
+        return false;
+    }
+
+    /**
+     * @return true, if parseHeader() is supported and parseData() does not change the header (type, format status),
+     *         so that the data can be parsed, when it is accessed the first time.
+     */
+    virtual bool isDataParsedOnDemand() const
+    {
+        return false;
+    }
+
+    /**
+     * @param headerCache are the header templates of the peer, if the format supports them. Without
+     *        cache, the header is serialized completely.
+     */
+    virtual void serialize(const IProtocolSessionPtr& session, IMessage& message, const Header& header, const StructBase* structBase = nullptr, HeaderTemplateCache* headerCache = nullptr) = 0;
     virtual void serializeData(const IProtocolSessionPtr& session, IMessage& message, const StructBase* structBase = nullptr) = 0;
+
+    /**
+     * Serializes only the data of structBase, as it is expected by StructBase::setRawData(). The raw data
+     * can be sent to all sessions with the same content type and format data without serializing the
+     * struct again.
+     * Structs with raw data, GeneralMessage and RawDataMessage are filtered by the registry before.
+     * @return false, if the format cannot provide raw data for this struct. Then, the struct has to be
+     *         serialized for every session.
+     */
+    virtual bool serializeRawData(const IProtocolSessionPtr& /*session*/, const StructBase& /*structBase*/, std::string& /*rawData*/)
+    {
+        return false;
+    }
+};
+
+/**
+ * The data of a received message. If the format supports it (see IRemoteEntityFormat::isDataParsedOnDemand()),
+ * the data is parsed, when it is accessed the first time, so that messages, which are rejected or
+ * forwarded, do not pay for parsing their data. The payload keeps the received message alive.
+ * The payload is not thread-safe.
+ */
+class SYMBOLEXP LazyPayload
+{
+public:
+    /**
+     * The data is already parsed.
+     */
+    LazyPayload(const std::shared_ptr<StructBase>& data, int formatStatus);
+
+    /**
+     * The data is parsed on demand by format->parseData().
+     * @param dataOwned is used instead of the received payload, if it is not empty (data inside the path).
+     */
+    LazyPayload(const std::shared_ptr<IRemoteEntityFormat>& format, const IProtocolSessionPtr& session, const IMessagePtr& message, const BufferRef& bufferRef,
+                bool storeRawData, const std::string& type, const std::string& typeOfGeneralMessage, std::string&& dataOwned);
+
+    /**
+     * Parses the data, if it is not parsed, yet.
+     * @return the data, nullptr if the data could not be parsed (see getFormatStatus()).
+     */
+    const std::shared_ptr<StructBase>& getData();
+
+    /**
+     * Parses the data into another type, e.g. a type that only contains the fields of interest
+     * (projection). The fields, which are not part of the type, are skipped by the parser.
+     * The data of getData() is not affected.
+     * @return the data, nullptr if the data could not be parsed or if the payload was created with parsed data.
+     */
+    std::shared_ptr<StructBase> getDataAs(const std::string& type);
+
+    /**
+     * The serialized data of the message, e.g. to forward it. Empty, if the payload was created with parsed data.
+     */
+    const BufferRef& getRawData() const;
+
+    bool isParsed() const;
+    int getFormatStatus() const;
+
+private:
+    LazyPayload(const LazyPayload&) = delete;
+    const LazyPayload& operator=(const LazyPayload&) = delete;
+
+    std::shared_ptr<IRemoteEntityFormat> m_format{};
+    IProtocolSessionPtr m_session{};
+    IMessagePtr m_message{};
+    BufferRef m_bufferRef{nullptr, 0};
+    bool m_storeRawData = false;
+    std::string m_type{};
+    std::string m_typeOfGeneralMessage{};
+    std::string m_dataOwned{};
+    std::shared_ptr<StructBase> m_data{};
+    int m_formatStatus = 0;
+    bool m_parsed = false;
 };
 
 struct IRemoteEntityFormatRegistry
 {
     virtual ~IRemoteEntityFormatRegistry()
     {}
-    virtual std::shared_ptr<StructBase> parse(const IProtocolSessionPtr& session, IMessage& message, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus) = 0;
-    virtual std::shared_ptr<StructBase> parseHeaderInMetainfo(const IProtocolSessionPtr& session, IMessage& message, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus) = 0;
-    virtual void send(const IProtocolSessionPtr& session, const std::string& virtualSessionId, Header& header, Variant&& echoData, const StructBase* structBase = nullptr, IMessage::Metainfo* metainfo = nullptr, Variant* controlData = nullptr) = 0;
+    virtual std::shared_ptr<LazyPayload> parse(const IProtocolSessionPtr& session, const IMessagePtr& message, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus) = 0;
+    virtual std::shared_ptr<LazyPayload> parseHeaderInMetainfo(const IProtocolSessionPtr& session, const IMessagePtr& message, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus) = 0;
+    virtual void send(const IProtocolSessionPtr& session, const std::string& virtualSessionId, Header& header, Variant&& echoData, const StructBase* structBase = nullptr, IMessage::Metainfo* metainfo = nullptr, Variant* controlData = nullptr, HeaderTemplateCache* headerCache = nullptr) = 0;
+    virtual bool serializeRawData(const IProtocolSessionPtr& session, const StructBase& structBase, std::string& rawData) = 0;
 
     virtual void registerFormat(const std::string& contentTypeName, int contentType, const std::shared_ptr<IRemoteEntityFormat>& format) = 0;
     virtual bool isRegistered(int contentType) const = 0;
@@ -68,9 +167,10 @@ struct IRemoteEntityFormatRegistry
 class RemoteEntityFormatRegistryImpl : public IRemoteEntityFormatRegistry
 {
 public:
-    virtual std::shared_ptr<StructBase> parse(const IProtocolSessionPtr& session, IMessage& message, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus) override;
-    virtual std::shared_ptr<StructBase> parseHeaderInMetainfo(const IProtocolSessionPtr& session, IMessage& message, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus) override;
-    virtual void send(const IProtocolSessionPtr& session, const std::string& virtualSessionId, Header& header, Variant&& echoData, const StructBase* structBase = nullptr, IMessage::Metainfo* metainfo = nullptr, Variant* controlData = nullptr) override;
+    virtual std::shared_ptr<LazyPayload> parse(const IProtocolSessionPtr& session, const IMessagePtr& message, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus) override;
+    virtual std::shared_ptr<LazyPayload> parseHeaderInMetainfo(const IProtocolSessionPtr& session, const IMessagePtr& message, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus) override;
+    virtual void send(const IProtocolSessionPtr& session, const std::string& virtualSessionId, Header& header, Variant&& echoData, const StructBase* structBase = nullptr, IMessage::Metainfo* metainfo = nullptr, Variant* controlData = nullptr, HeaderTemplateCache* headerCache = nullptr) override;
+    virtual bool serializeRawData(const IProtocolSessionPtr& session, const StructBase& structBase, std::string& rawData) override;
     virtual void registerFormat(const std::string& contentTypeName, int contentType, const std::shared_ptr<IRemoteEntityFormat>& format) override;
     virtual bool isRegistered(int contentType) const override;
     virtual int getContentType(const std::string& contentTypeName) const override;
@@ -78,7 +178,7 @@ public:
 private:
     void serializeHeaderToMetainfo(IMessage& message, const Header& header);
     std::string parseMetainfo(IMessage& message, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, std::string& typeOfGeneralMessage);
-    bool serialize(const IProtocolSessionPtr& session, IMessage& message, const Header& header, const StructBase* structBase = nullptr);
+    bool serialize(const IProtocolSessionPtr& session, IMessage& message, const Header& header, const StructBase* structBase = nullptr, HeaderTemplateCache* headerCache = nullptr);
     bool serializeData(const IProtocolSessionPtr& session, IMessage& message, const StructBase* structBase);
 
     std::unordered_map<int, std::shared_ptr<IRemoteEntityFormat>> m_contentTypeToFormat{};
@@ -0,0 +1,76 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "finalmq/metadata/MetaStruct.h"
+
+namespace finalmq
+{
+/**
+ * The plan of an HL7 message type, compiled once from the metadata. ParserHl7 and SerializerHl7
+ * walk the plan instead of resolving the structs of the fields and searching the message
+ * structure for the next segment ID for every segment.
+ */
+class SYMBOLEXP Hl7Schema
+{
+public:
+    struct Struct;
+
+    struct Field
+    {
+        const MetaField* field = nullptr;
+        // the compiled struct of a struct or struct array field, nullptr for all other fields
+        const Struct* subStruct = nullptr;
+    };
+
+    struct Struct
+    {
+        const MetaStruct* metaStruct = nullptr;
+        bool isSegment = false;
+        bool isChoice = false;
+        bool isMsh = false;     // the type name starts with "MSH"
+        std::vector<Field> fields{};
+        // segmentIdsFrom[ix] are the segment IDs, which can follow when the fields before ix are processed.
+        // The last entry (ix = number of fields) is always empty.
+        std::vector<std::unordered_set<std::string>> segmentIdsFrom{};
+        // parts of the type name, e.g. "ADT_A01" -> "ADT", "A01"
+        std::vector<std::string> typeNameParts{};
+
+        inline bool matches(const std::string& segmentId, ssize_t ixStart) const
+        {
+            const std::unordered_set<std::string>& segmentIds = segmentIdsFrom[ixStart];
+            return (segmentIds.find(segmentId) != segmentIds.end());
+        }
+    };
+
+    /**
+     * Returns the plan of a struct. It is compiled at the first call, the plan lives as long as the process.
+     */
+    static const Struct& getStruct(const MetaStruct& stru);
+};
+
+} // namespace finalmq
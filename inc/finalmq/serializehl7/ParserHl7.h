@@ -27,6 +27,7 @@
 
 #include "finalmq/hl7/Hl7Parser.h"
 #include "finalmq/metadata/MetaStruct.h"
+#include "finalmq/serializehl7/Hl7Schema.h"
 #include "finalmq/serialize/IParserVisitor.h"
 
 namespace finalmq
@@ -44,15 +45,15 @@ private:
     const ParserHl7& operator=(const ParserHl7&) = delete;
     const ParserHl7& operator=(ParserHl7&&) = delete;
 
-    int parseStruct(int levelSegment, const MetaStruct& stru, bool& isarray);
-    bool matches(const std::string& segId, const MetaStruct& stru, ssize_t ixStart);
-    bool matchesUp(const std::string& segId);
+    int parseStruct(int levelSegment, const Hl7Schema::Struct& stru, bool& isarray);
+    bool matchesUp(const std::string& segId) const;
 
     const char* m_ptr = nullptr;
     ssize_t m_size = 0;
     IParserVisitor& m_visitor;
     Hl7Parser m_parser{};
-    std::vector<std::pair<MetaStruct, ssize_t>> m_stackStruct{};
+    std::vector<std::pair<const Hl7Schema::Struct*, ssize_t>> m_stackStruct{};
+    std::string m_tokenBuffer{};    // for tokens with escape sequences
 };
 
 } // namespace finalmq
@@ -0,0 +1,327 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "finalmq/conversions/NumberParser.h"
+#include "finalmq/helpers/FmqDefines.h"
+#include "finalmq/helpers/MonotonicArena.h"
+#include "finalmq/metadata/MetaEnum.h"
+#include "finalmq/metadata/MetaType.h"
+
+namespace finalmq
+{
+/**
+ * Pull reader for the code generated json parsers (see StructBase::parseJson()). The
+ * values are converted like ParserJson converts them, but the reader only accepts the
+ * common cases: e.g. strings with escape sequences, floats for integer fields or null
+ * inside of arrays are rejected. Every read returns false in these cases or if the json
+ * is invalid, then the caller shall parse the json again with ParserJson.
+ */
+class SYMBOLEXP JsonReader
+{
+public:
+    JsonReader(const char* buffer, ssize_t size);
+
+    /**
+     * Returns the position after the last read value (like JsonParser::parse)
+     * or nullptr, if the reader failed.
+     */
+    inline const char* getCurrentPosition() const
+    {
+        return m_str;
+    }
+
+    inline bool isOk() const
+    {
+        return (m_str != nullptr);
+    }
+
+    bool enterObject();
+    /**
+     * Reads the next key of an object and the following ':'. Returns false at the end
+     * of the object or on error (see isOk()).
+     */
+    bool nextKey(const char*& key, ssize_t& size);
+
+    bool enterArray();
+    /**
+     * Returns true, if the array has a next entry. Returns false at the end of the array
+     * or on error (see isOk()).
+     */
+    bool nextEntry();
+
+    bool skipValue();
+
+    bool readBool(bool& value);
+    bool readString(std::string& value);
+    bool readBytes(Bytes& value);
+
+    template<class T>
+    bool readInteger(T& value)
+    {
+        if (peek() == 'n')
+        {
+            return readNull();
+        }
+        return readIntegerValue(value);
+    }
+
+    template<class T>
+    bool readFloat(T& value)
+    {
+        if (peek() == 'n')
+        {
+            return readNull();
+        }
+        return readFloatValue(value);
+    }
+
+    template<class T>
+    bool readEnum(T& value)
+    {
+        if (peek() == 'n')
+        {
+            return readNull();
+        }
+        std::int32_t v = 0;
+        if (!readEnumValue(T::enumInfo().getMetaEnum(), v))
+        {
+            return false;
+        }
+        value = static_cast<typename T::Enum>(v);
+        return true;
+    }
+
+    template<class T>
+    bool readStruct(T& value)
+    {
+        if (peek() == 'n')
+        {
+            return readNull();
+        }
+        return value.readJson(*this);
+    }
+
+    template<class T>
+    bool readStructNullable(std::shared_ptr<T>& value)
+    {
+        if (peek() == 'n')
+        {
+            value = nullptr;
+            return readNull();
+        }
+        if (!value)
+        {
+            value = makeSharedInArena<T>();
+        }
+        return value->readJson(*this);
+    }
+
+    bool readArrayBool(std::vector<bool>& value);
+    bool readArrayString(std::vector<std::string>& value);
+    bool readArrayBytes(std::vector<Bytes>& value);
+
+    template<class T>
+    bool readArrayInteger(std::vector<T>& value)
+    {
+        if (peek() == 'n')
+        {
+            return readNull();
+        }
+        if (!enterArray())
+        {
+            return false;
+        }
+        value.clear();
+        while (nextEntry())
+        {
+            T v{};
+            if (!readIntegerValue(v))
+            {
+                return false;
+            }
+            value.push_back(v);
+        }
+        return isOk();
+    }
+
+    template<class T>
+    bool readArrayFloat(std::vector<T>& value)
+    {
+        if (peek() == 'n')
+        {
+            return readNull();
+        }
+        if (!enterArray())
+        {
+            return false;
+        }
+        value.clear();
+        while (nextEntry())
+        {
+            T v{};
+            if (!readFloatValue(v))
+            {
+                return false;
+            }
+            value.push_back(v);
+        }
+        return isOk();
+    }
+
+    template<class T>
+    bool readArrayEnum(std::vector<T>& value)
+    {
+        if (peek() == 'n')
+        {
+            return readNull();
+        }
+        std::vector<std::int32_t> values;
+        if (!readArrayEnumValues(T::enumInfo().getMetaEnum(), values))
+        {
+            return false;
+        }
+        value.clear();
+        value.reserve(values.size());
+        for (std::int32_t v : values)
+        {
+            value.emplace_back(static_cast<typename T::Enum>(v));
+        }
+        return true;
+    }
+
+    template<class T>
+    bool readArrayStruct(std::vector<T>& value)
+    {
+        if (peek() == 'n')
+        {
+            return readNull();
+        }
+        if (!enterArray())
+        {
+            return false;
+        }
+        while (nextEntry())
+        {
+            value.emplace_back();
+            if (!value.back().readJson(*this))
+            {
+                return false;
+            }
+        }
+        return isOk();
+    }
+
+private:
+    struct Number
+    {
+        bool isFloat = false;
+        bool isNegative = false;
+        std::int64_t valueInt = 0;
+        std::uint64_t valueUInt = 0;
+        double valueDouble = 0;
+    };
+
+    inline char getChar() const
+    {
+        return ((m_str < m_end) ? *m_str : 0);
+    }
+
+    char peek();
+    void setError();
+    bool readNull();
+    bool readLiteral(const char* literal, ssize_t size);
+    bool readStringRaw(const char*& value, ssize_t& size);
+    bool readNumber(Number& number);
+    bool readBoolValue(bool& value);
+    bool readEnumValue(const MetaEnum& metaEnum, std::int32_t& value);
+    bool readArrayEnumValues(const MetaEnum& metaEnum, std::vector<std::int32_t>& value);
+    static float convertFloat(const char* value, ssize_t size, float*);
+    static double convertFloat(const char* value, ssize_t size, double*);
+
+    template<class T>
+    bool readIntegerValue(T& value)
+    {
+        if (peek() == '\"')
+        {
+            const char* str = nullptr;
+            ssize_t size = 0;
+            if (!readStringRaw(str, size))
+            {
+                return false;
+            }
+            value = NumberParser::toNumber<T>(str, str + size);
+            return true;
+        }
+        Number number;
+        if (!readNumber(number) || number.isFloat)
+        {
+            setError();
+            return false;
+        }
+        value = number.isNegative ? static_cast<T>(number.valueInt) : static_cast<T>(number.valueUInt);
+        return true;
+    }
+
+    template<class T>
+    bool readFloatValue(T& value)
+    {
+        if (peek() == '\"')
+        {
+            const char* str = nullptr;
+            ssize_t size = 0;
+            if (!readStringRaw(str, size))
+            {
+                return false;
+            }
+            value = convertFloat(str, size, static_cast<T*>(nullptr));
+            return true;
+        }
+        Number number;
+        if (!readNumber(number))
+        {
+            return false;
+        }
+        if (number.isFloat)
+        {
+            value = static_cast<T>(number.valueDouble);
+        }
+        else
+        {
+            value = number.isNegative ? static_cast<T>(number.valueInt) : static_cast<T>(number.valueUInt);
+        }
+        return true;
+    }
+
+    const char* m_str{nullptr};
+    const char* m_end{nullptr};
+    bool m_afterValue{false};
+};
+
+} // namespace finalmq
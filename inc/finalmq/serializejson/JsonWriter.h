@@ -0,0 +1,218 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "finalmq/helpers/FmqDefines.h"
+#include "finalmq/json/JsonBuilder.h"
+#include "finalmq/metadata/MetaEnum.h"
+#include "finalmq/metadata/MetaType.h"
+
+namespace finalmq
+{
+/**
+ * Writer for the code generated json serializers (see StructBase::serializeJson()). It
+ * writes the values the same way as SerializerJson, but without the lookups of the
+ * visitor chain.
+ */
+class SYMBOLEXP JsonWriter
+{
+public:
+    JsonWriter(IZeroCopyBuffer& buffer, int maxBlockSize, bool enumAsString);
+
+    void finished();
+
+    inline void enterObject()
+    {
+        m_jsonBuilder.enterObject();
+    }
+    inline void exitObject()
+    {
+        m_jsonBuilder.exitObject();
+    }
+    inline void enterKey(const char* key, ssize_t size)
+    {
+        m_jsonBuilder.enterKey(key, size);
+    }
+
+    inline void writeBool(bool value)
+    {
+        m_jsonBuilder.enterBool(value);
+    }
+    inline void writeInt32(std::int32_t value)
+    {
+        m_jsonBuilder.enterInt32(value);
+    }
+    inline void writeUInt32(std::uint32_t value)
+    {
+        m_jsonBuilder.enterUInt32(value);
+    }
+    inline void writeInt64(std::int64_t value)
+    {
+        m_jsonBuilder.enterString(std::to_string(value));
+    }
+    inline void writeUInt64(std::uint64_t value)
+    {
+        m_jsonBuilder.enterString(std::to_string(value));
+    }
+    void writeDouble(double value);
+    inline void writeString(const std::string& value)
+    {
+        m_jsonBuilder.enterString(value.data(), value.size());
+    }
+    void writeBytes(const Bytes& value);
+    void writeEnum(const MetaEnum& metaEnum, std::int32_t value);
+
+    template<class T>
+    void writeEnum(const T& value)
+    {
+        writeEnum(T::enumInfo().getMetaEnum(), static_cast<std::int32_t>(value));
+    }
+
+    template<class T>
+    void writeStruct(const T& value)
+    {
+        value.writeJson(*this);
+    }
+
+    template<class T>
+    void writeStructNullable(const std::shared_ptr<T>& value)
+    {
+        if (value)
+        {
+            value->writeJson(*this);
+        }
+        else
+        {
+            m_jsonBuilder.enterNull();
+        }
+    }
+
+    void writeArrayBool(const std::vector<bool>& value);
+
+    // the arrays of the native types are written in bulk, the templates convert the smaller types
+    inline void writeArrayInt32(const std::vector<std::int32_t>& value)
+    {
+        m_jsonBuilder.enterArrayInt32(value.data(), value.size());
+    }
+    inline void writeArrayUInt32(const std::vector<std::uint32_t>& value)
+    {
+        m_jsonBuilder.enterArrayUInt32(value.data(), value.size());
+    }
+    inline void writeArrayInt64(const std::vector<std::int64_t>& value)
+    {
+        m_jsonBuilder.enterArrayInt64(value.data(), value.size(), true);
+    }
+    inline void writeArrayInt64(const std::vector<std::uint64_t>& value)
+    {
+        m_jsonBuilder.enterArrayUInt64(value.data(), value.size(), true);
+    }
+    inline void writeArrayDouble(const std::vector<float>& value)
+    {
+        m_jsonBuilder.enterArrayFloat(value.data(), value.size());
+    }
+    inline void writeArrayDouble(const std::vector<double>& value)
+    {
+        m_jsonBuilder.enterArrayDouble(value.data(), value.size());
+    }
+
+    template<class T>
+    void writeArrayInt32(const std::vector<T>& value)
+    {
+        m_jsonBuilder.enterArray();
+        for (const T& entry : value)
+        {
+            m_jsonBuilder.enterInt32(entry);
+        }
+        m_jsonBuilder.exitArray();
+    }
+
+    template<class T>
+    void writeArrayUInt32(const std::vector<T>& value)
+    {
+        m_jsonBuilder.enterArray();
+        for (const T& entry : value)
+        {
+            m_jsonBuilder.enterUInt32(entry);
+        }
+        m_jsonBuilder.exitArray();
+    }
+
+    template<class T>
+    void writeArrayInt64(const std::vector<T>& value)
+    {
+        m_jsonBuilder.enterArray();
+        for (const T& entry : value)
+        {
+            m_jsonBuilder.enterString(std::to_string(entry));
+        }
+        m_jsonBuilder.exitArray();
+    }
+
+    template<class T>
+    void writeArrayDouble(const std::vector<T>& value)
+    {
+        m_jsonBuilder.enterArray();
+        for (const T& entry : value)
+        {
+            writeDouble(entry);
+        }
+        m_jsonBuilder.exitArray();
+    }
+
+    void writeArrayString(const std::vector<std::string>& value);
+    void writeArrayBytes(const std::vector<Bytes>& value);
+
+    template<class T>
+    void writeArrayEnum(const std::vector<T>& value)
+    {
+        const MetaEnum& metaEnum = T::enumInfo().getMetaEnum();
+        m_jsonBuilder.enterArray();
+        for (const T& entry : value)
+        {
+            writeEnum(metaEnum, static_cast<std::int32_t>(entry));
+        }
+        m_jsonBuilder.exitArray();
+    }
+
+    template<class T>
+    void writeArrayStruct(const std::vector<T>& value)
+    {
+        m_jsonBuilder.enterArray();
+        for (const T& entry : value)
+        {
+            entry.writeJson(*this);
+        }
+        m_jsonBuilder.exitArray();
+    }
+
+private:
+    JsonBuilder m_jsonBuilder;
+    const bool m_enumAsString;
+};
+
+} // namespace finalmq
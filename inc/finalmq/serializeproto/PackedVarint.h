@@ -0,0 +1,213 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <string.h>
+
+#include "finalmq/helpers/FmqDefines.h"
+
+namespace finalmq
+{
+/**
+ * Bulk kernels for packed repeated varint fields (one tag and one length for the whole array).
+ * The writers calculate the exact size of the payload first, so that the payload is written in
+ * one go into a reserved buffer. The readers count the varints of the payload first (every varint
+ * ends with a byte without the continuation bit), so that the array is resized only once, and they
+ * decode 8 one-byte varints at once, if a whole 64 bit word has no continuation bit set.
+ */
+class PackedVarint
+{
+public:
+    static inline std::size_t sizeVarint(std::uint64_t value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        // (log2 * 9 + 73) / 64 == log2 / 7 + 1 for log2 in [0, 63]
+        const int log2 = 63 - __builtin_clzll(value | 1);
+        return static_cast<std::size_t>((log2 * 9 + 73) / 64);
+#else
+        std::size_t size = 1;
+        while (value >= 0x80)
+        {
+            value >>= 7;
+            ++size;
+        }
+        return size;
+#endif
+    }
+
+    /**
+     * Size of the packed payload. The function toVarint converts an entry into its varint value.
+     */
+    template<class T, class F>
+    static std::size_t sizeArray(const T* value, std::size_t count, F toVarint)
+    {
+        std::size_t size = 0;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            size += sizeVarint(toVarint(value[i]));
+        }
+        return size;
+    }
+
+    /**
+     * Writes the packed payload and returns the end of the written data. The buffer must have
+     * the space of sizeArray().
+     */
+    template<class T, class F>
+    static char* writeArray(char* buffer, const T* value, std::size_t count, F toVarint)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::uint64_t v = toVarint(value[i]);
+            while (v >= 0x80)
+            {
+                *buffer = static_cast<char>(v | 0x80);
+                v >>= 7;
+                ++buffer;
+            }
+            *buffer = static_cast<char>(v);
+            ++buffer;
+        }
+        return buffer;
+    }
+
+    /**
+     * Number of varints in a packed payload.
+     */
+    static inline std::size_t countVarints(const char* buffer, std::size_t size)
+    {
+        std::size_t count = 0;
+        std::size_t i = 0;
+        for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t))
+        {
+            std::uint64_t word;
+            memcpy(&word, buffer + i, sizeof(word));
+            count += popcount(~word & MASK_CONTINUATION);
+        }
+        for (; i < size; ++i)
+        {
+            count += ((buffer[i] & 0x80) == 0) ? 1 : 0;
+        }
+        return count;
+    }
+
+    /**
+     * Decodes a packed payload and appends the entries to value. The function fromVarint converts
+     * a varint value into an entry. Returns false, if the payload is malformed.
+     */
+    template<class T, class F>
+    static bool readArray(const char* buffer, std::size_t size, std::vector<T>& value, F fromVarint)
+    {
+        const std::size_t count = countVarints(buffer, size);
+        const std::size_t offset = value.size();
+        value.resize(offset + count);
+        T* entries = value.data() + offset;
+        const char* end = buffer + size;
+        std::size_t i = 0;
+        while (i < count)
+        {
+            if (count - i >= 8 && end - buffer >= 8)
+            {
+                std::uint64_t word;
+                memcpy(&word, buffer, sizeof(word));
+                if ((word & MASK_CONTINUATION) == 0)
+                {
+                    for (int n = 0; n < 8; ++n)
+                    {
+                        entries[i + n] = fromVarint(static_cast<std::uint8_t>(buffer[n]));
+                    }
+                    buffer += 8;
+                    i += 8;
+                    continue;
+                }
+            }
+            std::uint64_t v = 0;
+            if (!readVarint(buffer, end, v))
+            {
+                value.resize(offset);
+                return false;
+            }
+            entries[i] = fromVarint(v);
+            ++i;
+        }
+        if (buffer != end)
+        {
+            value.resize(offset);
+            return false;
+        }
+        return true;
+    }
+
+    template<class F>
+    static bool readArray(const char* buffer, std::size_t size, std::vector<bool>& value, F fromVarint)
+    {
+        const char* end = buffer + size;
+        value.reserve(value.size() + countVarints(buffer, size));
+        while (buffer != end)
+        {
+            std::uint64_t v = 0;
+            if (!readVarint(buffer, end, v))
+            {
+                return false;
+            }
+            value.push_back(fromVarint(v));
+        }
+        return true;
+    }
+
+private:
+    static constexpr std::uint64_t MASK_CONTINUATION = 0x8080808080808080ull;
+
+    static inline int popcount(std::uint64_t value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcountll(value);
+#else
+        value = value - ((value >> 1) & 0x5555555555555555ull);
+        value = (value & 0x3333333333333333ull) + ((value >> 2) & 0x3333333333333333ull);
+        value = (value + (value >> 4)) & 0x0f0f0f0f0f0f0f0full;
+        return static_cast<int>((value * 0x0101010101010101ull) >> 56);
+#endif
+    }
+
+    static inline bool readVarint(const char*& buffer, const char* end, std::uint64_t& value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 70 && buffer != end; shift += 7)
+        {
+            const std::uint64_t c = static_cast<std::uint8_t>(*buffer);
+            ++buffer;
+            value |= (c & 0x7f) << shift;
+            if (c < 0x80)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+} // namespace finalmq
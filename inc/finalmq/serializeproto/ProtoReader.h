@@ -0,0 +1,336 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "finalmq/helpers/FmqDefines.h"
+#include "finalmq/helpers/MonotonicArena.h"
+#include "finalmq/metadata/MetaEnum.h"
+#include "finalmq/serializeproto/PackedVarint.h"
+
+namespace finalmq
+{
+/**
+ * Reader for the code generated proto parsers (see StructBase::parseProto()). It accepts
+ * the same encodings as ParserProto, but it is strict: every read returns false, if the
+ * data is corrupt or if it is not encoded the way SerializerProto would encode it (e.g. a
+ * wire type that does not match the field). The caller shall then parse the data again
+ * with ParserProto.
+ */
+class SYMBOLEXP ProtoReader
+{
+public:
+    enum WireType
+    {
+        WIRETYPE_VARINT = 0,
+        WIRETYPE_FIXED64 = 1,
+        WIRETYPE_LENGTH_DELIMITED = 2,
+        WIRETYPE_FIXED32 = 5,
+    };
+
+    ProtoReader(const char* buffer, ssize_t size);
+
+    inline bool hasData() const
+    {
+        return (m_tagNext != 0 || m_size > 0);
+    }
+
+    bool readTag(std::uint32_t& tag);
+    bool skip(std::uint32_t tag);
+
+    /**
+     * Reads a varint or a fixed value into the parse type P and casts it to the field type T.
+     */
+    template<class P, class T>
+    bool readValue(std::uint32_t tag, T& value, bool zz)
+    {
+        P v = 0;
+        switch (tag & 0x7)
+        {
+            case WIRETYPE_VARINT:
+            {
+                std::uint64_t varint = 0;
+                if (!readVarint(varint))
+                {
+                    return false;
+                }
+                v = static_cast<P>(varint);
+                if (zz)
+                {
+                    v = static_cast<P>(zigzag(static_cast<std::uint64_t>(v)));
+                }
+            }
+            break;
+            case WIRETYPE_FIXED32:
+            {
+                std::uint32_t fixed = 0;
+                if (!readFixed(fixed))
+                {
+                    return false;
+                }
+                v = static_cast<P>(fixed);
+            }
+            break;
+            case WIRETYPE_FIXED64:
+            {
+                std::uint64_t fixed = 0;
+                if (!readFixed(fixed))
+                {
+                    return false;
+                }
+                v = static_cast<P>(fixed);
+            }
+            break;
+            default:
+                return false;
+        }
+        value = static_cast<T>(v);
+        return true;
+    }
+
+    template<class T>
+    bool readFixed(std::uint32_t tag, T& value)
+    {
+        const std::uint32_t wireType = (sizeof(T) == 4) ? WIRETYPE_FIXED32 : WIRETYPE_FIXED64;
+        if ((tag & 0x7) != wireType)
+        {
+            return false;
+        }
+        return readFixed(value);
+    }
+
+    template<class T>
+    bool readString(std::uint32_t tag, T& value)
+    {
+        const char* buffer = nullptr;
+        ssize_t size = 0;
+        if (!readLengthDelimited(tag, buffer, size))
+        {
+            return false;
+        }
+        value.assign(buffer, buffer + size);
+        return true;
+    }
+
+    template<class T>
+    bool readEnum(std::uint32_t tag, T& value)
+    {
+        std::int32_t v = 0;
+        if (!readValue<std::int32_t>(tag, v, false))
+        {
+            return false;
+        }
+        if (!T::enumInfo().getMetaEnum().isId(v))
+        {
+            v = 0;
+        }
+        value = static_cast<typename T::Enum>(v);
+        return true;
+    }
+
+    template<class T>
+    bool readStruct(std::uint32_t tag, T& value)
+    {
+        const char* buffer = nullptr;
+        ssize_t size = 0;
+        if (!readLengthDelimited(tag, buffer, size))
+        {
+            return false;
+        }
+        ProtoReader reader(buffer, size);
+        return value.readProto(reader);
+    }
+
+    template<class T>
+    bool readStructNullable(std::uint32_t tag, std::shared_ptr<T>& value)
+    {
+        if (!value)
+        {
+            value = makeSharedInArena<T>();
+        }
+        return readStruct(tag, *value);
+    }
+
+    template<class T>
+    bool readArrayStruct(std::uint32_t tag, std::vector<T>& value)
+    {
+        value.emplace_back();
+        return readStruct(tag, value.back());
+    }
+
+    /**
+     * Reads a packed array or a sequence of fixed values of the same tag. The array replaces
+     * the content of the field.
+     */
+    template<class P, class T>
+    bool readArrayFixed(std::uint32_t tag, std::vector<T>& value)
+    {
+        const std::uint32_t wireType = (sizeof(P) == 4) ? WIRETYPE_FIXED32 : WIRETYPE_FIXED64;
+        value.clear();
+        if ((tag & 0x7) == WIRETYPE_LENGTH_DELIMITED)
+        {
+            const char* buffer = nullptr;
+            ssize_t size = 0;
+            if (!readLengthDelimited(tag, buffer, size))
+            {
+                return false;
+            }
+            const ssize_t count = size / static_cast<ssize_t>(sizeof(P));
+            value.reserve(count);
+            for (ssize_t i = 0; i < count; ++i)
+            {
+                P v;
+                EndianHelper<static_cast<int>(sizeof(P))>::read(buffer + i * sizeof(P), v);
+                value.push_back(static_cast<T>(v));
+            }
+            return true;
+        }
+        if ((tag & 0x7) != wireType)
+        {
+            return false;
+        }
+        do
+        {
+            P v;
+            if (!readFixed(v))
+            {
+                return false;
+            }
+            value.push_back(static_cast<T>(v));
+        } while (nextTagIs(tag));
+        return (m_ptr != nullptr);
+    }
+
+    /**
+     * Reads a packed array or a sequence of varints of the same tag. The array replaces
+     * the content of the field.
+     */
+    template<class P, class T>
+    bool readArrayVarint(std::uint32_t tag, std::vector<T>& value, bool zz)
+    {
+        value.clear();
+        if ((tag & 0x7) == WIRETYPE_LENGTH_DELIMITED)
+        {
+            const char* buffer = nullptr;
+            ssize_t size = 0;
+            if (!readLengthDelimited(tag, buffer, size))
+            {
+                return false;
+            }
+            return PackedVarint::readArray(buffer, size, value, [zz](std::uint64_t v) {
+                return static_cast<T>(convertVarint<P>(v, zz));
+            });
+        }
+        if ((tag & 0x7) != WIRETYPE_VARINT)
+        {
+            return false;
+        }
+        do
+        {
+            std::uint64_t v = 0;
+            if (!readVarint(v))
+            {
+                return false;
+            }
+            value.push_back(static_cast<T>(convertVarint<P>(v, zz)));
+        } while (nextTagIs(tag));
+        return (m_ptr != nullptr);
+    }
+
+    template<class T>
+    bool readArrayEnum(std::uint32_t tag, std::vector<T>& value)
+    {
+        std::vector<std::int32_t> values;
+        if (!readArrayVarint<std::int32_t>(tag, values, false))
+        {
+            return false;
+        }
+        const MetaEnum& metaEnum = T::enumInfo().getMetaEnum();
+        value.clear();
+        value.reserve(values.size());
+        for (std::int32_t v : values)
+        {
+            value.emplace_back(static_cast<typename T::Enum>(metaEnum.isId(v) ? v : 0));
+        }
+        return true;
+    }
+
+    /**
+     * Reads a sequence of strings of the same tag. The array replaces the content of the field.
+     */
+    template<class T>
+    bool readArrayString(std::uint32_t tag, std::vector<T>& value)
+    {
+        value.clear();
+        do
+        {
+            const char* buffer = nullptr;
+            ssize_t size = 0;
+            if (!readLengthDelimited(tag, buffer, size))
+            {
+                return false;
+            }
+            value.emplace_back(buffer, buffer + size);
+        } while (nextTagIs(tag));
+        return (m_ptr != nullptr);
+    }
+
+private:
+    template<class P>
+    static P convertVarint(std::uint64_t value, bool zz)
+    {
+        return zz ? static_cast<P>(zigzag(value)) : static_cast<P>(value);
+    }
+
+    static inline std::int64_t zigzag(std::uint64_t value)
+    {
+        return static_cast<std::int64_t>((value >> 1) ^ (~(value & 1) + 1));
+    }
+
+    bool readVarint(std::uint64_t& value);
+    bool readLengthDelimited(std::uint32_t tag, const char*& buffer, ssize_t& size);
+    bool nextTagIs(std::uint32_t tag);
+
+    template<class T>
+    bool readFixed(T& value)
+    {
+        if (m_size < static_cast<ssize_t>(sizeof(T)))
+        {
+            return false;
+        }
+        EndianHelper<static_cast<int>(sizeof(T))>::read(m_ptr, value);
+        m_ptr += sizeof(T);
+        m_size -= sizeof(T);
+        return true;
+    }
+
+    const char* m_ptr{nullptr};
+    ssize_t m_size{0};
+    std::uint32_t m_tagNext{0};
+};
+
+} // namespace finalmq
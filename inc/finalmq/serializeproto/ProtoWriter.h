@@ -0,0 +1,412 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <assert.h>
+#include <string.h>
+
+#include "finalmq/helpers/FmqDefines.h"
+#include "finalmq/helpers/IZeroCopyBuffer.h"
+#include "finalmq/serializeproto/PackedVarint.h"
+
+namespace finalmq
+{
+/**
+ * Writer for the code generated proto serializers (see StructBase::serializeProto()).
+ * The generated code runs two passes: the first pass calculates the size of the message
+ * and the sizes of all sub structs, so that the second pass can write the whole message
+ * into one buffer without any resizing or moving of already written data. The encoding
+ * is the same as the one of SerializerProto.
+ */
+class SYMBOLEXP ProtoWriter
+{
+public:
+    enum WireType
+    {
+        WIRETYPE_VARINT = 0,
+        WIRETYPE_FIXED64 = 1,
+        WIRETYPE_LENGTH_DELIMITED = 2,
+        WIRETYPE_FIXED32 = 5,
+    };
+
+    static inline std::size_t sizeVarint(std::uint64_t value)
+    {
+        return PackedVarint::sizeVarint(value);
+    }
+
+    static inline std::uint64_t zigzag(std::int64_t value)
+    {
+        return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+    }
+
+    ////////////////////////////////////////////
+    // size calculation
+
+    static inline std::size_t sizeVarintField(std::uint32_t tag, std::uint64_t value)
+    {
+        return (value != 0) ? (sizeVarint(tag) + sizeVarint(value)) : 0;
+    }
+
+    static inline std::size_t sizeZigZagField(std::uint32_t tag, std::int64_t value)
+    {
+        return (value != 0) ? (sizeVarint(tag) + sizeVarint(zigzag(value))) : 0;
+    }
+
+    template<class T>
+    static std::size_t sizeFixedField(std::uint32_t tag, T value)
+    {
+#ifndef WIN32
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfloat-equal"
+#endif
+        return (value != 0) ? (sizeVarint(tag) + sizeof(T)) : 0;
+#ifndef WIN32
+#pragma GCC diagnostic pop
+#endif
+    }
+
+    static inline std::size_t sizeStringField(std::uint32_t tag, std::size_t size)
+    {
+        return (size != 0) ? (sizeVarint(tag) + sizeVarint(size) + size) : 0;
+    }
+
+    template<class T>
+    static std::size_t sizeArrayFixed(std::uint32_t tag, std::size_t count)
+    {
+        return (count != 0) ? (sizeVarint(tag) + sizeVarint(count * sizeof(T)) + count * sizeof(T)) : 0;
+    }
+
+    static inline std::size_t sizeArrayBool(std::uint32_t tag, std::size_t count)
+    {
+        return (count != 0) ? (sizeVarint(tag) + sizeVarint(count) + count) : 0;
+    }
+
+    /**
+     * The repeated varint fields are packed: the tag of the field (with any wire type) is
+     * written once with the wire type length delimited.
+     */
+    static inline std::uint32_t packedTag(std::uint32_t tag)
+    {
+        return (tag & ~static_cast<std::uint32_t>(0x7)) | WIRETYPE_LENGTH_DELIMITED;
+    }
+
+    static inline std::size_t sizePacked(std::uint32_t tag, std::size_t sizeByte)
+    {
+        return (sizeByte != 0) ? (sizeVarint(packedTag(tag)) + sizeVarint(sizeByte) + sizeByte) : 0;
+    }
+
+    template<class T>
+    static std::size_t sizeArrayVarint(std::uint32_t tag, const std::vector<T>& value)
+    {
+        return sizePacked(tag, PackedVarint::sizeArray(value.data(), value.size(), toVarint<T>));
+    }
+
+    template<class T>
+    static std::size_t sizeArrayZigZag(std::uint32_t tag, const std::vector<T>& value)
+    {
+        return sizePacked(tag, PackedVarint::sizeArray(value.data(), value.size(), toZigZag<T>));
+    }
+
+    template<class T>
+    static std::size_t sizeArrayEnum(std::uint32_t tag, const std::vector<T>& value)
+    {
+        return sizePacked(tag, PackedVarint::sizeArray(value.data(), value.size(), toEnumVarint<T>));
+    }
+
+    template<class T>
+    static std::size_t sizeArrayString(std::uint32_t tag, const std::vector<T>& value)
+    {
+        std::size_t size = value.size() * sizeVarint(tag);
+        for (const T& entry : value)
+        {
+            size += sizeVarint(entry.size()) + entry.size();
+        }
+        return size;
+    }
+
+    template<class T>
+    std::size_t sizeStruct(std::uint32_t tag, const T& value, bool arrayEntry)
+    {
+        const std::size_t index = reserveStructSize();
+        const std::size_t size = value.sizeProto(*this);
+        setStructSize(index, size);
+        return sizeStructField(tag, size, arrayEntry);
+    }
+
+    static inline std::size_t sizeStructField(std::uint32_t tag, std::size_t size, bool arrayEntry)
+    {
+        return (size != 0 || arrayEntry) ? (sizeVarint(tag) + sizeVarint(size) + size) : 0;
+    }
+
+    /**
+     * The sizes of the sub structs are stored in the order of the size pass, which must be
+     * the order of the write pass. A sub struct reserves its entry before its own sub structs
+     * are calculated.
+     */
+    inline std::size_t reserveStructSize()
+    {
+        m_structSizes.push_back(0);
+        return m_structSizes.size() - 1;
+    }
+
+    inline void setStructSize(std::size_t index, std::size_t size)
+    {
+        assert(index < m_structSizes.size());
+        m_structSizes[index] = size;
+    }
+
+    template<class T>
+    std::size_t sizeStructNullable(std::uint32_t tag, const std::shared_ptr<T>& value)
+    {
+        return value ? sizeStruct(tag, *value, false) : 0;
+    }
+
+    template<class T>
+    std::size_t sizeArrayStruct(std::uint32_t tag, const std::vector<T>& value)
+    {
+        std::size_t size = 0;
+        for (const T& entry : value)
+        {
+            size += sizeStruct(tag, entry, true);
+        }
+        return size;
+    }
+
+    ////////////////////////////////////////////
+    // writing
+
+    /**
+     * Reserves the buffer for the whole message. The size must be the one that was calculated
+     * by the size pass.
+     */
+    void startWrite(IZeroCopyBuffer& buffer, std::size_t size);
+
+    /**
+     * Checks that the message was written exactly with the calculated size.
+     */
+    void finished();
+
+    inline void writeVarint(std::uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            *m_buffer = static_cast<char>(value | 0x80);
+            value >>= 7;
+            ++m_buffer;
+        }
+        *m_buffer = static_cast<char>(value);
+        ++m_buffer;
+    }
+
+    inline void writeVarintField(std::uint32_t tag, std::uint64_t value)
+    {
+        if (value != 0)
+        {
+            writeVarint(tag);
+            writeVarint(value);
+        }
+    }
+
+    inline void writeZigZagField(std::uint32_t tag, std::int64_t value)
+    {
+        if (value != 0)
+        {
+            writeVarint(tag);
+            writeVarint(zigzag(value));
+        }
+    }
+
+    template<class T>
+    void writeFixedField(std::uint32_t tag, T value)
+    {
+#ifndef WIN32
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfloat-equal"
+#endif
+        if (value != 0)
+#ifndef WIN32
+#pragma GCC diagnostic pop
+#endif
+        {
+            writeVarint(tag);
+            EndianHelper<static_cast<int>(sizeof(T))>::write(m_buffer, value);
+            m_buffer += sizeof(T);
+        }
+    }
+
+    inline void writeStringField(std::uint32_t tag, const char* value, std::size_t size)
+    {
+        if (size != 0)
+        {
+            writeLengthDelimited(tag, value, size);
+        }
+    }
+
+    template<class T, class D>
+    void writeArrayFixed(std::uint32_t tag, const std::vector<D>& value)
+    {
+        if (value.empty())
+        {
+            return;
+        }
+        const std::size_t sizeByte = value.size() * sizeof(T);
+        writeVarint(tag);
+        writeVarint(sizeByte);
+#ifdef FINALMQ_LITTLE_ENDIAN
+        if (std::is_same<T, D>::value)
+        {
+            memcpy(m_buffer, value.data(), sizeByte);
+            m_buffer += sizeByte;
+            return;
+        }
+#endif
+        for (const D& entry : value)
+        {
+            EndianHelper<static_cast<int>(sizeof(T))>::write(m_buffer, static_cast<T>(entry));
+            m_buffer += sizeof(T);
+        }
+    }
+
+    void writeArrayBool(std::uint32_t tag, const std::vector<bool>& value);
+
+    template<class T>
+    void writeArrayVarint(std::uint32_t tag, const std::vector<T>& value)
+    {
+        writePacked(tag, value, toVarint<T>);
+    }
+
+    template<class T>
+    void writeArrayZigZag(std::uint32_t tag, const std::vector<T>& value)
+    {
+        writePacked(tag, value, toZigZag<T>);
+    }
+
+    template<class T>
+    void writeArrayEnum(std::uint32_t tag, const std::vector<T>& value)
+    {
+        writePacked(tag, value, toEnumVarint<T>);
+    }
+
+    template<class T>
+    void writeArrayString(std::uint32_t tag, const std::vector<T>& value)
+    {
+        for (const T& entry : value)
+        {
+            writeLengthDelimited(tag, entry.data(), entry.size());
+        }
+    }
+
+    template<class T>
+    void writeStruct(std::uint32_t tag, const T& value, bool arrayEntry)
+    {
+        writeStructHeader(tag, arrayEntry);
+        // also an empty struct is visited to keep the order of the sub struct sizes
+        value.writeProto(*this);
+    }
+
+    /**
+     * Writes tag and length of the next sub struct, if the struct is not omitted.
+     * The caller writes the fields of the struct afterwards.
+     */
+    inline void writeStructHeader(std::uint32_t tag, bool arrayEntry)
+    {
+        assert(m_indexStruct < m_structSizes.size());
+        const std::size_t size = m_structSizes[m_indexStruct];
+        ++m_indexStruct;
+        if (size != 0 || arrayEntry)
+        {
+            writeVarint(tag);
+            writeVarint(size);
+        }
+    }
+
+    template<class T>
+    void writeStructNullable(std::uint32_t tag, const std::shared_ptr<T>& value)
+    {
+        if (value)
+        {
+            writeStruct(tag, *value, false);
+        }
+    }
+
+    template<class T>
+    void writeArrayStruct(std::uint32_t tag, const std::vector<T>& value)
+    {
+        for (const T& entry : value)
+        {
+            writeStruct(tag, entry, true);
+        }
+    }
+
+private:
+    template<class T>
+    static inline std::uint64_t toVarint(const T& entry)
+    {
+        return static_cast<std::uint64_t>(entry);
+    }
+
+    template<class T>
+    static inline std::uint64_t toZigZag(const T& entry)
+    {
+        return zigzag(static_cast<std::int64_t>(entry));
+    }
+
+    template<class T>
+    static inline std::uint64_t toEnumVarint(const T& entry)
+    {
+        return static_cast<std::uint64_t>(static_cast<std::int32_t>(entry));
+    }
+
+    template<class T, class F>
+    void writePacked(std::uint32_t tag, const std::vector<T>& value, F toVarintEntry)
+    {
+        if (value.empty())
+        {
+            return;
+        }
+        writeVarint(packedTag(tag));
+        writeVarint(PackedVarint::sizeArray(value.data(), value.size(), toVarintEntry));
+        m_buffer = PackedVarint::writeArray(m_buffer, value.data(), value.size(), toVarintEntry);
+    }
+
+    inline void writeLengthDelimited(std::uint32_t tag, const char* value, std::size_t size)
+    {
+        writeVarint(tag);
+        writeVarint(size);
+        memcpy(m_buffer, value, size);
+        m_buffer += size;
+    }
+
+    std::vector<std::size_t> m_structSizes{};
+    std::size_t m_indexStruct{0};
+    char* m_buffer{nullptr};
+    char* m_bufferEnd{nullptr};
+};
+
+} // namespace finalmq
@@ -0,0 +1,84 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "finalmq/helpers/IZeroCopyBuffer.h"
+#include "finalmq/serializeproto/ProtoWriter.h"
+#include "finalmq/serializestruct/StructBase.h"
+
+namespace finalmq
+{
+/**
+ * Reflective proto serializer for a StructBase, which does not need the visitor chain of
+ * ParserStruct + SerializerProto. It runs two passes like the code generated serializers:
+ * the first pass calculates the sizes of the message and of all sub structs, the second pass
+ * writes the message into one exactly sized buffer. So, nested structs are written without
+ * reserving space for their lengths and without moving their data afterwards.
+ */
+class SYMBOLEXP SerializerProtoSized
+{
+public:
+    SerializerProtoSized(IZeroCopyBuffer& buffer);
+
+    /**
+     * Returns false, without writing anything, if the struct contains fields that are only
+     * supported by SerializerProto (variants, index fields and the "abortstruct" attribute).
+     */
+    bool serializeStruct(const StructBase& structBase);
+
+private:
+    std::size_t sizeStruct(const StructBase& structBase);
+    std::size_t sizeField(const StructBase& structBase, const FieldInfo& fieldInfo);
+    std::size_t sizeSubStruct(const MetaField& field, const StructBase& structBase, bool arrayEntry);
+    void writeStruct(const StructBase& structBase);
+    void writeField(const StructBase& structBase, const FieldInfo& fieldInfo);
+    void writeSubStruct(const MetaField& field, const StructBase& structBase, bool arrayEntry);
+
+    template<class F, class T>
+    std::size_t sizeSigned(const MetaField& field, T value);
+    template<class F, class T>
+    std::size_t sizeUnsigned(const MetaField& field, T value);
+    template<class F, class T>
+    std::size_t sizeArraySigned(const MetaField& field, const std::vector<T>& value);
+    template<class F, class T>
+    std::size_t sizeArrayUnsigned(const MetaField& field, const std::vector<T>& value);
+    template<class F, class T>
+    void writeSigned(const MetaField& field, T value);
+    template<class F, class T>
+    void writeUnsigned(const MetaField& field, T value);
+    template<class F, class T>
+    void writeArraySigned(const MetaField& field, const std::vector<T>& value);
+    template<class F, class T>
+    void writeArrayUnsigned(const MetaField& field, const std::vector<T>& value);
+
+    IZeroCopyBuffer& m_buffer;
+    ProtoWriter m_writer{};
+    std::vector<std::string> m_jsonStrings{};
+    std::size_t m_indexJson = 0;
+    bool m_supported = true;
+};
+
+} // namespace finalmq
@@ -38,6 +38,13 @@ public:
     SerializerStruct(StructBase& root);
     void setExitNotification(std::function<void()> funcExit);
 
+    /**
+     * Fields with the flag METAFLAG_ZEROCOPY reference the buffer instead of copying the data,
+     * if the parser passes data that lies inside of the buffer (e.g. ParserProto, which parses
+     * the buffer). Other data is copied into the view.
+     */
+    void setZeroCopyBuffer(const std::shared_ptr<const std::string>& buffer);
+
 private:
     SerializerStruct(const SerializerStruct&) = delete;
     SerializerStruct(SerializerStruct&&) = delete;
@@ -129,6 +136,14 @@ private:
 
     void setValueString(const MetaField& field, const char* value, ssize_t size);
 
+    void setValueView(StructBase& structBase, const FieldInfo& fieldInfoDest, const char* value, ssize_t size);
+    void setValueView(StructBase& structBase, const FieldInfo& fieldInfoDest, const std::string& value);
+    void setValueView(StructBase& structBase, const FieldInfo& fieldInfoDest, const Bytes& value);
+    template<class T>
+    void setValueView(StructBase& /*structBase*/, const FieldInfo& /*fieldInfoDest*/, const T& /*value*/)
+    {
+    }
+
     template<class T>
     void setValueArrayNumber(const MetaField& field, const T* value, ssize_t size);
     template<class T>
@@ -153,6 +168,7 @@ private:
     bool m_wasStartStructCalled = false;
     Variant m_variantDummy{};
     IParserVisitor* m_visitor = nullptr;
+    std::shared_ptr<const std::string> m_zeroCopyBuffer{};
 };
 
 } // namespace finalmq
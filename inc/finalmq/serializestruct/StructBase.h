@@ -28,6 +28,8 @@
 
 #include <assert.h>
 
+#include "finalmq/helpers/BytesView.h"
+#include "finalmq/helpers/MonotonicArena.h"
 #include "finalmq/metadata/MetaEnum.h"
 #include "finalmq/metadata/MetaField.h"
 #include "finalmq/metadata/MetaStruct.h"
@@ -36,6 +38,7 @@
 namespace finalmq
 {
 class StructBase;
+struct IZeroCopyBuffer;
 typedef std::shared_ptr<StructBase> StructBasePtr;
 
 struct IArrayStructAdapter
@@ -87,7 +90,7 @@ private:
     // IStructPtrAdapter
     virtual StructBasePtr create() const override
     {
-        return std::make_shared<T>();
+        return makeSharedInArena<T>();
     }
 };
 
@@ -203,7 +206,7 @@ public:
     T* getData(const FieldInfo& fieldInfo)
     {
         const MetaField* fieldDest = fieldInfo.getField();
-        if (fieldDest)
+        if (fieldDest && !isZeroCopyField(*fieldDest))
         {
             if (((fieldDest->typeId == MetaTypeInfo<T>::TypeId) || (fieldDest->typeId == MetaTypeId::TYPE_STRUCT && MetaTypeInfo<T>::TypeId == MetaTypeId::TYPE_JSON))
                || ((MetaTypeInfo<T>::TypeId == MetaTypeInfo<std::int32_t>::TypeId) && (fieldDest->typeId == MetaTypeId::TYPE_ENUM))
@@ -216,6 +219,24 @@ public:
         return nullptr;
     }
 
+    static inline bool isZeroCopyField(const MetaField& field)
+    {
+        return (field.flags & METAFLAG_ZEROCOPY) && (field.typeId == MetaTypeId::TYPE_STRING || field.typeId == MetaTypeId::TYPE_BYTES);
+    }
+
+    /**
+     * Returns the view of a string or bytes field with the flag METAFLAG_ZEROCOPY, otherwise nullptr.
+     */
+    BytesView* getDataView(const FieldInfo& fieldInfo)
+    {
+        const MetaField* fieldDest = fieldInfo.getField();
+        if (fieldDest && isZeroCopyField(*fieldDest))
+        {
+            return reinterpret_cast<BytesView*>(reinterpret_cast<char*>(this) + fieldInfo.getOffset());
+        }
+        return nullptr;
+    }
+
     template<class T>
     const T& getValue(const FieldInfo& fieldInfo) const
     {
@@ -227,6 +248,35 @@ public:
     virtual const StructInfo& getStructInfo() const = 0;
     virtual std::shared_ptr<StructBase> clone() const = 0;
 
+    /**
+     * Code generated serializers and parsers, which do not need the visitor chain of
+     * the reflective serializers (e.g. SerializerProto + ParserStruct). They produce the
+     * same data as the reflective ones. A return value of false (or nullptr) means that
+     * the struct (or the data) is not supported by the generated code, the caller shall
+     * fall back to the reflective serializers. After a failed parse the struct can be
+     * partially filled.
+     */
+    virtual bool serializeProto(IZeroCopyBuffer& /*buffer*/) const
+    {
+        return false;
+    }
+    virtual bool parseProto(const char* /*buffer*/, ssize_t /*size*/)
+    {
+        return false;
+    }
+    virtual bool serializeJson(IZeroCopyBuffer& /*buffer*/, int /*maxBlockSize*/, bool /*enumAsString*/, bool /*skipDefaultValues*/) const
+    {
+        return false;
+    }
+    /**
+     * Returns the position after the parsed json object (like ParserJson::parseStruct())
+     * or nullptr.
+     */
+    virtual const char* parseJson(const char* /*buffer*/, ssize_t /*size*/)
+    {
+        return nullptr;
+    }
+
 private:
     struct RawData
     {
@@ -75,6 +75,8 @@ struct IMessage : public IZeroCopyBuffer
     virtual char* resizeReceiveBuffer(ssize_t size) = 0;
     virtual void setReceiveBuffer(const std::shared_ptr<std::string>& receiveBuffer, ssize_t offset, ssize_t size) = 0;
     virtual void setHeaderSize(ssize_t sizeHeader) = 0;
+    // the buffer behind getReceiveHeader() and getReceivePayload(), parsed structs can keep a reference to it (zero copy)
+    virtual const std::shared_ptr<std::string>& getReceiveBuffer() const = 0;
 
     // for the framework
     virtual const std::list<BufferRef>& getAllSendBuffers() const = 0;
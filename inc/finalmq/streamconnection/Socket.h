@@ -29,9 +29,11 @@
 #include "OpenSsl.h"
 #include "finalmq/helpers/OperatingSystem.h"
 #include "finalmq/helpers/SocketDescriptor.h"
+#include "finalmq/streamconnection/IMessage.h"
 
 #if !defined(WIN32) && !defined(__MINGW32__)
 #include <netdb.h>
+#include <sys/uio.h>
 #endif
 
 namespace finalmq
@@ -58,7 +60,23 @@ public:
     int bind(const sockaddr* addr, int namelen);
     int listen(int backlog);
     int send(const char* buf, int len, int flags = 0);
+    /**
+     * Sends all buffers with one gather write (sendmsg). SSL sockets and platforms without
+     * sendmsg fall back to one send per buffer. Returns the number of bytes written, 0 if
+     * the socket would block and -1 on error.
+     */
+    int sendVector(const BufferRef* buffers, int count, int flags = 0);
     int receive(char* buf, int len, int flags = 0);
+    /**
+     * Reads up to PREFETCH_SIZE bytes into a small internal buffer, without asking for the
+     * number of pending bytes (FIONREAD). Only if this buffer was filled, the pending bytes
+     * are asked for, and the following receive calls read them straight into the buffer
+     * of the caller. The prefetched bytes are served first. Returns the number of bytes
+     * that can be received (see getPrefetched()), 0 if the socket would block and -1 if
+     * the peer closed the connection or on error. Not for SSL sockets.
+     */
+    int prefetch();
+    int getPrefetched() const;
     void destroy();
     void attach(SOCKET sd);
     int pendingRead() const;
@@ -78,6 +96,14 @@ private:
     int m_af = 0;
     int m_protocol = 0;
     std::string m_name{};
+    static const int PREFETCH_SIZE = 2048;
+    std::unique_ptr<char[]> m_prefetchBuffer{};
+    int m_prefetchBegin = 0;
+    int m_prefetchEnd = 0;
+    int m_pendingAfterPrefetch = 0;
+#if !defined(WIN32) && !defined(__MINGW32__)
+    std::vector<struct iovec> m_ioVecs{};
+#endif
 
 #ifdef USE_OPENSSL
 public:
@@ -49,6 +49,7 @@ struct BindProperties
     CertificateData certificateData{};
     Variant protocolData{};
     Variant formatData{}; ///< data for the serialization format
+    bool reusePort = false; ///< with several poller loops: each poller loop gets its own listening socket (SO_REUSEPORT), the kernel distributes the incoming connections
 };
 
 struct ConnectConfig
@@ -143,12 +144,19 @@ private:
         int offset = 0;
     };
 
+    // gather write helpers, the mutex must be locked by the caller
+    bool addSendVector(const MessageSendState& messageSendState);
+    static bool advanceSendState(MessageSendState& messageSendState, ssize_t& bytesWritten);
+    int sendVector();
+
     const std::int64_t m_connectionId = 0;
     ConnectionData m_connectionData{};
     SocketPtr m_socketPrivate{};
     SocketPtr m_socket{};
     const IPollerPtr m_poller{};
     std::list<MessageSendState> m_pendingMessages{};
+    std::vector<BufferRef> m_sendVector{};
+    ssize_t m_sendVectorSize = 0;
     std::atomic<bool> m_disconnectFlag{};
     hybrid_ptr<IStreamConnectionCallback> m_callback{};
 
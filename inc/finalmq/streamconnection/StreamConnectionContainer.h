@@ -45,7 +45,12 @@ struct IStreamConnectionContainer
     virtual ~IStreamConnectionContainer()
     {}
 
-    virtual void init(int cycleTime = 100, FuncPollerLoopTimer funcTimer = {}, int checkReconnectInterval = 1000) = 0;
+    /**
+     * Each poller loop checks the reconnects of its own connections every checkReconnectInterval.
+     * The funcTimer is called once per cycleTime in the first poller loop, it is a timer of the
+     * whole container and not of a poller loop.
+     */
+    virtual void init(int cycleTime = 100, FuncPollerLoopTimer funcTimer = {}, int checkReconnectInterval = 1000, int numberOfPollerLoops = 1, ReceiveMode receiveMode = ReceiveMode::RECEIVEMODE_PENDINGREAD) = 0;
     virtual int bind(const std::string& endpoint, hybrid_ptr<IStreamConnectionCallback> callback, const BindProperties& bindProperties = {}) = 0;
     virtual void unbind(const std::string& endpoint) = 0;
     virtual IStreamConnectionPtr connect(const std::string& endpoint, hybrid_ptr<IStreamConnectionCallback> callback, const ConnectProperties& connectionProperties = {}) = 0;
@@ -56,6 +61,7 @@ struct IStreamConnectionContainer
     virtual void run() = 0;
     virtual void terminatePollerLoop() = 0;
     virtual IExecutorPtr getPollerThreadExecutor() const = 0;
+    virtual IExecutorPtr getPollerThreadExecutor(std::int64_t connectionId) const = 0;
 };
 
 class SYMBOLEXP StreamConnectionContainer : public IStreamConnectionContainer
@@ -70,7 +76,7 @@ public:
 
 private:
     // IStreamConnectionContainer
-    virtual void init(int cycleTime = 100, FuncPollerLoopTimer funcTimer = {}, int checkReconnectInterval = 1000) override;
+    virtual void init(int cycleTime = 100, FuncPollerLoopTimer funcTimer = {}, int checkReconnectInterval = 1000, int numberOfPollerLoops = 1, ReceiveMode receiveMode = ReceiveMode::RECEIVEMODE_PENDINGREAD) override;
     virtual int bind(const std::string& endpoint, hybrid_ptr<IStreamConnectionCallback> callback, const BindProperties& bindProperties = {}) override;
     virtual void unbind(const std::string& endpoint) override;
     virtual IStreamConnectionPtr connect(const std::string& endpoint, hybrid_ptr<IStreamConnectionCallback> callback, const ConnectProperties& connectionProperties = {}) override;
@@ -81,56 +87,78 @@ private:
     virtual void run() override;
     virtual void terminatePollerLoop() override;
     virtual IExecutorPtr getPollerThreadExecutor() const override;
+    virtual IExecutorPtr getPollerThreadExecutor(std::int64_t connectionId) const override;
 
-    void pollerLoop();
+#ifdef USE_OPENSSL
+    struct SslAcceptingData
+    {
+        SocketPtr socket;
+        ConnectionData connectionData;
+        hybrid_ptr<IStreamConnectionCallback> callback;
+    };
+#endif
+
+    // Each poller loop runs in its own thread with its own poller. A connection belongs to exactly one poller loop.
+    struct PollerLoop
+    {
+        std::shared_ptr<IPoller> poller{};
+        IExecutorPtr executorPollerThread{};
+        std::unordered_map<SOCKET, IStreamConnectionPrivatePtr> sd2Connection{};            // protected by m_mutex
+        std::unordered_map<SOCKET, IStreamConnectionPrivatePtr> sd2ConnectionPollerLoop{};  // only used at poller loop thread
+        std::atomic_flag connectionsStable{};
+        int numberOfConnections = 0;                                                        // protected by m_mutex
+#ifdef USE_OPENSSL
+        std::unordered_map<SOCKET, SslAcceptingData> sslAcceptings{};                       // only used at poller loop thread
+#endif
+        std::chrono::time_point<std::chrono::steady_clock> lastReconnectTime{};             // only used at poller loop thread
+        std::thread thread{};
+    };
 
     struct BindData
     {
         ConnectionData connectionData{};
         SocketPtr socket{};
         hybrid_ptr<IStreamConnectionCallback> callback{};
+        PollerLoop* pollerLoop = nullptr;
+        bool reusePort = false;
     };
 
+    std::unique_ptr<PollerLoop> createPollerLoop();
+    void pollerLoop(PollerLoop& pollerLoop);
+    PollerLoop& getLeastLoadedPollerLoop();
+    PollerLoop* findPollerLoop(std::int64_t connectionId) const;
+
     std::unordered_map<SOCKET, BindData>::iterator findBindByEndpoint(const std::string& endpoint);
-    IStreamConnectionPrivatePtr findConnectionBySdOnlyForPollerLoop(SOCKET sd);
+    IStreamConnectionPrivatePtr findConnectionBySdOnlyForPollerLoop(PollerLoop& pollerLoop, SOCKET sd);
     IStreamConnectionPrivatePtr findConnectionById(std::int64_t connectionId);
     bool createSocket(const IStreamConnectionPtr& streamConnection, ConnectionData& connectionData, const ConnectProperties& connectionProperties);
     void removeConnection(const SocketDescriptorPtr& sd, std::int64_t connectionId);
     void disconnectIntern(const IStreamConnectionPrivatePtr& connectionDisconnect, const SocketDescriptorPtr& sd);
-    IStreamConnectionPrivatePtr addConnection(const SocketPtr& socket, ConnectionData& connectionData, hybrid_ptr<IStreamConnectionCallback> callback);
-    void handleConnectionEvents(const IStreamConnectionPrivatePtr& connection, const SocketPtr& socket, const DescriptorInfo& info);
-    void handleBindEvents(const DescriptorInfo& info);
-    void handleReceive(const IStreamConnectionPrivatePtr& connection, const SocketPtr& socket, int bytesToRead);
+    IStreamConnectionPrivatePtr addConnection(PollerLoop& pollerLoop, const SocketPtr& socket, ConnectionData& connectionData, hybrid_ptr<IStreamConnectionCallback> callback);
+    void handleConnectionEvents(PollerLoop& pollerLoop, const IStreamConnectionPrivatePtr& connection, const SocketPtr& socket, const DescriptorInfo& info);
+    void handleBindEvents(PollerLoop& pollerLoop, const DescriptorInfo& info);
+    void handleReceive(PollerLoop& pollerLoop, const IStreamConnectionPrivatePtr& connection, const SocketPtr& socket, int bytesToRead);
     static bool isTimerExpired(std::chrono::time_point<std::chrono::steady_clock>& lastTime, int interval);
-    void doReconnect();
+    void doReconnect(PollerLoop& pollerLoop);
 
-    const std::shared_ptr<IPoller> m_poller{};
+    std::vector<std::unique_ptr<PollerLoop>> m_pollerLoops{};
     std::unordered_map<SOCKET, BindData> m_sd2binds{};
     std::unordered_map<std::int64_t, IStreamConnectionPrivatePtr> m_connectionId2Connection{};
-    std::unordered_map<SOCKET, IStreamConnectionPrivatePtr> m_sd2Connection{};
-    std::unordered_map<SOCKET, IStreamConnectionPrivatePtr> m_sd2ConnectionPollerLoop{};
-    std::atomic_flag m_connectionsStable{};
+    std::unordered_map<std::int64_t, PollerLoop*> m_connectionId2PollerLoop{};
+    size_t m_nextPollerLoop = 0;
     static std::atomic_int64_t m_nextConnectionId;
     std::atomic_bool m_terminatePollerLoop{false};
     int m_cycleTime = 100;
+    ReceiveMode m_receiveMode = ReceiveMode::RECEIVEMODE_PENDINGREAD;
     int m_checkReconnectInterval = 1000;
     FuncPollerLoopTimer m_funcTimer{};
-    const IExecutorPtr m_executorPollerThread;
     std::unique_ptr<IExecutorWorker> m_executorWorker{};
     std::thread m_threadTimer{};
     mutable std::mutex m_mutex{};
 
-    std::chrono::time_point<std::chrono::steady_clock> m_lastReconnectTime{};
-
 #ifdef USE_OPENSSL
-    struct SslAcceptingData
-    {
-        SocketPtr socket;
-        ConnectionData connectionData;
-        hybrid_ptr<IStreamConnectionCallback> callback;
-    };
-    bool sslAccepting(SslAcceptingData& sslAcceptingData);
-    std::unordered_map<SOCKET, SslAcceptingData> m_sslAcceptings{};
+    void startSslAccepting(PollerLoop& pollerLoop, const SslAcceptingData& sslAcceptingData);
+    bool sslAccepting(PollerLoop& pollerLoop, SslAcceptingData& sslAcceptingData);
 #endif
 };
 
@@ -26,6 +26,7 @@
 
 #include <string>
 #include <memory>
+#include <type_traits>
 
 
 namespace finalmq {
@@ -46,6 +47,8 @@ struct IVariantVisitor
 
 
 
+class Atom;
+
 struct IVariantValue
 {
     virtual ~IVariantValue() {}
@@ -62,6 +65,53 @@ struct IVariantValue
     virtual Variant* add(Variant&& variant) = 0;
     virtual ssize_t size() const = 0;
     virtual void accept(IVariantVisitor& visitor, Variant& variant, ssize_t index, int level, ssize_t size, const std::string& name, bool parentIsStruct) = 0;
+
+    /**
+     * Direct entries of a struct by an interned key, the key is not parsed as a path.
+     */
+    virtual Variant* getVariantByAtom(const Atom& /*key*/)
+    {
+        return nullptr;
+    }
+    virtual const Variant* getVariantByAtom(const Atom& /*key*/) const
+    {
+        return nullptr;
+    }
+    virtual Variant* addByAtom(const Atom& /*key*/, const Variant& /*variant*/)
+    {
+        return nullptr;
+    }
+    virtual Variant* addByAtom(const Atom& /*key*/, Variant&& /*variant*/)
+    {
+        return nullptr;
+    }
+
+    /**
+     * Copies or moves the value into the inline storage of a Variant (see VARIANT_INLINE_SIZE).
+     * Returns nullptr, if the value cannot be stored inline. The moved-from value stays valid.
+     */
+    virtual IVariantValue* cloneInto(void* /*storage*/) const
+    {
+        return nullptr;
+    }
+    virtual IVariantValue* moveInto(void* /*storage*/) noexcept
+    {
+        return nullptr;
+    }
+};
+
+
+/**
+ * Values up to this size are stored inside the Variant instead of a separate allocation.
+ * This covers the scalars, the strings (short strings do not allocate at all), the arrays
+ * and the wrappers of struct and list.
+ */
+const static std::size_t VARIANT_INLINE_SIZE = 5 * sizeof(void*);
+
+template <class V>
+struct VariantValueIsInline
+{
+    static const bool value = (sizeof(V) <= VARIANT_INLINE_SIZE) && (alignof(V) <= alignof(void*)) && std::is_nothrow_move_constructible<V>::value;
 };
 
 
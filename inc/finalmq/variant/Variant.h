@@ -23,11 +23,14 @@
 #pragma once
 
 #include <memory>
+#include <new>
 #include <string>
+#include <type_traits>
 
 #include <assert.h>
 
 #include "IVariantValue.h"
+#include "finalmq/helpers/Atom.h"
 
 namespace finalmq
 {
@@ -39,19 +42,21 @@ class SYMBOLEXP Variant
 {
 public:
     Variant();
+    ~Variant();
 
     Variant(std::shared_ptr<IVariantValue> value);
 
     template<class T>
     Variant(T data)
-        : m_value(std::make_shared<typename VariantValueTypeInfo<T>::VariantValueType>(std::move(data)))
     {
+        emplace<typename VariantValueTypeInfo<T>::VariantValueType>(std::move(data));
     }
 
     template<class T>
     const Variant& operator=(T data)
     {
-        m_value = std::make_shared<typename VariantValueTypeInfo<T>::VariantValueType>(std::move(data));
+        reset();
+        emplace<typename VariantValueTypeInfo<T>::VariantValueType>(std::move(data));
 #ifndef WIN32
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Weffc++"
@@ -82,7 +87,7 @@ public:
         {
             if (m_value->getType() == VariantValueTypeInfo<T>::VARTYPE)
             {
-                return static_cast<const T*>(m_value->getData());
+                return static_cast<const T*>(static_cast<const IVariantValue*>(m_value)->getData());
             }
         }
         return nullptr;
@@ -106,7 +111,7 @@ public:
         Variant* variant = getVariant(name);
         if (variant)
         {
-            std::shared_ptr<IVariantValue>& value = variant->m_value;
+            IVariantValue* value = variant->m_value;
             if (value)
             {
                 if (value->getType() == VariantValueTypeInfo<T>::VARTYPE)
@@ -121,7 +126,12 @@ public:
     template<class T>
     const T* getData(const std::string& name) const
     {
-        return const_cast<Variant*>(this)->getData<T>(name);
+        const Variant* variant = getVariant(name);
+        if (variant)
+        {
+            return variant->operator const T*();
+        }
+        return nullptr;
     }
 
     template<class T>
@@ -135,6 +145,50 @@ public:
         return T();
     }
 
+    /**
+     * Direct entries of a struct by an interned key, the key is not parsed as a path.
+     * An entry, which was added or looked up by the atom, is found in O(1).
+     */
+    template<class T>
+    T* getData(const Atom& key)
+    {
+        Variant* variant = getVariant(key);
+        if (variant)
+        {
+            IVariantValue* value = variant->m_value;
+            if (value)
+            {
+                if (value->getType() == VariantValueTypeInfo<T>::VARTYPE)
+                {
+                    return static_cast<T*>(value->getData());
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    template<class T>
+    const T* getData(const Atom& key) const
+    {
+        const Variant* variant = getVariant(key);
+        if (variant)
+        {
+            return variant->operator const T*();
+        }
+        return nullptr;
+    }
+
+    template<class T>
+    T getDataValue(const Atom& key) const
+    {
+        const Variant* variant = getVariant(key);
+        if (variant)
+        {
+            return VariantValueTypeInfo<T>::ConvertType::convert(*variant);
+        }
+        return T();
+    }
+
     inline int getType() const
     {
         if (m_value)
@@ -154,8 +208,15 @@ public:
 
     void accept(IVariantVisitor& visitor, ssize_t index = 0, int level = 0, ssize_t size = 0, const std::string& name = "", bool parentIsStruct = false);
 
+    /**
+     * Note: the non-const lookup builds a name index for wide structs, so it modifies the variant
+     * like the other non-const methods do. Concurrent readers shall use the const lookup, it never
+     * builds the index.
+     */
     Variant* getVariant(const std::string& name);
     const Variant* getVariant(const std::string& name) const;
+    Variant* getVariant(const Atom& key);
+    const Variant* getVariant(const Atom& key) const;
 
     bool operator==(const Variant& rhs) const;
 
@@ -163,12 +224,44 @@ public:
     Variant* add(const std::string& name, Variant&& variant);
     Variant* add(const Variant& variant);
     Variant* add(Variant&& variant);
+    Variant* add(const Atom& key, const Variant& variant);
+    Variant* add(const Atom& key, Variant&& variant);
     ssize_t size() const;
 
     Variant& getOrCreate(const std::string& name);
 
 private:
-    std::shared_ptr<IVariantValue> m_value{};
+    template<class V, class... Args>
+    void emplace(Args&&... args)
+    {
+        emplace<V>(std::integral_constant<bool, VariantValueIsInline<V>::value>(), std::forward<Args>(args)...);
+    }
+
+    template<class V, class... Args>
+    void emplace(std::true_type /*isInline*/, Args&&... args)
+    {
+        m_value = new (&m_storage) V(std::forward<Args>(args)...);
+    }
+
+    template<class V, class... Args>
+    void emplace(std::false_type /*isInline*/, Args&&... args)
+    {
+        m_shared = std::make_shared<V>(std::forward<Args>(args)...);
+        m_value = m_shared.get();
+    }
+
+    void reset() noexcept;
+    void moveFrom(Variant& rhs) noexcept;
+
+    inline bool isInline() const
+    {
+        return (m_value != nullptr && m_shared == nullptr);
+    }
+
+    // the value is either inline in m_storage or shared in m_shared
+    IVariantValue* m_value = nullptr;
+    std::shared_ptr<IVariantValue> m_shared{};
+    typename std::aligned_storage<VARIANT_INLINE_SIZE, alignof(void*)>::type m_storage;
 };
 
 } // namespace finalmq
@@ -60,9 +60,11 @@ private:
     virtual Variant* add(Variant&& variant) override;
     virtual ssize_t size() const override;
     virtual void accept(IVariantVisitor& visitor, Variant& variant, ssize_t index, int level, ssize_t size, const std::string& name, bool parentIsStruct) override;
-
+    virtual IVariantValue* cloneInto(void* storage) const override;
+    virtual IVariantValue* moveInto(void* storage) noexcept override;
 
     VariantList::iterator find(const std::string& name);
+    Variant* findPart(const std::string& name, std::string& restname);
 
     std::unique_ptr<VariantList>     m_value;
 };
@@ -27,6 +27,7 @@
 #include "VariantValueConvert.h"
 
 #include <deque>
+#include <unordered_map>
 
 namespace finalmq {
 
@@ -59,11 +60,34 @@ private:
     virtual Variant* add(Variant&& variant) override;
     virtual ssize_t size() const override;
     virtual void accept(IVariantVisitor& visitor, Variant& variant, ssize_t index, int level, ssize_t size, const std::string& name, bool parentIsStruct) override;
-
-
-    VariantStruct::iterator find(const std::string& name);
+    virtual Variant* getVariantByAtom(const Atom& key) override;
+    virtual const Variant* getVariantByAtom(const Atom& key) const override;
+    virtual Variant* addByAtom(const Atom& key, const Variant& variant) override;
+    virtual Variant* addByAtom(const Atom& key, Variant&& variant) override;
+    virtual IVariantValue* cloneInto(void* storage) const override;
+    virtual IVariantValue* moveInto(void* storage) noexcept override;
+
+    Variant* find(const char* name, ssize_t size, bool buildIndex);
+    ssize_t findIndex(const char* name, ssize_t size, bool buildIndex);
+    Variant* findAtom(const Atom& key, bool fillSlot);
+    void setSlot(std::uint32_t id, std::size_t index);
+    Variant* findPart(const std::string& name, std::string& restname, bool buildIndex);
+    void addToIndex(const std::string& name);
+
+    typedef std::unordered_map<std::string, std::size_t> Index;
 
     std::unique_ptr<VariantStruct>     m_value;
+    // index over the names for wide structs, it is built on demand by non-const lookups.
+    // If the struct is handed out for modification (getData), the names can be changed
+    // from outside at any time. Then, the index is dropped and never built again
+    // (m_indexSize == INDEX_DISABLED), so a stale index cannot hide an entry.
+    std::unique_ptr<Index>             m_index;
+    std::size_t                        m_indexSize = 0;
+    // positions of the entries by atom ID (see Atom), they are filled, when an entry is added or
+    // looked up by an atom. m_slots[0] is the number of slots, m_slots[1 + ID] is the index of the
+    // entry + 1 or 0, if the position is not known. Entries are never removed or renamed through
+    // this class, so the positions stay valid, until the struct is handed out like the name index.
+    std::unique_ptr<std::uint32_t[]>   m_slots;
 };
 
 
@@ -23,6 +23,7 @@
 #pragma once
 
 #include <functional>
+#include <new>
 #include <unordered_map>
 
 #include "IVariantValue.h"
@@ -133,6 +134,36 @@ private:
         visitor.enterLeaf(variant, VARTYPE, index, level, size, name, parentIsStruct);
     }
 
+    virtual IVariantValue* cloneInto(void* storage) const override
+    {
+        return cloneInto(storage, std::integral_constant<bool, VariantValueIsInline<VariantValueTemplate>::value>());
+    }
+
+    virtual IVariantValue* moveInto(void* storage) noexcept override
+    {
+        return moveInto(storage, std::integral_constant<bool, VariantValueIsInline<VariantValueTemplate>::value>());
+    }
+
+    IVariantValue* cloneInto(void* storage, std::true_type) const
+    {
+        return new (storage) VariantValueTemplate(*this);
+    }
+
+    IVariantValue* cloneInto(void* /*storage*/, std::false_type) const
+    {
+        return nullptr;
+    }
+
+    IVariantValue* moveInto(void* storage, std::true_type) noexcept
+    {
+        return new (storage) VariantValueTemplate(std::move(*this));
+    }
+
+    IVariantValue* moveInto(void* /*storage*/, std::false_type) noexcept
+    {
+        return nullptr;
+    }
+
     typename MetaTypeIdInfo<VARTYPE>::Type m_value;
 };
 
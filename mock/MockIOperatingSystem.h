@@ -50,6 +50,9 @@ public:
     MOCK_METHOD(int, read, (int fd, char* buffer, int len), (override));
     MOCK_METHOD(int, send, (SOCKET fd, const char* buffer, int len, int flags), (override));
     MOCK_METHOD(int, recv, (SOCKET fd, char* buffer, int len, int flags), (override));
+#if !defined(WIN32) && !defined(__MINGW32__)
+    MOCK_METHOD(int, sendmsg, (SOCKET fd, const struct msghdr* msg, int flags), (override));
+#endif
     MOCK_METHOD(int, getLastError, (), (override));
     MOCK_METHOD(int, select, (int nfds, fd_set* readfds, fd_set* writefds, fd_set* exceptfds, struct timeval* timeout), (override));
 #if !defined(WIN32) && !defined(__MINGW32__)
@@ -57,6 +60,9 @@ public:
     MOCK_METHOD(int, epoll_ctl, (int epfd, int op, int fd, struct epoll_event* event), (override));
     MOCK_METHOD(int, epoll_pwait, (int epfd, struct epoll_event *events, int maxevents, int timeout, const sigset_t* mask), (override));
 #endif
+    MOCK_METHOD(int, io_uring_setup, (unsigned int entries, struct io_uring_params* params), (override));
+    MOCK_METHOD(int, io_uring_enter, (int fd, unsigned int toSubmit, unsigned int minComplete, unsigned int flags, const void* arg, size_t argsz), (override));
+    MOCK_METHOD(int, io_uring_register, (int fd, unsigned int opcode, void* arg, unsigned int nrArgs), (override));
     MOCK_METHOD(int, makeSocketPair, (SocketDescriptorPtr& socket1, SocketDescriptorPtr& socket2), (override));
     MOCK_METHOD(int, ioctlInt, (SOCKET fd, unsigned long int request, int* value), (override));
     MOCK_METHOD(int, setNoDelay, (SOCKET fd, bool noDelay));
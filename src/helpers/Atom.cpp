@@ -0,0 +1,77 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "finalmq/helpers/Atom.h"
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace finalmq
+{
+namespace
+{
+struct AtomTable
+{
+    std::mutex mutex{};
+    std::unordered_map<std::string, std::uint32_t> ids{};
+    // a deque does not move its entries, the atoms keep pointers to the names
+    std::deque<std::string> names{};
+    std::atomic<std::uint32_t> size{0};
+};
+
+AtomTable& getAtomTable()
+{
+    // constructed on first use, atoms are created during static initialization
+    static AtomTable table;
+    return table;
+}
+} // namespace
+
+Atom::Atom(const char* name)
+    : Atom(std::string(name))
+{
+}
+
+Atom::Atom(const std::string& name)
+{
+    AtomTable& table = getAtomTable();
+    std::unique_lock<std::mutex> lock(table.mutex);
+    auto it = table.ids.find(name);
+    if (it == table.ids.end())
+    {
+        const std::uint32_t id = static_cast<std::uint32_t>(table.names.size());
+        table.names.push_back(name);
+        it = table.ids.emplace(name, id).first;
+        table.size = id + 1;
+    }
+    m_id = it->second;
+    m_name = &table.names[m_id];
+}
+
+std::uint32_t Atom::getNumberOfAtoms()
+{
+    return getAtomTable().size;
+}
+
+} // namespace finalmq
@@ -0,0 +1,218 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "finalmq/helpers/BufferPool.h"
+
+#include <assert.h>
+
+#include <atomic>
+#include <iterator>
+
+namespace finalmq
+{
+static const size_t SIZECLASS_MIN = 64;
+static const int NUMBER_OF_SIZECLASSES = 11; // 64 bytes ... 64 kbytes
+static const size_t POOL_BYTES_PER_SIZECLASS = 256 * 1024;
+static const size_t POOL_MIN_CHUNKS_PER_SIZECLASS = 8;
+static const size_t POOL_MAX_REFS = 1024;
+
+static std::atomic_uint64_t g_hits{};
+static std::atomic_uint64_t g_misses{};
+
+struct ThreadLocalBufferPool
+{
+    ~ThreadLocalBufferPool();
+    std::list<std::string> chunks[NUMBER_OF_SIZECLASSES]{};
+    std::list<BufferPool::Ref> refs{};
+};
+
+// messages can be released at thread exit, after the pool of the thread was already destroyed.
+static thread_local bool t_bufferPoolDestroyed = false;
+static thread_local ThreadLocalBufferPool t_bufferPool;
+
+ThreadLocalBufferPool::~ThreadLocalBufferPool()
+{
+    t_bufferPoolDestroyed = true;
+}
+
+static ThreadLocalBufferPool* getPool()
+{
+    if (t_bufferPoolDestroyed)
+    {
+        return nullptr;
+    }
+    return &t_bufferPool;
+}
+
+static size_t getSizeOfSizeClass(int sizeClass)
+{
+    return SIZECLASS_MIN << sizeClass;
+}
+
+// smallest size class that can hold size, -1 if size is too large to be pooled
+static int getSizeClassForSize(size_t size)
+{
+    int sizeClass = 0;
+    for (size_t sizeOfClass = SIZECLASS_MIN; sizeOfClass < size; sizeOfClass <<= 1)
+    {
+        ++sizeClass;
+    }
+    return (sizeClass < NUMBER_OF_SIZECLASSES) ? sizeClass : -1;
+}
+
+// largest size class that fits into capacity, -1 if the chunk shall not be pooled
+static int getSizeClassForCapacity(size_t capacity)
+{
+    if (capacity < SIZECLASS_MIN || capacity >= 2 * getSizeOfSizeClass(NUMBER_OF_SIZECLASSES - 1))
+    {
+        return -1;
+    }
+    int sizeClass = 0;
+    for (size_t sizeOfClass = SIZECLASS_MIN * 2; sizeOfClass <= capacity && sizeClass < NUMBER_OF_SIZECLASSES - 1; sizeOfClass <<= 1)
+    {
+        ++sizeClass;
+    }
+    return sizeClass;
+}
+
+static size_t getMaxChunks(int sizeClass)
+{
+    size_t maxChunks = POOL_BYTES_PER_SIZECLASS / getSizeOfSizeClass(sizeClass);
+    return (maxChunks > POOL_MIN_CHUNKS_PER_SIZECLASS) ? maxChunks : POOL_MIN_CHUNKS_PER_SIZECLASS;
+}
+
+static void releaseBuffer(std::list<std::string>& buffers, std::list<std::string>::iterator it)
+{
+    ThreadLocalBufferPool* pool = getPool();
+    int sizeClass = getSizeClassForCapacity(it->capacity());
+    if (pool && sizeClass >= 0 && pool->chunks[sizeClass].size() < getMaxChunks(sizeClass))
+    {
+        it->clear();
+        // the last released chunk is reused first, its memory is probably still in the cache
+        pool->chunks[sizeClass].splice(pool->chunks[sizeClass].begin(), buffers, it);
+    }
+    else
+    {
+        buffers.erase(it);
+    }
+}
+
+char* BufferPool::addBuffer(std::list<std::string>& buffers, ssize_t size)
+{
+    assert(size >= 0);
+    ThreadLocalBufferPool* pool = getPool();
+    int sizeClass = getSizeClassForSize(size);
+    if (pool && sizeClass >= 0 && !pool->chunks[sizeClass].empty())
+    {
+        std::list<std::string>& chunks = pool->chunks[sizeClass];
+        buffers.splice(buffers.end(), chunks, chunks.begin());
+        g_hits.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        buffers.emplace_back();
+        if (sizeClass >= 0)
+        {
+            // allocate the full size class, so that the chunk can be pooled
+            buffers.back().reserve(getSizeOfSizeClass(sizeClass));
+        }
+        g_misses.fetch_add(1, std::memory_order_relaxed);
+    }
+    std::string& buffer = buffers.back();
+    buffer.resize(size);
+    return const_cast<char*>(buffer.data());
+}
+
+void BufferPool::removeLastBuffer(std::list<std::string>& buffers)
+{
+    assert(!buffers.empty());
+    releaseBuffer(buffers, std::prev(buffers.end()));
+}
+
+void BufferPool::releaseBuffers(std::list<std::string>& buffers)
+{
+    while (!buffers.empty())
+    {
+        releaseBuffer(buffers, buffers.begin());
+    }
+}
+
+std::list<BufferPool::Ref>::iterator BufferPool::addRef(std::list<Ref>& refs, std::list<Ref>::iterator pos, const Ref& ref)
+{
+    ThreadLocalBufferPool* pool = getPool();
+    if (pool && !pool->refs.empty())
+    {
+        auto it = pool->refs.begin();
+        *it = ref;
+        refs.splice(pos, pool->refs, it);
+        g_hits.fetch_add(1, std::memory_order_relaxed);
+        return it;
+    }
+    g_misses.fetch_add(1, std::memory_order_relaxed);
+    return refs.insert(pos, ref);
+}
+
+void BufferPool::removeRef(std::list<Ref>& refs, std::list<Ref>::iterator pos)
+{
+    ThreadLocalBufferPool* pool = getPool();
+    if (pool && pool->refs.size() < POOL_MAX_REFS)
+    {
+        pool->refs.splice(pool->refs.begin(), refs, pos);
+    }
+    else
+    {
+        refs.erase(pos);
+    }
+}
+
+void BufferPool::releaseRefs(std::list<Ref>& refs)
+{
+    ThreadLocalBufferPool* pool = getPool();
+    if (pool)
+    {
+        pool->refs.splice(pool->refs.begin(), refs);
+        if (pool->refs.size() > POOL_MAX_REFS)
+        {
+            pool->refs.resize(POOL_MAX_REFS);
+        }
+    }
+    else
+    {
+        refs.clear();
+    }
+}
+
+BufferPool::Statistics BufferPool::getStatistics()
+{
+    Statistics statistics;
+    statistics.hits = g_hits.load(std::memory_order_relaxed);
+    statistics.misses = g_misses.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+void BufferPool::resetStatistics()
+{
+    g_hits.store(0, std::memory_order_relaxed);
+    g_misses.store(0, std::memory_order_relaxed);
+}
+
+} // namespace finalmq
@@ -21,6 +21,7 @@
 //SOFTWARE.
 
 #include "finalmq/helpers/Executor.h"
+#include "finalmq/helpers/ExecutorWorkStealing.h"
 
 #include <iostream>
 
@@ -381,12 +382,38 @@ namespace finalmq
         IExecutorWorker* inst = getStaticInstanceRef().load(std::memory_order_relaxed);
         if (!inst)
         {
-            setInstance(std::make_unique<ExecutorWorker<Executor>>());
+            const Config& config = getStaticConfigRef();
+            setInstance(createExecutorWorker(config.type, config.numberOfWorkerThreads));
             inst = getStaticInstanceRef().load(std::memory_order_relaxed);
         }
         return inst;
     }
 
+    void GlobalExecutorWorker::setConfig(ExecutorWorkerType type, int numberOfWorkerThreads)
+    {
+        Config& config = getStaticConfigRef();
+        config.type = type;
+        config.numberOfWorkerThreads = numberOfWorkerThreads;
+    }
+
+    std::unique_ptr<IExecutorWorker> GlobalExecutorWorker::createExecutorWorker(ExecutorWorkerType type, int numberOfWorkerThreads)
+    {
+        switch (type)
+        {
+            case ExecutorWorkerType::EXECUTORWORKER_WORKSTEALING:
+                return std::make_unique<ExecutorWorker<ExecutorWorkStealing>>(numberOfWorkerThreads);
+            case ExecutorWorkerType::EXECUTORWORKER_DEFAULT:
+            default:
+                return std::make_unique<ExecutorWorker<Executor>>(numberOfWorkerThreads);
+        }
+    }
+
+    GlobalExecutorWorker::Config& GlobalExecutorWorker::getStaticConfigRef()
+    {
+        static Config config;
+        return config;
+    }
+
     std::atomic<IExecutorWorker*>& GlobalExecutorWorker::getStaticInstanceRef()
     {
         static std::atomic<IExecutorWorker*> instance;
@@ -0,0 +1,399 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "finalmq/helpers/ExecutorWorkStealing.h"
+
+#include <thread>
+
+#include <assert.h>
+
+namespace finalmq
+{
+static const size_t WORKQUEUE_SIZE = 1024; // must be a power of 2
+static const int STRAND_BITS = 10;
+static const size_t NUMBER_OF_STRANDS = (1 << STRAND_BITS);
+
+// the queue of the worker thread
+static thread_local const ExecutorWorkStealing* t_executor = nullptr;
+static thread_local int t_queueIndex = 0;
+// round robin over the queues for threads that are not workers of the executor
+static thread_local unsigned int t_nextQueue = 0;
+
+static size_t getStrandIndex(std::int64_t instanceId)
+{
+    return static_cast<size_t>((static_cast<std::uint64_t>(instanceId) * 0x9E3779B97F4A7C15ull) >> (64 - STRAND_BITS));
+}
+
+//////////////////////////////////////////////////
+// Strand
+
+ExecutorWorkStealing::Strand::Strand()
+    : head(&stub), tail(&stub)
+{
+}
+
+void ExecutorWorkStealing::Strand::push(StrandNode* node)
+{
+    node->next.store(nullptr, std::memory_order_relaxed);
+    StrandNode* prev = head.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+}
+
+ExecutorWorkStealing::StrandNode* ExecutorWorkStealing::Strand::pop()
+{
+    StrandNode* tailCurrent = tail;
+    StrandNode* next = tailCurrent->next.load(std::memory_order_acquire);
+    if (tailCurrent == &stub)
+    {
+        if (next == nullptr)
+        {
+            return nullptr;
+        }
+        tail = next;
+        tailCurrent = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+    if (next)
+    {
+        tail = next;
+        return tailCurrent;
+    }
+    if (tailCurrent != head.load(std::memory_order_acquire))
+    {
+        // a producer is in the middle of a push
+        return nullptr;
+    }
+    push(&stub);
+    next = tailCurrent->next.load(std::memory_order_acquire);
+    if (next)
+    {
+        tail = next;
+        return tailCurrent;
+    }
+    return nullptr;
+}
+
+//////////////////////////////////////////////////
+// WorkQueue
+
+ExecutorWorkStealing::WorkQueue::WorkQueue()
+    : m_cells(new Cell[WORKQUEUE_SIZE])
+{
+    for (size_t i = 0; i < WORKQUEUE_SIZE; ++i)
+    {
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool ExecutorWorkStealing::WorkQueue::push(Item& item)
+{
+    Cell* cell = nullptr;
+    size_t pos = m_posPush.load(std::memory_order_relaxed);
+    while (true)
+    {
+        cell = &m_cells[pos & (WORKQUEUE_SIZE - 1)];
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        std::intptr_t diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+        if (diff == 0)
+        {
+            if (m_posPush.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // full
+            return false;
+        }
+        else
+        {
+            pos = m_posPush.load(std::memory_order_relaxed);
+        }
+    }
+    cell->item = std::move(item);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool ExecutorWorkStealing::WorkQueue::pop(Item& item)
+{
+    Cell* cell = nullptr;
+    size_t pos = m_posPop.load(std::memory_order_relaxed);
+    while (true)
+    {
+        cell = &m_cells[pos & (WORKQUEUE_SIZE - 1)];
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        std::intptr_t diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+        if (diff == 0)
+        {
+            if (m_posPop.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // empty
+            return false;
+        }
+        else
+        {
+            pos = m_posPop.load(std::memory_order_relaxed);
+        }
+    }
+    item = std::move(cell->item);
+    cell->sequence.store(pos + WORKQUEUE_SIZE, std::memory_order_release);
+    return true;
+}
+
+//////////////////////////////////////////////////
+// ExecutorWorkStealing
+
+ExecutorWorkStealing::ExecutorWorkStealing()
+    : m_strands(new Strand[NUMBER_OF_STRANDS])
+{
+    // queue for the threads that are not registered as worker
+    m_queues[0] = std::make_unique<WorkQueue>();
+    m_numberOfQueues = 1;
+}
+
+ExecutorWorkStealing::~ExecutorWorkStealing()
+{
+    for (size_t i = 0; i < NUMBER_OF_STRANDS; ++i)
+    {
+        Strand& strand = m_strands[i];
+        StrandNode* node = nullptr;
+        while ((node = strand.pop()) != nullptr)
+        {
+            delete node;
+        }
+    }
+}
+
+void ExecutorWorkStealing::addAction(std::function<void()> func, std::int64_t instanceId)
+{
+    ExecutorTask task;
+    task.set(std::move(func));
+    addTask(std::move(task), instanceId);
+}
+
+void ExecutorWorkStealing::addTask(ExecutorTask&& task, std::int64_t instanceId)
+{
+    Item item;
+    if (instanceId == 0)
+    {
+        item.task = std::move(task);
+    }
+    else
+    {
+        Strand& strand = m_strands[getStrandIndex(instanceId)];
+        StrandNode* node = new StrandNode;
+        node->task = std::move(task);
+        strand.push(node);
+        if (strand.count.fetch_add(1, std::memory_order_acq_rel) != 0)
+        {
+            // the strand is already queued or running
+            return;
+        }
+        item.strand = &strand;
+    }
+    pushItem(std::move(item));
+}
+
+void ExecutorWorkStealing::pushItem(Item&& item)
+{
+    int numberOfQueues = m_numberOfQueues.load(std::memory_order_acquire);
+    int index = (t_executor == this) ? t_queueIndex : static_cast<int>(t_nextQueue++ % numberOfQueues);
+    bool pushed = false;
+    for (int i = 0; i < numberOfQueues && !pushed; ++i)
+    {
+        pushed = m_queues[(index + i) % numberOfQueues]->push(item);
+    }
+    if (!pushed)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_overflow.push_back(std::move(item));
+        m_overflowSize.fetch_add(1, std::memory_order_release);
+    }
+
+    std::int64_t pendingBefore = m_pending.fetch_add(1);
+    if (m_sleeping.load() > 0)
+    {
+        m_newActions = true;
+    }
+    if (pendingBefore <= 0 && m_funcNotify)
+    {
+        m_funcNotify();
+    }
+}
+
+bool ExecutorWorkStealing::popItem(Item& item)
+{
+    int numberOfQueues = m_numberOfQueues.load(std::memory_order_acquire);
+    int index = (t_executor == this) ? t_queueIndex : 0;
+    bool popped = false;
+    // first the own queue, then steal from the others
+    for (int i = 0; i < numberOfQueues && !popped; ++i)
+    {
+        popped = m_queues[(index + i) % numberOfQueues]->pop(item);
+    }
+    if (!popped && m_overflowSize.load(std::memory_order_acquire) > 0)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_overflow.empty())
+        {
+            item = std::move(m_overflow.front());
+            m_overflow.pop_front();
+            m_overflowSize.fetch_sub(1, std::memory_order_relaxed);
+            popped = true;
+        }
+    }
+    if (popped)
+    {
+        m_pending.fetch_sub(1);
+    }
+    return popped;
+}
+
+void ExecutorWorkStealing::runStrand(Strand& strand, const FuncIsAbort& funcIsAbort)
+{
+    const std::int32_t count = strand.count.load(std::memory_order_acquire);
+    assert(count > 0);
+    for (std::int32_t i = 0; i < count; ++i)
+    {
+        StrandNode* node = strand.pop();
+        while (node == nullptr)
+        {
+            // the action is counted, but the producer has not finished its push, yet
+            std::this_thread::yield();
+            node = strand.pop();
+        }
+        assert(node->task);
+        if (!funcIsAbort || !funcIsAbort())
+        {
+            node->task();
+        }
+        delete node;
+    }
+    if (strand.count.fetch_sub(count, std::memory_order_acq_rel) != count)
+    {
+        // new actions were added in the meantime
+        Item item;
+        item.strand = &strand;
+        pushItem(std::move(item));
+    }
+}
+
+bool ExecutorWorkStealing::runAvailableActionBatch(const FuncIsAbort& funcIsAbort)
+{
+    Item item;
+    if (!popItem(item))
+    {
+        return false;
+    }
+
+    // trigger next possible thread
+    if (m_pending.load() > 0 && m_sleeping.load() > 0)
+    {
+        m_newActions = true;
+    }
+
+    if (item.strand)
+    {
+        runStrand(*item.strand, funcIsAbort);
+    }
+    else
+    {
+        assert(item.task);
+        if (!funcIsAbort || !funcIsAbort())
+        {
+            item.task();
+        }
+    }
+    return true;
+}
+
+bool ExecutorWorkStealing::runAvailableActions(const FuncIsAbort& funcIsAbort)
+{
+    bool wasAvailable = false;
+    // only the actions that are available now, not the ones that are added while running
+    std::int64_t pending = m_pending.load();
+    for (std::int64_t i = 0; i < pending; ++i)
+    {
+        if (!runAvailableActionBatch(funcIsAbort))
+        {
+            break;
+        }
+        wasAvailable = true;
+    }
+    return wasAvailable;
+}
+
+void ExecutorWorkStealing::registerWorker()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    int index = m_numberOfWorkers;
+    ++m_numberOfWorkers;
+    if (index < MAX_QUEUES)
+    {
+        if (index >= m_numberOfQueues.load(std::memory_order_relaxed))
+        {
+            m_queues[index] = std::make_unique<WorkQueue>();
+            m_numberOfQueues.store(index + 1, std::memory_order_release);
+        }
+    }
+    else
+    {
+        index %= MAX_QUEUES;
+    }
+    lock.unlock();
+    t_executor = this;
+    t_queueIndex = index;
+}
+
+void ExecutorWorkStealing::run()
+{
+    registerWorker();
+    while (!m_terminate.load())
+    {
+        bool wasAvailable = runAvailableActionBatch([this]() {
+            return m_terminate.load();
+        });
+        if (!wasAvailable && !m_terminate.load())
+        {
+            // m_sleeping and m_pending are sequentially consistent, so that pushItem() either
+            // sees the sleeping thread or this thread sees the new action.
+            m_sleeping.fetch_add(1);
+            if (m_pending.load() <= 0 && !m_terminate.load())
+            {
+                m_newActions.wait();
+            }
+            m_sleeping.fetch_sub(1);
+        }
+    }
+    t_executor = nullptr;
+    // release possible other threads
+    m_newActions = true;
+}
+
+} // namespace finalmq
@@ -0,0 +1,105 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "finalmq/helpers/MonotonicArena.h"
+
+#include <algorithm>
+
+namespace finalmq
+{
+static const std::size_t BLOCK_SIZE_MAX = 64 * 1024;
+
+static thread_local std::shared_ptr<MonotonicArena> t_arena;
+// the arena of the scope is created on demand
+static thread_local bool t_arenaLazy = false;
+
+MonotonicArena::MonotonicArena()
+    : m_pos(m_initialBuffer), m_end(m_initialBuffer + INITIAL_BUFFER_SIZE)
+{
+}
+
+MonotonicArena::~MonotonicArena()
+{
+    while (m_blocks)
+    {
+        BlockHeader* next = m_blocks->next;
+        delete[] reinterpret_cast<char*>(m_blocks);
+        m_blocks = next;
+    }
+}
+
+void* MonotonicArena::allocateBlock(std::size_t size, std::size_t alignment)
+{
+    const std::size_t sizeNeeded = sizeof(BlockHeader) + alignment + size;
+    std::size_t sizeBlock = std::max(m_nextBlockSize, sizeNeeded);
+    char* block = new char[sizeBlock];
+    BlockHeader* header = reinterpret_cast<BlockHeader*>(block);
+    header->next = m_blocks;
+    m_blocks = header;
+    ++m_numberOfBlocks;
+    if (m_nextBlockSize < BLOCK_SIZE_MAX)
+    {
+        m_nextBlockSize *= 2;
+    }
+
+    char* pos = align(block + sizeof(BlockHeader), alignment);
+    char* end = block + sizeBlock;
+    // keep the remaining space of the current block, if the new block is a large single allocation
+    if (end - (pos + size) >= m_end - m_pos)
+    {
+        m_pos = pos + size;
+        m_end = end;
+    }
+    m_bytesAllocated += size;
+    return pos;
+}
+
+const std::shared_ptr<MonotonicArena>& MonotonicArena::current()
+{
+    if (!t_arena && t_arenaLazy)
+    {
+        t_arena = std::make_shared<MonotonicArena>();
+    }
+    return t_arena;
+}
+
+ArenaScope::ArenaScope()
+    : m_previous(std::move(t_arena)), m_previousLazy(t_arenaLazy)
+{
+    t_arena = nullptr;
+    t_arenaLazy = true;
+}
+
+ArenaScope::ArenaScope(const std::shared_ptr<MonotonicArena>& arena)
+    : m_previous(std::move(t_arena)), m_previousLazy(t_arenaLazy)
+{
+    t_arena = arena;
+    t_arenaLazy = false;
+}
+
+ArenaScope::~ArenaScope()
+{
+    t_arena = std::move(m_previous);
+    t_arenaLazy = m_previousLazy;
+}
+
+} // namespace finalmq
@@ -23,19 +23,22 @@
 
 #include "finalmq/helpers/OperatingSystem.h"
 
+#include <errno.h>
 
 #if defined(WIN32) || defined(__MINGW32__)
 #include <direct.h>
 #include <io.h>
 #pragma warning(disable: 4996)
 #else
-#include <errno.h>
 #include <netinet/tcp.h>
 #include <fcntl.h>
 #include <sys/stat.h>
 #ifndef __QNX__
 #include <sys/unistd.h>
 #endif
+#if defined(USE_IO_URING)
+#include <sys/syscall.h>
+#endif
 #endif
 
 namespace finalmq
@@ -150,6 +153,13 @@ namespace finalmq
 #endif
     }
 
+#if !defined(WIN32) && !defined(__MINGW32__)
+    int OperatingSystemImpl::sendmsg(SOCKET fd, const struct msghdr* msg, int flags)
+    {
+        return static_cast<int>(::sendmsg(fd, msg, flags));
+    }
+#endif
+
     int OperatingSystemImpl::getLastError()
     {
         int err = -1;
@@ -292,6 +302,44 @@ namespace finalmq
 
 #endif
 
+#if defined(USE_IO_URING)
+    int OperatingSystemImpl::io_uring_setup(unsigned int entries, struct io_uring_params* params)
+    {
+        int err = static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+        return err;
+    }
+
+    int OperatingSystemImpl::io_uring_enter(int fd, unsigned int toSubmit, unsigned int minComplete, unsigned int flags, const void* arg, size_t argsz)
+    {
+        int err = static_cast<int>(::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, arg, argsz));
+        return err;
+    }
+
+    int OperatingSystemImpl::io_uring_register(int fd, unsigned int opcode, void* arg, unsigned int nrArgs)
+    {
+        int err = static_cast<int>(::syscall(__NR_io_uring_register, fd, opcode, arg, nrArgs));
+        return err;
+    }
+#else
+    int OperatingSystemImpl::io_uring_setup(unsigned int /*entries*/, struct io_uring_params* /*params*/)
+    {
+        errno = ENOSYS;
+        return -1;
+    }
+
+    int OperatingSystemImpl::io_uring_enter(int /*fd*/, unsigned int /*toSubmit*/, unsigned int /*minComplete*/, unsigned int /*flags*/, const void* /*arg*/, size_t /*argsz*/)
+    {
+        errno = ENOSYS;
+        return -1;
+    }
+
+    int OperatingSystemImpl::io_uring_register(int /*fd*/, unsigned int /*opcode*/, void* /*arg*/, unsigned int /*nrArgs*/)
+    {
+        errno = ENOSYS;
+        return -1;
+    }
+#endif
+
     int OperatingSystemImpl::ioctlInt(SOCKET fd, unsigned long int request, int* value)
     {
 #if defined(WIN32) || defined(__MINGW32__)
@@ -0,0 +1,147 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "finalmq/helpers/TimerWheel.h"
+
+#include <assert.h>
+
+namespace finalmq
+{
+TimerWheel::TimerWheel(std::int64_t now, int resolution)
+    : m_resolution((resolution > 0) ? resolution : 1), m_tick(now / m_resolution)
+{
+}
+
+TimerWheel::Handle TimerWheel::add(std::int64_t deadline, std::uint64_t id)
+{
+    // round up, so that the timer does not expire before the deadline
+    std::int64_t expires = (deadline + m_resolution - 1) / m_resolution;
+    if (expires <= m_tick)
+    {
+        expires = m_tick + 1;
+    }
+    static const std::int64_t MAX_TICKS = (static_cast<std::int64_t>(1) << (SLOT_BITS * LEVELS)) - 1;
+    if (expires - m_tick > MAX_TICKS)
+    {
+        expires = m_tick + MAX_TICKS;
+    }
+
+    if (m_free.empty())
+    {
+        m_free.emplace_back();
+    }
+    Handle handle = m_free.begin();
+    handle->id = id;
+    handle->expires = expires;
+    insert(m_free, handle);
+    ++m_size;
+    return handle;
+}
+
+void TimerWheel::insert(std::list<Entry>& from, Handle handle)
+{
+    std::int64_t delta = handle->expires - m_tick;
+    int level = 0;
+    while (level < LEVELS - 1 && delta >= (static_cast<std::int64_t>(1) << (SLOT_BITS * (level + 1))))
+    {
+        ++level;
+    }
+    int slot = static_cast<int>((handle->expires >> (SLOT_BITS * level)) & (SLOTS - 1));
+    handle->level = level;
+    handle->slot = slot;
+    std::list<Entry>& slotTo = m_slots[level][slot];
+    slotTo.splice(slotTo.end(), from, handle);
+}
+
+void TimerWheel::remove(Handle handle)
+{
+    assert(m_size > 0);
+    m_free.splice(m_free.begin(), m_slots[handle->level][handle->slot], handle);
+    --m_size;
+}
+
+void TimerWheel::cascade(int level, int slot)
+{
+    std::list<Entry> entries;
+    entries.swap(m_slots[level][slot]);
+    while (!entries.empty())
+    {
+        insert(entries, entries.begin());
+    }
+}
+
+void TimerWheel::step(std::vector<std::uint64_t>& expired)
+{
+    ++m_tick;
+    int slot = static_cast<int>(m_tick & (SLOTS - 1));
+    if (slot == 0)
+    {
+        // the timers of a higher level are distributed to the lower levels, if the lower level wraps around
+        for (int level = 1; level < LEVELS; ++level)
+        {
+            int slotLevel = static_cast<int>((m_tick >> (SLOT_BITS * level)) & (SLOTS - 1));
+            cascade(level, slotLevel);
+            if (slotLevel != 0)
+            {
+                break;
+            }
+        }
+    }
+
+    std::list<Entry>& entries = m_slots[0][slot];
+    for (auto it = entries.begin(); it != entries.end(); ++it)
+    {
+        assert(it->expires == m_tick);
+        expired.push_back(it->id);
+    }
+    m_size -= entries.size();
+    m_free.splice(m_free.begin(), entries);
+}
+
+void TimerWheel::advance(std::int64_t now, std::vector<std::uint64_t>& expired)
+{
+    std::int64_t tick = now / m_resolution;
+    if (m_size == 0)
+    {
+        // nothing to expire, jump directly to the current time
+        if (tick > m_tick)
+        {
+            m_tick = tick;
+        }
+        return;
+    }
+    while (m_tick < tick && m_size > 0)
+    {
+        step(expired);
+    }
+    if (tick > m_tick)
+    {
+        m_tick = tick;
+    }
+}
+
+size_t TimerWheel::size() const
+{
+    return m_size;
+}
+
+} // namespace finalmq
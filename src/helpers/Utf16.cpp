@@ -0,0 +1,229 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "finalmq/helpers/Utf16.h"
+
+#include <cstdint>
+
+#include "finalmq/helpers/Simd.h"
+
+namespace finalmq
+{
+static const std::uint32_t REPLACEMENT_CHARACTER = 0xFFFD;
+
+static inline std::uint32_t readUnit(const char* src)
+{
+    return (static_cast<std::uint32_t>(static_cast<unsigned char>(src[0])) << 8) | static_cast<unsigned char>(src[1]);
+}
+
+static inline void writeUnit(char* dest, std::uint32_t unit)
+{
+    dest[0] = static_cast<char>(unit >> 8);
+    dest[1] = static_cast<char>(unit & 0xff);
+}
+
+static inline bool isContinuation(unsigned char c)
+{
+    return ((c & 0xC0) == 0x80);
+}
+
+static inline char* writeUtf8(char* dest, std::uint32_t codePoint)
+{
+    if (codePoint < 0x800)
+    {
+        dest[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+        dest[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        return dest + 2;
+    }
+    else if (codePoint < 0x10000)
+    {
+        dest[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+        dest[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        dest[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        return dest + 3;
+    }
+    dest[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+    dest[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+    dest[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+    dest[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+    return dest + 4;
+}
+
+// Decodes one code point that is not ASCII. Returns the number of consumed bytes.
+static inline ssize_t readUtf8(const unsigned char* src, ssize_t size, std::uint32_t& codePoint)
+{
+    const unsigned char c = src[0];
+    codePoint = REPLACEMENT_CHARACTER;
+    if (c >= 0xC2 && c <= 0xDF)
+    {
+        if (size >= 2 && isContinuation(src[1]))
+        {
+            codePoint = ((c & 0x1Fu) << 6) | (src[1] & 0x3Fu);
+            return 2;
+        }
+    }
+    else if (c >= 0xE0 && c <= 0xEF)
+    {
+        if (size >= 3 && isContinuation(src[1]) && isContinuation(src[2]))
+        {
+            const std::uint32_t cp = ((c & 0x0Fu) << 12) | ((src[1] & 0x3Fu) << 6) | (src[2] & 0x3Fu);
+            // no overlong encodings and no surrogates
+            if (cp >= 0x800 && (cp < 0xD800 || cp > 0xDFFF))
+            {
+                codePoint = cp;
+                return 3;
+            }
+        }
+    }
+    else if (c >= 0xF0 && c <= 0xF4)
+    {
+        if (size >= 4 && isContinuation(src[1]) && isContinuation(src[2]) && isContinuation(src[3]))
+        {
+            const std::uint32_t cp = ((c & 0x07u) << 18) | ((src[1] & 0x3Fu) << 12) | ((src[2] & 0x3Fu) << 6) | (src[3] & 0x3Fu);
+            if (cp >= 0x10000 && cp <= 0x10FFFF)
+            {
+                codePoint = cp;
+                return 4;
+            }
+        }
+    }
+    return 1;
+}
+
+void Utf16::utf16BeToUtf8(const char* src, ssize_t count, std::string& dest)
+{
+    // a code unit needs at most 3 bytes, a surrogate pair needs 4 bytes for 2 code units
+    dest.resize(3 * count);
+    char* out = &dest[0];
+    const char* end = src + 2 * count;
+    while (src < end)
+    {
+#ifdef FINALMQ_SIMD_SSE2
+        // 16 ASCII characters at a time: the high bytes are 0 and the low bytes are < 0x80
+        const __m128i asciiMask = _mm_set1_epi16(static_cast<short>(0x80FF));
+        while (end - src >= 32)
+        {
+            const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16));
+            const __m128i notAscii = _mm_and_si128(_mm_or_si128(first, second), asciiMask);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(notAscii, _mm_setzero_si128())) != 0xFFFF)
+            {
+                break;
+            }
+            // the big endian low bytes are the high bytes of the little endian lanes
+            const __m128i ascii = _mm_packus_epi16(_mm_srli_epi16(first, 8), _mm_srli_epi16(second, 8));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), ascii);
+            src += 32;
+            out += 16;
+        }
+        if (src >= end)
+        {
+            break;
+        }
+#endif
+        std::uint32_t unit = readUnit(src);
+        src += 2;
+        if (unit < 0x80)
+        {
+            *out = static_cast<char>(unit);
+            ++out;
+            continue;
+        }
+        if (unit >= 0xD800 && unit <= 0xDFFF)
+        {
+            std::uint32_t codePoint = REPLACEMENT_CHARACTER;
+            if (unit <= 0xDBFF && src < end)
+            {
+                const std::uint32_t low = readUnit(src);
+                if (low >= 0xDC00 && low <= 0xDFFF)
+                {
+                    codePoint = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+                    src += 2;
+                }
+            }
+            unit = codePoint;
+        }
+        out = writeUtf8(out, unit);
+    }
+    dest.resize(out - dest.data());
+}
+
+ssize_t Utf16::utf8ToUtf16Be(const char* src, ssize_t size, char* dest, ssize_t maxCount)
+{
+    const unsigned char* in = reinterpret_cast<const unsigned char*>(src);
+    const unsigned char* end = in + size;
+    char* out = dest;
+    char* outEnd = dest + 2 * maxCount;
+    while (in < end && out < outEnd)
+    {
+#ifdef FINALMQ_SIMD_SSE2
+        // 16 ASCII characters at a time, interleaved with zeros they are big endian code units
+        while (end - in >= 16 && outEnd - out >= 32)
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+            if (_mm_movemask_epi8(block) != 0)
+            {
+                break;
+            }
+            const __m128i zero = _mm_setzero_si128();
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi8(zero, block));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16), _mm_unpackhi_epi8(zero, block));
+            in += 16;
+            out += 32;
+        }
+        if (in >= end || out >= outEnd)
+        {
+            break;
+        }
+#endif
+        const unsigned char c = *in;
+        if (c < 0x80)
+        {
+            writeUnit(out, c);
+            ++in;
+            out += 2;
+            continue;
+        }
+        std::uint32_t codePoint;
+        in += readUtf8(in, end - in, codePoint);
+        if (codePoint < 0x10000)
+        {
+            writeUnit(out, codePoint);
+            out += 2;
+        }
+        else
+        {
+            codePoint -= 0x10000;
+            writeUnit(out, 0xD800 + (codePoint >> 10));
+            out += 2;
+            // a fixed size may cut the surrogate pair
+            if (out < outEnd)
+            {
+                writeUnit(out, 0xDC00 + (codePoint & 0x3FF));
+                out += 2;
+            }
+        }
+    }
+    return (out - dest) / 2;
+}
+
+} // namespace finalmq
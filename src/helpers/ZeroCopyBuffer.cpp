@@ -24,6 +24,7 @@
 
 #include "finalmq/helpers/FmqDefines.h"
 #include "finalmq/helpers/ZeroCopyBuffer.h"
+#include "finalmq/helpers/BufferPool.h"
 
 #include <algorithm>
 #include <assert.h>
@@ -32,6 +33,12 @@
 namespace finalmq {
 
 
+ZeroCopyBuffer::~ZeroCopyBuffer()
+{
+    BufferPool::releaseBuffers(m_chunks);
+}
+
+
 std::string ZeroCopyBuffer::getData() const
 {
     ssize_t s = size();
@@ -66,10 +73,7 @@ const std::list<std::string>& ZeroCopyBuffer::chunks() const
 char* ZeroCopyBuffer::addBuffer(ssize_t size, ssize_t /*reserve*/)
 {
     assert(size > 0);
-    std::string str;
-    str.resize(size);
-    m_chunks.push_back(std::move(str));
-    return const_cast<char*>(m_chunks.back().data());
+    return BufferPool::addBuffer(m_chunks, size);
 }
 
 void ZeroCopyBuffer::downsizeLastBuffer(ssize_t newSize)
@@ -83,7 +87,7 @@ void ZeroCopyBuffer::downsizeLastBuffer(ssize_t newSize)
 
     if (newSize == 0)
     {
-        m_chunks.pop_back();
+        BufferPool::removeLastBuffer(m_chunks);
     }
     else
     {
@@ -23,6 +23,7 @@
 #include "finalmq/hl7/Hl7Parser.h"
 
 #include <climits>
+#include <cstring>
 #include <limits>
 #include <string>
 
@@ -70,6 +71,8 @@ bool Hl7Parser::startParse(const char* str, ssize_t size)
             m_delimiterField[3] = m_str[3 + 4]; // &
             m_delimiterRepeat = m_str[3 + 2];   // ~
             m_escape = m_str[3 + 3];            // '\\'
+            const char delimiters[Hl7Scan::NUMBER_OF_DELIMITERS] = {m_delimiterField[0], m_delimiterField[1], m_delimiterField[2], m_delimiterField[3], m_delimiterRepeat};
+            m_scan.setDelimiters(delimiters);
         }
         else
         {
@@ -99,21 +102,17 @@ int Hl7Parser::isDelimiter(char c) const
 
 void Hl7Parser::getSegmentId(std::string& token) const
 {
-    token.clear();
-    int i = 0;
-    while (true)
+    const char* end = m_str;
+    while (end < m_end && isDelimiter(*end) == LAYER_MAX)
     {
-        char c = getChar(m_str + i);
-        if (isDelimiter(c) == LAYER_MAX)
+        end = m_scan.findDelimiter(end, m_end);
+        if (end < m_end && *end == m_delimiterRepeat)
         {
-            token += c;
-        }
-        else
-        {
-            break;
+            // the repeat delimiter is part of the segment ID
+            ++end;
         }
-        ++i;
     }
+    token.assign(m_str, end);
 }
 
 int Hl7Parser::isNextFieldFilled(int level, bool& filled)
@@ -145,18 +144,33 @@ int Hl7Parser::isNextFieldFilled(int level, bool& filled)
 
 int Hl7Parser::parseToken(int level, std::string& token, bool& isarray)
 {
-    token.clear();
+    const char* value = nullptr;
+    ssize_t size = 0;
+    int l = parseToken(level, value, size, token, isarray);
+    if (value != token.data())
+    {
+        token.assign(value, size);
+    }
+    return l;
+}
+
+int Hl7Parser::parseToken(int level, const char*& token, ssize_t& size, std::string& buffer, bool& isarray)
+{
+    token = m_str;
+    size = 0;
     isarray = false;
     int l = level;
     if (m_waitForDeleimiterField == 1)
     {
-        token = std::string(m_str - 1, m_str);
+        token = m_str - 1;
+        size = 1;
     }
     else if (m_waitForDeleimiterField == 2)
     {
         if (m_str + 4 < m_end)
         {
-            token = std::string(m_str, m_str + 4);
+            token = m_str;
+            size = 4;
             m_str += 4 + 1;
         }
     }
@@ -165,10 +179,11 @@ int Hl7Parser::parseToken(int level, std::string& token, bool& isarray)
         const char* start = m_str;
         while (true)
         {
+            m_str = m_scan.findDelimiter(m_str, m_end);
             char c = this->getChar(m_str);
             if (c == m_delimiterRepeat)
             {
-                token = deEscape(start, m_str);
+                getToken(start, m_str, token, size, buffer);
                 ++m_str;
                 isarray = true;
                 l = 1; // array is only on level = 1
@@ -179,7 +194,7 @@ int Hl7Parser::parseToken(int level, std::string& token, bool& isarray)
                 l = isDelimiter(c);
                 if (l < LAYER_MAX)
                 {
-                    token = deEscape(start, m_str);
+                    getToken(start, m_str, token, size, buffer);
                     if (l != -1)
                     {
                         ++m_str;
@@ -212,10 +227,17 @@ int Hl7Parser::parseTokenArray(int level, std::vector<std::string>& array)
     bool filled = false;
     while (true)
     {
+        const char* next = m_scan.findDelimiter(m_str, m_end);
+        if (next != m_str)
+        {
+            m_str = next;
+            filled = true;
+        }
         char c = this->getChar(m_str);
         if (c == m_delimiterRepeat)
         {
-            array.emplace_back(deEscape(start, m_str));
+            array.emplace_back();
+            deEscape(start, m_str, array.back());
             ++m_str;
             start = m_str;
             filled = true;
@@ -227,7 +249,8 @@ int Hl7Parser::parseTokenArray(int level, std::vector<std::string>& array)
             {
                 if (filled || (l > 1)) // array/repeated (~) is on layer 1 possible
                 {
-                    array.emplace_back(deEscape(start, m_str));
+                    array.emplace_back();
+                    deEscape(start, m_str, array.back());
                 }
                 if (l != -1)
                 {
@@ -268,9 +291,14 @@ int Hl7Parser::parseTillEndOfStruct(int level)
 int Hl7Parser::parseTillEndOfStructIntern(int level, bool stopOnArray, bool& isarray)
 {
     isarray = false;
-    char c;
-    while ((c = this->getChar(m_str)) != 0)
+    while (true)
     {
+        m_str = m_scan.findDelimiter(m_str, m_end);
+        char c = this->getChar(m_str);
+        if (c == 0)
+        {
+            break;
+        }
         int l = isDelimiter(c);
         if (l <= level)
         {
@@ -334,90 +362,103 @@ static unsigned char hex2char(char c)
     return num;
 }
 
-std::string Hl7Parser::deEscape(const char* start, const char* end) const
+void Hl7Parser::getToken(const char* start, const char* end, const char*& token, ssize_t& size, std::string& buffer) const
+{
+    if (memchr(start, m_escape, end - start) == nullptr)
+    {
+        token = start;
+        size = end - start;
+    }
+    else
+    {
+        deEscape(start, end, buffer);
+        token = buffer.data();
+        size = buffer.size();
+    }
+}
+
+void Hl7Parser::deEscape(const char* start, const char* end, std::string& dest) const
 {
-    std::string dest;
+    dest.clear();
     const char* src = start;
     while (src < end)
     {
+        // the text till the next escape sequence is copied at once
+        const char* escape = static_cast<const char*>(memchr(src, m_escape, end - src));
+        if (escape == nullptr)
+        {
+            dest.append(src, end);
+            return;
+        }
+        dest.append(src, escape);
+        src = escape + 1;
+        if (src >= end)
+        {
+            return;
+        }
         char c = *src;
-        if (c == m_escape)
+        switch(c)
         {
-            ++src;
-            if (src >= end)
-            {
-                return dest;
-            }
-            c = *src;
-            switch(c)
-            {
-                case 'E':
-                    dest += m_escape;
-                    ++src;
-                    break;
-                case 'F':
-                    dest += m_delimiterField[1]; // |
-                    ++src;
-                    break;
-                case 'R':
-                    dest += m_delimiterRepeat; // ~
-                    ++src;
-                    break;
-                case 'S':
-                    dest += m_delimiterField[2]; // ^
+            case 'E':
+                dest += m_escape;
+                ++src;
+                break;
+            case 'F':
+                dest += m_delimiterField[1]; // |
+                ++src;
+                break;
+            case 'R':
+                dest += m_delimiterRepeat; // ~
+                ++src;
+                break;
+            case 'S':
+                dest += m_delimiterField[2]; // ^
+                ++src;
+                break;
+            case 'T':
+                dest += m_delimiterField[3]; // &
+                ++src;
+                break;
+            case 'X':
+                while (true)
+                {
                     ++src;
-                    break;
-                case 'T':
-                    dest += m_delimiterField[3]; // &
+                    if (src >= end)
+                    {
+                        break;
+                    }
+                    c = *src;
+                    if (c == '\\')
+                    {
+                        break;
+                    }
+                    unsigned char num = hex2char(c);
+                    if (num == static_cast<unsigned char>(0xff))
+                    {
+                        return;
+                    }
+                    unsigned char d = num;
                     ++src;
-                    break;
-                case 'X':
-                    while (true)
+                    if (src >= end)
                     {
-                        ++src;
-                        if (src >= end)
-                        {
-                            break;
-                        }
-                        c = *src;
-                        if (c == '\\')
-                        {
-                            break;
-                        }
-                        unsigned char num = hex2char(c);
-                        if (num == static_cast<unsigned char>(0xff))
-                        {
-                            return dest;
-                        }
-                        unsigned char d = num;
-                        ++src;
-                        if (src >= end)
-                        {
-                            break;
-                        }
-                        c = *src;
-                        num = hex2char(c);
-                        if (num == static_cast<unsigned char>(0xff))
-                        {
-                            return dest;
-                        }
-                        d = static_cast<unsigned char>(d << 4);
-                        d |= num;
-                        dest += d;
+                        break;
                     }
-                    break;
-                default:
-                    break;
-            }
-        }
-        else
-        {
-            dest += c;
+                    c = *src;
+                    num = hex2char(c);
+                    if (num == static_cast<unsigned char>(0xff))
+                    {
+                        return;
+                    }
+                    d = static_cast<unsigned char>(d << 4);
+                    d |= num;
+                    dest += d;
+                }
+                break;
+            default:
+                break;
         }
         ++src;
     }
-
-    return dest;
 }
 
 } // namespace finalmq
@@ -0,0 +1,125 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "finalmq/hl7/Hl7Scan.h"
+
+#include <cstdint>
+
+#include "finalmq/helpers/Simd.h"
+
+namespace finalmq
+{
+static const char* findDelimiterScalar(const Hl7Scan& scan, const char* str, const char* end)
+{
+    while (str < end && !scan.isDelimiter(*str))
+    {
+        ++str;
+    }
+    return str;
+}
+
+#ifdef FINALMQ_SIMD_SSE2
+
+static const char* findDelimiterSse2(const Hl7Scan& scan, const char* str, const char* end)
+{
+    const char* delimiters = scan.getDelimiters();
+    const __m128i segment = _mm_set1_epi8(delimiters[0]);
+    const __m128i field = _mm_set1_epi8(delimiters[1]);
+    const __m128i component = _mm_set1_epi8(delimiters[2]);
+    const __m128i subcomponent = _mm_set1_epi8(delimiters[3]);
+    const __m128i repeat = _mm_set1_epi8(delimiters[4]);
+    const __m128i zero = _mm_setzero_si128();
+    while (end - str >= 16)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str));
+        const __m128i found = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, segment), _mm_cmpeq_epi8(block, field)),
+                                                        _mm_or_si128(_mm_cmpeq_epi8(block, component), _mm_cmpeq_epi8(block, subcomponent))),
+                                           _mm_or_si128(_mm_cmpeq_epi8(block, repeat), _mm_cmpeq_epi8(block, zero)));
+        const std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(found));
+        if (mask != 0)
+        {
+            return str + Simd::countTrailingZeros(mask);
+        }
+        str += 16;
+    }
+    return findDelimiterScalar(scan, str, end);
+}
+
+#endif
+
+#ifdef FINALMQ_SIMD_AVX2
+
+FINALMQ_SIMD_TARGET_AVX2 static const char* findDelimiterAvx2(const Hl7Scan& scan, const char* str, const char* end)
+{
+    const char* delimiters = scan.getDelimiters();
+    const __m256i segment = _mm256_set1_epi8(delimiters[0]);
+    const __m256i field = _mm256_set1_epi8(delimiters[1]);
+    const __m256i component = _mm256_set1_epi8(delimiters[2]);
+    const __m256i subcomponent = _mm256_set1_epi8(delimiters[3]);
+    const __m256i repeat = _mm256_set1_epi8(delimiters[4]);
+    const __m256i zero = _mm256_setzero_si256();
+    while (end - str >= 32)
+    {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str));
+        const __m256i found = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(block, segment), _mm256_cmpeq_epi8(block, field)),
+                                                              _mm256_or_si256(_mm256_cmpeq_epi8(block, component), _mm256_cmpeq_epi8(block, subcomponent))),
+                                              _mm256_or_si256(_mm256_cmpeq_epi8(block, repeat), _mm256_cmpeq_epi8(block, zero)));
+        const std::uint32_t mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(found));
+        if (mask != 0)
+        {
+            return str + Simd::countTrailingZeros(mask);
+        }
+        str += 32;
+    }
+    return findDelimiterSse2(scan, str, end);
+}
+
+#endif
+
+typedef const char* (*FuncHl7Scan)(const Hl7Scan& scan, const char* str, const char* end);
+
+Hl7Scan::Hl7Scan()
+{
+    m_isDelimiter[0] = true;
+}
+
+void Hl7Scan::setDelimiters(const char (&delimiters)[NUMBER_OF_DELIMITERS])
+{
+    for (int i = 0; i < NUMBER_OF_DELIMITERS; ++i)
+    {
+        m_isDelimiter[static_cast<unsigned char>(m_delimiters[i])] = false;
+    }
+    for (int i = 0; i < NUMBER_OF_DELIMITERS; ++i)
+    {
+        m_delimiters[i] = delimiters[i];
+        m_isDelimiter[static_cast<unsigned char>(delimiters[i])] = true;
+    }
+    m_isDelimiter[0] = true;
+}
+
+const char* Hl7Scan::findDelimiterBlocks(const char* str, const char* end) const
+{
+    static const FuncHl7Scan findDelimiter = FINALMQ_SIMD_SELECT(findDelimiterScalar, findDelimiterSse2, findDelimiterAvx2);
+    return findDelimiter(*this, str, end);
+}
+
+} // namespace finalmq
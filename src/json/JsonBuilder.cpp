@@ -29,7 +29,9 @@
 
 #include <assert.h>
 #include <string.h>
+#include <cmath>
 #include <iostream>
+#include <limits>
 
 
 namespace finalmq {
@@ -283,6 +285,112 @@ void JsonBuilder::correctComma()
 }
 
 
+static const ssize_t ARRAY_CHUNK = 256;
+
+template<class T, class F>
+void JsonBuilder::enterArrayNumbers(const T* value, ssize_t size, ssize_t maxSizeEntry, F funcWrite)
+{
+    enterArray();
+    const T* end = value + size;
+    while (value < end)
+    {
+        const T* endChunk = value + std::min<ssize_t>(end - value, ARRAY_CHUNK);
+        reserveSpace((endChunk - value) * maxSizeEntry);
+        assert(m_buffer);
+        char* buffer = m_buffer;
+        for (; value < endChunk; ++value)
+        {
+            buffer = funcWrite(*value, buffer);
+            *buffer = ',';
+            ++buffer;
+        }
+        m_buffer = buffer;
+    }
+    exitArray();
+}
+
+void JsonBuilder::enterArrayInt32(const std::int32_t* value, ssize_t size)
+{
+    enterArrayNumbers(value, size, 12, [](std::int32_t entry, char* buffer) {
+        return rapidjson::i32toa(entry, buffer);
+    });
+}
+
+void JsonBuilder::enterArrayUInt32(const std::uint32_t* value, ssize_t size)
+{
+    enterArrayNumbers(value, size, 11, [](std::uint32_t entry, char* buffer) {
+        return rapidjson::u32toa(entry, buffer);
+    });
+}
+
+void JsonBuilder::enterArrayInt64(const std::int64_t* value, ssize_t size, bool quoted)
+{
+    enterArrayNumbers(value, size, 24, [quoted](std::int64_t entry, char* buffer) {
+        if (!quoted)
+        {
+            return rapidjson::i64toa(entry, buffer);
+        }
+        *buffer = '\"';
+        buffer = rapidjson::i64toa(entry, buffer + 1);
+        *buffer = '\"';
+        return buffer + 1;
+    });
+}
+
+void JsonBuilder::enterArrayUInt64(const std::uint64_t* value, ssize_t size, bool quoted)
+{
+    enterArrayNumbers(value, size, 24, [quoted](std::uint64_t entry, char* buffer) {
+        if (!quoted)
+        {
+            return rapidjson::u64toa(entry, buffer);
+        }
+        *buffer = '\"';
+        buffer = rapidjson::u64toa(entry, buffer + 1);
+        *buffer = '\"';
+        return buffer + 1;
+    });
+}
+
+static char* writeDouble(double value, char* buffer)
+{
+#ifndef WIN32
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfloat-equal"
+#endif
+    if (std::isnan(value))
+    {
+        memcpy(buffer, "\"NaN\"", 5);
+        return buffer + 5;
+    }
+    else if (value == std::numeric_limits<double>::infinity())
+    {
+        memcpy(buffer, "\"Infinity\"", 10);
+        return buffer + 10;
+    }
+    else if (value == -std::numeric_limits<double>::infinity())
+    {
+        memcpy(buffer, "\"-Infinity\"", 11);
+        return buffer + 11;
+    }
+#ifndef WIN32
+#pragma GCC diagnostic pop
+#endif
+    return rapidjson::dtoa(value, buffer);
+}
+
+void JsonBuilder::enterArrayFloat(const float* value, ssize_t size)
+{
+    enterArrayNumbers(value, size, 50, [](float entry, char* buffer) {
+        return writeDouble(entry, buffer);
+    });
+}
+
+void JsonBuilder::enterArrayDouble(const double* value, ssize_t size)
+{
+    enterArrayNumbers(value, size, 50, writeDouble);
+}
+
+
 
 static unsigned char getRange(unsigned char c)
 {
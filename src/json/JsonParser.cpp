@@ -28,7 +28,9 @@
 
 #include <assert.h>
 
+#include "finalmq/conversions/NumberParser.h"
 #include "finalmq/helpers/FmqDefines.h"
+#include "finalmq/json/JsonScan.h"
 
 namespace finalmq
 {
@@ -44,22 +46,7 @@ char JsonParser::getChar(const char* str) const
 
 void JsonParser::parseWhiteSpace()
 {
-    char c;
-    while ((c = this->getChar(m_str)) != 0)
-    {
-        switch(c)
-        {
-            case ' ':
-            case '\t':
-            case '\n':
-            case '\r':
-                m_str++;
-                break;
-            default:
-                return;
-                break;
-        }
-    }
+    m_str = JsonScan::skipWhiteSpace(m_str, m_end);
 }
 
 const char* JsonParser::parse(const char* str, ssize_t size)
@@ -223,13 +210,14 @@ void JsonParser::parseNumber()
         }
     }
 
-    char* res = nullptr;
+    const char* res = nullptr;
     if (isFloat)
     {
-        double value = strtof64(first, &res);
+        double value = 0;
+        res = NumberParser::parseDouble(first, m_str, value);
         if (res != m_str)
         {
-            m_visitor.syntaxError(res, "wrong number format");
+            m_visitor.syntaxError(res ? res : first, "wrong number format");
             m_str = nullptr;
             return;
         }
@@ -237,14 +225,14 @@ void JsonParser::parseNumber()
     }
     else if (isNegative)
     {
-        long long value = strtoll(first, &res, 10);
+        std::int64_t value = 0;
+        res = NumberParser::parseInt64(first, m_str, value);
         if (res != m_str)
         {
-            m_visitor.syntaxError(res, "wrong number format");
+            m_visitor.syntaxError(res ? res : first, "wrong number format");
             m_str = nullptr;
             return;
         }
-        assert(value < 0);
         if (value >= INT_MIN)
         {
             m_visitor.enterInt32(static_cast<std::int32_t>(value));
@@ -256,10 +244,11 @@ void JsonParser::parseNumber()
     }
     else
     {
-        unsigned long long value = strtoull(first, &res, 10);
+        std::uint64_t value = 0;
+        res = NumberParser::parseUInt64(first, m_str, value);
         if (res != m_str)
         {
-            m_visitor.syntaxError(res, "wrong number format");
+            m_visitor.syntaxError(res ? res : first, "wrong number format");
             m_str = nullptr;
             return;
         }
@@ -272,9 +261,6 @@ void JsonParser::parseNumber()
             m_visitor.enterUInt64(value);
         }
     }
-
-    assert(res);
-    m_str = res;
 }
 
 static std::int32_t getHexDigit(char c)
@@ -320,28 +306,21 @@ void JsonParser::parseString(bool key)
     const char* strBegin = m_str;
 
     // try fast parse. it is fast when there is no escape character in the string
-    char c;
-    while ((c = getChar(m_str)) != 0)
+    m_str = JsonScan::findStringSpecial(m_str, m_end);
+    char c = getChar(m_str);
+    if (c == '\"')
     {
-        if (c == '\"')
+        ssize_t size = m_str - strBegin;
+        if (key)
         {
-            ssize_t size = m_str - strBegin;
-            if (key)
-            {
-                m_visitor.enterKey(strBegin, size);
-            }
-            else
-            {
-                m_visitor.enterString(strBegin, size);
-            }
-            m_str++;
-            return;
+            m_visitor.enterKey(strBegin, size);
         }
-        else if (c == '\\')
+        else
         {
-            break;
+            m_visitor.enterString(strBegin, size);
         }
         m_str++;
+        return;
     }
 
     if (c == 0)
@@ -477,7 +456,11 @@ void JsonParser::parseString(bool key)
         }
         else
         {
-            dest += c;
+            // copy the characters up to the next '"' or '\\' at once
+            const char* next = JsonScan::findStringSpecial(m_str, m_end);
+            dest.append(m_str, next);
+            m_str = next;
+            continue;
         }
         m_str++;
     }
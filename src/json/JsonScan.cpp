@@ -0,0 +1,156 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "finalmq/json/JsonScan.h"
+
+#include <cstdint>
+
+#include "finalmq/helpers/Simd.h"
+
+namespace finalmq
+{
+static inline bool isStringSpecial(char c)
+{
+    return (c == '\"' || c == '\\' || c == 0);
+}
+
+static const char* findStringSpecialScalar(const char* str, const char* end)
+{
+    while (str < end && !isStringSpecial(*str))
+    {
+        ++str;
+    }
+    return str;
+}
+
+static const char* skipWhiteSpaceScalar(const char* str, const char* end)
+{
+    while (str < end && JsonScan::isWhiteSpace(*str))
+    {
+        ++str;
+    }
+    return str;
+}
+
+#ifdef FINALMQ_SIMD_SSE2
+
+static const char* findStringSpecialSse2(const char* str, const char* end)
+{
+    const __m128i quote = _mm_set1_epi8('\"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i zero = _mm_setzero_si128();
+    while (end - str >= 16)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str));
+        const __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, quote), _mm_cmpeq_epi8(block, backslash)), _mm_cmpeq_epi8(block, zero));
+        const std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(special));
+        if (mask != 0)
+        {
+            return str + Simd::countTrailingZeros(mask);
+        }
+        str += 16;
+    }
+    return findStringSpecialScalar(str, end);
+}
+
+static const char* skipWhiteSpaceSse2(const char* str, const char* end)
+{
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i newLine = _mm_set1_epi8('\n');
+    const __m128i carriageReturn = _mm_set1_epi8('\r');
+    while (end - str >= 16)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str));
+        const __m128i whiteSpace = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, space), _mm_cmpeq_epi8(block, tab)),
+                                                _mm_or_si128(_mm_cmpeq_epi8(block, newLine), _mm_cmpeq_epi8(block, carriageReturn)));
+        const std::uint32_t mask = static_cast<std::uint32_t>(~_mm_movemask_epi8(whiteSpace)) & 0xffff;
+        if (mask != 0)
+        {
+            return str + Simd::countTrailingZeros(mask);
+        }
+        str += 16;
+    }
+    return skipWhiteSpaceScalar(str, end);
+}
+
+#endif
+
+#ifdef FINALMQ_SIMD_AVX2
+
+FINALMQ_SIMD_TARGET_AVX2 static const char* findStringSpecialAvx2(const char* str, const char* end)
+{
+    const __m256i quote = _mm256_set1_epi8('\"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i zero = _mm256_setzero_si256();
+    while (end - str >= 32)
+    {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str));
+        const __m256i special = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(block, quote), _mm256_cmpeq_epi8(block, backslash)), _mm256_cmpeq_epi8(block, zero));
+        const std::uint32_t mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(special));
+        if (mask != 0)
+        {
+            return str + Simd::countTrailingZeros(mask);
+        }
+        str += 32;
+    }
+    return findStringSpecialSse2(str, end);
+}
+
+FINALMQ_SIMD_TARGET_AVX2 static const char* skipWhiteSpaceAvx2(const char* str, const char* end)
+{
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i newLine = _mm256_set1_epi8('\n');
+    const __m256i carriageReturn = _mm256_set1_epi8('\r');
+    while (end - str >= 32)
+    {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str));
+        const __m256i whiteSpace = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(block, space), _mm256_cmpeq_epi8(block, tab)),
+                                                   _mm256_or_si256(_mm256_cmpeq_epi8(block, newLine), _mm256_cmpeq_epi8(block, carriageReturn)));
+        const std::uint32_t mask = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(whiteSpace));
+        if (mask != 0)
+        {
+            return str + Simd::countTrailingZeros(mask);
+        }
+        str += 32;
+    }
+    return skipWhiteSpaceSse2(str, end);
+}
+
+#endif
+
+typedef const char* (*FuncScan)(const char* str, const char* end);
+
+const char* JsonScan::findStringSpecial(const char* str, const char* end)
+{
+    static const FuncScan findStringSpecial = FINALMQ_SIMD_SELECT(findStringSpecialScalar, findStringSpecialSse2, findStringSpecialAvx2);
+    return findStringSpecial(str, end);
+}
+
+const char* JsonScan::skipWhiteSpaceBlocks(const char* str, const char* end)
+{
+    static const FuncScan skipWhiteSpace = FINALMQ_SIMD_SELECT(skipWhiteSpaceScalar, skipWhiteSpaceSse2, skipWhiteSpaceAvx2);
+    return skipWhiteSpace(str, end);
+}
+
+} // namespace finalmq
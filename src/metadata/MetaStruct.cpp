@@ -23,7 +23,11 @@
 
 #include "finalmq/metadata/MetaStruct.h"
 
+#include <algorithm>
 #include <unordered_map>
+#include <unordered_set>
+
+#include <string.h>
 
 
 namespace finalmq {
@@ -34,6 +38,25 @@ static std::string removeNamespace(const std::string& typeName)
     return typeName.substr(pos, typeName.size() - pos);
 }
 
+static inline std::uint32_t hashName(const char* name, ssize_t size, std::uint32_t seed)
+{
+    // FNV-1a with a murmur3 finalizer, so that the low bits depend on all characters
+    std::uint32_t hash = 2166136261u ^ seed;
+    for (ssize_t i = 0; i < size; ++i)
+    {
+        hash ^= static_cast<unsigned char>(name[i]);
+        hash *= 16777619u;
+    }
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+static const std::uint32_t MAX_SEED = 0x10000;
+
 
 MetaStruct::MetaStruct()
     : m_flags(0)
@@ -49,10 +72,16 @@ MetaStruct::MetaStruct(const std::string& typeName, const std::string& descripti
     , m_attrs(attrs)
     , m_properties(generateProperties(attrs))
 {
+    std::unordered_set<std::string> names;
     for (size_t i = 0 ; i < fields.size(); ++i)
     {
-        addField(fields[i]);
+        // ignore fields that were already added
+        if (names.insert(fields[i].name).second)
+        {
+            addFieldIntern(fields[i]);
+        }
     }
+    buildFieldTable();
 }
 
 
@@ -99,10 +128,30 @@ const MetaField* MetaStruct::getFieldByIndex(ssize_t index) const
 
 const MetaField* MetaStruct::getFieldByName(const std::string& name) const
 {
-    auto it = m_name2Field.find(name);
-    if (it != m_name2Field.end())
+    return getFieldByName(name.data(), name.size());
+}
+
+
+const MetaField* MetaStruct::getFieldByName(const char* name, ssize_t size) const
+{
+    if (!m_fieldTable.empty())
     {
-        return it->second.get();
+        const std::uint32_t mask = static_cast<std::uint32_t>(m_fieldTable.size() - 1);
+        const std::uint32_t seed = m_fieldTableSeeds[hashName(name, size, 0) & mask];
+        const MetaField* field = m_fieldTable[hashName(name, size, seed) & mask];
+        if (field && static_cast<ssize_t>(field->name.size()) == size && memcmp(field->name.data(), name, size) == 0)
+        {
+            return field;
+        }
+    }
+    // the fields, which were added after the table was built
+    for (size_t i = m_fieldsInTable; i < m_fields.size(); ++i)
+    {
+        const MetaField* field = m_fields[i].get();
+        if (static_cast<ssize_t>(field->name.size()) == size && memcmp(field->name.data(), name, size) == 0)
+        {
+            return field;
+        }
     }
     return nullptr;
 }
@@ -110,17 +159,114 @@ const MetaField* MetaStruct::getFieldByName(const std::string& name) const
 
 void MetaStruct::addField(const MetaField& field)
 {
-    if (m_name2Field.find(field.name) != m_name2Field.end())
+    if (getFieldByName(field.name) != nullptr)
     {
         // field already added
         return;
     }
 
+    addFieldIntern(field);
+
+    // structs that are built field by field shall not rebuild the table for every field,
+    // the table is rebuilt when the not hashed fields outnumber the hashed ones.
+    const size_t fieldsNotInTable = m_fields.size() - m_fieldsInTable;
+    if (fieldsNotInTable > FIELDS_NOT_IN_TABLE_MIN && fieldsNotInTable > m_fieldsInTable)
+    {
+        buildFieldTable();
+    }
+}
+
+
+void MetaStruct::addFieldIntern(const MetaField& field)
+{
     std::shared_ptr<MetaField> f = std::make_shared<MetaField>(MetaField(field.typeId, field.typeName, field.name, 
         field.description, field.flags, field.attrs, static_cast<int>(m_fields.size())));
 
     m_fields.emplace_back(f);
-    m_name2Field.emplace(f->name, f);
+}
+
+
+void MetaStruct::buildFieldTable()
+{
+    m_fieldTable.clear();
+    m_fieldTableSeeds.clear();
+    m_fieldsInTable = m_fields.size();
+    if (m_fields.empty())
+    {
+        return;
+    }
+
+    size_t sizeTable = 1;
+    while (sizeTable < m_fields.size())
+    {
+        sizeTable <<= 1;
+    }
+
+    bool done = false;
+    while (!done)
+    {
+        const std::uint32_t mask = static_cast<std::uint32_t>(sizeTable - 1);
+        std::vector<std::vector<const MetaField*>> buckets(sizeTable);
+        for (size_t i = 0; i < m_fields.size(); ++i)
+        {
+            const std::string& name = m_fields[i]->name;
+            buckets[hashName(name.data(), name.size(), 0) & mask].push_back(m_fields[i].get());
+        }
+
+        // place the largest buckets first, while there are still many free slots
+        std::vector<size_t> order(sizeTable);
+        for (size_t i = 0; i < sizeTable; ++i)
+        {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), [&buckets](size_t a, size_t b) {
+            return buckets[a].size() > buckets[b].size();
+        });
+
+        m_fieldTable.assign(sizeTable, nullptr);
+        m_fieldTableSeeds.assign(sizeTable, 0);
+        done = true;
+        std::vector<std::uint32_t> slots;
+        for (size_t i = 0; i < sizeTable && done; ++i)
+        {
+            const std::vector<const MetaField*>& bucket = buckets[order[i]];
+            if (bucket.empty())
+            {
+                break;
+            }
+            bool placed = false;
+            for (std::uint32_t seed = 1; seed < MAX_SEED && !placed; ++seed)
+            {
+                slots.clear();
+                placed = true;
+                for (size_t n = 0; n < bucket.size() && placed; ++n)
+                {
+                    const std::string& name = bucket[n]->name;
+                    std::uint32_t slot = hashName(name.data(), name.size(), seed) & mask;
+                    if (m_fieldTable[slot] != nullptr || std::find(slots.begin(), slots.end(), slot) != slots.end())
+                    {
+                        placed = false;
+                    }
+                    slots.push_back(slot);
+                }
+                if (placed)
+                {
+                    for (size_t n = 0; n < bucket.size(); ++n)
+                    {
+                        m_fieldTable[slots[n]] = bucket[n];
+                    }
+                    m_fieldTableSeeds[order[i]] = seed;
+                }
+            }
+            done = placed;
+        }
+
+        if (!done)
+        {
+            // no seed found, try again with a larger table
+            sizeTable <<= 1;
+        }
+    }
 }
 
 
@@ -30,6 +30,7 @@
 #include "finalmq/serializejson/SerializerJson.h"
 #include "finalmq/serializeproto/ParserProto.h"
 #include "finalmq/serializeproto/SerializerProto.h"
+#include "finalmq/serializeproto/SerializerProtoSized.h"
 #include "finalmq/serializestruct/ParserStruct.h"
 #include "finalmq/serializestruct/SerializerStruct.h"
 
@@ -217,9 +218,13 @@ void MetaDataExchange::exportMetaDataProto(std::string& proto)
     exportMetaData(root);
 
     ZeroCopyBuffer buffer;
-    SerializerProto serializer(buffer, 8192);
-    ParserStruct parser(serializer, root);
-    parser.parseStruct();
+    SerializerProtoSized serializerSized(buffer);
+    if (!serializerSized.serializeStruct(root))
+    {
+        SerializerProto serializer(buffer, 8192);
+        ParserStruct parser(serializer, root);
+        parser.parseStruct();
+    }
 
     proto = buffer.getData();
 }
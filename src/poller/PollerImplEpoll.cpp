@@ -48,8 +48,9 @@ PollerImplEpoll::~PollerImplEpoll()
     }
 }
 
-void PollerImplEpoll::init()
+void PollerImplEpoll::init(ReceiveMode receiveMode)
 {
+    m_receiveMode = receiveMode;
     m_fdEpoll = OperatingSystem::instance().epoll_create1(EPOLL_CLOEXEC);
     assert(m_fdEpoll != -1);
     int res = OperatingSystem::instance().makeSocketPair(m_controlSocketRead, m_controlSocketWrite);
@@ -59,6 +60,11 @@ void PollerImplEpoll::init()
         assert(m_controlSocketRead);
         addSocketEnableRead(m_controlSocketRead);
     }
+    // the control socket stays level triggered, all other sockets get the edge triggered flag
+    if (m_receiveMode == ReceiveMode::RECEIVEMODE_EDGETRIGGERED)
+    {
+        m_eventFlags = EPOLLET;
+    }
 }
 
 void PollerImplEpoll::addSocket(const SocketDescriptorPtr& fd)
@@ -68,7 +74,7 @@ void PollerImplEpoll::addSocket(const SocketDescriptorPtr& fd)
     if (result.second)
     {
         epoll_event ev;
-        ev.events = 0;
+        ev.events = m_eventFlags;
         ev.data.fd = fd->getDescriptor();
         int res = OperatingSystem::instance().epoll_ctl(m_fdEpoll, EPOLL_CTL_ADD, fd->getDescriptor(), &ev);
         if (res == -1)
@@ -92,7 +98,7 @@ void PollerImplEpoll::addSocketEnableRead(const SocketDescriptorPtr& fd)
     if (result.second)
     {
         epoll_event ev;
-        ev.events = EPOLLIN;
+        ev.events = EPOLLIN | m_eventFlags;
         ev.data.fd = fd->getDescriptor();
         int res = OperatingSystem::instance().epoll_ctl(m_fdEpoll, EPOLL_CTL_ADD, fd->getDescriptor(), &ev);
         if (res == -1)
@@ -142,7 +148,7 @@ void PollerImplEpoll::enableRead(const SocketDescriptorPtr& fd)
     {
         it->second |= EPOLLIN;
         epoll_event ev;
-        ev.events = it->second;
+        ev.events = it->second | m_eventFlags;
         ev.data.fd = fd->getDescriptor();
         int res = OperatingSystem::instance().epoll_ctl(m_fdEpoll, EPOLL_CTL_MOD, fd->getDescriptor(), &ev);
         if (res == -1)
@@ -166,7 +172,7 @@ void PollerImplEpoll::disableRead(const SocketDescriptorPtr& fd)
     {
         it->second &= ~EPOLLIN;
         epoll_event ev;
-        ev.events = it->second;
+        ev.events = it->second | m_eventFlags;
         ev.data.fd = fd->getDescriptor();
         int res = OperatingSystem::instance().epoll_ctl(m_fdEpoll, EPOLL_CTL_MOD, fd->getDescriptor(), &ev);
         if (res == -1)
@@ -190,7 +196,7 @@ void PollerImplEpoll::enableWrite(const SocketDescriptorPtr& fd)
     {
         it->second |= EPOLLOUT;
         epoll_event ev;
-        ev.events = it->second;
+        ev.events = it->second | m_eventFlags;
         ev.data.fd = fd->getDescriptor();
         int res = OperatingSystem::instance().epoll_ctl(m_fdEpoll, EPOLL_CTL_MOD, fd->getDescriptor(), &ev);
         if (res == -1)
@@ -214,7 +220,7 @@ void PollerImplEpoll::disableWrite(const SocketDescriptorPtr& fd)
     {
         it->second &= ~EPOLLOUT;
         epoll_event ev;
-        ev.events = it->second;
+        ev.events = it->second | m_eventFlags;
         ev.data.fd = fd->getDescriptor();
         int res = OperatingSystem::instance().epoll_ctl(m_fdEpoll, EPOLL_CTL_MOD, fd->getDescriptor(), &ev);
         if (res == -1)
@@ -284,15 +290,15 @@ void PollerImplEpoll::collectSockets(int res)
             }
             if (pe.events & EPOLLIN)
             {
-                int countRead = 0;
-                int resIoCtl = OperatingSystem::instance().ioctlInt(sd, FIONREAD, &countRead);
-                if (resIoCtl == -1)
-                {
-                    countRead = 0;
-                }
-
                 if (sd == m_controlSocketRead->getDescriptor())
                 {
+                    int countRead = 0;
+                    int resIoCtl = OperatingSystem::instance().ioctlInt(sd, FIONREAD, &countRead);
+                    if (resIoCtl == -1)
+                    {
+                        countRead = 0;
+                    }
+
                     if (countRead > 0)
                     {
                         // read pending bytes from control socket
@@ -315,7 +321,22 @@ void PollerImplEpoll::collectSockets(int res)
                     assert(descriptorInfo);
                     assert(descriptorInfo->sd == sd);
                     descriptorInfo->readable = true;
-                    descriptorInfo->bytesToRead = countRead;
+                    if (m_receiveMode == ReceiveMode::RECEIVEMODE_PENDINGREAD)
+                    {
+                        int countRead = 0;
+                        int resIoCtl = OperatingSystem::instance().ioctlInt(sd, FIONREAD, &countRead);
+                        if (resIoCtl == -1)
+                        {
+                            countRead = 0;
+                        }
+                        descriptorInfo->bytesToRead = countRead;
+                    }
+                    else
+                    {
+                        // the receiver reads until the socket would block
+                        descriptorInfo->bytesToRead = -1;
+                        m_syscallsSaved.fetch_add(1, std::memory_order_relaxed);
+                    }
                 }
             }
         }
@@ -382,6 +403,16 @@ void PollerImplEpoll::releaseWait(std::uint32_t info)
     }
 }
 
+ReceiveMode PollerImplEpoll::getReceiveMode() const
+{
+    return m_receiveMode;
+}
+
+std::uint64_t PollerImplEpoll::getSyscallsSaved() const
+{
+    return m_syscallsSaved.load(std::memory_order_relaxed);
+}
+
 } // namespace finalmq
 
 #endif
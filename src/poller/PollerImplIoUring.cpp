@@ -0,0 +1,615 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#if defined(USE_IO_URING)
+
+#include "finalmq/poller/PollerImplIoUring.h"
+
+#include <assert.h>
+#include <poll.h>
+#include <signal.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+
+#include "finalmq/helpers/ModulenameFinalmq.h"
+#include "finalmq/helpers/OperatingSystem.h"
+#include "finalmq/logger/LogStream.h"
+
+namespace finalmq
+{
+static const unsigned int RING_ENTRIES = 256;
+static const std::uint64_t USERDATA_POLL_REMOVE = 0xFFFFFFFFFFFFFFFFull;
+static const std::uint32_t REQUIRED_FEATURES = IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG | IORING_FEAT_POLL_32BITS;
+
+static std::uint64_t makeUserData(SOCKET sd, std::uint32_t sequence)
+{
+    return (static_cast<std::uint64_t>(sequence) << 32) | static_cast<std::uint32_t>(sd);
+}
+
+PollerImplIoUring::PollerImplIoUring()
+{
+}
+
+PollerImplIoUring::~PollerImplIoUring()
+{
+    if (m_sqes)
+    {
+        std::unique_lock<std::mutex> locker(m_mutex);
+        for (const auto& entry : m_socketDescriptors)
+        {
+            if (entry.second.sequence != 0)
+            {
+                removePoll(makeUserData(entry.first, entry.second.sequence));
+            }
+        }
+        submit();
+    }
+    releaseRing();
+}
+
+bool PollerImplIoUring::isAvailable()
+{
+    static const bool available = []() {
+        io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        int fd = OperatingSystem::instance().io_uring_setup(4, &params);
+        if (fd < 0)
+        {
+            return false;
+        }
+        bool ok = ((params.features & REQUIRED_FEATURES) == REQUIRED_FEATURES);
+        if (ok)
+        {
+            static const unsigned int NUMBER_OF_OPS = 256;
+            std::vector<char> buffer(sizeof(io_uring_probe) + NUMBER_OF_OPS * sizeof(io_uring_probe_op), 0);
+            io_uring_probe* probe = reinterpret_cast<io_uring_probe*>(buffer.data());
+            int res = OperatingSystem::instance().io_uring_register(fd, IORING_REGISTER_PROBE, probe, NUMBER_OF_OPS);
+            ok = (res == 0 && probe->last_op >= IORING_OP_POLL_REMOVE &&
+                  (probe->ops[IORING_OP_POLL_ADD].flags & IO_URING_OP_SUPPORTED) &&
+                  (probe->ops[IORING_OP_POLL_REMOVE].flags & IO_URING_OP_SUPPORTED));
+        }
+        OperatingSystem::instance().close(fd);
+        return ok;
+    }();
+    return available;
+}
+
+bool PollerImplIoUring::setupRing()
+{
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    m_fdRing = OperatingSystem::instance().io_uring_setup(RING_ENTRIES, &params);
+    if (m_fdRing < 0)
+    {
+        streamFatal << "io_uring_setup failed with errno: " << OperatingSystem::instance().getLastError();
+        m_fdRing = -1;
+        return false;
+    }
+
+    m_ringSqSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+    m_ringCqSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP);
+    if (singleMmap)
+    {
+        m_ringSqSize = std::max(m_ringSqSize, m_ringCqSize);
+        m_ringCqSize = m_ringSqSize;
+    }
+    m_ringSq = ::mmap(nullptr, m_ringSqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fdRing, IORING_OFF_SQ_RING);
+    if (m_ringSq == MAP_FAILED)
+    {
+        m_ringSq = nullptr;
+        releaseRing();
+        return false;
+    }
+    if (singleMmap)
+    {
+        m_ringCq = m_ringSq;
+    }
+    else
+    {
+        m_ringCq = ::mmap(nullptr, m_ringCqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fdRing, IORING_OFF_CQ_RING);
+        if (m_ringCq == MAP_FAILED)
+        {
+            m_ringCq = nullptr;
+            releaseRing();
+            return false;
+        }
+    }
+    m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes = ::mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fdRing, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED)
+    {
+        releaseRing();
+        return false;
+    }
+    m_sqes = static_cast<io_uring_sqe*>(sqes);
+
+    char* sq = static_cast<char*>(m_ringSq);
+    m_sqHead = reinterpret_cast<unsigned int*>(sq + params.sq_off.head);
+    m_sqTail = reinterpret_cast<unsigned int*>(sq + params.sq_off.tail);
+    m_sqMask = reinterpret_cast<unsigned int*>(sq + params.sq_off.ring_mask);
+    m_sqArray = reinterpret_cast<unsigned int*>(sq + params.sq_off.array);
+    m_sqEntries = params.sq_entries;
+    char* cq = static_cast<char*>(m_ringCq);
+    m_cqHead = reinterpret_cast<unsigned int*>(cq + params.cq_off.head);
+    m_cqTail = reinterpret_cast<unsigned int*>(cq + params.cq_off.tail);
+    m_cqMask = reinterpret_cast<unsigned int*>(cq + params.cq_off.ring_mask);
+    m_cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    return true;
+}
+
+void PollerImplIoUring::releaseRing()
+{
+    if (m_sqes)
+    {
+        ::munmap(m_sqes, m_sqesSize);
+        m_sqes = nullptr;
+    }
+    if (m_ringCq && m_ringCq != m_ringSq)
+    {
+        ::munmap(m_ringCq, m_ringCqSize);
+    }
+    m_ringCq = nullptr;
+    if (m_ringSq)
+    {
+        ::munmap(m_ringSq, m_ringSqSize);
+        m_ringSq = nullptr;
+    }
+    if (m_fdRing != -1)
+    {
+        OperatingSystem::instance().close(m_fdRing);
+        m_fdRing = -1;
+    }
+}
+
+void PollerImplIoUring::init(ReceiveMode receiveMode)
+{
+    // a poll request of io_uring is one shot and it is rearmed after the events were handled,
+    // so RECEIVEMODE_EDGETRIGGERED behaves like RECEIVEMODE_READUNTILWOULDBLOCK.
+    m_receiveMode = receiveMode;
+    bool ok = setupRing();
+    assert(ok);
+    (void)ok;
+    int res = OperatingSystem::instance().makeSocketPair(m_controlSocketRead, m_controlSocketWrite);
+    if (res == 0)
+    {
+        assert(m_controlSocketWrite);
+        assert(m_controlSocketRead);
+        addSocketEnableRead(m_controlSocketRead);
+    }
+}
+
+void PollerImplIoUring::addSocketIntern(const SocketDescriptorPtr& fd, std::uint32_t events)
+{
+    if (!fd)
+    {
+        return;
+    }
+    std::unique_lock<std::mutex> locker(m_mutex);
+    SOCKET sd = fd->getDescriptor();
+    auto result = m_socketDescriptors.emplace(sd, SocketState());
+    if (result.second)
+    {
+        SocketState& state = result.first->second;
+        state.sd = fd;
+        state.events = events;
+        socketHasChanged(sd);
+    }
+    else
+    {
+        // socket already added
+    }
+    bool wakeUpNeeded = (result.second && m_waiting);
+    locker.unlock();
+    if (wakeUpNeeded)
+    {
+        wakeUp();
+    }
+}
+
+void PollerImplIoUring::addSocket(const SocketDescriptorPtr& fd)
+{
+    addSocketIntern(fd, 0);
+}
+
+void PollerImplIoUring::addSocketEnableRead(const SocketDescriptorPtr& fd)
+{
+    addSocketIntern(fd, POLLIN);
+}
+
+void PollerImplIoUring::removeSocket(const SocketDescriptorPtr& fd)
+{
+    if (!fd)
+    {
+        return;
+    }
+    std::unique_lock<std::mutex> locker(m_mutex);
+    auto it = m_socketDescriptors.find(fd->getDescriptor());
+    if (it != m_socketDescriptors.end())
+    {
+        const SocketState& state = it->second;
+        if (state.sequence != 0)
+        {
+            // the armed poll request holds a reference to the file, so that the socket would
+            // not be closed. Therefore, the poll request is removed immediately.
+            removePoll(makeUserData(it->first, state.sequence));
+            submit();
+        }
+        m_socketDescriptors.erase(it);
+    }
+    else
+    {
+        // socket not added
+    }
+    locker.unlock();
+}
+
+void PollerImplIoUring::modifyEvents(const SocketDescriptorPtr& fd, std::uint32_t eventsSet, std::uint32_t eventsClear)
+{
+    if (!fd)
+    {
+        return;
+    }
+    std::unique_lock<std::mutex> locker(m_mutex);
+    bool wakeUpNeeded = false;
+    auto it = m_socketDescriptors.find(fd->getDescriptor());
+    if (it != m_socketDescriptors.end())
+    {
+        SocketState& state = it->second;
+        std::uint32_t events = (state.events | eventsSet) & ~eventsClear;
+        if (events != state.events)
+        {
+            state.events = events;
+            socketHasChanged(it->first);
+            wakeUpNeeded = m_waiting;
+        }
+    }
+    else
+    {
+        // error: socket not added
+    }
+    locker.unlock();
+    if (wakeUpNeeded)
+    {
+        wakeUp();
+    }
+}
+
+void PollerImplIoUring::enableRead(const SocketDescriptorPtr& fd)
+{
+    modifyEvents(fd, POLLIN, 0);
+}
+
+void PollerImplIoUring::disableRead(const SocketDescriptorPtr& fd)
+{
+    modifyEvents(fd, 0, POLLIN);
+}
+
+void PollerImplIoUring::enableWrite(const SocketDescriptorPtr& fd)
+{
+    modifyEvents(fd, POLLOUT, 0);
+}
+
+void PollerImplIoUring::disableWrite(const SocketDescriptorPtr& fd)
+{
+    modifyEvents(fd, 0, POLLOUT);
+}
+
+void PollerImplIoUring::socketHasChanged(SOCKET sd)
+{
+    // mutex already locked
+    m_changedSockets.push_back(sd);
+}
+
+void PollerImplIoUring::wakeUp()
+{
+    if (m_controlSocketWrite)
+    {
+        char dummy = 0;
+        OperatingSystem::instance().send(m_controlSocketWrite->getDescriptor(), &dummy, 1, 0);
+    }
+}
+
+io_uring_sqe* PollerImplIoUring::getSqe()
+{
+    unsigned int tail = *m_sqTail + m_sqPending;
+    unsigned int head = __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE);
+    if (tail - head >= m_sqEntries)
+    {
+        // submission queue is full
+        submit();
+        head = __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE);
+        assert(tail - head < m_sqEntries);
+    }
+    unsigned int index = tail & *m_sqMask;
+    io_uring_sqe* sqe = &m_sqes[index];
+    memset(sqe, 0, sizeof(io_uring_sqe));
+    m_sqArray[index] = index;
+    ++m_sqPending;
+    return sqe;
+}
+
+void PollerImplIoUring::publishSqes()
+{
+    // mutex already locked
+    __atomic_store_n(m_sqTail, *m_sqTail + m_sqPending, __ATOMIC_RELEASE);
+    m_sqPending = 0;
+}
+
+void PollerImplIoUring::submit()
+{
+    // mutex already locked
+    publishSqes();
+    int res = 0;
+    do
+    {
+        res = OperatingSystem::instance().io_uring_enter(m_fdRing, m_sqEntries, 0, 0, nullptr, 0);
+    } while (res == -1 && OperatingSystem::instance().getLastError() == EINTR);
+}
+
+void PollerImplIoUring::removePoll(std::uint64_t userData)
+{
+    // mutex already locked
+    io_uring_sqe* sqe = getSqe();
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = userData;
+    sqe->user_data = USERDATA_POLL_REMOVE;
+}
+
+void PollerImplIoUring::submitChanges()
+{
+    // mutex already locked
+    for (SOCKET sd : m_changedSockets)
+    {
+        auto it = m_socketDescriptors.find(sd);
+        if (it == m_socketDescriptors.end())
+        {
+            continue;
+        }
+        SocketState& state = it->second;
+        if (state.sequence != 0)
+        {
+            if (state.armedEvents == state.events)
+            {
+                continue;
+            }
+            removePoll(makeUserData(sd, state.sequence));
+            state.sequence = 0;
+            state.armedEvents = 0;
+        }
+        // also without events, the poll request reports errors and hang ups (like epoll)
+        std::uint32_t sequence = m_nextSequence++;
+        if (sequence == 0)
+        {
+            sequence = m_nextSequence++;
+        }
+        io_uring_sqe* sqe = getSqe();
+        sqe->opcode = IORING_OP_POLL_ADD;
+        sqe->fd = sd;
+        sqe->poll32_events = state.events;
+        sqe->user_data = makeUserData(sd, sequence);
+        state.sequence = sequence;
+        state.armedEvents = state.events;
+    }
+    m_changedSockets.clear();
+}
+
+void PollerImplIoUring::handleCompletion(const io_uring_cqe& cqe)
+{
+    if (cqe.user_data == USERDATA_POLL_REMOVE)
+    {
+        return;
+    }
+    SOCKET sd = static_cast<SOCKET>(cqe.user_data & 0xFFFFFFFF);
+    std::uint32_t sequence = static_cast<std::uint32_t>(cqe.user_data >> 32);
+
+    std::unique_lock<std::mutex> locker(m_mutex);
+    auto it = m_socketDescriptors.find(sd);
+    if (it == m_socketDescriptors.end() || it->second.sequence != sequence)
+    {
+        // completion of a removed or modified poll request
+        return;
+    }
+    SocketState& state = it->second;
+    const std::uint32_t armedEvents = state.armedEvents;
+    state.sequence = 0;
+    state.armedEvents = 0;
+    // rearm at the next wait, after the events were handled
+    socketHasChanged(sd);
+    locker.unlock();
+
+    std::uint32_t events = 0;
+    if (cqe.res < 0)
+    {
+        if (cqe.res == -ECANCELED)
+        {
+            return;
+        }
+        events = POLLERR;
+    }
+    else
+    {
+        events = static_cast<std::uint32_t>(cqe.res);
+    }
+
+    if (sd == m_controlSocketRead->getDescriptor())
+    {
+        if (events & POLLIN)
+        {
+            int countRead = 0;
+            int resIoCtl = OperatingSystem::instance().ioctlInt(sd, FIONREAD, &countRead);
+            if (resIoCtl == -1)
+            {
+                countRead = 0;
+            }
+            if (countRead > 0)
+            {
+                // read pending bytes from control socket
+                std::vector<char> buffer(countRead);
+                OperatingSystem::instance().recv(sd, buffer.data(), static_cast<int>(buffer.size()), 0);
+                m_result.releaseWait |= m_releaseFlags.exchange(0, std::memory_order_acq_rel);
+            }
+        }
+        return;
+    }
+
+    DescriptorInfo* descriptorInfo = &m_result.descriptorInfos.add();
+    descriptorInfo->sd = sd;
+    if (events & (POLLERR | POLLHUP | POLLNVAL))
+    {
+        descriptorInfo->disconnected = true;
+    }
+    if ((events & POLLOUT) && (armedEvents & POLLOUT))
+    {
+        descriptorInfo->writable = true;
+    }
+    if ((events & POLLIN) && (armedEvents & POLLIN))
+    {
+        descriptorInfo->readable = true;
+        if (m_receiveMode == ReceiveMode::RECEIVEMODE_PENDINGREAD)
+        {
+            int countRead = 0;
+            int resIoCtl = OperatingSystem::instance().ioctlInt(sd, FIONREAD, &countRead);
+            if (resIoCtl == -1)
+            {
+                countRead = 0;
+            }
+            descriptorInfo->bytesToRead = countRead;
+        }
+        else
+        {
+            // the receiver reads until the socket would block
+            descriptorInfo->bytesToRead = -1;
+            m_syscallsSaved.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+void PollerImplIoUring::collectSockets()
+{
+    unsigned int head = *m_cqHead;
+    unsigned int tail = __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE);
+    for (; head != tail; ++head)
+    {
+        const io_uring_cqe& cqe = m_cqes[head & *m_cqMask];
+        handleCompletion(cqe);
+    }
+    __atomic_store_n(m_cqHead, head, __ATOMIC_RELEASE);
+}
+
+const PollerResult& PollerImplIoUring::wait(std::int32_t timeout)
+{
+    // check if init happened
+    assert(m_fdRing != -1);
+
+    m_result.clear();
+
+    const std::chrono::time_point<std::chrono::steady_clock> start = std::chrono::steady_clock::now();
+    std::int32_t timeoutRemaining = timeout;
+    bool ex = false;
+    while (!ex)
+    {
+        std::unique_lock<std::mutex> locker(m_mutex);
+        // from now on, other threads wake up the wait for their changes
+        m_waiting = true;
+        submitChanges();
+        publishSqes();
+        locker.unlock();
+
+        __kernel_timespec ts;
+        ts.tv_sec = timeoutRemaining / 1000;
+        ts.tv_nsec = (timeoutRemaining % 1000) * 1000000;
+        io_uring_getevents_arg arg;
+        memset(&arg, 0, sizeof(arg));
+        arg.sigmask = 0;
+        arg.sigmask_sz = _NSIG / 8;
+        arg.ts = (timeoutRemaining >= 0) ? reinterpret_cast<std::uint64_t>(&ts) : 0;
+
+        // submit the changes and wait for completions with one system call
+        int res = 0;
+        int err = 0;
+        do
+        {
+            // the kernel submits only the available entries, other threads may have submitted them already
+            res = OperatingSystem::instance().io_uring_enter(m_fdRing, m_sqEntries, (timeoutRemaining != 0) ? 1 : 0, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+            if (res == -1)
+            {
+                err = OperatingSystem::instance().getLastError();
+            }
+        } while (res == -1 && err == EINTR);
+
+        m_waiting = false;
+
+        if (res == -1 && err != ETIME && err != EBUSY && err != EAGAIN)
+        {
+            streamError << "io_uring_enter failed with errno: " << err;
+            m_result.error = true;
+            return m_result;
+        }
+
+        collectSockets();
+
+        if (m_result.descriptorInfos.size() != 0 || m_result.releaseWait != 0 || timeoutRemaining == 0 || (res == -1 && err == ETIME))
+        {
+            ex = true;
+        }
+        else if (timeoutRemaining > 0)
+        {
+            // woken up by a change of another thread, or only completions of removed poll requests
+            std::int32_t elapsed = static_cast<std::int32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+            timeoutRemaining = std::max(timeout - elapsed, 0);
+        }
+    }
+
+    if (m_result.descriptorInfos.size() == 0 && m_result.releaseWait == 0)
+    {
+        m_result.timeout = true;
+    }
+
+    return m_result;
+}
+
+void PollerImplIoUring::releaseWait(std::uint32_t info)
+{
+    m_releaseFlags.fetch_or(info, std::memory_order_acq_rel);
+    wakeUp();
+}
+
+ReceiveMode PollerImplIoUring::getReceiveMode() const
+{
+    return m_receiveMode;
+}
+
+std::uint64_t PollerImplIoUring::getSyscallsSaved() const
+{
+    return m_syscallsSaved.load(std::memory_order_relaxed);
+}
+
+} // namespace finalmq
+
+#endif
@@ -51,8 +51,10 @@ PollerImplSelect::PollerImplSelect()
 
 
 
-void PollerImplSelect::init()
+void PollerImplSelect::init(ReceiveMode receiveMode)
 {
+    // select has no edge triggered mode, RECEIVEMODE_EDGETRIGGERED behaves like RECEIVEMODE_READUNTILWOULDBLOCK.
+    m_receiveMode = receiveMode;
     FD_ZERO(&m_readfdsCached);
     FD_ZERO(&m_writefdsCached);
     FD_ZERO(&m_errorfdsCached);
@@ -335,15 +337,15 @@ void PollerImplSelect::collectSockets(int res)
             {
                 cntFd++;
 
-                int countRead = 0;
-                int resIoCtl = OperatingSystem::instance().ioctlInt(sd, FIONREAD, &countRead);
-                if (resIoCtl == -1)
-                {
-                    countRead = 0;
-                }
-
                 if (sd == m_controlSocketRead->getDescriptor())
                 {
+                    int countRead = 0;
+                    int resIoCtl = OperatingSystem::instance().ioctlInt(sd, FIONREAD, &countRead);
+                    if (resIoCtl == -1)
+                    {
+                        countRead = 0;
+                    }
+
                     if (countRead > 0)
                     {
                         // read pending bytes from control socket
@@ -362,7 +364,22 @@ void PollerImplSelect::collectSockets(int res)
                     assert(descriptorInfo);
                     descriptorInfo->sd = sd;
                     descriptorInfo->readable = true;
-                    descriptorInfo->bytesToRead = countRead;
+                    if (m_receiveMode == ReceiveMode::RECEIVEMODE_PENDINGREAD)
+                    {
+                        int countRead = 0;
+                        int resIoCtl = OperatingSystem::instance().ioctlInt(sd, FIONREAD, &countRead);
+                        if (resIoCtl == -1)
+                        {
+                            countRead = 0;
+                        }
+                        descriptorInfo->bytesToRead = countRead;
+                    }
+                    else
+                    {
+                        // the receiver reads until the socket would block
+                        descriptorInfo->bytesToRead = -1;
+                        m_syscallsSaved.fetch_add(1, std::memory_order_relaxed);
+                    }
                 }
             }
             if (FD_ISSET(sd, &m_writefds))
@@ -480,4 +497,14 @@ void PollerImplSelect::releaseWait(std::uint32_t info)
     }
 }
 
+ReceiveMode PollerImplSelect::getReceiveMode() const
+{
+    return m_receiveMode;
+}
+
+std::uint64_t PollerImplSelect::getSyscallsSaved() const
+{
+    return m_syscallsSaved.load(std::memory_order_relaxed);
+}
+
 }   // namespace finalmq
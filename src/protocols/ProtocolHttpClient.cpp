@@ -1141,6 +1141,16 @@ static const std::string FMQ_PATH_CREATESESSION = "/fmq/createsession";
 static const std::string FMQ_PATH_REMOVESESSION = "/fmq/removesession";
 static const std::string FMQ_MULTIPART_BOUNDARY = "B9BMAhxAhY.mQw1IDRBA";
 
+// keys of the control data, looked up for every message
+static const Atom ATOM_FMQ_HTTP("fmq_http");
+static const Atom ATOM_FMQ_METHOD("fmq_method");
+static const Atom ATOM_FMQ_PROTOCOL("fmq_protocol");
+static const Atom ATOM_FMQ_PATH("fmq_path");
+static const Atom ATOM_FMQ_HTTP_STATUS("fmq_http_status");
+static const Atom ATOM_FMQ_HTTP_STATUSTEXT("fmq_http_statustext");
+static const Atom ATOM_FILETRANSFER("filetransfer");
+static const Atom ATOM_QUERIES("queries");
+
 //enum ChunkedState
 //{
 //    STATE_STOP = 0,
@@ -1309,9 +1319,9 @@ bool ProtocolHttpClient::receiveHeaders(ssize_t bytesReceived)
                             {
                                 m_message = std::make_shared<ProtocolMessage>(0);
                                 Variant& controlData = m_message->getControlData();
-                                controlData.add(FMQ_HTTP, std::string(HTTP_RESPONSE));
-                                controlData.add(FMQ_PROTOCOL, std::move(lineSplit[0]));
-                                controlData.add(FMQ_HTTP_STATUS, std::move(lineSplit[1]));
+                                controlData.add(ATOM_FMQ_HTTP, std::string(HTTP_RESPONSE));
+                                controlData.add(ATOM_FMQ_PROTOCOL, std::move(lineSplit[0]));
+                                controlData.add(ATOM_FMQ_HTTP_STATUS, std::move(lineSplit[1]));
                                 std::string statusText;
                                 for (size_t i = 2; i < lineSplit.size(); ++i)
                                 {
@@ -1321,7 +1331,7 @@ bool ProtocolHttpClient::receiveHeaders(ssize_t bytesReceived)
                                         statusText += ' ';
                                     }
                                 }
-                                controlData.add(FMQ_HTTP_STATUSTEXT, std::move(statusText));
+                                controlData.add(ATOM_FMQ_HTTP_STATUSTEXT, std::move(statusText));
                                 m_state = State::STATE_FIND_HEADERS;
                             }
                             else
@@ -1424,7 +1434,7 @@ void ProtocolHttpClient::sendMessage(IMessagePtr message)
     assert(!message->wasSent());
     std::string firstLine;
     const Variant& controlData = message->getControlData();
-    const std::string* filename = controlData.getData<std::string>("filetransfer");
+    const std::string* filename = controlData.getData<std::string>(ATOM_FILETRANSFER);
     ssize_t filesize = -1;
     if (filename)
     {
@@ -1452,8 +1462,8 @@ void ProtocolHttpClient::sendMessage(IMessagePtr message)
     static const std::string METHOD_GET = "GET";
     static const std::string METHOD_POST = "POST";
     static const std::string PATH_ROOT = "/";
-    const std::string* method = controlData.getData<std::string>(FMQ_METHOD);
-    const std::string* path = controlData.getData<std::string>(FMQ_PATH);
+    const std::string* method = controlData.getData<std::string>(ATOM_FMQ_METHOD);
+    const std::string* path = controlData.getData<std::string>(ATOM_FMQ_PATH);
     if (method == nullptr || method->empty())
     {
         if (sizeBody > 0)
@@ -1476,7 +1486,7 @@ void ProtocolHttpClient::sendMessage(IMessagePtr message)
     firstLine += ' ';
     firstLine += pathEncode;
 
-    const VariantStruct* queries = controlData.getData<VariantStruct>("queries");
+    const VariantStruct* queries = controlData.getData<VariantStruct>(ATOM_QUERIES);
     if (queries)
     {
         for (auto it = queries->begin(); it != queries->end(); ++it)
@@ -67,6 +67,16 @@ static const std::string FMQ_PATH_CREATESESSION = "/fmq/createsession";
 static const std::string FMQ_PATH_REMOVESESSION = "/fmq/removesession";
 static const std::string FMQ_MULTIPART_BOUNDARY = "B9BMAhxAhY.mQw1IDRBA";
 
+// keys of the control data, looked up for every message
+static const Atom ATOM_FMQ_HTTP("fmq_http");
+static const Atom ATOM_FMQ_METHOD("fmq_method");
+static const Atom ATOM_FMQ_PATH("fmq_path");
+static const Atom ATOM_FMQ_HTTP_STATUS("fmq_http_status");
+static const Atom ATOM_FMQ_HTTP_STATUSTEXT("fmq_http_statustext");
+static const Atom ATOM_FMQ_POLL_STOP("fmq_poll_stop");
+static const Atom ATOM_FILETRANSFER("filetransfer");
+static const Atom ATOM_QUERIES("queries");
+
 enum ChunkedState
 {
     STATE_STOP = 0,
@@ -595,13 +605,13 @@ void ProtocolHttpServer::sendMessage(IMessagePtr message)
     bool pollStop = false;
     if (m_chunkedState != STATE_STOP)
     {
-        const bool* pPollStop = controlData.getData<bool>("fmq_poll_stop");
+        const bool* pPollStop = controlData.getData<bool>(ATOM_FMQ_POLL_STOP);
         if (pPollStop && *pPollStop)
         {
             pollStop = *pPollStop;
         }
     }
-    const std::string* filename = controlData.getData<std::string>("filetransfer");
+    const std::string* filename = controlData.getData<std::string>(ATOM_FILETRANSFER);
     ssize_t filesize = -1;
     if (filename)
     {
@@ -614,7 +624,7 @@ void ProtocolHttpServer::sendMessage(IMessagePtr message)
             message->downsizeLastSendPayload(0);
         }
     }
-    const std::string* http = controlData.getData<std::string>(FMQ_HTTP);
+    const std::string* http = controlData.getData<std::string>(ATOM_FMQ_HTTP);
     if (m_chunkedState < STATE_FIRST_CHUNK)
     {
         if (http && *http == HTTP_REQUEST)
@@ -623,8 +633,8 @@ void ProtocolHttpServer::sendMessage(IMessagePtr message)
             {
                 filesize = 0;
             }
-            const std::string* method = controlData.getData<std::string>(FMQ_METHOD);
-            const std::string* path = controlData.getData<std::string>(FMQ_PATH);
+            const std::string* method = controlData.getData<std::string>(ATOM_FMQ_METHOD);
+            const std::string* path = controlData.getData<std::string>(ATOM_FMQ_PATH);
             if (method && path)
             {
                 std::string pathEncode;
@@ -633,7 +643,7 @@ void ProtocolHttpServer::sendMessage(IMessagePtr message)
                 firstLine += ' ';
                 firstLine += pathEncode;
 
-                const VariantStruct* queries = controlData.getData<VariantStruct>("queries");
+                const VariantStruct* queries = controlData.getData<VariantStruct>(ATOM_QUERIES);
                 if (queries)
                 {
                     for (auto it = queries->begin(); it != queries->end(); ++it)
@@ -662,8 +672,8 @@ void ProtocolHttpServer::sendMessage(IMessagePtr message)
         }
         else
         {
-            std::string status = controlData.getDataValue<std::string>(FMQ_HTTP_STATUS);
-            const std::string* statustext = controlData.getData<std::string>(FMQ_HTTP_STATUSTEXT);
+            std::string status = controlData.getDataValue<std::string>(ATOM_FMQ_HTTP_STATUS);
+            const std::string* statustext = controlData.getData<std::string>(ATOM_FMQ_HTTP_STATUSTEXT);
             if (filename && filesize == -1)
             {
                 status = "404";
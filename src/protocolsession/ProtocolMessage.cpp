@@ -22,6 +22,8 @@
 
 #include "finalmq/protocolsession/ProtocolMessage.h"
 
+#include "finalmq/helpers/BufferPool.h"
+
 namespace finalmq
 {
 //---------------------------------------
@@ -36,6 +38,15 @@ ProtocolMessage::ProtocolMessage(std::uint32_t protocolId, ssize_t sizeHeader, s
     m_itSendBufferRefsPayloadBegin = m_sendBufferRefs.end();
 }
 
+ProtocolMessage::~ProtocolMessage()
+{
+    // give the buffers back to the pool of this thread
+    BufferPool::releaseRefs(m_sendBufferRefs);
+    BufferPool::releaseRefs(m_sendPayloadRefs);
+    BufferPool::releaseBuffers(m_headerBuffers);
+    BufferPool::releaseBuffers(m_payloadBuffers);
+}
+
 char* ProtocolMessage::addBuffer(ssize_t size, ssize_t reserve)
 {
     assert(!m_preparedToSend);
@@ -83,9 +94,9 @@ char* ProtocolMessage::addBuffer(ssize_t size, ssize_t reserve)
         lastRef.second -= m_sizeTrailer;
         if (lastRef.second == 0)
         {
-            m_sendBufferRefs.pop_back();
-            m_sendPayloadRefs.pop_back();
-            m_payloadBuffers.pop_back();
+            BufferPool::removeRef(m_sendBufferRefs, std::prev(m_sendBufferRefs.end()));
+            BufferPool::removeRef(m_sendPayloadRefs, std::prev(m_sendPayloadRefs.end()));
+            BufferPool::removeLastBuffer(m_payloadBuffers);
         }
     }
 
@@ -95,15 +106,14 @@ char* ProtocolMessage::addBuffer(ssize_t size, ssize_t reserve)
     m_sizeSendBufferTotal += reserve;
     m_sizeSendPayloadTotal += reserve;
     ssize_t sizeBuffer = sizeHeader + reserve + m_sizeTrailer;
-    m_payloadBuffers.resize(m_payloadBuffers.size() + 1);
-    m_payloadBuffers.back().resize(sizeBuffer);
-    m_sendBufferRefs.push_back({const_cast<char*>(m_payloadBuffers.back().data()), sizeBuffer});
-    m_sendPayloadRefs.push_back({const_cast<char*>(m_payloadBuffers.back().data() + sizeHeader), reserve});
+    char* buffer = BufferPool::addBuffer(m_payloadBuffers, sizeBuffer);
+    BufferPool::addRef(m_sendBufferRefs, m_sendBufferRefs.end(), {buffer, sizeBuffer});
+    BufferPool::addRef(m_sendPayloadRefs, m_sendPayloadRefs.end(), {buffer + sizeHeader, reserve});
     if (size < reserve)
     {
         downsizeLastBuffer(size);
     }
-    return const_cast<char*>(m_payloadBuffers.back().data() + sizeHeader);
+    return buffer + sizeHeader;
 }
 
 void ProtocolMessage::downsizeLastBuffer(ssize_t newSize)
@@ -145,9 +155,9 @@ void ProtocolMessage::downsizeLastBuffer(ssize_t newSize)
     }
     else
     {
-        m_sendBufferRefs.pop_back();
-        m_sendPayloadRefs.pop_back();
-        m_payloadBuffers.pop_back();
+        BufferPool::removeRef(m_sendBufferRefs, std::prev(m_sendBufferRefs.end()));
+        BufferPool::removeRef(m_sendPayloadRefs, std::prev(m_sendPayloadRefs.end()));
+        BufferPool::removeLastBuffer(m_payloadBuffers);
         m_offset = -1;
     }
 }
@@ -314,6 +324,11 @@ void ProtocolMessage::setHeaderSize(ssize_t sizeHeader)
     m_sizeHeader = sizeHeader;
 }
 
+const std::shared_ptr<std::string>& ProtocolMessage::getReceiveBuffer() const
+{
+    return m_receiveBuffer;
+}
+
 // for the framework
 const std::list<BufferRef>& ProtocolMessage::getAllSendBuffers() const
 {
@@ -337,12 +352,14 @@ void ProtocolMessage::moveSendBuffers(std::list<std::string>&& payloadBuffers, c
 {
     assert(payloadBuffers.size() == payloads.size());
     auto itSize = payloads.begin();
-    for (auto it = payloadBuffers.begin(); it != payloadBuffers.end(); ++it, ++itSize)
+    for (; !payloadBuffers.empty(); ++itSize)
     {
-        m_payloadBuffers.emplace_back(std::move(*it));
-        size_t size = itSize->second;
-        m_sendBufferRefs.emplace_back(const_cast<char*>(m_payloadBuffers.back().data()), size);
-        m_sendPayloadRefs.emplace_back(const_cast<char*>(m_payloadBuffers.back().data()), size);
+        // take over the list node, the data of the buffer stays where it is
+        m_payloadBuffers.splice(m_payloadBuffers.end(), payloadBuffers, payloadBuffers.begin());
+        ssize_t size = itSize->second;
+        char* buffer = const_cast<char*>(m_payloadBuffers.back().data());
+        BufferPool::addRef(m_sendBufferRefs, m_sendBufferRefs.end(), {buffer, size});
+        BufferPool::addRef(m_sendPayloadRefs, m_sendPayloadRefs.end(), {buffer, size});
         m_offset = size;
         m_sizeLastBlock = size;
         m_sizeSendBufferTotal += size;
@@ -372,11 +389,10 @@ char* ProtocolMessage::addSendHeader(ssize_t size)
     {
         m_itSendBufferRefsPayloadBegin = m_sendBufferRefs.begin();
     }
-    m_headerBuffers.resize(m_headerBuffers.size() + 1);
-    m_headerBuffers.back().resize(size);
-    m_sendBufferRefs.insert(m_itSendBufferRefsPayloadBegin, {const_cast<char*>(m_headerBuffers.back().data()), m_headerBuffers.back().size()});
+    char* header = BufferPool::addBuffer(m_headerBuffers, size);
+    BufferPool::addRef(m_sendBufferRefs, m_itSendBufferRefsPayloadBegin, {header, size});
     m_sizeSendBufferTotal += size;
-    return const_cast<char*>(m_headerBuffers.back().data());
+    return header;
 }
 void ProtocolMessage::downsizeLastSendHeader(ssize_t newSize)
 {
@@ -392,8 +408,8 @@ void ProtocolMessage::downsizeLastSendHeader(ssize_t newSize)
     sizeCurrent = newSize;
     if (newSize == 0)
     {
-        m_sendBufferRefs.erase(itSendBufferRefs);
-        m_headerBuffers.pop_back();
+        BufferPool::removeRef(m_sendBufferRefs, itSendBufferRefs);
+        BufferPool::removeLastBuffer(m_headerBuffers);
     }
 }
 
@@ -405,7 +421,9 @@ void ProtocolMessage::prepareMessageToSend()
     {
         if (it->second == 0)
         {
-            it = m_sendBufferRefs.erase(it);
+            auto itRemove = it;
+            ++it;
+            BufferPool::removeRef(m_sendBufferRefs, itRemove);
         }
         else
         {
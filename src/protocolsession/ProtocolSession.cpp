@@ -33,6 +33,7 @@ namespace finalmq {
 constexpr int64_t INSTANCEID_PREFIX = 0x0100000000000000ll;
 constexpr int DEFAULT_MAX_SYNC_REQREP_CONNECTIONS = 6;
 static const std::string PROPERTY_MAX_SYNC_REQREP_CONNECTIONS = "max_sync_reqrep_connections";
+static const Atom ATOM_FMQ_POLL_STOP("fmq_poll_stop");
 
 
 const static std::string FMQ_CONNECTION_ID = "fmq_echo_connid";
@@ -153,6 +154,9 @@ bool ProtocolSession::connect()
     {
         assert(m_streamConnectionContainer);
         IStreamConnectionPtr connection = m_streamConnectionContainer->createConnection(std::weak_ptr<IStreamConnectionCallback>(m_protocol));
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_executorPollerThread = m_streamConnectionContainer->getPollerThreadExecutor(connection->getConnectionId());
+        lock.unlock();
         setConnection(connection, true);
         res = m_streamConnectionContainer->connect(m_endpointStreamConnection, connection, m_connectionProperties);
     }
@@ -526,6 +530,7 @@ void ProtocolSession::disconnect()
             protocols.push_back(it->second);
         }
     }
+    IExecutorPtr executorPollerThread = m_executorPollerThread;
     lock.unlock();
 
     for (size_t i = 0; i < protocols.size(); ++i)
@@ -538,10 +543,10 @@ void ProtocolSession::disconnect()
         protocolSessionList->removeProtocolSession(m_sessionId);
     }
 
-    assert(m_executorPollerThread);
+    assert(executorPollerThread);
 
     std::weak_ptr<ProtocolSession> pThisWeak = shared_from_this();
-    m_executorPollerThread->addAction([pThisWeak]() {
+    executorPollerThread->addAction([pThisWeak]() {
         std::shared_ptr<ProtocolSession> pThis = pThisWeak.lock();
         if (pThis)
         {
@@ -644,6 +649,7 @@ bool ProtocolSession::connect(const std::string& endpoint, const ConnectProperti
         m_contentType = contentType;
         m_protocol = protocol;
         m_connectionId = connection->getConnectionId();
+        m_executorPollerThread = m_streamConnectionContainer->getPollerThreadExecutor(m_connectionId);
         initProtocolValues();
         m_protocol->setCallback(shared_from_this());
         m_protocol->setConnection(connection);
@@ -659,7 +665,12 @@ bool ProtocolSession::connect(const std::string& endpoint, const ConnectProperti
 
 IExecutorPtr ProtocolSession::getExecutor() const
 {
-    return m_executor ? m_executor : m_executorPollerThread;
+    if (m_executor)
+    {
+        return m_executor;
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_executorPollerThread;
 }
 
 void ProtocolSession::subscribe(const std::vector<std::string>& subscribtions)
@@ -1099,7 +1110,10 @@ void ProtocolSession::setSessionName(const std::string& sessionName, const IProt
         }
         else
         {
-            IProtocolSessionPrivatePtr protocolSession = std::make_shared<ProtocolSession>(m_callback, m_executor, m_executorPollerThread, protocol, list, m_bindProperties, m_contentType);
+            lock.lock();
+            IExecutorPtr executorPollerThread = m_executorPollerThread;
+            lock.unlock();
+            IProtocolSessionPrivatePtr protocolSession = std::make_shared<ProtocolSession>(m_callback, m_executor, executorPollerThread, protocol, list, m_bindProperties, m_contentType);
             protocolSession->setConnection(connection, false);
             protocolSession->setSessionNameInternal(sessionName);
         }
@@ -1117,7 +1131,7 @@ void ProtocolSession::pollRelease()
         if (reply)
         {
             Variant& controlData = reply->getControlData();
-            controlData.add("fmq_poll_stop", true);
+            controlData.add(ATOM_FMQ_POLL_STOP, true);
             sendMessage(reply, m_pollProtocol);
         }
         m_pollProtocol = nullptr;
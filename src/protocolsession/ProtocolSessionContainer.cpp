@@ -27,10 +27,10 @@
 
 namespace finalmq {
 
-ProtocolBind::ProtocolBind(hybrid_ptr<IProtocolSessionCallback> callback, const IExecutorPtr& executor, const IExecutorPtr& executorPollerThread, IProtocolFactoryPtr protocolFactory, const std::weak_ptr<IProtocolSessionList>& protocolSessionList, const BindProperties& bindProperties, int contentType)
+ProtocolBind::ProtocolBind(hybrid_ptr<IProtocolSessionCallback> callback, const IExecutorPtr& executor, const std::weak_ptr<IStreamConnectionContainer>& streamConnectionContainer, IProtocolFactoryPtr protocolFactory, const std::weak_ptr<IProtocolSessionList>& protocolSessionList, const BindProperties& bindProperties, int contentType)
     : m_callback(callback)
     , m_executor(executor)
-    , m_executorPollerThread(executorPollerThread)
+    , m_streamConnectionContainer(streamConnectionContainer)
     , m_protocolFactory(protocolFactory)
     , m_protocolSessionList(protocolSessionList)
     , m_bindProperties(bindProperties)
@@ -44,11 +44,14 @@ hybrid_ptr<IStreamConnectionCallback> ProtocolBind::connected(const IStreamConne
 {
     IProtocolPtr protocol;
     IProtocolSessionListPtr protocolSessionList = m_protocolSessionList.lock();
-    if (protocolSessionList)
+    std::shared_ptr<IStreamConnectionContainer> streamConnectionContainer = m_streamConnectionContainer.lock();
+    if (protocolSessionList && streamConnectionContainer)
     {
         protocol = m_protocolFactory->createProtocol(m_bindProperties.protocolData);
         assert(protocol);
-        IProtocolSessionPrivatePtr protocolSession = std::make_shared<ProtocolSession>(m_callback, m_executor, m_executorPollerThread, protocol, protocolSessionList, m_bindProperties, m_contentType);
+        // the session runs its actions in the poller loop of its connection
+        IExecutorPtr executorPollerThread = streamConnectionContainer->getPollerThreadExecutor(connection->getConnectionId());
+        IProtocolSessionPrivatePtr protocolSession = std::make_shared<ProtocolSession>(m_callback, m_executor, executorPollerThread, protocol, protocolSessionList, m_bindProperties, m_contentType);
         protocolSession->setConnection(connection, !protocol->doesSupportSession());
     }
     return std::weak_ptr<IStreamConnectionCallback>(protocol);
@@ -84,7 +87,7 @@ ProtocolSessionContainer::~ProtocolSessionContainer()
 }
 
 // IProtocolSessionContainer
-void ProtocolSessionContainer::init(const IExecutorPtr& executor, int cycleTime, FuncTimer funcTimer, int checkReconnectInterval)
+void ProtocolSessionContainer::init(const IExecutorPtr& executor, int cycleTime, FuncTimer funcTimer, int checkReconnectInterval, int numberOfPollerLoops, ReceiveMode receiveMode)
 {
     m_executor = executor;
     std::shared_ptr<FuncTimer> pFuncTimer = funcTimer ? std::make_shared<FuncTimer>(std::move(funcTimer)) : nullptr;
@@ -109,7 +112,7 @@ void ProtocolSessionContainer::init(const IExecutorPtr& executor, int cycleTime,
             assert(session);
             session->cycleTime();
         }
-    }, checkReconnectInterval);
+    }, checkReconnectInterval, numberOfPollerLoops, receiveMode);
     if (m_executor)
     {
         m_thread = std::thread([this]() { m_streamConnectionContainer->run(); });
@@ -167,7 +170,7 @@ int ProtocolSessionContainer::bind(const std::string& endpoint, hybrid_ptr<IProt
     auto it = m_endpoint2Bind.find(endpoint);
     if (it == m_endpoint2Bind.end())
     {
-        ProtocolBindPtr bind = std::make_shared<ProtocolBind>(callback, m_executor, m_executorPollerThread, protocolFactory, m_protocolSessionList, bindPropertiesToUse, contentType);
+        ProtocolBindPtr bind = std::make_shared<ProtocolBind>(callback, m_executor, m_streamConnectionContainer, protocolFactory, m_protocolSessionList, bindPropertiesToUse, contentType);
         m_endpoint2Bind[endpoint] = bind;
         lock.unlock();
 
@@ -0,0 +1,304 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+
+#include "finalmq/remoteentity/CommandRouter.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <assert.h>
+
+#include "finalmq/helpers/Utils.h"
+
+namespace finalmq
+{
+static const std::uint64_t PRIORITY_NONE = 0xFFFFFFFFFFFFFFFFull;
+static const std::uint64_t PRIORITY_STAR_ROUTE = (static_cast<std::uint64_t>(1) << 32);
+static const std::string PATH_PREFIX = "PATH_";
+
+struct CommandRouter::Node
+{
+    std::vector<std::pair<std::string, std::unique_ptr<Node>>> literals{}; ///< sorted by the entry
+    std::unique_ptr<Node> var{};
+    std::unique_ptr<Node> star{};
+    std::uint64_t priority = PRIORITY_NONE; ///< of the route that ends at this node
+    std::uint32_t route = 0;
+    std::uint64_t priorityMin = PRIORITY_NONE; ///< best priority of all routes of the subtree
+};
+
+struct CommandRouter::Search
+{
+    const std::string& path;
+    std::vector<Range>& entries;
+    std::vector<Range>& captures;
+    std::vector<Range>& capturesMatch;
+    std::uint64_t priority;
+    std::uint32_t route;
+};
+
+CommandRouter::CommandRouter()
+    : m_root(std::make_unique<Node>())
+{
+}
+
+CommandRouter::~CommandRouter()
+{
+}
+
+bool CommandRouter::isVariablePath(const std::string& path)
+{
+    return (path.find('{') != std::string::npos || path.find('*') != std::string::npos);
+}
+
+static bool lessEntry(const std::string& entry, const char* data, std::uint32_t size)
+{
+    return (entry.compare(0, std::string::npos, data, size) < 0);
+}
+
+CommandRouter::Node* CommandRouter::getLiteralChild(Node& node, const std::string& entry)
+{
+    auto it = std::lower_bound(node.literals.begin(), node.literals.end(), entry, [](const std::pair<std::string, std::unique_ptr<Node>>& child, const std::string& e) {
+        return lessEntry(child.first, e.data(), static_cast<std::uint32_t>(e.size()));
+    });
+    if (it == node.literals.end() || it->first != entry)
+    {
+        it = node.literals.emplace(it, entry, std::make_unique<Node>());
+    }
+    return it->second.get();
+}
+
+const CommandRouter::Node* CommandRouter::findLiteralChild(const Node& node, const char* entry, std::uint32_t size)
+{
+    auto it = std::lower_bound(node.literals.begin(), node.literals.end(), std::make_pair(entry, size), [](const std::pair<std::string, std::unique_ptr<Node>>& child, const std::pair<const char*, std::uint32_t>& e) {
+        return lessEntry(child.first, e.first, e.second);
+    });
+    if (it != node.literals.end() && it->first.compare(0, std::string::npos, entry, size) == 0)
+    {
+        return it->second.get();
+    }
+    return nullptr;
+}
+
+static std::string getKey(const std::string& entry)
+{
+    if (entry.size() >= 3)
+    {
+        std::string key = PATH_PREFIX;
+        key.insert(key.end(), entry.data() + 1, entry.data() + entry.size() - 1);
+        return key;
+    }
+    return {};
+}
+
+void CommandRouter::addRoute(const std::string& path, std::uint32_t routeId)
+{
+    // the entries of a route with {var} entries are compared literally, if they are not {var} entries.
+    const bool varRoute = (path.find('{') != std::string::npos);
+    const std::uint64_t priority = (varRoute ? 0 : PRIORITY_STAR_ROUTE) | routeId;
+
+    std::vector<std::string> entries;
+    Utils::split(path, 0, path.size(), '/', entries);
+
+    Route route;
+    route.routeId = routeId;
+    std::vector<Node*> nodes;
+    Node* node = m_root.get();
+    nodes.push_back(node);
+    bool afterStar = false;
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        const std::string& entry = entries[i];
+        if (varRoute && entry.size() >= 2 && entry[0] == '{')
+        {
+            if (!node->var)
+            {
+                node->var = std::make_unique<Node>();
+            }
+            node = node->var.get();
+            route.keys.push_back(getKey(entry));
+            afterStar = false;
+        }
+        else if (!varRoute && !afterStar && !entry.empty() && entry[0] == '*')
+        {
+            if (!node->star)
+            {
+                node->star = std::make_unique<Node>();
+            }
+            node = node->star.get();
+            route.keys.push_back(getKey(entry));
+            // the entry after a star entry is the end marker of the star, it is always compared literally
+            afterStar = true;
+        }
+        else
+        {
+            node = getLiteralChild(*node, entry);
+            afterStar = false;
+        }
+        nodes.push_back(node);
+    }
+
+    if (priority < node->priority)
+    {
+        node->priority = priority;
+        node->route = static_cast<std::uint32_t>(m_routes.size());
+        m_routes.push_back(std::move(route));
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            nodes[i]->priorityMin = std::min(nodes[i]->priorityMin, priority);
+        }
+    }
+}
+
+void CommandRouter::updateMatch(const Node& node, Search& search)
+{
+    if (node.priority < search.priority)
+    {
+        search.priority = node.priority;
+        search.route = node.route;
+        search.capturesMatch = search.captures;
+    }
+}
+
+void CommandRouter::walk(const Node& node, std::uint32_t index, Search& search)
+{
+    if (node.priorityMin >= search.priority)
+    {
+        return;
+    }
+    const std::uint32_t size = static_cast<std::uint32_t>(search.entries.size());
+    if (index == size)
+    {
+        updateMatch(node, search);
+        return;
+    }
+
+    const Range& entry = search.entries[index];
+    const Node* child = findLiteralChild(node, search.path.data() + entry.first, entry.second);
+    if (child)
+    {
+        walk(*child, index + 1, search);
+    }
+    if (node.var)
+    {
+        search.captures.push_back(entry);
+        walk(*node.var, index + 1, search);
+        search.captures.pop_back();
+    }
+    if (node.star)
+    {
+        walkStar(*node.star, index, search);
+    }
+}
+
+void CommandRouter::walkStar(const Node& node, std::uint32_t index, Search& search)
+{
+    if (node.priorityMin >= search.priority)
+    {
+        return;
+    }
+    const std::vector<Range>& entries = search.entries;
+    const std::uint32_t size = static_cast<std::uint32_t>(entries.size());
+    const char* path = search.path.data();
+
+    // the star ends at the first occurrence of the entry that follows the star in the route
+    for (std::uint32_t end = index; end < size && !node.literals.empty(); ++end)
+    {
+        const Range& entry = entries[end];
+        const Node* child = findLiteralChild(node, path + entry.first, entry.second);
+        if (child)
+        {
+            bool firstOccurrence = true;
+            for (std::uint32_t i = index; i < end && firstOccurrence; ++i)
+            {
+                firstOccurrence = (entries[i].second != entry.second || memcmp(path + entries[i].first, path + entry.first, entry.second) != 0);
+            }
+            if (firstOccurrence)
+            {
+                Range capture = (end > index) ? Range(entries[index].first, entries[end - 1].first + entries[end - 1].second - entries[index].first) : Range(entry.first, 0);
+                search.captures.push_back(capture);
+                walk(*child, end + 1, search);
+                search.captures.pop_back();
+            }
+        }
+    }
+
+    // star at the end of the route: all remaining entries, at least one
+    if (node.priority != PRIORITY_NONE && index < size)
+    {
+        search.captures.emplace_back(entries[index].first, entries[size - 1].first + entries[size - 1].second - entries[index].first);
+        updateMatch(node, search);
+        search.captures.pop_back();
+    }
+}
+
+bool CommandRouter::findRoute(const std::string& path, IMessage::Metainfo* keys, std::uint32_t& routeId) const
+{
+    if (m_routes.empty())
+    {
+        return false;
+    }
+
+    // reuse the memory of the search between the calls
+    static thread_local std::vector<Range> entries;
+    static thread_local std::vector<Range> captures;
+    static thread_local std::vector<Range> capturesMatch;
+    entries.clear();
+    captures.clear();
+    capturesMatch.clear();
+
+    // split the path at '/' like Utils::split()
+    const std::uint32_t pathSize = static_cast<std::uint32_t>(path.size());
+    std::uint32_t begin = 0;
+    while (begin < pathSize)
+    {
+        const char* pos = static_cast<const char*>(memchr(path.data() + begin, '/', pathSize - begin));
+        std::uint32_t end = pos ? static_cast<std::uint32_t>(pos - path.data()) : pathSize;
+        entries.emplace_back(begin, end - begin);
+        begin = end + 1;
+    }
+
+    Search search{path, entries, captures, capturesMatch, PRIORITY_NONE, 0};
+    walk(*m_root, 0, search);
+    if (search.priority == PRIORITY_NONE)
+    {
+        return false;
+    }
+
+    const Route& route = m_routes[search.route];
+    routeId = route.routeId;
+    if (keys)
+    {
+        assert(route.keys.size() == capturesMatch.size());
+        for (size_t i = 0; i < route.keys.size(); ++i)
+        {
+            if (!route.keys[i].empty())
+            {
+                const Range& capture = capturesMatch[i];
+                (*keys)[route.keys[i]].assign(path, capture.first, capture.second);
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace finalmq
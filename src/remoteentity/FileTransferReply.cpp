@@ -31,6 +31,8 @@
 
 namespace finalmq
 {
+static const Atom ATOM_FILETRANSFER("filetransfer");
+
 bool FileTransferReply::replyFile(const RequestContextPtr& requestContext, const std::string& filename, IMessage::Metainfo* metainfo)
 {
     bool handeled = false;
@@ -45,7 +47,8 @@ bool FileTransferReply::replyFile(const RequestContextPtr& requestContext, const
 
         if (requestContext->doesSupportFileTransfer())
         {
-            Variant controlData = VariantStruct{{"filetransfer", filename}};
+            Variant controlData = VariantStruct();
+            controlData.add(ATOM_FILETRANSFER, filename);
             requestContext->reply(controlData);
         }
         else
@@ -0,0 +1,133 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "finalmq/remoteentity/HeaderTemplateCache.h"
+
+#include <string.h>
+
+#include "finalmq/helpers/ZeroCopyBuffer.h"
+
+namespace finalmq
+{
+// the correlation ID, which marks the position of the correlation ID field inside the template
+static const std::uint64_t CORRID_TEMPLATE = 0x7ffffffffffffffeull;
+
+static bool isSameExceptCorrid(const Header& a, const Header& b)
+{
+    return (a.destid == b.destid &&
+            a.srcid == b.srcid &&
+            a.mode == b.mode &&
+            a.status == b.status &&
+            a.destname == b.destname &&
+            a.path == b.path &&
+            a.type == b.type &&
+            a.meta == b.meta);
+}
+
+HeaderTemplateCache::Entry& HeaderTemplateCache::createEntry(const Header& header, FuncSerializeHeader funcSerializeHeader, FuncSerializeCorrid funcSerializeCorrid)
+{
+    Entry& entry = m_entries[m_nextEntry];
+    m_nextEntry = (m_nextEntry + 1) % NUMBER_OF_ENTRIES;
+    if (m_numberOfEntries < NUMBER_OF_ENTRIES)
+    {
+        ++m_numberOfEntries;
+    }
+
+    entry.funcSerializeHeader = funcSerializeHeader;
+    entry.header = header;
+    entry.header.corrid = CORRID_TEMPLATE;
+    ZeroCopyBuffer buffer;
+    funcSerializeHeader(buffer, entry.header);
+    entry.header.corrid = 0;
+    const std::string data = buffer.getData();
+
+    // the field of the correlation ID must be unique inside the header to patch it
+    funcSerializeCorrid(CORRID_TEMPLATE, m_corrid);
+    entry.patchable = false;
+    entry.prefix.clear();
+    entry.suffix.clear();
+    size_t pos = data.find(m_corrid);
+    if (!m_corrid.empty() && pos != std::string::npos && data.find(m_corrid, pos + 1) == std::string::npos)
+    {
+        entry.prefix.assign(data, 0, pos);
+        entry.suffix.assign(data, pos + m_corrid.size(), std::string::npos);
+        entry.patchable = true;
+    }
+    return entry;
+}
+
+void HeaderTemplateCache::serialize(IZeroCopyBuffer& buffer, const Header& header, FuncSerializeHeader funcSerializeHeader, FuncSerializeCorrid funcSerializeCorrid)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    Entry* entry = nullptr;
+    for (int i = 0; i < m_numberOfEntries; ++i)
+    {
+        if (m_entries[i].funcSerializeHeader == funcSerializeHeader && isSameExceptCorrid(m_entries[i].header, header))
+        {
+            entry = &m_entries[i];
+            break;
+        }
+    }
+    if (entry)
+    {
+        ++m_hits;
+    }
+    else
+    {
+        ++m_misses;
+        entry = &createEntry(header, funcSerializeHeader, funcSerializeCorrid);
+    }
+
+    if (!entry->patchable)
+    {
+        lock.unlock();
+        funcSerializeHeader(buffer, header);
+        return;
+    }
+
+    funcSerializeCorrid(header.corrid, m_corrid);
+    const ssize_t size = entry->prefix.size() + m_corrid.size() + entry->suffix.size();
+    if (size == 0)
+    {
+        return;
+    }
+    char* dest = buffer.addBuffer(size);
+    memcpy(dest, entry->prefix.data(), entry->prefix.size());
+    dest += entry->prefix.size();
+    memcpy(dest, m_corrid.data(), m_corrid.size());
+    dest += m_corrid.size();
+    memcpy(dest, entry->suffix.data(), entry->suffix.size());
+}
+
+std::uint64_t HeaderTemplateCache::getHits() const
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_hits;
+}
+
+std::uint64_t HeaderTemplateCache::getMisses() const
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_misses;
+}
+
+} // namespace finalmq
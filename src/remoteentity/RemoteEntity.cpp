@@ -23,9 +23,9 @@
 #include "finalmq/remoteentity/RemoteEntity.h"
 
 #include <algorithm>
+#include <chrono>
 
 #include "finalmq/helpers/ModulenameFinalmq.h"
-#include "finalmq/helpers/Utils.h"
 #include "finalmq/protocolsession/ProtocolMessage.h"
 #include "finalmq/remoteentity/RemoteEntityContainer.h"
 #include "finalmq/serializestruct/StructBase.h"
@@ -43,6 +43,11 @@ namespace finalmq
 static const std::string FMQ_METHOD = "fmq_method";
 static const std::string EMPTY_PATH;
 
+static std::int64_t getTimeMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 PeerEvent::PeerEvent()
 {
 }
@@ -280,7 +285,7 @@ std::shared_ptr<PeerManager::Peer> PeerManager::getPeer(const PeerId& peerId) co
     return {};
 }
 
-PeerManager::ReadyToSend PeerManager::getRequestHeader(const PeerId& peerId, const std::string& path, const StructBase& structBase, CorrelationId correlationId, Header& header, IProtocolSessionPtr& session, std::string& virtualSessionId)
+PeerManager::ReadyToSend PeerManager::getRequestHeader(const PeerId& peerId, const std::string& path, const StructBase& structBase, CorrelationId correlationId, Header& header, IProtocolSessionPtr& session, std::string& virtualSessionId, std::shared_ptr<HeaderTemplateCache>& headerCache)
 {
     ReadyToSend readyToSend = RTS_PEER_NOT_AVAILABLE;
 
@@ -299,6 +304,11 @@ PeerManager::ReadyToSend PeerManager::getRequestHeader(const PeerId& peerId, con
             }
             assert(typeName);
             header = {peer->entityId, (peer->entityId == ENTITYID_INVALID) ? peer->entityName : std::string(), m_entityId, MsgMode::MSG_REQUEST, Status::STATUS_OK, path, *typeName, correlationId, {}};
+            if (!peer->headerCache)
+            {
+                peer->headerCache = std::make_shared<HeaderTemplateCache>();
+            }
+            headerCache = peer->headerCache;
             readyToSend = RTS_READY;
         }
         else
@@ -310,6 +320,21 @@ PeerManager::ReadyToSend PeerManager::getRequestHeader(const PeerId& peerId, con
     return readyToSend;
 }
 
+std::shared_ptr<HeaderTemplateCache> PeerManager::getHeaderCache(const PeerId& peerId)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    std::shared_ptr<PeerManager::Peer> peer = getPeer(peerId);
+    if (peer)
+    {
+        if (!peer->headerCache)
+        {
+            peer->headerCache = std::make_shared<HeaderTemplateCache>();
+        }
+        return peer->headerCache;
+    }
+    return nullptr;
+}
+
 std::string PeerManager::getEntityName(const PeerId& peerId)
 {
     std::string entityName;
@@ -458,7 +483,7 @@ const SessionInfo& PeerManager::getSession(PeerId peerId) const
 std::atomic<EntityId> RemoteEntity::m_entityIdNext{0};
 
 RemoteEntity::RemoteEntity()
-    : m_entityId(++m_entityIdNext), m_peerManager(std::make_shared<PeerManager>())
+    : m_entityId(++m_entityIdNext), m_timerWheel(getTimeMs()), m_peerManager(std::make_shared<PeerManager>())
 {
     m_peerManager->setEntityId(m_entityId);
     registerCommand<ConnectEntity>([this](const RequestContextPtr& requestContext, const std::shared_ptr<ConnectEntity>& request) {
@@ -515,30 +540,66 @@ void RemoteEntity::sendEvent(const PeerId& peerId, const std::string& path, cons
     sendRequest(peerId, path, structBase, CORRELATIONID_NONE);
 }
 
-void RemoteEntity::sendEventToAllPeers(const StructBase& structBase)
+/**
+ * Serializes the data of an event only once per content type and format data. All peers with
+ * the same content type and format data get the same raw data, only the header is serialized per peer.
+ */
+class RemoteEntity::FanOut
 {
-    std::vector<PeerId> peers = getAllPeers();
-    for (size_t i = 0; i < peers.size(); ++i)
+public:
+    FanOut(const StructBase& structBase)
+        : m_structBase(structBase)
     {
-        sendRequest(peers[i], EMPTY_PATH, structBase, CORRELATIONID_NONE);
     }
+
+    const StructBase& getStructToSend(const IProtocolSessionPtr& session)
+    {
+        const int contentType = session->getContentType();
+        const Variant& formatData = session->getFormatData();
+        for (const auto& entry : m_entries)
+        {
+            if (entry.contentType == contentType && entry.formatData == formatData)
+            {
+                return entry.structRaw ? *entry.structRaw : m_structBase;
+            }
+        }
+        std::shared_ptr<StructBase> structRaw;
+        std::string rawData;
+        if (RemoteEntityFormatRegistry::instance().serializeRawData(session, m_structBase, rawData))
+        {
+            structRaw = std::make_shared<RawDataMessage>();
+            structRaw->setRawData(m_structBase.getStructInfo().getTypeName(), contentType, rawData.data(), rawData.size());
+        }
+        m_entries.push_back({contentType, formatData, structRaw});
+        return structRaw ? *structRaw : m_structBase;
+    }
+
+private:
+    struct Entry
+    {
+        int contentType{};
+        Variant formatData{};
+        std::shared_ptr<StructBase> structRaw{};   ///< nullptr, if the format does not support raw data
+    };
+
+    const StructBase& m_structBase;
+    std::vector<Entry> m_entries{};
+};
+
+void RemoteEntity::sendEventToAllPeers(const StructBase& structBase)
+{
+    sendEventToAllPeersIntern(EMPTY_PATH, nullptr, structBase);
 }
 
 void RemoteEntity::sendEventToAllPeers(const std::string& path, const StructBase& structBase)
 {
-    std::vector<PeerId> peers = getAllPeers();
-    for (size_t i = 0; i < peers.size(); ++i)
-    {
-        sendRequest(peers[i], path, structBase, CORRELATIONID_NONE);
-    }
+    sendEventToAllPeersIntern(path, nullptr, structBase);
 }
 
 CorrelationId RemoteEntity::sendRequest(const PeerId& peerId, const StructBase& structBase, FuncReply funcReply)
 {
     CorrelationId correlationId = getNextCorrelationId();
-    std::unique_lock<std::mutex> lock(m_mutexRequests);
-    m_requests.emplace(correlationId, std::make_unique<Request>(peerId, std::make_shared<FuncReply>(std::move(funcReply))));
-    lock.unlock();
+    addRequest(correlationId, std::make_unique<Request>(peerId, std::make_shared<FuncReply>(std::move(funcReply))), 0);
     sendRequest(peerId, EMPTY_PATH, structBase, correlationId);
     return correlationId;
 }
@@ -546,14 +607,17 @@ CorrelationId RemoteEntity::sendRequest(const PeerId& peerId, const StructBase&
 CorrelationId RemoteEntity::sendRequest(const PeerId& peerId, const std::string& path, const StructBase& structBase, FuncReply funcReply)
 {
     CorrelationId correlationId = getNextCorrelationId();
-    std::unique_lock<std::mutex> lock(m_mutexRequests);
-    m_requests.emplace(correlationId, std::make_unique<Request>(peerId, std::make_shared<FuncReply>(std::move(funcReply))));
-    lock.unlock();
+    addRequest(correlationId, std::make_unique<Request>(peerId, std::make_shared<FuncReply>(std::move(funcReply))), 0);
     sendRequest(peerId, path, structBase, correlationId);
     return correlationId;
 }
 
 void RemoteEntity::sendRequest(const PeerId& peerId, const std::string& path, const StructBase& structBase, CorrelationId correlationId, IMessage::Metainfo* metainfo)
+{
+    sendRequestIntern(peerId, path, structBase, correlationId, metainfo, nullptr);
+}
+
+void RemoteEntity::sendRequestIntern(const PeerId& peerId, const std::string& path, const StructBase& structBase, CorrelationId correlationId, IMessage::Metainfo* metainfo, FanOut* fanOut)
 {
     //// if not initialized (entity not registered)
     //if (!m_initialized.load(std::memory_order_acquire))
@@ -566,16 +630,18 @@ void RemoteEntity::sendRequest(const PeerId& peerId, const std::string& path, co
     Header header;
     IProtocolSessionPtr session;
     std::string virtualSessionId;
+    std::shared_ptr<HeaderTemplateCache> headerCache;
 
     // the mutex lock is important for RTS_CONNECT_NOT_AVAILABLE / RTS_READY handling. See connectIntern(PeerId ...)
     std::unique_lock<std::mutex> lock(m_mutex);
-    PeerManager::ReadyToSend readyToSend = m_peerManager->getRequestHeader(peerId, path, structBase, correlationId, header, session, virtualSessionId);
+    PeerManager::ReadyToSend readyToSend = m_peerManager->getRequestHeader(peerId, path, structBase, correlationId, header, session, virtualSessionId, headerCache);
     lock.unlock();
 
     if (readyToSend == PeerManager::ReadyToSend::RTS_READY)
     {
         assert(session);
-        RemoteEntityFormatRegistry::instance().send(session, virtualSessionId, header, {}, &structBase, metainfo);
+        const StructBase& structToSend = fanOut ? fanOut->getStructToSend(session) : structBase;
+        RemoteEntityFormatRegistry::instance().send(session, virtualSessionId, header, {}, &structToSend, metainfo, nullptr, headerCache.get());
     }
     else if (readyToSend == PeerManager::ReadyToSend::RTS_SESSION_NOT_AVAILABLE)
     {
@@ -619,28 +685,37 @@ void RemoteEntity::sendEvent(const PeerId& peerId, const std::string& path, IMes
 
 void RemoteEntity::sendEventToAllPeers(IMessage::Metainfo&& metainfo, const StructBase& structBase)
 {
-    std::vector<PeerId> peers = getAllPeers();
-    for (size_t i = 0; i < peers.size(); ++i)
-    {
-        sendRequest(peers[i], EMPTY_PATH, structBase, CORRELATIONID_NONE, &metainfo);
-    }
+    sendEventToAllPeersIntern(EMPTY_PATH, &metainfo, structBase);
 }
 
 void RemoteEntity::sendEventToAllPeers(const std::string& path, IMessage::Metainfo&& metainfo, const StructBase& structBase)
 {
+    sendEventToAllPeersIntern(path, &metainfo, structBase);
+}
+
+void RemoteEntity::sendEventToAllPeersIntern(const std::string& path, IMessage::Metainfo* metainfo, const StructBase& structBase)
+{
+    FanOut fanOut(structBase);
     std::vector<PeerId> peers = getAllPeers();
     for (size_t i = 0; i < peers.size(); ++i)
     {
-        sendRequest(peers[i], path, structBase, CORRELATIONID_NONE, &metainfo);
+        if (metainfo && i + 1 < peers.size())
+        {
+            // the metainfo is moved into the message, every peer needs its own copy
+            IMessage::Metainfo metainfoPeer = *metainfo;
+            sendRequestIntern(peers[i], path, structBase, CORRELATIONID_NONE, &metainfoPeer, &fanOut);
+        }
+        else
+        {
+            sendRequestIntern(peers[i], path, structBase, CORRELATIONID_NONE, metainfo, &fanOut);
+        }
     }
 }
 
 CorrelationId RemoteEntity::sendRequest(const PeerId& peerId, IMessage::Metainfo&& metainfo, const StructBase& structBase, FuncReplyMeta funcReply)
 {
     CorrelationId correlationId = getNextCorrelationId();
-    std::unique_lock<std::mutex> lock(m_mutexRequests);
-    m_requests.emplace(correlationId, std::make_unique<Request>(peerId, std::make_shared<FuncReplyMeta>(std::move(funcReply))));
-    lock.unlock();
+    addRequest(correlationId, std::make_unique<Request>(peerId, std::make_shared<FuncReplyMeta>(std::move(funcReply))), 0);
     sendRequest(peerId, EMPTY_PATH, structBase, correlationId, &metainfo);
     return correlationId;
 }
@@ -648,13 +723,70 @@ CorrelationId RemoteEntity::sendRequest(const PeerId& peerId, IMessage::Metainfo
 CorrelationId RemoteEntity::sendRequest(const PeerId& peerId, const std::string& path, IMessage::Metainfo&& metainfo, const StructBase& structBase, FuncReplyMeta funcReply)
 {
     CorrelationId correlationId = getNextCorrelationId();
-    std::unique_lock<std::mutex> lock(m_mutexRequests);
-    m_requests.emplace(correlationId, std::make_unique<Request>(peerId, std::make_shared<FuncReplyMeta>(std::move(funcReply))));
-    lock.unlock();
+    addRequest(correlationId, std::make_unique<Request>(peerId, std::make_shared<FuncReplyMeta>(std::move(funcReply))), 0);
+    sendRequest(peerId, path, structBase, correlationId, &metainfo);
+    return correlationId;
+}
+
+CorrelationId RemoteEntity::sendRequest(const PeerId& peerId, const std::string& path, const StructBase& structBase, int timeout, FuncReply funcReply)
+{
+    CorrelationId correlationId = getNextCorrelationId();
+    addRequest(correlationId, std::make_unique<Request>(peerId, std::make_shared<FuncReply>(std::move(funcReply))), timeout);
+    sendRequest(peerId, path, structBase, correlationId);
+    return correlationId;
+}
+
+CorrelationId RemoteEntity::sendRequest(const PeerId& peerId, const std::string& path, IMessage::Metainfo&& metainfo, const StructBase& structBase, int timeout, FuncReplyMeta funcReply)
+{
+    CorrelationId correlationId = getNextCorrelationId();
+    addRequest(correlationId, std::make_unique<Request>(peerId, std::make_shared<FuncReplyMeta>(std::move(funcReply))), timeout);
     sendRequest(peerId, path, structBase, correlationId, &metainfo);
     return correlationId;
 }
 
+void RemoteEntity::addRequest(CorrelationId correlationId, std::unique_ptr<Request>&& request, int timeout)
+{
+    std::unique_lock<std::mutex> lock(m_mutexRequests);
+    if (timeout > 0)
+    {
+        request->timer = m_timerWheel.add(getTimeMs() + timeout, correlationId);
+        request->hasTimer = true;
+    }
+    m_requests.emplace(correlationId, std::move(request));
+}
+
+// m_mutexRequests must be locked
+std::unique_ptr<RemoteEntity::Request> RemoteEntity::takeRequest(std::unordered_map<CorrelationId, std::unique_ptr<Request>>::iterator it)
+{
+    std::unique_ptr<Request> request = std::move(it->second);
+    assert(request);
+    m_requests.erase(it);
+    if (request->hasTimer)
+    {
+        m_timerWheel.remove(request->timer);
+        request->hasTimer = false;
+    }
+    return request;
+}
+
+void RemoteEntity::releaseRequests(std::vector<std::unique_ptr<Request>>& requests, Status status)
+{
+    for (size_t i = 0; i < requests.size(); ++i)
+    {
+        std::unique_ptr<Request>& request = requests[i];
+        assert(request);
+        if (request->func && *request->func)
+        {
+            (*request->func)(request->peerId, status, nullptr);
+        }
+        else if (request->funcMeta && *request->funcMeta)
+        {
+            IMessage::Metainfo metainfoEmty;
+            (*request->funcMeta)(request->peerId, status, metainfoEmty, nullptr);
+        }
+    }
+}
+
 bool RemoteEntity::cancelReply(CorrelationId correlationId)
 {
     if (correlationId == CORRELATIONID_NONE)
@@ -665,7 +797,7 @@ bool RemoteEntity::cancelReply(CorrelationId correlationId)
     auto it = m_requests.find(correlationId);
     if (it != m_requests.end())
     {
-        m_requests.erase(it);
+        takeRequest(it);
         return true;
     }
     else
@@ -681,9 +813,7 @@ void RemoteEntity::replyReceived(const ReceiveData& receiveData)
     auto it = m_requests.find(receiveData.header.corrid);
     if (it != m_requests.end())
     {
-        request = std::move(it->second);
-        assert(request);
-        m_requests.erase(it);
+        request = takeRequest(it);
     }
     lock.unlock();
 
@@ -847,8 +977,9 @@ void RemoteEntity::removePeer(PeerId peerId, Status status)
             {
                 if (it->second->peerId == peerId)
                 {
-                    requests.push_back(std::move(it->second));
-                    it = m_requests.erase(it);
+                    auto itRemove = it;
+                    ++it;
+                    requests.push_back(takeRequest(itRemove));
                 }
                 else
                 {
@@ -858,20 +989,7 @@ void RemoteEntity::removePeer(PeerId peerId, Status status)
             lock.unlock();
 
             // release pending calls
-            for (size_t i = 0; i < requests.size(); ++i)
-            {
-                std::unique_ptr<Request>& request = requests[i];
-                assert(request);
-                if (request->func && *request->func)
-                {
-                    (*request->func)(request->peerId, status, nullptr);
-                }
-                else if (request->funcMeta && *request->funcMeta)
-                {
-                    IMessage::Metainfo metainfoEmty;
-                    (*request->funcMeta)(request->peerId, status, metainfoEmty, nullptr);
-                }
-            }
+            releaseRequests(requests, status);
         }
     }
 }
@@ -901,13 +1019,14 @@ void RemoteEntity::connectIntern(PeerId peerId, const SessionInfo& session, cons
         Header header;
         IProtocolSessionPtr sessionRet;
         std::string virtualSessionIdRet;
+        std::shared_ptr<HeaderTemplateCache> headerCache;
         assert(request.structBase);
-        PeerManager::ReadyToSend readyToSend = m_peerManager->getRequestHeader(peerId, EMPTY_PATH, *request.structBase, request.correlationId, header, sessionRet, virtualSessionIdRet);
+        PeerManager::ReadyToSend readyToSend = m_peerManager->getRequestHeader(peerId, EMPTY_PATH, *request.structBase, request.correlationId, header, sessionRet, virtualSessionIdRet, headerCache);
 
         if (readyToSend == PeerManager::ReadyToSend::RTS_READY)
         {
             assert(session);
-            RemoteEntityFormatRegistry::instance().send(sessionRet, virtualSessionIdRet, header, {}, request.structBase.get());
+            RemoteEntityFormatRegistry::instance().send(sessionRet, virtualSessionIdRet, header, {}, request.structBase.get(), nullptr, nullptr, headerCache.get());
             ok = true;
         }
         else
@@ -939,28 +1058,27 @@ void RemoteEntity::connect(PeerId peerId, const SessionInfo& session, const std:
 }
 
 void RemoteEntity::registerCommandFunction(const std::string& path, const std::string& type, FuncCommand funcCommand)
+{
+    registerCommandFunction(path, type, std::move(funcCommand), false);
+}
+
+void RemoteEntity::registerCommandFunctionLazy(const std::string& path, const std::string& type, FuncCommand funcCommand)
+{
+    registerCommandFunction(path, type, std::move(funcCommand), true);
+}
+
+void RemoteEntity::registerCommandFunction(const std::string& path, const std::string& type, FuncCommand funcCommand, bool lazy)
 {
     std::shared_ptr<FuncCommand> func = std::make_shared<FuncCommand>(std::move(funcCommand));
     std::unique_lock<std::mutex> lock(m_mutexFunctions);
-    if (path.find('{') != std::string::npos)
+    if (CommandRouter::isVariablePath(path))
     {
-        FunctionVar funcVar;
-        funcVar.type = type;
-        funcVar.func = func;
-        Utils::split(path, 0, path.size(), '/', funcVar.pathEntries);
-        m_funcCommandsVar.emplace_back(std::move(funcVar));
-    }
-    else if (path.find('*') != std::string::npos)
-    {
-        FunctionVar funcVar;
-        funcVar.type = type;
-        funcVar.func = func;
-        Utils::split(path, 0, path.size(), '/', funcVar.pathEntries);
-        m_funcCommandsVarStar.emplace_back(std::move(funcVar));
+        m_routerCommandsVar.addRoute(path, static_cast<std::uint32_t>(m_funcCommandsVar.size()));
+        m_funcCommandsVar.push_back({type, func, lazy});
     }
     else
     {
-        m_funcCommandsStatic[path] = {type, func};
+        m_funcCommandsStatic[path] = {type, func, lazy};
     }
 }
 
@@ -1040,108 +1158,11 @@ const RemoteEntity::Function* RemoteEntity::getFunction(const std::string& path,
         return &it1->second;
     }
 
-    std::vector<std::string> pathEntries;
-    Utils::split(path, 0, path.size(), '/', pathEntries);
-
-    if (!m_funcCommandsVar.empty())
+    std::uint32_t routeId = 0;
+    if (m_routerCommandsVar.findRoute(path, keys, routeId))
     {
-        for (auto it2 = m_funcCommandsVar.begin(); it2 != m_funcCommandsVar.end(); ++it2)
-        {
-            const FunctionVar& funcVar = *it2;
-            if (funcVar.pathEntries.size() == pathEntries.size())
-            {
-                bool match = true;
-                for (size_t i = 0; i < pathEntries.size() && match; ++i)
-                {
-                    const std::string& funcVarEntry = funcVar.pathEntries[i];
-                    if (funcVarEntry.size() >= 2 && funcVarEntry[0] == '{')
-                    {
-                        if (keys && funcVarEntry.size() >= 3)
-                        {
-                            static const std::string PATH_PREFIX = "PATH_";
-                            std::string key = PATH_PREFIX;
-                            key.insert(key.end(), funcVarEntry.data() + 1, funcVarEntry.data() + funcVarEntry.size() - 1);
-                            (*keys)[std::move(key)] = pathEntries[i];
-                        }
-                    }
-                    else
-                    {
-                        if (funcVarEntry != pathEntries[i])
-                        {
-                            match = false;
-                        }
-                    }
-                }
-                if (match)
-                {
-                    return &funcVar;
-                }
-            }
-        }
-    }
-
-    if (!m_funcCommandsVarStar.empty())
-    {
-        for (auto it2 = m_funcCommandsVarStar.begin(); it2 != m_funcCommandsVarStar.end(); ++it2)
-        {
-            const FunctionVar& funcVar = *it2;
-            bool match = true;
-            size_t j = 0;
-            for (size_t i = 0; i < funcVar.pathEntries.size() && match; ++i)
-            {
-                const std::string& funcVarEntry = funcVar.pathEntries[i];
-                if (funcVarEntry[0] == '*')
-                {
-                    std::string nextEntry;
-                    ++i;
-                    bool nextEntryAvailable = (i < funcVar.pathEntries.size());
-                    if (nextEntryAvailable)
-                    {
-                        nextEntry = funcVar.pathEntries[i];
-                    }
-                    std::string value;
-                    match = false;
-                    for (; j < pathEntries.size() && !match; ++j)
-                    {
-                        bool matchNextEntry = (nextEntryAvailable && pathEntries[j] == nextEntry);
-                        bool matchLastEntry = (!nextEntryAvailable && (j == pathEntries.size() - 1));
-
-                        if (!matchNextEntry)
-                        {
-                            if (!value.empty())
-                            {
-                                value += '/';
-                            }
-                            value += pathEntries[j];
-                        }
-
-                        if (matchNextEntry || matchLastEntry)
-                        {
-                            if (keys && funcVarEntry.size() >= 3)
-                            {
-                                static const std::string PATH_PREFIX = "PATH_";
-                                std::string key = PATH_PREFIX;
-                                key.insert(key.end(), funcVarEntry.data() + 1, funcVarEntry.data() + funcVarEntry.size() - 1);
-                                (*keys)[std::move(key)] = std::move(value);
-                            }
-                            match = true;
-                        }
-                    }
-                }
-                else
-                {
-                    if (funcVarEntry != pathEntries[j])
-                    {
-                        match = false;
-                    }
-                    ++j;
-                }
-            }
-            if (match && j == pathEntries.size())
-            {
-                return &funcVar;
-            }
-        }
+        assert(routeId < m_funcCommandsVar.size());
+        return &m_funcCommandsVar[routeId];
     }
 
     return nullptr;
@@ -1155,10 +1176,12 @@ void RemoteEntity::receivedRequest(ReceiveData& receiveData)
     }
 
     std::shared_ptr<FuncCommand> func;
+    bool lazy = false;
     const RemoteEntity::Function* funcData = getFunction(receiveData.header.path, &receiveData.message->getAllMetainfo());
     if (funcData)
     {
         func = funcData->func;
+        lazy = funcData->lazy;
         assert(func);
     }
 
@@ -1167,7 +1190,17 @@ void RemoteEntity::receivedRequest(ReceiveData& receiveData)
 
     if (func && *func)
     {
-        (*func)(requestContext, receiveData.structBase);
+        // the data is parsed only, if there is a function for the request
+        if (!lazy && !receiveData.structBase && receiveData.payload)
+        {
+            receiveData.structBase = receiveData.payload->getData();
+            if (receiveData.payload->getFormatStatus() & FORMATSTATUS_SYNTAX_ERROR)
+            {
+                requestContext->reply(Status::STATUS_SYNTAX_ERROR);
+                return;
+            }
+        }
+        (*func)(requestContext, lazy ? nullptr : receiveData.structBase);
     }
     else
     {
@@ -1218,6 +1251,25 @@ void RemoteEntity::receivedReply(const ReceiveData& receiveData)
     }
 }
 
+void RemoteEntity::cycleTime()
+{
+    std::vector<std::unique_ptr<Request>> requests;
+    std::vector<std::uint64_t> expired;
+    std::unique_lock<std::mutex> lock(m_mutexRequests);
+    m_timerWheel.advance(getTimeMs(), expired);
+    for (size_t i = 0; i < expired.size(); ++i)
+    {
+        auto it = m_requests.find(expired[i]);
+        assert(it != m_requests.end());
+        // the timer is already removed by the timer wheel
+        it->second->hasTimer = false;
+        requests.push_back(takeRequest(it));
+    }
+    lock.unlock();
+
+    releaseRequests(requests, Status::STATUS_REQUEST_TIMEOUT);
+}
+
 void RemoteEntity::deinit()
 {
     std::vector<PeerId> peers = getAllPeers();
@@ -115,10 +115,37 @@ void RemoteEntityContainer::deinit()
 
 // IRemoteEntityContainer
 
-void RemoteEntityContainer::init(const IExecutorPtr& executor, int cycleTime, FuncTimer funcTimer, bool storeRawDataInReceiveStruct, int checkReconnectInterval)
+void RemoteEntityContainer::init(const IExecutorPtr& executor, int cycleTime, FuncTimer funcTimer, bool storeRawDataInReceiveStruct, int checkReconnectInterval, int numberOfPollerLoops, ReceiveMode receiveMode)
 {
     m_storeRawDataInReceiveStruct = storeRawDataInReceiveStruct;
-    m_protocolSessionContainer->init(executor, cycleTime, std::move(funcTimer), checkReconnectInterval);
+    m_protocolSessionContainer->init(executor, cycleTime, [this, funcTimer{std::move(funcTimer)}]() {
+        if (funcTimer)
+        {
+            funcTimer();
+        }
+        cycleTimeEntities();
+    }, checkReconnectInterval, numberOfPollerLoops, receiveMode);
+}
+
+void RemoteEntityContainer::cycleTimeEntities()
+{
+    std::vector<hybrid_ptr<IRemoteEntity>> entities;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    entities.reserve(m_entityId2entity.size());
+    for (auto it = m_entityId2entity.begin(); it != m_entityId2entity.end(); ++it)
+    {
+        entities.push_back(it->second);
+    }
+    lock.unlock();
+
+    for (size_t i = 0; i < entities.size(); ++i)
+    {
+        auto entity = entities[i].lock();
+        if (entity)
+        {
+            entity->cycleTime();
+        }
+    }
 }
 
 static std::string endpointToProtocolEndpoint(const std::string& endpoint, std::string* contentTypeName = nullptr)
@@ -515,11 +542,17 @@ void RemoteEntityContainer::received(const IProtocolSessionPtr& session, const I
     ReceiveData receiveData{createSessionInfo(session), {}, message, {}, false, {}};
     if (!session->doesSupportMetainfo())
     {
-        receiveData.structBase = RemoteEntityFormatRegistry::instance().parse(session, *message, m_storeRawDataInReceiveStruct, name2entityNoLock, receiveData.header, formatStatus);
+        receiveData.payload = RemoteEntityFormatRegistry::instance().parse(session, message, m_storeRawDataInReceiveStruct, name2entityNoLock, receiveData.header, formatStatus);
     }
     else
     {
-        receiveData.structBase = RemoteEntityFormatRegistry::instance().parseHeaderInMetainfo(session, *message, m_storeRawDataInReceiveStruct, name2entityNoLock, receiveData.header, formatStatus);
+        receiveData.payload = RemoteEntityFormatRegistry::instance().parseHeaderInMetainfo(session, message, m_storeRawDataInReceiveStruct, name2entityNoLock, receiveData.header, formatStatus);
+    }
+    assert(receiveData.payload);
+    // the data of requests is parsed by the entity, if it has a function for the request
+    if (receiveData.payload->isParsed())
+    {
+        receiveData.structBase = receiveData.payload->getData();
     }
 
     EntityId entityId = receiveData.header.destid;
@@ -592,6 +625,7 @@ void RemoteEntityContainer::received(const IProtocolSessionPtr& session, const I
     {
         if (entity)
         {
+            receiveData.structBase = receiveData.payload->getData();
             if (!receiveData.structBase && receiveData.header.status == Status::STATUS_OK && !type.empty())
             {
                 receiveData.header.status = Status::STATUS_REPLYTYPE_NOT_KNOWN;
@@ -22,6 +22,7 @@
 
 #include "finalmq/remoteentity/RemoteEntityFormatHl7.h"
 
+#include "finalmq/helpers/ZeroCopyBuffer.h"
 #include "finalmq/protocolsession/ProtocolMessage.h"
 #include "finalmq/remoteentity/entitydata.fmq.h"
 #include "finalmq/serializehl7/ParserHl7.h"
@@ -179,7 +180,7 @@ static bool isReplaceNeeded(const IProtocolSessionPtr& session, std::string& lin
     return replaceNeeded;
 }
 
-void RemoteEntityFormatHl7::serialize(const IProtocolSessionPtr& session, IMessage& message, const Header& /*header*/, const StructBase* structBase)
+void RemoteEntityFormatHl7::serialize(const IProtocolSessionPtr& session, IMessage& message, const Header& /*header*/, const StructBase* structBase, HeaderTemplateCache* /*headerCache*/)
 {
     serializeData(session, message, structBase);
 }
@@ -228,7 +229,18 @@ void RemoteEntityFormatHl7::serializeData(const IProtocolSessionPtr& session, IM
     }
 }
 
-std::shared_ptr<StructBase> RemoteEntityFormatHl7::parse(const IProtocolSessionPtr& session, const BufferRef& bufferRef, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& /*name2Entity*/, Header& header, int& formatStatus)
+bool RemoteEntityFormatHl7::serializeRawData(const IProtocolSessionPtr& /*session*/, const StructBase& structBase, std::string& rawData)
+{
+    // the line end replacement and the message start/end are done per session in serializeData()
+    ZeroCopyBuffer buffer;
+    SerializerHl7 serializerData(buffer, 512);
+    ParserStruct parserData(serializerData, structBase);
+    parserData.parseStruct();
+    rawData = buffer.getData();
+    return true;
+}
+
+std::shared_ptr<StructBase> RemoteEntityFormatHl7::parse(const IProtocolSessionPtr& session, const BufferRef& bufferRef, const std::shared_ptr<const std::string>& receiveBuffer, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& /*name2Entity*/, Header& header, int& formatStatus)
 {
     formatStatus = FORMATSTATUS_HEADER_PARSED_BY_FORMAT;
     char* buffer = bufferRef.first;
@@ -328,7 +340,7 @@ std::shared_ptr<StructBase> RemoteEntityFormatHl7::parse(const IProtocolSessionP
         header.corrid = 1;
 
         BufferRef bufferRefData = {buffer, sizeBuffer};
-        data = parseData(session, bufferRefData, storeRawData, header.type, formatStatus, {});
+        data = parseData(session, bufferRefData, receiveBuffer, storeRawData, header.type, formatStatus, {});
 
         formatStatus |= FORMATSTATUS_AUTOMATIC_CONNECT;
     }
@@ -336,7 +348,7 @@ std::shared_ptr<StructBase> RemoteEntityFormatHl7::parse(const IProtocolSessionP
     return data;
 }
 
-std::shared_ptr<StructBase> RemoteEntityFormatHl7::parseData(const IProtocolSessionPtr& session, const BufferRef& bufferRef, bool storeRawData, std::string& type, int& formatStatus, const std::string& /*typeOfGeneralMessage*/)
+std::shared_ptr<StructBase> RemoteEntityFormatHl7::parseData(const IProtocolSessionPtr& session, const BufferRef& bufferRef, const std::shared_ptr<const std::string>& receiveBuffer, bool storeRawData, std::string& type, int& formatStatus, const std::string& /*typeOfGeneralMessage*/)
 {
     const char* buffer = bufferRef.first;
     ssize_t sizeBuffer = bufferRef.second;
@@ -406,6 +418,7 @@ std::shared_ptr<StructBase> RemoteEntityFormatHl7::parseData(const IProtocolSess
             if (sizeData > 0)
             {
                 SerializerStruct serializerData(*data);
+                serializerData.setZeroCopyBuffer(receiveBuffer);
                 ParserHl7 parserData(serializerData, buffer, sizeData);
                 const char* endData = parserData.parseStruct(type);
                 if (!endData)
@@ -33,6 +33,7 @@
 #include "finalmq/protocolsession/ProtocolMessage.h"
 #include "finalmq/helpers/ZeroCopyBuffer.h"
 
+#include "finalmq/remoteentity/HeaderTemplateCache.h"
 #include "finalmq/remoteentity/entitydata.fmq.h"
 
 //#include "finalmq/helpers/ModulenameFinalmq.h"
@@ -64,13 +65,39 @@ struct RegisterFormatJson
 
 #define JSONBLOCKSIZE   512
 
-void RemoteEntityFormatJson::serialize(const IProtocolSessionPtr& session, IMessage& message, const Header& header, const StructBase* structBase)
+static void serializeHeaderJson(IZeroCopyBuffer& buffer, const Header& header)
 {
-    message.addSendPayload("[", 1, JSONBLOCKSIZE);
-
-    SerializerJson serializerHeader(message, JSONBLOCKSIZE);
+    SerializerJson serializerHeader(buffer, JSONBLOCKSIZE);
     ParserStruct parserHeader(serializerHeader, header);
     parserHeader.parseStruct();
+}
+
+static void serializeCorridJson(std::uint64_t corrid, std::string& field)
+{
+    field.clear();
+    // the default value is skipped. If corrid is the first field of the header, the field is not
+    // found in the template (no comma), then the header is always serialized completely.
+    if (corrid != 0)
+    {
+        field = ",\"corrid\":\"";
+        field += std::to_string(corrid);
+        field += '\"';
+    }
+}
+
+void RemoteEntityFormatJson::serialize(const IProtocolSessionPtr& session, IMessage& message, const Header& header, const StructBase* structBase, HeaderTemplateCache* headerCache)
+{
+    message.addSendPayload("[", 1, JSONBLOCKSIZE);
+
+    // the header of consecutive messages to a peer differs often only in the correlation ID
+    if (headerCache)
+    {
+        headerCache->serialize(message, header, serializeHeaderJson, serializeCorridJson);
+    }
+    else
+    {
+        serializeHeaderJson(message, header);
+    }
 
 
     // add end of header
@@ -90,26 +117,33 @@ void RemoteEntityFormatJson::serialize(const IProtocolSessionPtr& session, IMess
 }
 
 
+static void getSerializeProperties(const IProtocolSessionPtr& session, bool& enumAsString, bool& skipDefaultValues)
+{
+    enumAsString = true;
+    skipDefaultValues = false;
+    const Variant& formatData = session->getFormatData();
+    if (formatData.getType() != VARTYPE_NONE)
+    {
+        const bool* propEnumAsString = formatData.getData<bool>(RemoteEntityFormatJson::PROPERTY_SERIALIZE_ENUM_AS_STRING);
+        const bool* propSkipDefaultValues = formatData.getData<bool>(RemoteEntityFormatJson::PROPERTY_SERIALIZE_SKIP_DEFAULT_VALUES);
+        if (propEnumAsString != nullptr)
+        {
+            enumAsString = *propEnumAsString;
+        }
+        if (propSkipDefaultValues != nullptr)
+        {
+            skipDefaultValues = *propSkipDefaultValues;
+        }
+    }
+}
+
 void RemoteEntityFormatJson::serializeData(const IProtocolSessionPtr& session, IMessage& message, const StructBase* structBase)
 {
     if (structBase)
     {
         bool enumAsString = true;
         bool skipDefaultValues = false;
-        const Variant& formatData = session->getFormatData();
-        if (formatData.getType() != VARTYPE_NONE)
-        {
-            const bool* propEnumAsString = formatData.getData<bool>(PROPERTY_SERIALIZE_ENUM_AS_STRING);
-            const bool* propSkipDefaultValues = formatData.getData<bool>(PROPERTY_SERIALIZE_SKIP_DEFAULT_VALUES);
-            if (propEnumAsString != nullptr)
-            {
-                enumAsString = *propEnumAsString;
-            }
-            if (propSkipDefaultValues != nullptr)
-            {
-                skipDefaultValues = *propSkipDefaultValues;
-            }
-        }
+        getSerializeProperties(session, enumAsString, skipDefaultValues);
 
         // payload
         if (structBase->getRawContentType() == CONTENT_TYPE)
@@ -135,9 +169,12 @@ void RemoteEntityFormatJson::serializeData(const IProtocolSessionPtr& session, I
         }
         else if (structBase->getStructInfo().getTypeName() != RawDataMessage::structInfo().getTypeName())
         {
-            SerializerJson serializerData(message, JSONBLOCKSIZE, enumAsString, skipDefaultValues);
-            ParserStruct parserData(serializerData, *structBase);
-            parserData.parseStruct();
+            if (!structBase->serializeJson(message, JSONBLOCKSIZE, enumAsString, skipDefaultValues))
+            {
+                SerializerJson serializerData(message, JSONBLOCKSIZE, enumAsString, skipDefaultValues);
+                ParserStruct parserData(serializerData, *structBase);
+                parserData.parseStruct();
+            }
         }
     }
     else
@@ -147,6 +184,22 @@ void RemoteEntityFormatJson::serializeData(const IProtocolSessionPtr& session, I
 }
 
 
+bool RemoteEntityFormatJson::serializeRawData(const IProtocolSessionPtr& session, const StructBase& structBase, std::string& rawData)
+{
+    bool enumAsString = true;
+    bool skipDefaultValues = false;
+    getSerializeProperties(session, enumAsString, skipDefaultValues);
+    ZeroCopyBuffer buffer;
+    if (!structBase.serializeJson(buffer, JSONBLOCKSIZE, enumAsString, skipDefaultValues))
+    {
+        SerializerJson serializerData(buffer, JSONBLOCKSIZE, enumAsString, skipDefaultValues);
+        ParserStruct parserData(serializerData, structBase);
+        parserData.parseStruct();
+    }
+    rawData = buffer.getData();
+    return true;
+}
+
 static ssize_t findLast(const char* buffer, ssize_t size, char c)
 {
     for (ssize_t i = size - 1; i >= 0; --i)
@@ -189,15 +242,27 @@ static const std::string FMQ_PATH = "fmq_path";
 
 
 
-std::shared_ptr<StructBase> RemoteEntityFormatJson::parse(const IProtocolSessionPtr& session, const BufferRef& bufferRef, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus)
+std::shared_ptr<StructBase> RemoteEntityFormatJson::parse(const IProtocolSessionPtr& session, const BufferRef& bufferRef, const std::shared_ptr<const std::string>& receiveBuffer, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus)
 {
     formatStatus = 0;
+    std::string typeOfGeneralMessage;
+    BufferRef bufferRefData{nullptr, 0};
+    std::shared_ptr<StructBase> data;
+    if (parseHeader(session, bufferRef, name2Entity, header, typeOfGeneralMessage, bufferRefData))
+    {
+        data = parseData(session, bufferRefData, receiveBuffer, storeRawData, header.type, formatStatus, typeOfGeneralMessage);
+    }
+    return data;
+}
+
+bool RemoteEntityFormatJson::parseHeader(const IProtocolSessionPtr& /*session*/, const BufferRef& bufferRef, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, std::string& typeOfGeneralMessage, BufferRef& bufferRefData)
+{
     char* buffer = bufferRef.first;
     ssize_t sizeBuffer = bufferRef.second;
 
     if (sizeBuffer == 0)
     {
-        return nullptr;
+        return false;
     }
 
     if (sizeBuffer > 0 && buffer[0] == '[')
@@ -210,8 +275,6 @@ std::shared_ptr<StructBase> RemoteEntityFormatJson::parse(const IProtocolSession
         --sizeBuffer;
     }
 
-    std::string typeOfGeneralMessage;
-
     static const std::string WILDCARD = "*";
     const char* endHeader = nullptr;
     if (buffer[0] == '/')
@@ -283,9 +346,13 @@ std::shared_ptr<StructBase> RemoteEntityFormatJson::parse(const IProtocolSession
     }
     else
     {
-        SerializerStruct serializerHeader(header);
-        ParserJson parserHeader(serializerHeader, buffer, sizeBuffer);
-        endHeader = parserHeader.parseStruct(header.getStructInfo().getTypeName());
+        endHeader = header.parseJson(buffer, sizeBuffer);
+        if (!endHeader)
+        {
+            SerializerStruct serializerHeader(header);
+            ParserJson parserHeader(serializerHeader, buffer, sizeBuffer);
+            endHeader = parserHeader.parseStruct(header.getStructInfo().getTypeName());
+        }
         if (endHeader)
         {
             // skip comma
@@ -323,8 +390,6 @@ std::shared_ptr<StructBase> RemoteEntityFormatJson::parse(const IProtocolSession
         }
     }
 
-    std::shared_ptr<StructBase> data;
-
     if (endHeader)
     {
         ssize_t sizeHeader = endHeader - buffer;
@@ -333,16 +398,20 @@ std::shared_ptr<StructBase> RemoteEntityFormatJson::parse(const IProtocolSession
         ssize_t sizeData = sizeBuffer - sizeHeader;
         assert(sizeData >= 0);
 
-        BufferRef bufferRefData = {buffer, sizeData};
-        data = parseData(session, bufferRefData, storeRawData, header.type, formatStatus, typeOfGeneralMessage);
+        bufferRefData = {buffer, sizeData};
     }
 
-    return data;
+    return (endHeader != nullptr);
 }
 
+bool RemoteEntityFormatJson::isDataParsedOnDemand() const
+{
+    return true;
+}
 
 
-std::shared_ptr<StructBase> RemoteEntityFormatJson::parseData(const IProtocolSessionPtr& /*session*/, const BufferRef& bufferRef, bool storeRawData, std::string& type, int& formatStatus, const std::string& typeOfGeneralMessage)
+
+std::shared_ptr<StructBase> RemoteEntityFormatJson::parseData(const IProtocolSessionPtr& /*session*/, const BufferRef& bufferRef, const std::shared_ptr<const std::string>& receiveBuffer, bool storeRawData, std::string& type, int& formatStatus, const std::string& typeOfGeneralMessage)
 {
     formatStatus = 0;
     const char* buffer = bufferRef.first;
@@ -362,9 +431,14 @@ std::shared_ptr<StructBase> RemoteEntityFormatJson::parseData(const IProtocolSes
             {
                 if (type != GeneralMessage::structInfo().getTypeName() || typeOfGeneralMessage.empty())
                 {
-                    SerializerStruct serializerData(*data);
-                    ParserJson parserData(serializerData, buffer, sizeData);
-                    const char* endData = parserData.parseStruct(type);
+                    const char* endData = data->parseJson(buffer, sizeData);
+                    if (!endData)
+                    {
+                        SerializerStruct serializerData(*data);
+                        serializerData.setZeroCopyBuffer(receiveBuffer);
+                        ParserJson parserData(serializerData, buffer, sizeData);
+                        endData = parserData.parseStruct(type);
+                    }
                     if (!endData)
                     {
                         formatStatus |= FORMATSTATUS_SYNTAX_ERROR;
@@ -23,9 +23,12 @@
 #include "finalmq/remoteentity/RemoteEntityFormatProto.h"
 
 #include "finalmq/helpers/ModulenameFinalmq.h"
+#include "finalmq/helpers/ZeroCopyBuffer.h"
+#include "finalmq/remoteentity/HeaderTemplateCache.h"
 #include "finalmq/remoteentity/entitydata.fmq.h"
 #include "finalmq/serializeproto/ParserProto.h"
 #include "finalmq/serializeproto/SerializerProto.h"
+#include "finalmq/serializeproto/SerializerProtoSized.h"
 #include "finalmq/serializestruct/ParserStruct.h"
 #include "finalmq/serializestruct/SerializerStruct.h"
 #include "finalmq/serializestruct/StructFactoryRegistry.h"
@@ -50,13 +53,62 @@ struct RegisterFormatProto
 
 #define PROTOBUFBLOCKSIZE 512
 
-void RemoteEntityFormatProto::serialize(const IProtocolSessionPtr& session, IMessage& message, const Header& header, const StructBase* structBase)
+static void serializeStructProto(IZeroCopyBuffer& buffer, const StructBase& structBase, int maxBlockSize)
+{
+    if (structBase.serializeProto(buffer))
+    {
+        return;
+    }
+    SerializerProtoSized serializerSized(buffer);
+    if (serializerSized.serializeStruct(structBase))
+    {
+        return;
+    }
+    SerializerProto serializer(buffer, maxBlockSize);
+    ParserStruct parser(serializer, structBase);
+    parser.parseStruct();
+}
+
+static void serializeHeaderProto(IZeroCopyBuffer& buffer, const Header& header)
+{
+    serializeStructProto(buffer, header, PROTOBUFBLOCKSIZE);
+}
+
+static void appendVarint(std::string& field, std::uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        field += static_cast<char>(value | 0x80);
+        value >>= 7;
+    }
+    field += static_cast<char>(value);
+}
+
+static void serializeCorridProto(std::uint64_t corrid, std::string& field)
+{
+    static const int INDEX_CORRID = Header::structInfo().getMetaStruct().getFieldByName("corrid")->index;
+    field.clear();
+    // like ProtoWriter::writeVarintField(), the default value is not serialized
+    if (corrid != 0)
+    {
+        appendVarint(field, static_cast<std::uint64_t>(INDEX_CORRID + 1) << 3);
+        appendVarint(field, corrid);
+    }
+}
+
+void RemoteEntityFormatProto::serialize(const IProtocolSessionPtr& session, IMessage& message, const Header& header, const StructBase* structBase, HeaderTemplateCache* headerCache)
 {
     char* bufferSizeHeader = message.addSendPayload(4, PROTOBUFBLOCKSIZE);
 
-    SerializerProto serializerHeader(message, PROTOBUFBLOCKSIZE);
-    ParserStruct parserHeader(serializerHeader, header);
-    parserHeader.parseStruct();
+    // the header of consecutive messages to a peer differs often only in the correlation ID
+    if (headerCache)
+    {
+        headerCache->serialize(message, header, serializeHeaderProto, serializeCorridProto);
+    }
+    else
+    {
+        serializeHeaderProto(message, header);
+    }
     ssize_t sizeHeader = message.getTotalSendPayloadSize() - 4;
     assert(sizeHeader >= 0);
     size_t uSizeHeader = sizeHeader;
@@ -94,9 +146,7 @@ void RemoteEntityFormatProto::serializeData(const IProtocolSessionPtr& /*session
         }
         else if (structBase->getStructInfo().getTypeName() != finalmq::RawDataMessage::structInfo().getTypeName())
         {
-            SerializerProto serializerData(message);
-            ParserStruct parserData(serializerData, *structBase);
-            parserData.parseStruct();
+            serializeStructProto(message, *structBase, PROTOBUFBLOCKSIZE);
         }
         ssize_t sizeEnd = message.getTotalSendPayloadSize();
         sizePayload = sizeEnd - sizeStart;
@@ -112,15 +162,35 @@ void RemoteEntityFormatProto::serializeData(const IProtocolSessionPtr& /*session
     *bufferSizePayload = static_cast<unsigned char>(uSizePayload >> 24);
 }
 
-std::shared_ptr<StructBase> RemoteEntityFormatProto::parse(const IProtocolSessionPtr& session, const BufferRef& bufferRef, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus)
+bool RemoteEntityFormatProto::serializeRawData(const IProtocolSessionPtr& /*session*/, const StructBase& structBase, std::string& rawData)
+{
+    ZeroCopyBuffer buffer;
+    serializeStructProto(buffer, structBase, PROTOBUFBLOCKSIZE);
+    rawData = buffer.getData();
+    return true;
+}
+
+std::shared_ptr<StructBase> RemoteEntityFormatProto::parse(const IProtocolSessionPtr& session, const BufferRef& bufferRef, const std::shared_ptr<const std::string>& receiveBuffer, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus)
 {
     formatStatus = 0;
+    std::string typeOfGeneralMessage;
+    BufferRef bufferRefData{nullptr, 0};
+    std::shared_ptr<StructBase> data;
+    if (parseHeader(session, bufferRef, name2Entity, header, typeOfGeneralMessage, bufferRefData))
+    {
+        data = parseData(session, bufferRefData, receiveBuffer, storeRawData, header.type, formatStatus, typeOfGeneralMessage);
+    }
+    return data;
+}
+
+bool RemoteEntityFormatProto::parseHeader(const IProtocolSessionPtr& /*session*/, const BufferRef& bufferRef, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, std::string& typeOfGeneralMessage, BufferRef& bufferRefData)
+{
     char* buffer = bufferRef.first;
     ssize_t sizeBuffer = bufferRef.second;
     if (sizeBuffer < 4)
     {
         streamError << "buffer size too small: " << sizeBuffer;
-        return nullptr;
+        return false;
     }
 
     ssize_t sizePayload = sizeBuffer - 4;
@@ -138,13 +208,15 @@ std::shared_ptr<StructBase> RemoteEntityFormatProto::parse(const IProtocolSessio
     }
     bool ok = false;
 
-    std::string typeOfGeneralMessage;
-
     if (sizeHeader <= sizePayload)
     {
-        SerializerStruct serializerHeader(header);
-        ParserProto parserHeader(serializerHeader, buffer, sizeHeader);
-        ok = parserHeader.parseStruct(Header::structInfo().getTypeName());
+        ok = header.parseProto(buffer, sizeHeader);
+        if (!ok)
+        {
+            SerializerStruct serializerHeader(header);
+            ParserProto parserHeader(serializerHeader, buffer, sizeHeader);
+            ok = parserHeader.parseStruct(Header::structInfo().getTypeName());
+        }
         if (header.type.empty() && !header.path.empty())
         {
             hybrid_ptr<IRemoteEntity> remoteEntity;
@@ -178,21 +250,23 @@ std::shared_ptr<StructBase> RemoteEntityFormatProto::parse(const IProtocolSessio
         }
     }
 
-    std::shared_ptr<StructBase> data;
-
     if (ok)
     {
         ssize_t sizeData = sizePayload - sizeHeader;
         buffer += sizeHeader;
 
-        BufferRef bufferRefData = {buffer, sizeData};
-        data = parseData(session, bufferRefData, storeRawData, header.type, formatStatus, typeOfGeneralMessage);
+        bufferRefData = {buffer, sizeData};
     }
 
-    return data;
+    return ok;
 }
 
-std::shared_ptr<StructBase> RemoteEntityFormatProto::parseData(const IProtocolSessionPtr& /*session*/, const BufferRef& bufferRef, bool storeRawData, std::string& type, int& formatStatus, const std::string& typeOfGeneralMessage)
+bool RemoteEntityFormatProto::isDataParsedOnDemand() const
+{
+    return true;
+}
+
+std::shared_ptr<StructBase> RemoteEntityFormatProto::parseData(const IProtocolSessionPtr& /*session*/, const BufferRef& bufferRef, const std::shared_ptr<const std::string>& receiveBuffer, bool storeRawData, std::string& type, int& formatStatus, const std::string& typeOfGeneralMessage)
 {
     formatStatus = 0;
     const char* buffer = bufferRef.first;
@@ -242,9 +316,14 @@ std::shared_ptr<StructBase> RemoteEntityFormatProto::parseData(const IProtocolSe
                 if (type != GeneralMessage::structInfo().getTypeName() || typeOfGeneralMessage.empty())
                 {
                     assert(sizeDataInStream >= 0);
-                    SerializerStruct serializerData(*data);
-                    ParserProto parserData(serializerData, buffer, sizeDataInStream);
-                    ok = parserData.parseStruct(type);
+                    ok = data->parseProto(buffer, sizeDataInStream);
+                    if (!ok)
+                    {
+                        SerializerStruct serializerData(*data);
+                        serializerData.setZeroCopyBuffer(receiveBuffer);
+                        ParserProto parserData(serializerData, buffer, sizeDataInStream);
+                        ok = parserData.parseStruct(type);
+                    }
                     if (!ok)
                     {
                         formatStatus |= FORMATSTATUS_SYNTAX_ERROR;
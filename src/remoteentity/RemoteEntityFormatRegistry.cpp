@@ -26,6 +26,7 @@
 #include <mutex>
 
 #include "finalmq/helpers/ModulenameFinalmq.h"
+#include "finalmq/helpers/MonotonicArena.h"
 #include "finalmq/protocolsession/ProtocolMessage.h"
 #include "finalmq/remoteentity/entitydata.fmq.h"
 #include "finalmq/variant/Variant.h"
@@ -38,7 +39,6 @@ using finalmq::Status;
 
 namespace finalmq
 {
-static const std::string FMQ_HTTP = "fmq_http";
 static const std::string FMQ_METHOD = "fmq_method";
 static const std::string FMQ_HTTP_STATUS = "fmq_http_status";
 static const std::string FMQ_HTTP_STATUSTEXT = "fmq_http_statustext";
@@ -56,6 +56,11 @@ static const std::string MSG_REPLY = "MSG_REPLY";
 
 static const std::string FMQ_VIRTUAL_SESSION_ID = "fmq_virtsessid";
 
+// keys of the control data, the protocols look them up by the same atoms
+static const Atom ATOM_FMQ_HTTP("fmq_http");
+static const Atom ATOM_FMQ_HTTP_STATUS("fmq_http_status");
+static const Atom ATOM_FMQ_HTTP_STATUSTEXT("fmq_http_statustext");
+
 void RemoteEntityFormatRegistryImpl::registerFormat(const std::string& contentTypeName, int contentType, const std::shared_ptr<IRemoteEntityFormat>& format)
 {
     m_contentTypeToFormat[contentType] = format;
@@ -82,14 +87,14 @@ int RemoteEntityFormatRegistryImpl::getContentType(const std::string& contentTyp
     return 0;
 }
 
-bool RemoteEntityFormatRegistryImpl::serialize(const IProtocolSessionPtr& session, IMessage& message, const Header& header, const StructBase* structBase)
+bool RemoteEntityFormatRegistryImpl::serialize(const IProtocolSessionPtr& session, IMessage& message, const Header& header, const StructBase* structBase, HeaderTemplateCache* headerCache)
 {
     int contentType = session->getContentType();
     auto it = m_contentTypeToFormat.find(contentType);
     if (it != m_contentTypeToFormat.end())
     {
         assert(it->second);
-        it->second->serialize(session, message, header, structBase);
+        it->second->serialize(session, message, header, structBase, headerCache);
         return true;
     }
     streamError << "ContentType not found: " << contentType;
@@ -135,6 +140,25 @@ bool RemoteEntityFormatRegistryImpl::serializeData(const IProtocolSessionPtr& se
     return false;
 }
 
+bool RemoteEntityFormatRegistryImpl::serializeRawData(const IProtocolSessionPtr& session, const StructBase& structBase, std::string& rawData)
+{
+    // structs, which carry raw data already, and the wrappers of raw data are serialized per session
+    if (structBase.getRawData() != nullptr ||
+        structBase.getStructInfo().getTypeName() == GeneralMessage::structInfo().getTypeName() ||
+        structBase.getStructInfo().getTypeName() == RawDataMessage::structInfo().getTypeName())
+    {
+        return false;
+    }
+    int contentType = session->getContentType();
+    auto it = m_contentTypeToFormat.find(contentType);
+    if (it != m_contentTypeToFormat.end())
+    {
+        assert(it->second);
+        return it->second->serializeRawData(session, structBase, rawData);
+    }
+    return false;
+}
+
 inline static bool shallSend(const Header& header, const IProtocolSessionPtr& session)
 {
     if ((header.mode != MsgMode::MSG_REPLY) || (header.corrid != CORRELATIONID_NONE) || session->needsReply())
@@ -146,7 +170,7 @@ inline static bool shallSend(const Header& header, const IProtocolSessionPtr& se
 
 static void statusToProtocolStatus(Status status, Variant& controlData, IMessage::Metainfo* metainfo, const IProtocolSessionPtr& session)
 {
-    controlData.add(FMQ_HTTP, HTTP_RESPONSE);
+    controlData.add(ATOM_FMQ_HTTP, HTTP_RESPONSE);
     switch(status)
     {
         case Status::STATUS_OK:
@@ -168,42 +192,42 @@ static void statusToProtocolStatus(Status status, Variant& controlData, IMessage
                     {
                         statustext = "_";
                     }
-                    controlData.add(FMQ_HTTP_STATUS, itStatus->second);
-                    controlData.add(FMQ_HTTP_STATUSTEXT, std::move(statustext));
+                    controlData.add(ATOM_FMQ_HTTP_STATUS, itStatus->second);
+                    controlData.add(ATOM_FMQ_HTTP_STATUSTEXT, std::move(statustext));
                 }
             }
             if (statusOk)
             {
-                controlData.add(FMQ_HTTP_STATUS, 200);
-                controlData.add(FMQ_HTTP_STATUSTEXT, std::string("OK"));
+                controlData.add(ATOM_FMQ_HTTP_STATUS, 200);
+                controlData.add(ATOM_FMQ_HTTP_STATUSTEXT, std::string("OK"));
             }
         }
         break;
         case Status::STATUS_ENTITY_NOT_FOUND:
         case Status::STATUS_REQUEST_NOT_FOUND:
         case Status::STATUS_REQUESTTYPE_NOT_KNOWN:
-            controlData.add(FMQ_HTTP_STATUS, 404);
-            controlData.add(FMQ_HTTP_STATUSTEXT, std::string("Not Found"));
+            controlData.add(ATOM_FMQ_HTTP_STATUS, 404);
+            controlData.add(ATOM_FMQ_HTTP_STATUSTEXT, std::string("Not Found"));
             break;
         case Status::STATUS_SYNTAX_ERROR:
-            controlData.add(FMQ_HTTP_STATUS, 400);
-            controlData.add(FMQ_HTTP_STATUSTEXT, std::string("Bad Request"));
+            controlData.add(ATOM_FMQ_HTTP_STATUS, 400);
+            controlData.add(ATOM_FMQ_HTTP_STATUSTEXT, std::string("Bad Request"));
             break;
         case Status::STATUS_NO_REPLY:
             if (session->needsReply())
             {
-                controlData.add(FMQ_HTTP_STATUS, 200);
-                controlData.add(FMQ_HTTP_STATUSTEXT, std::string("OK"));
+                controlData.add(ATOM_FMQ_HTTP_STATUS, 200);
+                controlData.add(ATOM_FMQ_HTTP_STATUSTEXT, std::string("OK"));
             }
             else
             {
-                controlData.add(FMQ_HTTP_STATUS, 500);
-                controlData.add(FMQ_HTTP_STATUSTEXT, std::string("Internal Server Error"));
+                controlData.add(ATOM_FMQ_HTTP_STATUS, 500);
+                controlData.add(ATOM_FMQ_HTTP_STATUSTEXT, std::string("Internal Server Error"));
             }
             break;
         default:
-            controlData.add(FMQ_HTTP_STATUS, 500);
-            controlData.add(FMQ_HTTP_STATUSTEXT, std::string("Internal Server Error"));
+            controlData.add(ATOM_FMQ_HTTP_STATUS, 500);
+            controlData.add(ATOM_FMQ_HTTP_STATUSTEXT, std::string("Internal Server Error"));
             break;
     }
 }
@@ -219,7 +243,7 @@ static void metainfoToHeader(Header& header, IMessage::Metainfo& metainfo)
     metainfo.clear();
 }
 
-void RemoteEntityFormatRegistryImpl::send(const IProtocolSessionPtr& session, const std::string& virtualSessionId, Header& header, Variant&& echoData, const StructBase* structBase, IMessage::Metainfo* metainfo, Variant* controlData)
+void RemoteEntityFormatRegistryImpl::send(const IProtocolSessionPtr& session, const std::string& virtualSessionId, Header& header, Variant&& echoData, const StructBase* structBase, IMessage::Metainfo* metainfo, Variant* controlData, HeaderTemplateCache* headerCache)
 {
     assert(session);
     if (shallSend(header, session))
@@ -278,11 +302,15 @@ void RemoteEntityFormatRegistryImpl::send(const IProtocolSessionPtr& session, co
 
         if (controlData)
         {
-            VariantStruct* varstruct = message->getControlData().getData<VariantStruct>("");
+            // add entry by entry, so the control data of the message keeps its lookup index
+            Variant& controlDataMessage = message->getControlData();
             VariantStruct* varstruct2 = controlData->getData<VariantStruct>("");
-            if (varstruct && varstruct2)
+            if (controlDataMessage.getType() == VARTYPE_STRUCT && varstruct2)
             {
-                varstruct->insert(varstruct->begin(), std::make_move_iterator(varstruct2->begin()), std::make_move_iterator(varstruct2->end()));
+                for (auto& entry : *varstruct2)
+                {
+                    controlDataMessage.add(entry.first, std::move(entry.second));
+                }
                 varstruct2->clear();
             }
         }
@@ -291,7 +319,7 @@ void RemoteEntityFormatRegistryImpl::send(const IProtocolSessionPtr& session, co
             bool ok = false;
             if (!session->doesSupportMetainfo() || (session->isSendRequestByPoll() && header.mode == MsgMode::MSG_REQUEST))
             {
-                ok = serialize(session, *message, header, structBase);
+                ok = serialize(session, *message, header, structBase, headerCache);
             }
             else
             {
@@ -515,13 +543,14 @@ std::string RemoteEntityFormatRegistryImpl::parseMetainfo(IMessage& message, con
     return data;
 }
 
-std::shared_ptr<StructBase> RemoteEntityFormatRegistryImpl::parseHeaderInMetainfo(const IProtocolSessionPtr& session, IMessage& message, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus)
+std::shared_ptr<LazyPayload> RemoteEntityFormatRegistryImpl::parseHeaderInMetainfo(const IProtocolSessionPtr& session, const IMessagePtr& message, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus)
 {
+    assert(message);
     std::string typeOfGeneralMessage;
-    std::string data = parseMetainfo(message, name2Entity, header, typeOfGeneralMessage);
+    std::string data = parseMetainfo(*message, name2Entity, header, typeOfGeneralMessage);
 
     formatStatus = 0;
-    BufferRef bufferRef = message.getReceivePayload();
+    BufferRef bufferRef = message->getReceivePayload();
 
     std::shared_ptr<StructBase> structBase;
 
@@ -533,13 +562,23 @@ std::shared_ptr<StructBase> RemoteEntityFormatRegistryImpl::parseHeaderInMetainf
             bufferRef.first = const_cast<char*>(data.data());
             bufferRef.second = data.size();
         }
+        else
+        {
+            data.clear();
+        }
 
         int contentType = session->getContentType();
         auto it = m_contentTypeToFormat.find(contentType);
         if (it != m_contentTypeToFormat.end())
         {
             assert(it->second);
-            structBase = it->second->parseData(session, bufferRef, storeRawData, header.type, formatStatus, typeOfGeneralMessage);
+            if (it->second->isDataParsedOnDemand())
+            {
+                return std::make_shared<LazyPayload>(it->second, session, message, bufferRef, storeRawData, header.type, typeOfGeneralMessage, std::move(data));
+            }
+            // the structs of the message are allocated in one arena, it is released with the last struct
+            ArenaScope arenaScope;
+            structBase = it->second->parseData(session, bufferRef, message->getReceiveBuffer(), storeRawData, header.type, formatStatus, typeOfGeneralMessage);
         }
     }
     else
@@ -549,13 +588,14 @@ std::shared_ptr<StructBase> RemoteEntityFormatRegistryImpl::parseHeaderInMetainf
         structBase = structRawBytes;
     }
 
-    return structBase;
+    return std::make_shared<LazyPayload>(structBase, formatStatus);
 }
 
-std::shared_ptr<StructBase> RemoteEntityFormatRegistryImpl::parse(const IProtocolSessionPtr& session, IMessage& message, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus)
+std::shared_ptr<LazyPayload> RemoteEntityFormatRegistryImpl::parse(const IProtocolSessionPtr& session, const IMessagePtr& message, bool storeRawData, const std::unordered_map<std::string, hybrid_ptr<IRemoteEntity>>& name2Entity, Header& header, int& formatStatus)
 {
+    assert(message);
     formatStatus = 0;
-    BufferRef bufferRef = message.getReceivePayload();
+    BufferRef bufferRef = message->getReceivePayload();
 
     std::shared_ptr<StructBase> structBase;
 
@@ -564,11 +604,29 @@ std::shared_ptr<StructBase> RemoteEntityFormatRegistryImpl::parse(const IProtoco
     if (it != m_contentTypeToFormat.end())
     {
         assert(it->second);
-        structBase = it->second->parse(session, bufferRef, storeRawData, name2Entity, header, formatStatus);
-        metainfoToMessage(message, header.meta);
+        if (it->second->isDataParsedOnDemand())
+        {
+            std::shared_ptr<LazyPayload> payload;
+            std::string typeOfGeneralMessage;
+            BufferRef bufferRefData{nullptr, 0};
+            if (it->second->parseHeader(session, bufferRef, name2Entity, header, typeOfGeneralMessage, bufferRefData))
+            {
+                payload = std::make_shared<LazyPayload>(it->second, session, message, bufferRefData, storeRawData, header.type, typeOfGeneralMessage, std::string());
+            }
+            else
+            {
+                payload = std::make_shared<LazyPayload>(nullptr, formatStatus);
+            }
+            metainfoToMessage(*message, header.meta);
+            return payload;
+        }
+        // the structs of the message are allocated in one arena, it is released with the last struct
+        ArenaScope arenaScope;
+        structBase = it->second->parse(session, bufferRef, message->getReceiveBuffer(), storeRawData, name2Entity, header, formatStatus);
+        metainfoToMessage(*message, header.meta);
     }
 
-    return structBase;
+    return std::make_shared<LazyPayload>(structBase, formatStatus);
 }
 
 //std::shared_ptr<StructBase> RemoteEntityFormatRegistryImpl::parsePureData(IMessage& message, Header& header)
@@ -585,6 +643,70 @@ std::shared_ptr<StructBase> RemoteEntityFormatRegistryImpl::parse(const IProtoco
 //    return structBytes;
 //}
 
+//////////////////////////////////////
+/// LazyPayload
+
+LazyPayload::LazyPayload(const std::shared_ptr<StructBase>& data, int formatStatus)
+    : m_data(data), m_formatStatus(formatStatus), m_parsed(true)
+{
+}
+
+LazyPayload::LazyPayload(const std::shared_ptr<IRemoteEntityFormat>& format, const IProtocolSessionPtr& session, const IMessagePtr& message, const BufferRef& bufferRef,
+                         bool storeRawData, const std::string& type, const std::string& typeOfGeneralMessage, std::string&& dataOwned)
+    : m_format(format), m_session(session), m_message(message), m_bufferRef(bufferRef), m_storeRawData(storeRawData), m_type(type), m_typeOfGeneralMessage(typeOfGeneralMessage), m_dataOwned(std::move(dataOwned))
+{
+    assert(m_format);
+    assert(m_message);
+    if (!m_dataOwned.empty())
+    {
+        m_bufferRef = {const_cast<char*>(m_dataOwned.data()), m_dataOwned.size()};
+    }
+}
+
+const std::shared_ptr<StructBase>& LazyPayload::getData()
+{
+    if (!m_parsed)
+    {
+        m_parsed = true;
+        // the structs of the message are allocated in one arena, it is released with the last struct
+        ArenaScope arenaScope;
+        m_data = m_format->parseData(m_session, m_bufferRef, m_message->getReceiveBuffer(), m_storeRawData, m_type, m_formatStatus, m_typeOfGeneralMessage);
+    }
+    return m_data;
+}
+
+std::shared_ptr<StructBase> LazyPayload::getDataAs(const std::string& type)
+{
+    if (!m_format)
+    {
+        return nullptr;
+    }
+    std::string typeProjection = type;
+    int formatStatus = 0;
+    ArenaScope arenaScope;
+    std::shared_ptr<StructBase> data = m_format->parseData(m_session, m_bufferRef, m_message->getReceiveBuffer(), false, typeProjection, formatStatus, {});
+    if (formatStatus & FORMATSTATUS_SYNTAX_ERROR)
+    {
+        return nullptr;
+    }
+    return data;
+}
+
+const BufferRef& LazyPayload::getRawData() const
+{
+    return m_bufferRef;
+}
+
+bool LazyPayload::isParsed() const
+{
+    return m_parsed;
+}
+
+int LazyPayload::getFormatStatus() const
+{
+    return m_formatStatus;
+}
+
 //////////////////////////////////////
 /// RemoteEntityFormat
 
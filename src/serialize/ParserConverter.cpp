@@ -27,6 +27,7 @@
 
 #include <assert.h>
 
+#include "finalmq/conversions/NumberParser.h"
 #include "finalmq/conversions/dtoa.h"
 #include "finalmq/conversions/itoa.h"
 #include "finalmq/helpers/ModulenameFinalmq.h"
@@ -813,61 +814,61 @@ void ParserConverter::convertString(const MetaField& field, const char* value, s
         break;
         case MetaTypeId::TYPE_INT8:
         {
-            std::int8_t v = static_cast<std::int8_t>(strtol(value, nullptr, 10));
+            std::int8_t v = NumberParser::toNumber<std::int8_t>(value, value + size);
             m_visitor->enterInt8(field, v);
         }
         break;
         case MetaTypeId::TYPE_UINT8:
         {
-            std::uint8_t v = static_cast<std::uint8_t>(strtoul(value, nullptr, 10));
+            std::uint8_t v = NumberParser::toNumber<std::uint8_t>(value, value + size);
             m_visitor->enterUInt8(field, v);
         }
         break;
         case MetaTypeId::TYPE_INT16:
         {
-            std::int16_t v = static_cast<std::int16_t>(strtol(value, nullptr, 10));
+            std::int16_t v = NumberParser::toNumber<std::int16_t>(value, value + size);
             m_visitor->enterInt16(field, v);
         }
         break;
         case MetaTypeId::TYPE_UINT16:
         {
-            std::uint16_t v = static_cast<std::uint16_t>(strtoul(value, nullptr, 10));
+            std::uint16_t v = NumberParser::toNumber<std::uint16_t>(value, value + size);
             m_visitor->enterUInt16(field, v);
         }
         break;
         case MetaTypeId::TYPE_INT32:
         {
-            std::int32_t v = static_cast<std::int32_t>(strtol(value, nullptr, 10));
+            std::int32_t v = NumberParser::toNumber<std::int32_t>(value, value + size);
             m_visitor->enterInt32(field, v);
         }
         break;
         case MetaTypeId::TYPE_UINT32:
         {
-            std::uint32_t v = static_cast<std::uint32_t>(strtoul(value, nullptr, 10));
+            std::uint32_t v = NumberParser::toNumber<std::uint32_t>(value, value + size);
             m_visitor->enterUInt32(field, v);
         }
         break;
         case MetaTypeId::TYPE_INT64:
         {
-            std::int64_t v = strtoll(value, nullptr, 10);
+            std::int64_t v = NumberParser::toNumber<std::int64_t>(value, value + size);
             m_visitor->enterInt64(field, v);
         }
         break;
         case MetaTypeId::TYPE_UINT64:
         {
-            std::uint64_t v = strtoull(value, nullptr, 10);
+            std::uint64_t v = NumberParser::toNumber<std::uint64_t>(value, value + size);
             m_visitor->enterUInt64(field, v);
         }
         break;
         case MetaTypeId::TYPE_FLOAT:
         {
-            float v = strtof32(value, nullptr);
+            float v = NumberParser::toNumber<float>(value, value + size);
             m_visitor->enterFloat(field, v);
         }
         break;
         case MetaTypeId::TYPE_DOUBLE:
         {
-            double v = strtof64(value, nullptr);
+            double v = NumberParser::toNumber<double>(value, value + size);
             m_visitor->enterDouble(field, v);
         }
         break;
@@ -885,55 +886,55 @@ void ParserConverter::convertString(const MetaField& field, const char* value, s
         break;
         case MetaTypeId::TYPE_ARRAY_INT8:
         {
-            std::int8_t v = static_cast<std::int8_t>(strtol(value, nullptr, 10));
+            std::int8_t v = NumberParser::toNumber<std::int8_t>(value, value + size);
             m_visitor->enterArrayInt8(field, &v, 1);
         }
         break;
         case MetaTypeId::TYPE_ARRAY_INT16:
         {
-            std::int16_t v = static_cast<std::int16_t>(strtol(value, nullptr, 10));
+            std::int16_t v = NumberParser::toNumber<std::int16_t>(value, value + size);
             m_visitor->enterArrayInt16(field, &v, 1);
         }
         break;
         case MetaTypeId::TYPE_ARRAY_UINT16:
         {
-            std::uint16_t v = static_cast<std::uint16_t>(strtoul(value, nullptr, 10));
+            std::uint16_t v = NumberParser::toNumber<std::uint16_t>(value, value + size);
             m_visitor->enterArrayUInt16(field, &v, 1);
         }
         break;
         case MetaTypeId::TYPE_ARRAY_INT32:
         {
-            std::int32_t v = static_cast<std::int32_t>(strtol(value, nullptr, 10));
+            std::int32_t v = NumberParser::toNumber<std::int32_t>(value, value + size);
             m_visitor->enterArrayInt32(field, &v, 1);
         }
         break;
         case MetaTypeId::TYPE_ARRAY_UINT32:
         {
-            std::uint32_t v = static_cast<std::uint32_t>(strtoul(value, nullptr, 10));
+            std::uint32_t v = NumberParser::toNumber<std::uint32_t>(value, value + size);
             m_visitor->enterArrayUInt32(field, &v, 1);
         }
         break;
         case MetaTypeId::TYPE_ARRAY_INT64:
         {
-            std::int64_t v = strtoll(value, nullptr, 10);
+            std::int64_t v = NumberParser::toNumber<std::int64_t>(value, value + size);
             m_visitor->enterArrayInt64(field, &v, 1);
         }
         break;
         case MetaTypeId::TYPE_ARRAY_UINT64:
         {
-            std::uint64_t v = strtoull(value, nullptr, 10);
+            std::uint64_t v = NumberParser::toNumber<std::uint64_t>(value, value + size);
             m_visitor->enterArrayUInt64(field, &v, 1);
         }
         break;
         case MetaTypeId::TYPE_ARRAY_FLOAT:
         {
-            float v = strtof32(value, nullptr);
+            float v = NumberParser::toNumber<float>(value, value + size);
             m_visitor->enterArrayFloat(field, &v, 1);
         }
         break;
         case MetaTypeId::TYPE_ARRAY_DOUBLE:
         {
-            double v = strtof64(value, nullptr);
+            double v = NumberParser::toNumber<double>(value, value + size);
             m_visitor->enterArrayDouble(field, &v, 1);
         }
         break;
@@ -1415,70 +1416,70 @@ void ParserConverter::convertArraytString(const MetaField& field, const std::vec
         case MetaTypeId::TYPE_INT8:
             if (!value.empty())
             {
-                std::int8_t v = static_cast<std::int8_t>(strtol(value[0].c_str(), nullptr, 10));
+                std::int8_t v = NumberParser::toNumber<std::int8_t>(value[0].data(), value[0].data() + value[0].size());
                 m_visitor->enterInt8(field, v);
             }
             break;
         case MetaTypeId::TYPE_UINT8:
             if (!value.empty())
             {
-                std::uint8_t v = static_cast<std::uint8_t>(strtoul(value[0].c_str(), nullptr, 10));
+                std::uint8_t v = NumberParser::toNumber<std::uint8_t>(value[0].data(), value[0].data() + value[0].size());
                 m_visitor->enterUInt8(field, v);
             }
             break;
         case MetaTypeId::TYPE_INT16:
             if (!value.empty())
             {
-                std::int16_t v = static_cast<std::int16_t>(strtol(value[0].c_str(), nullptr, 10));
+                std::int16_t v = NumberParser::toNumber<std::int16_t>(value[0].data(), value[0].data() + value[0].size());
                 m_visitor->enterInt16(field, v);
             }
             break;
         case MetaTypeId::TYPE_UINT16:
             if (!value.empty())
             {
-                std::uint16_t v = static_cast<std::uint16_t>(strtoul(value[0].c_str(), nullptr, 10));
+                std::uint16_t v = NumberParser::toNumber<std::uint16_t>(value[0].data(), value[0].data() + value[0].size());
                 m_visitor->enterUInt16(field, v);
             }
             break;
         case MetaTypeId::TYPE_INT32:
             if (!value.empty())
             {
-                std::int32_t v = static_cast<std::int32_t>(strtol(value[0].c_str(), nullptr, 10));
+                std::int32_t v = NumberParser::toNumber<std::int32_t>(value[0].data(), value[0].data() + value[0].size());
                 m_visitor->enterInt32(field, v);
             }
             break;
         case MetaTypeId::TYPE_UINT32:
             if (!value.empty())
             {
-                std::uint32_t v = static_cast<std::uint32_t>(strtoul(value[0].c_str(), nullptr, 10));
+                std::uint32_t v = NumberParser::toNumber<std::uint32_t>(value[0].data(), value[0].data() + value[0].size());
                 m_visitor->enterUInt32(field, v);
             }
             break;
         case MetaTypeId::TYPE_INT64:
             if (!value.empty())
             {
-                std::int64_t v = strtoll(value[0].c_str(), nullptr, 10);
+                std::int64_t v = NumberParser::toNumber<std::int64_t>(value[0].data(), value[0].data() + value[0].size());
                 m_visitor->enterInt64(field, v);
             }
             break;
         case MetaTypeId::TYPE_UINT64:
             if (!value.empty())
             {
-                std::uint64_t v = strtoull(value[0].c_str(), nullptr, 10);
+                std::uint64_t v = NumberParser::toNumber<std::uint64_t>(value[0].data(), value[0].data() + value[0].size());
                 m_visitor->enterUInt64(field, v);
             }
             break;
         case MetaTypeId::TYPE_FLOAT:
             if (!value.empty())
             {
-                float v = strtof32(value[0].c_str(), nullptr);
+                float v = NumberParser::toNumber<float>(value[0].data(), value[0].data() + value[0].size());
                 m_visitor->enterFloat(field, v);
             }
             break;
         case MetaTypeId::TYPE_DOUBLE:
             if (!value.empty())
             {
-                double v = strtof64(value[0].c_str(), nullptr);
+                double v = NumberParser::toNumber<double>(value[0].data(), value[0].data() + value[0].size());
                 m_visitor->enterDouble(field, v);
             }
             break;
@@ -1510,7 +1511,7 @@ void ParserConverter::convertArraytString(const MetaField& field, const std::vec
             std::vector<std::int8_t> v;
             v.reserve(size);
             std::for_each(value.begin(), value.end(), [&v](const std::string& entry) {
-                v.push_back(static_cast<std::int8_t>(strtol(entry.c_str(), nullptr, 10)));
+                v.push_back(NumberParser::toNumber<std::int8_t>(entry.data(), entry.data() + entry.size()));
             });
             m_visitor->enterArrayInt8(field, std::move(v));
         }
@@ -1520,7 +1521,7 @@ void ParserConverter::convertArraytString(const MetaField& field, const std::vec
             std::vector<std::int16_t> v;
             v.reserve(size);
             std::for_each(value.begin(), value.end(), [&v](const std::string& entry) {
-                v.push_back(static_cast<std::int16_t>(strtol(entry.c_str(), nullptr, 10)));
+                v.push_back(NumberParser::toNumber<std::int16_t>(entry.data(), entry.data() + entry.size()));
             });
             m_visitor->enterArrayInt16(field, std::move(v));
         }
@@ -1530,7 +1531,7 @@ void ParserConverter::convertArraytString(const MetaField& field, const std::vec
             std::vector<std::uint16_t> v;
             v.reserve(size);
             std::for_each(value.begin(), value.end(), [&v](const std::string& entry) {
-                v.push_back(static_cast<std::uint16_t>(strtoul(entry.c_str(), nullptr, 10)));
+                v.push_back(NumberParser::toNumber<std::uint16_t>(entry.data(), entry.data() + entry.size()));
             });
             m_visitor->enterArrayUInt16(field, std::move(v));
         }
@@ -1540,7 +1541,7 @@ void ParserConverter::convertArraytString(const MetaField& field, const std::vec
             std::vector<std::int32_t> v;
             v.reserve(size);
             std::for_each(value.begin(), value.end(), [&v](const std::string& entry) {
-                v.push_back(static_cast<std::int32_t>(strtol(entry.c_str(), nullptr, 10)));
+                v.push_back(NumberParser::toNumber<std::int32_t>(entry.data(), entry.data() + entry.size()));
             });
             m_visitor->enterArrayInt32(field, std::move(v));
         }
@@ -1550,7 +1551,7 @@ void ParserConverter::convertArraytString(const MetaField& field, const std::vec
             std::vector<std::uint32_t> v;
             v.reserve(size);
             std::for_each(value.begin(), value.end(), [&v](const std::string& entry) {
-                v.push_back(static_cast<std::int32_t>(strtoul(entry.c_str(), nullptr, 10)));
+                v.push_back(NumberParser::toNumber<std::int32_t>(entry.data(), entry.data() + entry.size()));
             });
             m_visitor->enterArrayUInt32(field, std::move(v));
         }
@@ -1560,7 +1561,7 @@ void ParserConverter::convertArraytString(const MetaField& field, const std::vec
             std::vector<std::int64_t> v;
             v.reserve(size);
             std::for_each(value.begin(), value.end(), [&v](const std::string& entry) {
-                v.push_back(strtoll(entry.c_str(), nullptr, 10));
+                v.push_back(NumberParser::toNumber<std::int64_t>(entry.data(), entry.data() + entry.size()));
             });
             m_visitor->enterArrayInt64(field, std::move(v));
         }
@@ -1570,7 +1571,7 @@ void ParserConverter::convertArraytString(const MetaField& field, const std::vec
             std::vector<std::uint64_t> v;
             v.reserve(size);
             std::for_each(value.begin(), value.end(), [&v](const std::string& entry) {
-                v.push_back(strtoull(entry.c_str(), nullptr, 10));
+                v.push_back(NumberParser::toNumber<std::uint64_t>(entry.data(), entry.data() + entry.size()));
             });
             m_visitor->enterArrayUInt64(field, std::move(v));
         }
@@ -1580,7 +1581,7 @@ void ParserConverter::convertArraytString(const MetaField& field, const std::vec
             std::vector<float> v;
             v.reserve(size);
             std::for_each(value.begin(), value.end(), [&v](const std::string& entry) {
-                v.push_back(strtof32(entry.c_str(), nullptr));
+                v.push_back(NumberParser::toNumber<float>(entry.data(), entry.data() + entry.size()));
             });
             m_visitor->enterArrayFloat(field, std::move(v));
         }
@@ -1590,7 +1591,7 @@ void ParserConverter::convertArraytString(const MetaField& field, const std::vec
             std::vector<double> v;
             v.reserve(size);
             std::for_each(value.begin(), value.end(), [&v](const std::string& entry) {
-                v.push_back(strtof64(entry.c_str(), nullptr));
+                v.push_back(NumberParser::toNumber<double>(entry.data(), entry.data() + entry.size()));
             });
             m_visitor->enterArrayDouble(field, std::move(v));
         }
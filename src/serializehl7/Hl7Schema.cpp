@@ -0,0 +1,127 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "finalmq/serializehl7/Hl7Schema.h"
+#include "finalmq/helpers/Utils.h"
+#include "finalmq/metadata/MetaData.h"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <assert.h>
+
+namespace finalmq
+{
+namespace
+{
+class Hl7SchemaCache
+{
+public:
+    const Hl7Schema::Struct& getStruct(const MetaStruct& stru)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return compile(stru);
+    }
+
+private:
+    const Hl7Schema::Struct& compile(const MetaStruct& stru)
+    {
+        static const std::string STR_MSH = "MSH";
+
+        auto it = m_structs.find(&stru);
+        if (it != m_structs.end())
+        {
+            return *it->second;
+        }
+        // insert before the fields are compiled, so that recursive types terminate
+        Hl7Schema::Struct& plan = *m_structs.emplace(&stru, std::make_unique<Hl7Schema::Struct>()).first->second;
+
+        const ssize_t size = stru.getFieldsSize();
+        const std::string& typeName = stru.getTypeNameWithoutNamespace();
+        plan.metaStruct = &stru;
+        plan.isSegment = ((stru.getFlags() & METASTRUCTFLAG_HL7_SEGMENT) != 0);
+        plan.isChoice = ((stru.getFlags() & METASTRUCTFLAG_CHOICE) != 0);
+        plan.isMsh = (typeName.compare(0, STR_MSH.size(), STR_MSH) == 0);
+        Utils::split(typeName, 0, typeName.size(), '_', plan.typeNameParts);
+        plan.fields.resize(size);
+        plan.segmentIdsFrom.resize(size + 1);
+
+        for (ssize_t i = 0; i < size; ++i)
+        {
+            const MetaField* field = stru.getFieldByIndex(i);
+            assert(field != nullptr);
+            plan.fields[i].field = field;
+            const MetaStruct* subStruct = MetaDataGlobal::instance().getStruct(*field);
+            if (subStruct != nullptr)
+            {
+                plan.fields[i].subStruct = &compile(*subStruct);
+            }
+        }
+
+        // A segment ID matches at field ix, if it is the segment of a struct field at or after ix, or if it
+        // matches inside of one of these structs. The search stops at the first struct that must be present.
+        if (!plan.isSegment)
+        {
+            for (ssize_t i = size - 1; i >= 0; --i)
+            {
+                const MetaField& field = *plan.fields[i].field;
+                std::unordered_set<std::string>& segmentIds = plan.segmentIdsFrom[i];
+                bool required = false;
+                if (field.typeId == MetaTypeId::TYPE_STRUCT || field.typeId == MetaTypeId::TYPE_ARRAY_STRUCT)
+                {
+                    segmentIds.insert(field.typeNameWithoutNamespace);
+                    const Hl7Schema::Struct* subPlan = plan.fields[i].subStruct;
+                    if (subPlan != nullptr && !subPlan->segmentIdsFrom.empty())
+                    {
+                        segmentIds.insert(subPlan->segmentIdsFrom[0].begin(), subPlan->segmentIdsFrom[0].end());
+                    }
+                    required = ((field.typeId == MetaTypeId::TYPE_STRUCT) && (field.flags & MetaFieldFlags::METAFLAG_NULLABLE) == 0) ||
+                               ((field.typeId == MetaTypeId::TYPE_ARRAY_STRUCT) && (field.flags & MetaFieldFlags::METAFLAG_ONE_REQUIRED) != 0);
+                }
+                if (!required)
+                {
+                    const std::unordered_set<std::string>& segmentIdsNext = plan.segmentIdsFrom[i + 1];
+                    segmentIds.insert(segmentIdsNext.begin(), segmentIdsNext.end());
+                }
+            }
+        }
+        return plan;
+    }
+
+    std::mutex m_mutex{};
+    std::unordered_map<const MetaStruct*, std::unique_ptr<Hl7Schema::Struct>> m_structs{};
+};
+
+Hl7SchemaCache& getHl7SchemaCache()
+{
+    static Hl7SchemaCache cache;
+    return cache;
+}
+} // namespace
+
+const Hl7Schema::Struct& Hl7Schema::getStruct(const MetaStruct& stru)
+{
+    return getHl7SchemaCache().getStruct(stru);
+}
+
+} // namespace finalmq
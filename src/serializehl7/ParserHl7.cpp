@@ -46,47 +46,7 @@ ParserHl7::ParserHl7(IParserVisitor& visitor, const char* ptr, ssize_t size)
 
 
 
-bool ParserHl7::matches(const std::string& segId, const MetaStruct& stru, ssize_t ixStart)
-{
-    if ((stru.getFlags() & MetaStructFlags::METASTRUCTFLAG_HL7_SEGMENT) != 0)
-    {
-        return false;
-    }
-    for (ssize_t i = ixStart; i < stru.getFieldsSize(); ++i)
-    {
-        const MetaField* field = stru.getFieldByIndex(i);
-        assert(field != nullptr);
-        if (field->typeId == MetaTypeId::TYPE_STRUCT || field->typeId == MetaTypeId::TYPE_ARRAY_STRUCT)
-        {
-            if (segId == field->typeNameWithoutNamespace)
-            {
-                return true;
-            }
-            const MetaStruct* subStruct = MetaDataGlobal::instance().getStruct(*field);
-            if (subStruct != nullptr)
-            {
-                bool match = matches(segId, *subStruct, 0);
-                if (match)
-                {
-                    return true;
-                }
-            }
-            if ((field->typeId == MetaTypeId::TYPE_STRUCT) &&
-                (field->flags & MetaFieldFlags::METAFLAG_NULLABLE) == 0)
-            {
-                return false;
-            }
-            if ((field->typeId == MetaTypeId::TYPE_ARRAY_STRUCT) &&
-                (field->flags & MetaFieldFlags::METAFLAG_ONE_REQUIRED) != 0)
-            {
-                return false;
-            }
-        }
-    }
-    return false;
-}
-
-bool ParserHl7::matchesUp(const std::string& segId)
+bool ParserHl7::matchesUp(const std::string& segId) const
 {
     if (m_stackStruct.empty())
     {
@@ -94,8 +54,8 @@ bool ParserHl7::matchesUp(const std::string& segId)
     }
     for (ssize_t i = static_cast<ssize_t>(m_stackStruct.size()) - 1; i >= 0; --i)
     {
-        const std::pair<MetaStruct, ssize_t>& entry = m_stackStruct[i];
-        bool match = matches(segId, entry.first, entry.second);
+        const std::pair<const Hl7Schema::Struct*, ssize_t>& entry = m_stackStruct[i];
+        bool match = entry.first->matches(segId, entry.second);
         if (match)
         {
             return true;
@@ -126,7 +86,7 @@ const char* ParserHl7::parseStruct(const std::string& typeName)
         
     m_visitor.startStruct(*stru);
     bool isarrayDummy;
-    int level = parseStruct(0, *stru, isarrayDummy);
+    int level = parseStruct(0, Hl7Schema::getStruct(*stru), isarrayDummy);
     m_visitor.finished();
 
     if (level <= PARSER_HL7_ERROR)
@@ -136,7 +96,7 @@ const char* ParserHl7::parseStruct(const std::string& typeName)
     return m_parser.getCurrentPosition();
 }
 
-int ParserHl7::parseStruct(int levelSegment, const MetaStruct& stru, bool& isarray)
+int ParserHl7::parseStruct(int levelSegment, const Hl7Schema::Struct& stru, bool& isarray)
 {
     static const std::string STR_MSH = "MSH";
 
@@ -153,22 +113,22 @@ int ParserHl7::parseStruct(int levelSegment, const MetaStruct& stru, bool& isarr
             return levelNew;
         }
         
-        const std::string& typeName = stru.getTypeNameWithoutNamespace();
-        if ((segId != typeName) && ((segId != STR_MSH) || (typeName.compare(0, STR_MSH.size(), STR_MSH) != 0)))  // for MSH -> startsWith("MSH") to allow also different types to read only the header (see MSH_RE)
+        const std::string& typeName = stru.metaStruct->getTypeNameWithoutNamespace();
+        if ((segId != typeName) && ((segId != STR_MSH) || !stru.isMsh))  // for MSH -> startsWith("MSH") to allow also different types to read only the header (see MSH_RE)
         {
             return m_parser.parseTillEndOfStruct(0);
         }
     }
 
-    ssize_t size = stru.getFieldsSize();
+    ssize_t size = static_cast<ssize_t>(stru.fields.size());
     for (ssize_t i = 0; i < size; ++i)
     {
-        const MetaField* field = stru.getFieldByIndex(i);
+        const MetaField* field = stru.fields[i].field;
         assert(field != nullptr);
 
         if (field->typeId == TYPE_STRUCT)
         {
-            const MetaStruct* subStruct = MetaDataGlobal::instance().getStruct(*field);
+            const Hl7Schema::Struct* subStruct = stru.fields[i].subStruct;
             if (subStruct == nullptr)
             {
                 return PARSER_HL7_ERROR;
@@ -183,15 +143,15 @@ int ParserHl7::parseStruct(int levelSegment, const MetaStruct& stru, bool& isarr
                 {
                     return levelSegment;
                 }
-                else if ((segId == typeName) || ((segId == STR_MSH) && (typeName.compare(0, STR_MSH.size(), STR_MSH) == 0)))  // for MSH -> startsWith("MSH") to allow also different types to read only the header (see MSH_RE)
+                else if ((segId == typeName) || ((segId == STR_MSH) && subStruct->isMsh))  // for MSH -> startsWith("MSH") to allow also different types to read only the header (see MSH_RE)
                 {
                     processStruct = true;
                 }
-                else if (matches(segId, *subStruct, 0))
+                else if (subStruct->matches(segId, 0))
                 {
                     processStruct = true;
                 }
-                else if (matches(segId, stru, i + 1))
+                else if (stru.matches(segId, i + 1))
                 {
                     processStruct = false;
                 }
@@ -209,9 +169,9 @@ int ParserHl7::parseStruct(int levelSegment, const MetaStruct& stru, bool& isarr
             if (processStruct)
             {
                 m_visitor.enterStruct(*field);
-                m_stackStruct.emplace_back(stru, i + 1);
+                m_stackStruct.emplace_back(&stru, i + 1);
                 int LevelSegmentNext = levelSegment;
-                if ((LevelSegmentNext > 0) || (subStruct->getFlags() & METASTRUCTFLAG_HL7_SEGMENT))
+                if ((LevelSegmentNext > 0) || subStruct->isSegment)
                 {
                     ++LevelSegmentNext;
                 }
@@ -227,7 +187,7 @@ int ParserHl7::parseStruct(int levelSegment, const MetaStruct& stru, bool& isarr
                 {
                     return levelNew;
                 }
-                if ((levelSegment == 0) && ((stru.getFlags() & MetaStructFlags::METASTRUCTFLAG_CHOICE) != 0))
+                if ((levelSegment == 0) && stru.isChoice)
                 {
                     return levelSegment;
                 }
@@ -235,7 +195,7 @@ int ParserHl7::parseStruct(int levelSegment, const MetaStruct& stru, bool& isarr
         }
         else if (field->typeId == TYPE_ARRAY_STRUCT)
         {
-            const MetaStruct* subStruct = MetaDataGlobal::instance().getStruct(*field);
+            const Hl7Schema::Struct* subStruct = stru.fields[i].subStruct;
             if (subStruct == nullptr)
             {
                 return PARSER_HL7_ERROR;
@@ -244,7 +204,7 @@ int ParserHl7::parseStruct(int levelSegment, const MetaStruct& stru, bool& isarr
             assert(fieldWithoutArray);
             if (levelSegment == 0)
             {
-                std::string typeName = field->typeNameWithoutNamespace;
+                const std::string& typeName = field->typeNameWithoutNamespace;
                 bool firstLoop = true;
                 while (true)
                 {
@@ -260,11 +220,11 @@ int ParserHl7::parseStruct(int levelSegment, const MetaStruct& stru, bool& isarr
                     {
                         processStructArray = true;
                     }
-                    else if (matches(segId, *subStruct, 0))
+                    else if (subStruct->matches(segId, 0))
                     {
                         processStructArray = true;
                     }
-                    else if (matches(segId, stru, i + 1))
+                    else if (stru.matches(segId, i + 1))
                     {
                         processStructArray = false;
                     }
@@ -284,13 +244,13 @@ int ParserHl7::parseStruct(int levelSegment, const MetaStruct& stru, bool& isarr
                         m_parser.getSegmentId(segId);
                         if (firstLoop)
                         {
-                            m_stackStruct.emplace_back(stru, i);
+                            m_stackStruct.emplace_back(&stru, i);
                             firstLoop = false;
                             m_visitor.enterArrayStruct(*field);
                         }
                         m_visitor.enterStruct(*fieldWithoutArray);
                         int levelSegmentNext = levelSegment;
-                        if ((subStruct->getFlags() & MetaStructFlags::METASTRUCTFLAG_HL7_SEGMENT) != 0)
+                        if (subStruct->isSegment)
                         {
                             ++levelSegmentNext;
                         }
@@ -366,11 +326,12 @@ int ParserHl7::parseStruct(int levelSegment, const MetaStruct& stru, bool& isarr
         {
             if (levelSegment > 0)
             {
-                std::string token;
-                int levelNew = m_parser.parseToken(levelSegment, token, isarray);
-                if (!token.empty())
+                const char* token = nullptr;
+                ssize_t size = 0;
+                int levelNew = m_parser.parseToken(levelSegment, token, size, m_tokenBuffer, isarray);
+                if (size > 0)
                 {
-                    m_visitor.enterString(*field, std::move(token));
+                    m_visitor.enterString(*field, token, size);
                 }
                 if (isarray && levelSegment == 1)
                 {
@@ -24,7 +24,7 @@
 #include "finalmq/serializehl7/SerializerHl7.h"
 #include "finalmq/metadata/MetaData.h"
 #include "finalmq/helpers/base64.h"
-#include "finalmq/helpers/Utils.h"
+#include "finalmq/serializehl7/Hl7Schema.h"
 #include "finalmq/helpers/ZeroCopyBuffer.h"
 #include "finalmq/jsonvariant/VariantToJson.h"
 
@@ -59,22 +59,22 @@ void SerializerHl7::Internal::notifyError(const char* /*str*/, const char* /*mes
 
 void SerializerHl7::Internal::startStruct(const MetaStruct& stru)
 {
-    std::vector<std::string> splitString;
-    std::string messageStructure = stru.getTypeNameWithoutNamespace();
-    Utils::split(messageStructure, 0, messageStructure.size(), '_', splitString);
+    const Hl7Schema::Struct& plan = Hl7Schema::getStruct(stru);
+    const std::vector<std::string>& splitString = plan.typeNameParts;
+    const std::string& messageStructure = stru.getTypeNameWithoutNamespace();
 
     m_indexOfLayer.push_back(-1);
 
     int indexMessageType[3] = { 0, 8, 0 };
     if (splitString.size() >= 1)
     {
-        m_hl7Builder.enterString(indexMessageType, 3, 0, std::move(splitString[0]));
+        m_hl7Builder.enterString(indexMessageType, 3, 0, splitString[0].c_str(), splitString[0].size());
     }
     if (splitString.size() >= 2)
     {
-        m_hl7Builder.enterString(indexMessageType, 3, 1, std::move(splitString[1]));
+        m_hl7Builder.enterString(indexMessageType, 3, 1, splitString[1].c_str(), splitString[1].size());
     }
-    m_hl7Builder.enterString(indexMessageType, 3, 2, std::move(messageStructure));
+    m_hl7Builder.enterString(indexMessageType, 3, 2, messageStructure.c_str(), messageStructure.size());
 }
 
 
@@ -0,0 +1,537 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "finalmq/serializejson/JsonReader.h"
+
+#include <cmath>
+#include <limits>
+
+#include <string.h>
+
+#include "finalmq/helpers/base64.h"
+#include "finalmq/json/JsonScan.h"
+
+namespace finalmq
+{
+// integers with more digits could overflow, they are handled by ParserJson
+static const ssize_t MAX_DIGITS_NEGATIVE = 18;
+static const ssize_t MAX_DIGITS_POSITIVE = 19;
+
+JsonReader::JsonReader(const char* buffer, ssize_t size)
+    : m_str(buffer), m_end(buffer ? buffer + size : nullptr)
+{
+}
+
+void JsonReader::setError()
+{
+    m_str = nullptr;
+    m_end = nullptr;
+}
+
+char JsonReader::peek()
+{
+    m_str = JsonScan::skipWhiteSpace(m_str, m_end);
+    return getChar();
+}
+
+bool JsonReader::enterObject()
+{
+    if (peek() != '{')
+    {
+        setError();
+        return false;
+    }
+    ++m_str;
+    m_afterValue = false;
+    return true;
+}
+
+bool JsonReader::nextKey(const char*& key, ssize_t& size)
+{
+    char c = peek();
+    if (m_afterValue && c == ',')
+    {
+        ++m_str;
+        c = peek();
+    }
+    else if (m_afterValue && c != '}')
+    {
+        setError();
+        return false;
+    }
+    if (c == '}')
+    {
+        ++m_str;
+        m_afterValue = true;
+        return false;
+    }
+    if (c != '\"' || !readStringRaw(key, size) || peek() != ':')
+    {
+        setError();
+        return false;
+    }
+    ++m_str;
+    m_afterValue = false;
+    return true;
+}
+
+bool JsonReader::enterArray()
+{
+    if (peek() != '[')
+    {
+        setError();
+        return false;
+    }
+    ++m_str;
+    m_afterValue = false;
+    return true;
+}
+
+bool JsonReader::nextEntry()
+{
+    char c = peek();
+    if (m_afterValue && c == ',')
+    {
+        ++m_str;
+        c = peek();
+    }
+    else if (m_afterValue && c != ']')
+    {
+        setError();
+        return false;
+    }
+    if (c == ']')
+    {
+        ++m_str;
+        m_afterValue = true;
+        return false;
+    }
+    if (c == 0)
+    {
+        setError();
+        return false;
+    }
+    return true;
+}
+
+bool JsonReader::readLiteral(const char* literal, ssize_t size)
+{
+    if (m_end - m_str < size || memcmp(m_str, literal, size) != 0)
+    {
+        setError();
+        return false;
+    }
+    m_str += size;
+    m_afterValue = true;
+    return true;
+}
+
+bool JsonReader::readNull()
+{
+    return readLiteral("null", 4);
+}
+
+bool JsonReader::readStringRaw(const char*& value, ssize_t& size)
+{
+    if (peek() != '\"')
+    {
+        setError();
+        return false;
+    }
+    const char* strBegin = m_str + 1;
+    const char* str = JsonScan::findStringSpecial(strBegin, m_end);
+    // escape sequences and 0 characters are handled by ParserJson
+    if (str >= m_end || *str != '\"')
+    {
+        setError();
+        return false;
+    }
+    value = strBegin;
+    size = str - strBegin;
+    m_str = str + 1;
+    m_afterValue = true;
+    return true;
+}
+
+bool JsonReader::readNumber(Number& number)
+{
+    char c = peek();
+    const char* first = m_str;
+    number.isNegative = (c == '-');
+    if (number.isNegative)
+    {
+        ++m_str;
+        c = getChar();
+    }
+    if (c < '0' || c > '9')
+    {
+        setError();
+        return false;
+    }
+    bool onlyDigits = true;
+    while ((c = getChar()) != 0)
+    {
+        if (c >= '0' && c <= '9')
+        {
+        }
+        else if (c == '.' || c == 'e' || c == 'E')
+        {
+            number.isFloat = true;
+        }
+        else if (c == '+' || c == '-')
+        {
+            onlyDigits = false;
+        }
+        else
+        {
+            break;
+        }
+        ++m_str;
+    }
+
+    if (number.isFloat)
+    {
+        if (NumberParser::parseDouble(first, m_str, number.valueDouble) != m_str)
+        {
+            setError();
+            return false;
+        }
+    }
+    else
+    {
+        const char* digits = number.isNegative ? first + 1 : first;
+        const ssize_t countDigits = m_str - digits;
+        if (!onlyDigits || countDigits > (number.isNegative ? MAX_DIGITS_NEGATIVE : MAX_DIGITS_POSITIVE))
+        {
+            setError();
+            return false;
+        }
+        std::uint64_t value = 0;
+        for (const char* d = digits; d < m_str; ++d)
+        {
+            value = value * 10 + static_cast<std::uint64_t>(*d - '0');
+        }
+        if (number.isNegative)
+        {
+            if (value == 0)
+            {
+                setError();
+                return false;
+            }
+            number.valueInt = -static_cast<std::int64_t>(value);
+        }
+        else
+        {
+            number.valueUInt = value;
+        }
+    }
+    m_afterValue = true;
+    return true;
+}
+
+bool JsonReader::skipValue()
+{
+    switch (peek())
+    {
+        case '\"':
+        {
+            const char* str = nullptr;
+            ssize_t size = 0;
+            return readStringRaw(str, size);
+        }
+        case '{':
+        {
+            if (!enterObject())
+            {
+                return false;
+            }
+            const char* key = nullptr;
+            ssize_t size = 0;
+            while (nextKey(key, size))
+            {
+                if (!skipValue())
+                {
+                    return false;
+                }
+            }
+            return isOk();
+        }
+        case '[':
+            if (!enterArray())
+            {
+                return false;
+            }
+            while (nextEntry())
+            {
+                if (!skipValue())
+                {
+                    return false;
+                }
+            }
+            return isOk();
+        case 't':
+            return readLiteral("true", 4);
+        case 'f':
+            return readLiteral("false", 5);
+        case 'n':
+            return readNull();
+        default:
+            break;
+    }
+    Number number;
+    return readNumber(number);
+}
+
+float JsonReader::convertFloat(const char* value, ssize_t size, float*)
+{
+    if (size == 3 && memcmp(value, "NaN", 3) == 0)
+    {
+        return NAN;
+    }
+    else if (size == 8 && memcmp(value, "Infinity", 8) == 0)
+    {
+        return std::numeric_limits<float>::infinity();
+    }
+    else if (size == 9 && memcmp(value, "-Infinity", 9) == 0)
+    {
+        return -std::numeric_limits<float>::infinity();
+    }
+    return NumberParser::toNumber<float>(value, value + size);
+}
+
+double JsonReader::convertFloat(const char* value, ssize_t size, double*)
+{
+    if (size == 3 && memcmp(value, "NaN", 3) == 0)
+    {
+        return NAN;
+    }
+    else if (size == 8 && memcmp(value, "Infinity", 8) == 0)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+    else if (size == 9 && memcmp(value, "-Infinity", 9) == 0)
+    {
+        return -std::numeric_limits<double>::infinity();
+    }
+    return NumberParser::toNumber<double>(value, value + size);
+}
+
+bool JsonReader::readBoolValue(bool& value)
+{
+    switch (peek())
+    {
+        case 't':
+            value = true;
+            return readLiteral("true", 4);
+        case 'f':
+            value = false;
+            return readLiteral("false", 5);
+        case '\"':
+        {
+            const char* str = nullptr;
+            ssize_t size = 0;
+            if (!readStringRaw(str, size))
+            {
+                return false;
+            }
+            value = (size == 4 && memcmp(str, "true", 4) == 0);
+            return true;
+        }
+        default:
+            break;
+    }
+    setError();
+    return false;
+}
+
+bool JsonReader::readBool(bool& value)
+{
+    if (peek() == 'n')
+    {
+        return readNull();
+    }
+    return readBoolValue(value);
+}
+
+bool JsonReader::readString(std::string& value)
+{
+    if (peek() == 'n')
+    {
+        return readNull();
+    }
+    const char* str = nullptr;
+    ssize_t size = 0;
+    if (!readStringRaw(str, size))
+    {
+        return false;
+    }
+    value.assign(str, size);
+    return true;
+}
+
+bool JsonReader::readBytes(Bytes& value)
+{
+    if (peek() == 'n')
+    {
+        return readNull();
+    }
+    const char* str = nullptr;
+    ssize_t size = 0;
+    if (!readStringRaw(str, size))
+    {
+        return false;
+    }
+    Bytes bytes;
+    Base64::decode(str, size, bytes);
+    value = std::move(bytes);
+    return true;
+}
+
+bool JsonReader::readEnumValue(const MetaEnum& metaEnum, std::int32_t& value)
+{
+    if (peek() == '\"')
+    {
+        const char* str = nullptr;
+        ssize_t size = 0;
+        if (!readStringRaw(str, size))
+        {
+            return false;
+        }
+        value = metaEnum.getValueByName(std::string(str, size));
+        return true;
+    }
+    Number number;
+    if (!readNumber(number) || number.isFloat)
+    {
+        setError();
+        return false;
+    }
+    value = number.isNegative ? static_cast<std::int32_t>(number.valueInt) : static_cast<std::int32_t>(number.valueUInt);
+    if (!metaEnum.isId(value))
+    {
+        value = 0;
+    }
+    return true;
+}
+
+bool JsonReader::readArrayBool(std::vector<bool>& value)
+{
+    if (peek() == 'n')
+    {
+        return readNull();
+    }
+    if (!enterArray())
+    {
+        return false;
+    }
+    value.clear();
+    while (nextEntry())
+    {
+        bool v = false;
+        if (!readBoolValue(v))
+        {
+            return false;
+        }
+        value.push_back(v);
+    }
+    return isOk();
+}
+
+bool JsonReader::readArrayString(std::vector<std::string>& value)
+{
+    if (peek() == 'n')
+    {
+        return readNull();
+    }
+    if (!enterArray())
+    {
+        return false;
+    }
+    value.clear();
+    while (nextEntry())
+    {
+        const char* str = nullptr;
+        ssize_t size = 0;
+        if (!readStringRaw(str, size))
+        {
+            return false;
+        }
+        value.emplace_back(str, size);
+    }
+    return isOk();
+}
+
+bool JsonReader::readArrayBytes(std::vector<Bytes>& value)
+{
+    if (peek() == 'n')
+    {
+        return readNull();
+    }
+    if (!enterArray())
+    {
+        return false;
+    }
+    value.clear();
+    while (nextEntry())
+    {
+        const char* str = nullptr;
+        ssize_t size = 0;
+        if (!readStringRaw(str, size))
+        {
+            return false;
+        }
+        value.emplace_back();
+        Base64::decode(str, size, value.back());
+    }
+    return isOk();
+}
+
+bool JsonReader::readArrayEnumValues(const MetaEnum& metaEnum, std::vector<std::int32_t>& value)
+{
+    if (!enterArray())
+    {
+        return false;
+    }
+    // ParserJson handles arrays with names and numbers mixed
+    bool names = false;
+    bool numbers = false;
+    while (nextEntry())
+    {
+        std::int32_t v = 0;
+        const bool name = (peek() == '\"');
+        names = names || name;
+        numbers = numbers || !name;
+        if (names && numbers)
+        {
+            setError();
+            return false;
+        }
+        if (!readEnumValue(metaEnum, v))
+        {
+            return false;
+        }
+        value.push_back(v);
+    }
+    return isOk();
+}
+
+} // namespace finalmq
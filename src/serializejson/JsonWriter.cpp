@@ -0,0 +1,122 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "finalmq/serializejson/JsonWriter.h"
+
+#include <cmath>
+#include <limits>
+
+#include "finalmq/helpers/base64.h"
+
+namespace finalmq
+{
+JsonWriter::JsonWriter(IZeroCopyBuffer& buffer, int maxBlockSize, bool enumAsString)
+    : m_jsonBuilder(buffer, maxBlockSize), m_enumAsString(enumAsString)
+{
+}
+
+void JsonWriter::finished()
+{
+    m_jsonBuilder.finished();
+}
+
+void JsonWriter::writeDouble(double value)
+{
+#ifndef WIN32
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfloat-equal"
+#endif
+    if (std::isnan(value))
+    {
+        m_jsonBuilder.enterString("NaN");
+    }
+    else if (value == std::numeric_limits<double>::infinity())
+    {
+        m_jsonBuilder.enterString("Infinity");
+    }
+    else if (value == -std::numeric_limits<double>::infinity())
+    {
+        m_jsonBuilder.enterString("-Infinity");
+    }
+    else
+    {
+        m_jsonBuilder.enterDouble(value);
+    }
+#ifndef WIN32
+#pragma GCC diagnostic pop
+#endif
+}
+
+void JsonWriter::writeBytes(const Bytes& value)
+{
+    std::string base64;
+    Base64::encode(value, base64);
+    m_jsonBuilder.enterString(base64.data(), base64.size());
+}
+
+void JsonWriter::writeEnum(const MetaEnum& metaEnum, std::int32_t value)
+{
+    if (m_enumAsString)
+    {
+        const std::string& name = metaEnum.getAliasByValue(value);
+        m_jsonBuilder.enterString(name.data(), name.size());
+    }
+    else
+    {
+        m_jsonBuilder.enterInt32(value);
+    }
+}
+
+void JsonWriter::writeArrayBool(const std::vector<bool>& value)
+{
+    m_jsonBuilder.enterArray();
+    for (bool entry : value)
+    {
+        m_jsonBuilder.enterBool(entry);
+    }
+    m_jsonBuilder.exitArray();
+}
+
+void JsonWriter::writeArrayString(const std::vector<std::string>& value)
+{
+    m_jsonBuilder.enterArray();
+    for (const std::string& entry : value)
+    {
+        m_jsonBuilder.enterString(entry.data(), entry.size());
+    }
+    m_jsonBuilder.exitArray();
+}
+
+void JsonWriter::writeArrayBytes(const std::vector<Bytes>& value)
+{
+    m_jsonBuilder.enterArray();
+    std::string base64;
+    for (const Bytes& entry : value)
+    {
+        base64.clear();
+        Base64::encode(entry, base64);
+        m_jsonBuilder.enterString(base64.data(), base64.size());
+    }
+    m_jsonBuilder.exitArray();
+}
+
+} // namespace finalmq
@@ -24,6 +24,7 @@
 
 #include <assert.h>
 
+#include "finalmq/conversions/NumberParser.h"
 #include "finalmq/conversions/dtoa.h"
 #include "finalmq/conversions/itoa.h"
 #include "finalmq/helpers/ModulenameFinalmq.h"
@@ -264,7 +265,7 @@ float ParserJson::convert<float>(const char* value, ssize_t size)
     }
     else
     {
-        v = strtof32(value, nullptr);
+        v = NumberParser::toNumber<float>(value, value + size);
     }
     return v;
 }
@@ -289,7 +290,7 @@ double ParserJson::convert<double>(const char* value, ssize_t size)
     }
     else
     {
-        v = strtof64(value, nullptr);
+        v = NumberParser::toNumber<double>(value, value + size);
     }
     return v;
 }
@@ -320,49 +321,49 @@ void ParserJson::enterString(const char* value, ssize_t size)
         break;
         case MetaTypeId::TYPE_INT8:
         {
-            std::int8_t v = static_cast<std::int8_t>(strtol(value, nullptr, 10));
+            std::int8_t v = NumberParser::toNumber<std::int8_t>(value, value + size);
             m_visitor.enterInt8(*m_fieldCurrent, v);
         }
         break;
         case MetaTypeId::TYPE_UINT8:
         {
-            std::uint8_t v = static_cast<std::uint8_t>(strtoul(value, nullptr, 10));
+            std::uint8_t v = NumberParser::toNumber<std::uint8_t>(value, value + size);
             m_visitor.enterUInt8(*m_fieldCurrent, v);
         }
         break;
         case MetaTypeId::TYPE_INT16:
         {
-            std::int16_t v = static_cast<std::int16_t>(strtol(value, nullptr, 10));
+            std::int16_t v = NumberParser::toNumber<std::int16_t>(value, value + size);
             m_visitor.enterInt16(*m_fieldCurrent, v);
         }
         break;
         case MetaTypeId::TYPE_UINT16:
         {
-            std::uint16_t v = static_cast<std::uint16_t>(strtoul(value, nullptr, 10));
+            std::uint16_t v = NumberParser::toNumber<std::uint16_t>(value, value + size);
             m_visitor.enterUInt16(*m_fieldCurrent, v);
         }
         break;
         case MetaTypeId::TYPE_INT32:
         {
-            std::int32_t v = static_cast<std::int32_t>(strtol(value, nullptr, 10));
+            std::int32_t v = NumberParser::toNumber<std::int32_t>(value, value + size);
             m_visitor.enterInt32(*m_fieldCurrent, v);
         }
         break;
         case MetaTypeId::TYPE_UINT32:
         {
-            std::uint32_t v = static_cast<std::uint32_t>(strtoul(value, nullptr, 10));
+            std::uint32_t v = NumberParser::toNumber<std::uint32_t>(value, value + size);
             m_visitor.enterUInt32(*m_fieldCurrent, v);
         }
         break;
         case MetaTypeId::TYPE_INT64:
         {
-            std::int64_t v = strtoll(value, nullptr, 10);
+            std::int64_t v = NumberParser::toNumber<std::int64_t>(value, value + size);
             m_visitor.enterInt64(*m_fieldCurrent, v);
         }
         break;
         case MetaTypeId::TYPE_UINT64:
         {
-            std::uint64_t v = strtoull(value, nullptr, 10);
+            std::uint64_t v = NumberParser::toNumber<std::uint64_t>(value, value + size);
             m_visitor.enterUInt64(*m_fieldCurrent, v);
         }
         break;
@@ -400,43 +401,43 @@ void ParserJson::enterString(const char* value, ssize_t size)
         break;
         case MetaTypeId::TYPE_ARRAY_INT8:
         {
-            std::int8_t v = static_cast<std::int8_t>(strtol(value, nullptr, 10));
+            std::int8_t v = NumberParser::toNumber<std::int8_t>(value, value + size);
             m_arrayInt8.push_back(v);
         }
         break;
         case MetaTypeId::TYPE_ARRAY_INT16:
         {
-            std::int16_t v = static_cast<std::int16_t>(strtol(value, nullptr, 10));
+            std::int16_t v = NumberParser::toNumber<std::int16_t>(value, value + size);
             m_arrayInt16.push_back(v);
         }
         break;
         case MetaTypeId::TYPE_ARRAY_UINT16:
         {
-            std::uint16_t v = static_cast<std::uint16_t>(strtoul(value, nullptr, 10));
+            std::uint16_t v = NumberParser::toNumber<std::uint16_t>(value, value + size);
             m_arrayUInt16.push_back(v);
         }
         break;
         case MetaTypeId::TYPE_ARRAY_INT32:
         {
-            std::int32_t v = static_cast<std::int32_t>(strtol(value, nullptr, 10));
+            std::int32_t v = NumberParser::toNumber<std::int32_t>(value, value + size);
             m_arrayInt32.push_back(v);
         }
         break;
         case MetaTypeId::TYPE_ARRAY_UINT32:
         {
-            std::uint32_t v = static_cast<std::uint32_t>(strtoul(value, nullptr, 10));
+            std::uint32_t v = NumberParser::toNumber<std::uint32_t>(value, value + size);
             m_arrayUInt32.push_back(v);
         }
         break;
         case MetaTypeId::TYPE_ARRAY_INT64:
         {
-            std::int64_t v = strtoll(value, nullptr, 10);
+            std::int64_t v = NumberParser::toNumber<std::int64_t>(value, value + size);
             m_arrayInt64.push_back(v);
         }
         break;
         case MetaTypeId::TYPE_ARRAY_UINT64:
         {
-            std::uint64_t v = strtoull(value, nullptr, 10);
+            std::uint64_t v = NumberParser::toNumber<std::uint64_t>(value, value + size);
             m_arrayUInt64.push_back(v);
         }
         break;
@@ -507,49 +508,49 @@ void ParserJson::enterString(std::string&& value)
         break;
         case MetaTypeId::TYPE_INT8:
         {
-            std::int8_t v = static_cast<std::int8_t>(strtol(value.c_str(), nullptr, 10));
+            std::int8_t v = NumberParser::toNumber<std::int8_t>(value.data(), value.data() + value.size());
             m_visitor.enterInt8(*m_fieldCurrent, v);
         }
         break;
         case MetaTypeId::TYPE_UINT8:
         {
-            std::uint8_t v = static_cast<std::uint8_t>(strtoul(value.c_str(), nullptr, 10));
+            std::uint8_t v = NumberParser::toNumber<std::uint8_t>(value.data(), value.data() + value.size());
             m_visitor.enterUInt8(*m_fieldCurrent, v);
         }
         break;
         case MetaTypeId::TYPE_INT16:
         {
-            std::int16_t v = static_cast<std::int16_t>(strtol(value.c_str(), nullptr, 10));
+            std::int16_t v = NumberParser::toNumber<std::int16_t>(value.data(), value.data() + value.size());
             m_visitor.enterInt16(*m_fieldCurrent, v);
         }
         break;
         case MetaTypeId::TYPE_UINT16:
         {
-            std::uint16_t v = static_cast<std::uint16_t>(strtoul(value.c_str(), nullptr, 10));
+            std::uint16_t v = NumberParser::toNumber<std::uint16_t>(value.data(), value.data() + value.size());
             m_visitor.enterUInt16(*m_fieldCurrent, v);
         }
         break;
         case MetaTypeId::TYPE_INT32:
         {
-            std::int32_t v = static_cast<std::int32_t>(strtol(value.c_str(), nullptr, 10));
+            std::int32_t v = NumberParser::toNumber<std::int32_t>(value.data(), value.data() + value.size());
             m_visitor.enterInt32(*m_fieldCurrent, v);
         }
         break;
         case MetaTypeId::TYPE_UINT32:
         {
-            std::uint32_t v = static_cast<std::uint32_t>(strtoul(value.c_str(), nullptr, 10));
+            std::uint32_t v = NumberParser::toNumber<std::uint32_t>(value.data(), value.data() + value.size());
             m_visitor.enterUInt32(*m_fieldCurrent, v);
         }
         break;
         case MetaTypeId::TYPE_INT64:
         {
-            std::int64_t v = strtoll(value.c_str(), nullptr, 10);
+            std::int64_t v = NumberParser::toNumber<std::int64_t>(value.data(), value.data() + value.size());
             m_visitor.enterInt64(*m_fieldCurrent, v);
         }
         break;
         case MetaTypeId::TYPE_UINT64:
         {
-            std::uint64_t v = strtoull(value.c_str(), nullptr, 10);
+            std::uint64_t v = NumberParser::toNumber<std::uint64_t>(value.data(), value.data() + value.size());
             m_visitor.enterUInt64(*m_fieldCurrent, v);
         }
         break;
@@ -587,25 +588,25 @@ void ParserJson::enterString(std::string&& value)
         break;
         case MetaTypeId::TYPE_ARRAY_INT32:
         {
-            std::int32_t v = static_cast<std::int32_t>(strtol(value.c_str(), nullptr, 10));
+            std::int32_t v = NumberParser::toNumber<std::int32_t>(value.data(), value.data() + value.size());
             m_arrayInt32.push_back(v);
         }
         break;
         case MetaTypeId::TYPE_ARRAY_UINT32:
         {
-            std::uint32_t v = static_cast<std::uint32_t>(strtoul(value.c_str(), nullptr, 10));
+            std::uint32_t v = NumberParser::toNumber<std::uint32_t>(value.data(), value.data() + value.size());
             m_arrayUInt32.push_back(v);
         }
         break;
         case MetaTypeId::TYPE_ARRAY_INT64:
         {
-            std::int64_t v = strtoll(value.c_str(), nullptr, 10);
+            std::int64_t v = NumberParser::toNumber<std::int64_t>(value.data(), value.data() + value.size());
             m_arrayInt64.push_back(v);
         }
         break;
         case MetaTypeId::TYPE_ARRAY_UINT64:
         {
-            std::uint64_t v = strtoull(value.c_str(), nullptr, 10);
+            std::uint64_t v = NumberParser::toNumber<std::uint64_t>(value.data(), value.data() + value.size());
             m_arrayUInt64.push_back(v);
         }
         break;
@@ -908,12 +909,12 @@ void ParserJson::exitObject()
     }
 }
 
-void ParserJson::enterKey(const char* key, ssize_t size)
+void ParserJson::enterKey(std::string&& key)
 {
-    enterKey(std::string(key, size));
+    enterKey(key.data(), key.size());
 }
 
-void ParserJson::enterKey(std::string&& key)
+void ParserJson::enterKey(const char* key, ssize_t size)
 {
     if (m_jsonTypeActive > 0)
     {
@@ -922,7 +923,7 @@ void ParserJson::enterKey(std::string&& key)
     m_fieldCurrent = nullptr;
     if (m_structCurrent)
     {
-        m_fieldCurrent = m_structCurrent->getFieldByName(key);
+        m_fieldCurrent = m_structCurrent->getFieldByName(key, size);
         if (m_fieldCurrent && (m_fieldCurrent->typeId == TYPE_JSON))
         {
             assert(m_jsonTypeActive == 0);
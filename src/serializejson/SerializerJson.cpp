@@ -391,11 +391,7 @@ void SerializerJson::Internal::enterArrayInt32(const MetaField& field, const std
 {
     assert(field.typeId == MetaTypeId::TYPE_ARRAY_INT32);
     setKey(field);
-    m_jsonBuilder.enterArray();
-    std::for_each(value, value + size, [this](std::int32_t entry) {
-        m_jsonBuilder.enterInt32(entry);
-    });
-    m_jsonBuilder.exitArray();
+    m_jsonBuilder.enterArrayInt32(value, size);
 }
 
 void SerializerJson::Internal::enterArrayUInt32(const MetaField& field, std::vector<std::uint32_t>&& value)
@@ -407,11 +403,7 @@ void SerializerJson::Internal::enterArrayUInt32(const MetaField& field, const st
 {
     assert(field.typeId == MetaTypeId::TYPE_ARRAY_UINT32);
     setKey(field);
-    m_jsonBuilder.enterArray();
-    std::for_each(value, value + size, [this](std::uint32_t entry) {
-        m_jsonBuilder.enterUInt32(entry);
-    });
-    m_jsonBuilder.exitArray();
+    m_jsonBuilder.enterArrayUInt32(value, size);
 }
 
 void SerializerJson::Internal::enterArrayInt64(const MetaField& field, std::vector<std::int64_t>&& value)
@@ -423,11 +415,7 @@ void SerializerJson::Internal::enterArrayInt64(const MetaField& field, const std
 {
     assert(field.typeId == MetaTypeId::TYPE_ARRAY_INT64);
     setKey(field);
-    m_jsonBuilder.enterArray();
-    std::for_each(value, value + size, [this](std::int64_t entry) {
-        m_jsonBuilder.enterString(std::to_string(entry));
-    });
-    m_jsonBuilder.exitArray();
+    m_jsonBuilder.enterArrayInt64(value, size, true);
 }
 
 void SerializerJson::Internal::enterArrayUInt64(const MetaField& field, std::vector<std::uint64_t>&& value)
@@ -439,11 +427,7 @@ void SerializerJson::Internal::enterArrayUInt64(const MetaField& field, const st
 {
     assert(field.typeId == MetaTypeId::TYPE_ARRAY_UINT64);
     setKey(field);
-    m_jsonBuilder.enterArray();
-    std::for_each(value, value + size, [this](std::uint64_t entry) {
-        m_jsonBuilder.enterString(std::to_string(entry));
-    });
-    m_jsonBuilder.exitArray();
+    m_jsonBuilder.enterArrayUInt64(value, size, true);
 }
 
 void SerializerJson::Internal::enterArrayFloat(const MetaField& field, std::vector<float>&& value)
@@ -455,11 +439,7 @@ void SerializerJson::Internal::enterArrayFloat(const MetaField& field, const flo
 {
     assert(field.typeId == MetaTypeId::TYPE_ARRAY_FLOAT);
     setKey(field);
-    m_jsonBuilder.enterArray();
-    std::for_each(value, value + size, [this](float entry) {
-        handleDouble(entry);
-    });
-    m_jsonBuilder.exitArray();
+    m_jsonBuilder.enterArrayFloat(value, size);
 }
 
 void SerializerJson::Internal::enterArrayDouble(const MetaField& field, std::vector<double>&& value)
@@ -471,11 +451,7 @@ void SerializerJson::Internal::enterArrayDouble(const MetaField& field, const do
 {
     assert(field.typeId == MetaTypeId::TYPE_ARRAY_DOUBLE);
     setKey(field);
-    m_jsonBuilder.enterArray();
-    std::for_each(value, value + size, [this](double entry) {
-        handleDouble(entry);
-    });
-    m_jsonBuilder.exitArray();
+    m_jsonBuilder.enterArrayDouble(value, size);
 }
 
 void SerializerJson::Internal::enterArrayStringMove(const MetaField& field, std::vector<std::string>&& value)
@@ -29,6 +29,7 @@
 
 #include "finalmq/helpers/FmqDefines.h"
 #include "finalmq/metadata/MetaData.h"
+#include "finalmq/serializeproto/PackedVarint.h"
 
 namespace finalmq
 {
@@ -304,13 +305,18 @@ bool ParserProto::parseArrayVarint(std::vector<T>& array)
             int sizeBuffer = static_cast<std::int32_t>(parseVarint());
             if ((sizeBuffer >= 0 && sizeBuffer <= m_size) && m_ptr)
             {
-                int sizeEnd = static_cast<int>(m_size - sizeBuffer);
-                sizeEnd = std::max(sizeEnd, 0);
-                while (m_size > sizeEnd)
+                ok = PackedVarint::readArray(m_ptr, sizeBuffer, array, [this](std::uint64_t value) {
+                    return (ZIGZAG) ? static_cast<T>(zigzag(value)) : static_cast<T>(value);
+                });
+                if (ok)
                 {
-                    std::uint64_t value = parseVarint();
-                    T v = (ZIGZAG) ? static_cast<T>(zigzag(value)) : static_cast<T>(value);
-                    array.push_back(v);
+                    m_ptr += sizeBuffer;
+                    m_size -= sizeBuffer;
+                }
+                else
+                {
+                    m_ptr = nullptr;
+                    m_size = 0;
                 }
             }
             else
@@ -0,0 +1,146 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "finalmq/serializeproto/ProtoReader.h"
+
+namespace finalmq
+{
+static const int MAX_VARINT_SIZE = 10;
+
+ProtoReader::ProtoReader(const char* buffer, ssize_t size)
+    : m_ptr(buffer), m_size(buffer ? size : 0)
+{
+}
+
+bool ProtoReader::readVarint(std::uint64_t& value)
+{
+    value = 0;
+    for (int i = 0; i < MAX_VARINT_SIZE && m_size > 0; ++i)
+    {
+        const std::uint64_t c = static_cast<std::uint8_t>(*m_ptr);
+        ++m_ptr;
+        --m_size;
+        value |= (c & 0x7f) << (i * 7);
+        if (c < 0x80)
+        {
+            return true;
+        }
+    }
+    m_ptr = nullptr;
+    m_size = 0;
+    return false;
+}
+
+bool ProtoReader::readTag(std::uint32_t& tag)
+{
+    if (m_tagNext != 0)
+    {
+        tag = m_tagNext;
+        m_tagNext = 0;
+        return true;
+    }
+    std::uint64_t value = 0;
+    if (!readVarint(value))
+    {
+        return false;
+    }
+    tag = static_cast<std::uint32_t>(value);
+    // ParserProto handles the id 0 in a special way, let it do so.
+    return ((tag >> 3) != 0);
+}
+
+bool ProtoReader::nextTagIs(std::uint32_t tag)
+{
+    if (m_size <= 0)
+    {
+        return false;
+    }
+    std::uint32_t tagNext = 0;
+    if (!readTag(tagNext))
+    {
+        m_ptr = nullptr;
+        m_size = 0;
+        return false;
+    }
+    if (tagNext == tag)
+    {
+        return true;
+    }
+    m_tagNext = tagNext;
+    return false;
+}
+
+bool ProtoReader::readLengthDelimited(std::uint32_t tag, const char*& buffer, ssize_t& size)
+{
+    if ((tag & 0x7) != WIRETYPE_LENGTH_DELIMITED)
+    {
+        return false;
+    }
+    std::uint64_t value = 0;
+    if (!readVarint(value))
+    {
+        return false;
+    }
+    if (value > static_cast<std::uint64_t>(m_size))
+    {
+        return false;
+    }
+    const ssize_t sizeBuffer = static_cast<ssize_t>(value);
+    buffer = m_ptr;
+    size = sizeBuffer;
+    m_ptr += sizeBuffer;
+    m_size -= sizeBuffer;
+    return true;
+}
+
+bool ProtoReader::skip(std::uint32_t tag)
+{
+    switch (tag & 0x7)
+    {
+        case WIRETYPE_VARINT:
+        {
+            std::uint64_t value = 0;
+            return readVarint(value);
+        }
+        case WIRETYPE_FIXED64:
+        {
+            std::uint64_t value = 0;
+            return readFixed(value);
+        }
+        case WIRETYPE_LENGTH_DELIMITED:
+        {
+            const char* buffer = nullptr;
+            ssize_t size = 0;
+            return readLengthDelimited(tag, buffer, size);
+        }
+        case WIRETYPE_FIXED32:
+        {
+            std::uint32_t value = 0;
+            return readFixed(value);
+        }
+        default:
+            break;
+    }
+    return false;
+}
+
+} // namespace finalmq
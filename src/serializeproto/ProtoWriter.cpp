@@ -0,0 +1,60 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "finalmq/serializeproto/ProtoWriter.h"
+
+namespace finalmq
+{
+void ProtoWriter::startWrite(IZeroCopyBuffer& buffer, std::size_t size)
+{
+    m_indexStruct = 0;
+    m_buffer = nullptr;
+    m_bufferEnd = nullptr;
+    if (size > 0)
+    {
+        m_buffer = buffer.addBuffer(size);
+        m_bufferEnd = m_buffer + size;
+    }
+}
+
+void ProtoWriter::finished()
+{
+    assert(m_buffer == m_bufferEnd);
+    assert(m_indexStruct == m_structSizes.size());
+}
+
+void ProtoWriter::writeArrayBool(std::uint32_t tag, const std::vector<bool>& value)
+{
+    if (value.empty())
+    {
+        return;
+    }
+    writeVarint(tag);
+    writeVarint(value.size());
+    for (bool entry : value)
+    {
+        *m_buffer = entry ? 1 : 0;
+        ++m_buffer;
+    }
+}
+
+} // namespace finalmq
@@ -33,6 +33,7 @@
 #include "finalmq/logger/LogStream.h"
 #include "finalmq/metadata/MetaData.h"
 #include "finalmq/serialize/ParserAbortAndIndex.h"
+#include "finalmq/serializeproto/PackedVarint.h"
 #include "finalmq/jsonvariant/VariantToJson.h"
 
 namespace finalmq
@@ -219,15 +220,16 @@ void SerializerProto::Internal::serializeArrayVarint(int id, const T* value, ssi
         return;
     }
 
-    reserveSpace(size * 2 * MAX_VARINT_SIZE);
+    auto toVarint = [](T entry) {
+        return static_cast<std::uint64_t>(entry);
+    };
+    const ssize_t sizeByte = PackedVarint::sizeArray(value, size, toVarint);
+    reserveSpace(MAX_VARINT_SIZE + MAX_VARINT_SIZE + sizeByte);
 
-    std::uint32_t tag = (id << 3) | WIRETYPE_VARINT;
-
-    for (int i = 0; i < size; i++)
-    {
-        serializeVarint(tag);
-        serializeVarint(value[i]);
-    }
+    std::uint32_t tag = (id << 3) | WIRETYPE_LENGTH_DELIMITED;
+    serializeVarint(tag);
+    serializeVarint(sizeByte);
+    m_buffer = PackedVarint::writeArray(m_buffer, value, size, toVarint);
 }
 
 template<class T>
@@ -238,16 +240,16 @@ void SerializerProto::Internal::serializeArrayZigZag(int id, const T* value, ssi
         return;
     }
 
-    reserveSpace(size * 2 * MAX_VARINT_SIZE);
+    auto toVarint = [this](T entry) {
+        return zigzag(entry);
+    };
+    const ssize_t sizeByte = PackedVarint::sizeArray(value, size, toVarint);
+    reserveSpace(MAX_VARINT_SIZE + MAX_VARINT_SIZE + sizeByte);
 
-    std::uint32_t tag = (id << 3) | WIRETYPE_VARINT;
-
-    for (int i = 0; i < size; i++)
-    {
-        serializeVarint(tag);
-        auto v = zigzag(value[i]);
-        serializeVarint(v);
-    }
+    std::uint32_t tag = (id << 3) | WIRETYPE_LENGTH_DELIMITED;
+    serializeVarint(tag);
+    serializeVarint(sizeByte);
+    m_buffer = PackedVarint::writeArray(m_buffer, value, size, toVarint);
 }
 
 static const int RESERVE_STRUCT_SIZE = 8;
@@ -0,0 +1,487 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "finalmq/serializeproto/SerializerProtoSized.h"
+
+#include <assert.h>
+
+#include "finalmq/helpers/ZeroCopyBuffer.h"
+#include "finalmq/jsonvariant/VariantToJson.h"
+#include "finalmq/metadata/MetaData.h"
+
+namespace finalmq
+{
+static constexpr int INDEX2ID = 1;
+static const std::string STR_VARVALUE = "finalmq.variant.VarValue";
+static const std::string ABORTSTRUCT = "abortstruct";
+
+static inline std::uint32_t getTag(const MetaField& field, ProtoWriter::WireType wireType)
+{
+    return (static_cast<std::uint32_t>(field.index + INDEX2ID) << 3) | wireType;
+}
+
+static inline ProtoWriter::WireType getWireTypeFixed(std::size_t size)
+{
+    return (size == sizeof(std::uint64_t)) ? ProtoWriter::WIRETYPE_FIXED64 : ProtoWriter::WIRETYPE_FIXED32;
+}
+
+SerializerProtoSized::SerializerProtoSized(IZeroCopyBuffer& buffer)
+    : m_buffer(buffer)
+{
+}
+
+bool SerializerProtoSized::serializeStruct(const StructBase& structBase)
+{
+    m_supported = true;
+    m_jsonStrings.clear();
+    const std::size_t size = sizeStruct(structBase);
+    if (!m_supported)
+    {
+        return false;
+    }
+    m_indexJson = 0;
+    m_writer.startWrite(m_buffer, size);
+    writeStruct(structBase);
+    m_writer.finished();
+    assert(m_indexJson == m_jsonStrings.size());
+    return true;
+}
+
+////////////////////////////////////////////
+// size calculation
+
+// F is the type on the wire for the fixed encoding (the small integers are sent as 32 bit values)
+template<class F, class T>
+std::size_t SerializerProtoSized::sizeSigned(const MetaField& field, T value)
+{
+    if (field.flags & METAFLAG_PROTO_VARINT)
+    {
+        return ProtoWriter::sizeVarintField(getTag(field, ProtoWriter::WIRETYPE_VARINT), static_cast<std::uint64_t>(static_cast<std::int64_t>(value)));
+    }
+    else if (field.flags & METAFLAG_PROTO_ZIGZAG)
+    {
+        return ProtoWriter::sizeZigZagField(getTag(field, ProtoWriter::WIRETYPE_VARINT), value);
+    }
+    return ProtoWriter::sizeFixedField<F>(getTag(field, getWireTypeFixed(sizeof(F))), value);
+}
+
+template<class F, class T>
+std::size_t SerializerProtoSized::sizeUnsigned(const MetaField& field, T value)
+{
+    if (field.flags & METAFLAG_PROTO_VARINT)
+    {
+        return ProtoWriter::sizeVarintField(getTag(field, ProtoWriter::WIRETYPE_VARINT), value);
+    }
+    return ProtoWriter::sizeFixedField<F>(getTag(field, getWireTypeFixed(sizeof(F))), value);
+}
+
+template<class F, class T>
+std::size_t SerializerProtoSized::sizeArraySigned(const MetaField& field, const std::vector<T>& value)
+{
+    if (field.flags & METAFLAG_PROTO_VARINT)
+    {
+        return ProtoWriter::sizeArrayVarint(getTag(field, ProtoWriter::WIRETYPE_VARINT), value);
+    }
+    else if (field.flags & METAFLAG_PROTO_ZIGZAG)
+    {
+        return ProtoWriter::sizeArrayZigZag(getTag(field, ProtoWriter::WIRETYPE_VARINT), value);
+    }
+    return ProtoWriter::sizeArrayFixed<F>(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), value.size());
+}
+
+template<class F, class T>
+std::size_t SerializerProtoSized::sizeArrayUnsigned(const MetaField& field, const std::vector<T>& value)
+{
+    if (field.flags & METAFLAG_PROTO_VARINT)
+    {
+        return ProtoWriter::sizeArrayVarint(getTag(field, ProtoWriter::WIRETYPE_VARINT), value);
+    }
+    return ProtoWriter::sizeArrayFixed<F>(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), value.size());
+}
+
+std::size_t SerializerProtoSized::sizeSubStruct(const MetaField& field, const StructBase& structBase, bool arrayEntry)
+{
+    const std::size_t index = m_writer.reserveStructSize();
+    const std::size_t size = sizeStruct(structBase);
+    m_writer.setStructSize(index, size);
+    return ProtoWriter::sizeStructField(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), size, arrayEntry);
+}
+
+std::size_t SerializerProtoSized::sizeStruct(const StructBase& structBase)
+{
+    std::size_t size = 0;
+    const std::vector<FieldInfo>& fields = structBase.getStructInfo().getFields();
+    for (size_t i = 0; i < fields.size() && m_supported; ++i)
+    {
+        size += sizeField(structBase, fields[i]);
+    }
+    return size;
+}
+
+std::size_t SerializerProtoSized::sizeField(const StructBase& structBase, const FieldInfo& fieldInfo)
+{
+    const MetaField* f = fieldInfo.getField();
+    assert(f);
+    const MetaField& field = *f;
+    if ((field.flags & METAFLAG_INDEX) || (!field.properties.empty() && !field.getProperty(ABORTSTRUCT).empty()))
+    {
+        m_supported = false;
+        return 0;
+    }
+    switch (field.typeId)
+    {
+    case TYPE_BOOL:
+        return ProtoWriter::sizeVarintField(getTag(field, ProtoWriter::WIRETYPE_VARINT), structBase.getValue<bool>(fieldInfo));
+    case TYPE_INT8:
+        return sizeSigned<std::int32_t>(field, structBase.getValue<std::int8_t>(fieldInfo));
+    case TYPE_UINT8:
+        return sizeUnsigned<std::uint32_t>(field, structBase.getValue<std::uint8_t>(fieldInfo));
+    case TYPE_INT16:
+        return sizeSigned<std::int32_t>(field, structBase.getValue<std::int16_t>(fieldInfo));
+    case TYPE_UINT16:
+        return sizeUnsigned<std::uint32_t>(field, structBase.getValue<std::uint16_t>(fieldInfo));
+    case TYPE_INT32:
+        return sizeSigned<std::int32_t>(field, structBase.getValue<std::int32_t>(fieldInfo));
+    case TYPE_UINT32:
+        return sizeUnsigned<std::uint32_t>(field, structBase.getValue<std::uint32_t>(fieldInfo));
+    case TYPE_INT64:
+        return sizeSigned<std::int64_t>(field, structBase.getValue<std::int64_t>(fieldInfo));
+    case TYPE_UINT64:
+        return sizeUnsigned<std::uint64_t>(field, structBase.getValue<std::uint64_t>(fieldInfo));
+    case TYPE_FLOAT:
+        return ProtoWriter::sizeFixedField(getTag(field, ProtoWriter::WIRETYPE_FIXED32), structBase.getValue<float>(fieldInfo));
+    case TYPE_DOUBLE:
+        return ProtoWriter::sizeFixedField(getTag(field, ProtoWriter::WIRETYPE_FIXED64), structBase.getValue<double>(fieldInfo));
+    case TYPE_STRING:
+        if (field.flags & METAFLAG_ZEROCOPY)
+        {
+            return ProtoWriter::sizeStringField(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), structBase.getValue<BytesView>(fieldInfo).size());
+        }
+        return ProtoWriter::sizeStringField(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), structBase.getValue<std::string>(fieldInfo).size());
+    case TYPE_BYTES:
+        if (field.flags & METAFLAG_ZEROCOPY)
+        {
+            return ProtoWriter::sizeStringField(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), structBase.getValue<BytesView>(fieldInfo).size());
+        }
+        return ProtoWriter::sizeStringField(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), structBase.getValue<Bytes>(fieldInfo).size());
+    case TYPE_STRUCT:
+        if (field.typeName == STR_VARVALUE)
+        {
+            m_supported = false;
+            return 0;
+        }
+        if (!(field.flags & METAFLAG_NULLABLE))
+        {
+            return sizeSubStruct(field, structBase.getValue<StructBase>(fieldInfo), false);
+        }
+        else
+        {
+            const StructBasePtr& value = structBase.getValue<StructBasePtr>(fieldInfo);
+            return value ? sizeSubStruct(field, *value, false) : 0;
+        }
+    case TYPE_ENUM:
+        return ProtoWriter::sizeVarintField(getTag(field, ProtoWriter::WIRETYPE_VARINT), static_cast<std::uint64_t>(static_cast<std::int64_t>(structBase.getValue<std::int32_t>(fieldInfo))));
+    case TYPE_JSON:
+        {
+            // the json string is needed for its size, keep it for the write pass
+            ZeroCopyBuffer buffer;
+            VariantToJson variantToJson(buffer);
+            variantToJson.parse(structBase.getValue<Variant>(fieldInfo));
+            m_jsonStrings.push_back(buffer.getData());
+            return ProtoWriter::sizeStringField(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), m_jsonStrings.back().size());
+        }
+    case TYPE_ARRAY_BOOL:
+        return ProtoWriter::sizeArrayBool(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), structBase.getValue<std::vector<bool>>(fieldInfo).size());
+    case TYPE_ARRAY_INT8:
+        return sizeArraySigned<std::int32_t>(field, structBase.getValue<std::vector<std::int8_t>>(fieldInfo));
+    case TYPE_ARRAY_INT16:
+        return sizeArraySigned<std::int32_t>(field, structBase.getValue<std::vector<std::int16_t>>(fieldInfo));
+    case TYPE_ARRAY_UINT16:
+        return sizeArrayUnsigned<std::uint32_t>(field, structBase.getValue<std::vector<std::uint16_t>>(fieldInfo));
+    case TYPE_ARRAY_INT32:
+        return sizeArraySigned<std::int32_t>(field, structBase.getValue<std::vector<std::int32_t>>(fieldInfo));
+    case TYPE_ARRAY_UINT32:
+        return sizeArrayUnsigned<std::uint32_t>(field, structBase.getValue<std::vector<std::uint32_t>>(fieldInfo));
+    case TYPE_ARRAY_INT64:
+        return sizeArraySigned<std::int64_t>(field, structBase.getValue<std::vector<std::int64_t>>(fieldInfo));
+    case TYPE_ARRAY_UINT64:
+        return sizeArrayUnsigned<std::uint64_t>(field, structBase.getValue<std::vector<std::uint64_t>>(fieldInfo));
+    case TYPE_ARRAY_FLOAT:
+        return ProtoWriter::sizeArrayFixed<float>(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), structBase.getValue<std::vector<float>>(fieldInfo).size());
+    case TYPE_ARRAY_DOUBLE:
+        return ProtoWriter::sizeArrayFixed<double>(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), structBase.getValue<std::vector<double>>(fieldInfo).size());
+    case TYPE_ARRAY_STRING:
+        return ProtoWriter::sizeArrayString(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), structBase.getValue<std::vector<std::string>>(fieldInfo));
+    case TYPE_ARRAY_BYTES:
+        return ProtoWriter::sizeArrayString(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), structBase.getValue<std::vector<Bytes>>(fieldInfo));
+    case TYPE_ARRAY_STRUCT:
+        {
+            std::size_t size = 0;
+            const char& array = structBase.getValue<char>(fieldInfo);
+            IArrayStructAdapter* arrayStructAdapter = fieldInfo.getArrayStructAdapter();
+            if (arrayStructAdapter)
+            {
+                const ssize_t count = arrayStructAdapter->size(array);
+                for (ssize_t i = 0; i < count; ++i)
+                {
+                    size += sizeSubStruct(field, arrayStructAdapter->at(array, i), true);
+                }
+            }
+            return size;
+        }
+    case TYPE_ARRAY_ENUM:
+        return ProtoWriter::sizeArrayEnum(getTag(field, ProtoWriter::WIRETYPE_VARINT), structBase.getValue<std::vector<std::int32_t>>(fieldInfo));
+    default:
+        assert(false);
+        break;
+    }
+    return 0;
+}
+
+////////////////////////////////////////////
+// writing
+
+template<class F, class T>
+void SerializerProtoSized::writeSigned(const MetaField& field, T value)
+{
+    if (field.flags & METAFLAG_PROTO_VARINT)
+    {
+        m_writer.writeVarintField(getTag(field, ProtoWriter::WIRETYPE_VARINT), static_cast<std::uint64_t>(static_cast<std::int64_t>(value)));
+    }
+    else if (field.flags & METAFLAG_PROTO_ZIGZAG)
+    {
+        m_writer.writeZigZagField(getTag(field, ProtoWriter::WIRETYPE_VARINT), value);
+    }
+    else
+    {
+        m_writer.writeFixedField<F>(getTag(field, getWireTypeFixed(sizeof(F))), value);
+    }
+}
+
+template<class F, class T>
+void SerializerProtoSized::writeUnsigned(const MetaField& field, T value)
+{
+    if (field.flags & METAFLAG_PROTO_VARINT)
+    {
+        m_writer.writeVarintField(getTag(field, ProtoWriter::WIRETYPE_VARINT), value);
+    }
+    else
+    {
+        m_writer.writeFixedField<F>(getTag(field, getWireTypeFixed(sizeof(F))), value);
+    }
+}
+
+template<class F, class T>
+void SerializerProtoSized::writeArraySigned(const MetaField& field, const std::vector<T>& value)
+{
+    if (field.flags & METAFLAG_PROTO_VARINT)
+    {
+        m_writer.writeArrayVarint(getTag(field, ProtoWriter::WIRETYPE_VARINT), value);
+    }
+    else if (field.flags & METAFLAG_PROTO_ZIGZAG)
+    {
+        m_writer.writeArrayZigZag(getTag(field, ProtoWriter::WIRETYPE_VARINT), value);
+    }
+    else
+    {
+        m_writer.writeArrayFixed<F>(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), value);
+    }
+}
+
+template<class F, class T>
+void SerializerProtoSized::writeArrayUnsigned(const MetaField& field, const std::vector<T>& value)
+{
+    if (field.flags & METAFLAG_PROTO_VARINT)
+    {
+        m_writer.writeArrayVarint(getTag(field, ProtoWriter::WIRETYPE_VARINT), value);
+    }
+    else
+    {
+        m_writer.writeArrayFixed<F>(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), value);
+    }
+}
+
+void SerializerProtoSized::writeSubStruct(const MetaField& field, const StructBase& structBase, bool arrayEntry)
+{
+    m_writer.writeStructHeader(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), arrayEntry);
+    // also an empty struct is visited to keep the order of the sub struct sizes
+    writeStruct(structBase);
+}
+
+void SerializerProtoSized::writeStruct(const StructBase& structBase)
+{
+    const std::vector<FieldInfo>& fields = structBase.getStructInfo().getFields();
+    for (size_t i = 0; i < fields.size(); ++i)
+    {
+        writeField(structBase, fields[i]);
+    }
+}
+
+void SerializerProtoSized::writeField(const StructBase& structBase, const FieldInfo& fieldInfo)
+{
+    const MetaField* f = fieldInfo.getField();
+    assert(f);
+    const MetaField& field = *f;
+    switch (field.typeId)
+    {
+    case TYPE_BOOL:
+        m_writer.writeVarintField(getTag(field, ProtoWriter::WIRETYPE_VARINT), structBase.getValue<bool>(fieldInfo));
+        break;
+    case TYPE_INT8:
+        writeSigned<std::int32_t>(field, structBase.getValue<std::int8_t>(fieldInfo));
+        break;
+    case TYPE_UINT8:
+        writeUnsigned<std::uint32_t>(field, structBase.getValue<std::uint8_t>(fieldInfo));
+        break;
+    case TYPE_INT16:
+        writeSigned<std::int32_t>(field, structBase.getValue<std::int16_t>(fieldInfo));
+        break;
+    case TYPE_UINT16:
+        writeUnsigned<std::uint32_t>(field, structBase.getValue<std::uint16_t>(fieldInfo));
+        break;
+    case TYPE_INT32:
+        writeSigned<std::int32_t>(field, structBase.getValue<std::int32_t>(fieldInfo));
+        break;
+    case TYPE_UINT32:
+        writeUnsigned<std::uint32_t>(field, structBase.getValue<std::uint32_t>(fieldInfo));
+        break;
+    case TYPE_INT64:
+        writeSigned<std::int64_t>(field, structBase.getValue<std::int64_t>(fieldInfo));
+        break;
+    case TYPE_UINT64:
+        writeUnsigned<std::uint64_t>(field, structBase.getValue<std::uint64_t>(fieldInfo));
+        break;
+    case TYPE_FLOAT:
+        m_writer.writeFixedField(getTag(field, ProtoWriter::WIRETYPE_FIXED32), structBase.getValue<float>(fieldInfo));
+        break;
+    case TYPE_DOUBLE:
+        m_writer.writeFixedField(getTag(field, ProtoWriter::WIRETYPE_FIXED64), structBase.getValue<double>(fieldInfo));
+        break;
+    case TYPE_STRING:
+        if (field.flags & METAFLAG_ZEROCOPY)
+        {
+            const BytesView& value = structBase.getValue<BytesView>(fieldInfo);
+            m_writer.writeStringField(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), value.data(), value.size());
+        }
+        else
+        {
+            const std::string& value = structBase.getValue<std::string>(fieldInfo);
+            m_writer.writeStringField(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), value.data(), value.size());
+        }
+        break;
+    case TYPE_BYTES:
+        if (field.flags & METAFLAG_ZEROCOPY)
+        {
+            const BytesView& value = structBase.getValue<BytesView>(fieldInfo);
+            m_writer.writeStringField(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), value.data(), value.size());
+        }
+        else
+        {
+            const Bytes& value = structBase.getValue<Bytes>(fieldInfo);
+            m_writer.writeStringField(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), value.data(), value.size());
+        }
+        break;
+    case TYPE_STRUCT:
+        if (!(field.flags & METAFLAG_NULLABLE))
+        {
+            writeSubStruct(field, structBase.getValue<StructBase>(fieldInfo), false);
+        }
+        else
+        {
+            const StructBasePtr& value = structBase.getValue<StructBasePtr>(fieldInfo);
+            if (value)
+            {
+                writeSubStruct(field, *value, false);
+            }
+        }
+        break;
+    case TYPE_ENUM:
+        m_writer.writeVarintField(getTag(field, ProtoWriter::WIRETYPE_VARINT), static_cast<std::uint64_t>(static_cast<std::int64_t>(structBase.getValue<std::int32_t>(fieldInfo))));
+        break;
+    case TYPE_JSON:
+        {
+            assert(m_indexJson < m_jsonStrings.size());
+            const std::string& json = m_jsonStrings[m_indexJson];
+            ++m_indexJson;
+            m_writer.writeStringField(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), json.data(), json.size());
+        }
+        break;
+    case TYPE_ARRAY_BOOL:
+        m_writer.writeArrayBool(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), structBase.getValue<std::vector<bool>>(fieldInfo));
+        break;
+    case TYPE_ARRAY_INT8:
+        writeArraySigned<std::int32_t>(field, structBase.getValue<std::vector<std::int8_t>>(fieldInfo));
+        break;
+    case TYPE_ARRAY_INT16:
+        writeArraySigned<std::int32_t>(field, structBase.getValue<std::vector<std::int16_t>>(fieldInfo));
+        break;
+    case TYPE_ARRAY_UINT16:
+        writeArrayUnsigned<std::uint32_t>(field, structBase.getValue<std::vector<std::uint16_t>>(fieldInfo));
+        break;
+    case TYPE_ARRAY_INT32:
+        writeArraySigned<std::int32_t>(field, structBase.getValue<std::vector<std::int32_t>>(fieldInfo));
+        break;
+    case TYPE_ARRAY_UINT32:
+        writeArrayUnsigned<std::uint32_t>(field, structBase.getValue<std::vector<std::uint32_t>>(fieldInfo));
+        break;
+    case TYPE_ARRAY_INT64:
+        writeArraySigned<std::int64_t>(field, structBase.getValue<std::vector<std::int64_t>>(fieldInfo));
+        break;
+    case TYPE_ARRAY_UINT64:
+        writeArrayUnsigned<std::uint64_t>(field, structBase.getValue<std::vector<std::uint64_t>>(fieldInfo));
+        break;
+    case TYPE_ARRAY_FLOAT:
+        m_writer.writeArrayFixed<float>(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), structBase.getValue<std::vector<float>>(fieldInfo));
+        break;
+    case TYPE_ARRAY_DOUBLE:
+        m_writer.writeArrayFixed<double>(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), structBase.getValue<std::vector<double>>(fieldInfo));
+        break;
+    case TYPE_ARRAY_STRING:
+        m_writer.writeArrayString(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), structBase.getValue<std::vector<std::string>>(fieldInfo));
+        break;
+    case TYPE_ARRAY_BYTES:
+        m_writer.writeArrayString(getTag(field, ProtoWriter::WIRETYPE_LENGTH_DELIMITED), structBase.getValue<std::vector<Bytes>>(fieldInfo));
+        break;
+    case TYPE_ARRAY_STRUCT:
+        {
+            const char& array = structBase.getValue<char>(fieldInfo);
+            IArrayStructAdapter* arrayStructAdapter = fieldInfo.getArrayStructAdapter();
+            if (arrayStructAdapter)
+            {
+                const ssize_t count = arrayStructAdapter->size(array);
+                for (ssize_t i = 0; i < count; ++i)
+                {
+                    writeSubStruct(field, arrayStructAdapter->at(array, i), true);
+                }
+            }
+        }
+        break;
+    case TYPE_ARRAY_ENUM:
+        m_writer.writeArrayEnum(getTag(field, ProtoWriter::WIRETYPE_VARINT), structBase.getValue<std::vector<std::int32_t>>(fieldInfo));
+        break;
+    default:
+        assert(false);
+        break;
+    }
+}
+
+} // namespace finalmq
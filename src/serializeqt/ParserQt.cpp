@@ -23,14 +23,13 @@
 #include "finalmq/serializeqt/ParserQt.h"
 
 #include <algorithm>
-#include <codecvt>
 #include <iostream>
-#include <locale>
 
 #include <assert.h>
 #include <memory.h>
 
 #include "finalmq/helpers/FmqDefines.h"
+#include "finalmq/helpers/Utf16.h"
 #include "finalmq/metadata/MetaData.h"
 #include "finalmq/serializeqt/Qt.h"
 #include "finalmq/logger/LogStream.h"
@@ -921,8 +920,6 @@ bool ParserQt::parse(std::string& str, const MetaField* field)
 {
     str.clear();
 
-    std::u16string utf16;
-
     std::uint32_t sizeBytes;
     bool ok = field ? parseSize(*field, sizeBytes) : parse(sizeBytes);
     if (!ok)
@@ -937,16 +934,8 @@ bool ParserQt::parse(std::string& str, const MetaField* field)
     if (m_size >= static_cast<ssize_t>(sizeBytes))
     {
         std::uint32_t sizeChar = sizeBytes / 2;
-        utf16.resize(sizeChar);
-        for (std::uint32_t i = 0; i < sizeChar; ++i)
-        {
-            char16_t c = static_cast<char16_t>(static_cast<char16_t>(*m_ptr) << 8);
-            ++m_ptr;
-            c = static_cast<char16_t>(c | static_cast<char16_t>(*m_ptr));
-            ++m_ptr;
-            utf16[i] = c;
-        }
-        str = std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t>{}.to_bytes(utf16);
+        Utf16::utf16BeToUtf8(reinterpret_cast<const char*>(m_ptr), sizeChar, str);
+        m_ptr += sizeBytes;
         m_size -= sizeBytes;
         return true;
     }
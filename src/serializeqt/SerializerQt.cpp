@@ -23,12 +23,11 @@
 #include "finalmq/serializeqt/SerializerQt.h"
 
 #include <algorithm>
-#include <codecvt>
-#include <locale>
 
 #include <assert.h>
 
 #include "finalmq/helpers/ModulenameFinalmq.h"
+#include "finalmq/helpers/Utf16.h"
 #include "finalmq/helpers/Utils.h"
 #include "finalmq/helpers/ZeroCopyBuffer.h"
 #include "finalmq/logger/LogStream.h"
@@ -1070,26 +1069,34 @@ void SerializerQt::Internal::serialize(double value)
 
 void SerializerQt::Internal::serializeString(const std::string& value)
 {
-    std::u16string u16 = std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t>{}.from_bytes(value);
-    assert(u16.size() <= value.size());
-    serializeArray(reinterpret_cast<std::int16_t*>(const_cast<char16_t*>(u16.data())), u16.size(), true);
+    serializeString(value.data(), value.size());
 }
 
 void SerializerQt::Internal::serializeString(const char* value, ssize_t size)
 {
-    serializeString(std::string(value, value + size));
+    // the size is written after the conversion, when the number of code units is known
+    char* bufferSize = m_buffer;
+    m_buffer += sizeof(std::uint32_t);
+    const ssize_t count = Utf16::utf8ToUtf16Be(value, size, m_buffer, size);
+    assert(count <= size);
+    m_buffer = bufferSize;
+    serialize(static_cast<std::uint32_t>(2 * count));
+    m_buffer += 2 * count;
 }
 
 void SerializerQt::Internal::serializeStringFixed(const std::string& value, std::uint32_t sizeFixed)
 {
-    std::u16string u16 = std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t>{}.from_bytes(value);
-    assert(u16.size() <= value.size());
-    serializeArrayFixed(reinterpret_cast<std::int16_t*>(const_cast<char16_t*>(u16.data())), u16.size(), sizeFixed);
+    serializeStringFixed(value.data(), value.size(), sizeFixed);
 }
 
 void SerializerQt::Internal::serializeStringFixed(const char* value, ssize_t size, std::uint32_t sizeFixed)
 {
-    serializeStringFixed(std::string(value, value + size), sizeFixed);
+    const ssize_t count = Utf16::utf8ToUtf16Be(value, size, m_buffer, sizeFixed);
+    m_buffer += 2 * count;
+    for (std::uint32_t i = static_cast<std::uint32_t>(count); i < sizeFixed; ++i)
+    {
+        serialize(std::int16_t{});
+    }
 }
 
 template<class T>
@@ -93,12 +93,24 @@ void ParserStruct::processField(const StructBase& structBase, const FieldInfo& f
         m_visitor.enterDouble(field, structBase.getValue<double>(fieldInfo));
         break;
     case TYPE_STRING:
+        if (StructBase::isZeroCopyField(field))
+        {
+            const BytesView& value = structBase.getValue<BytesView>(fieldInfo);
+            m_visitor.enterString(field, value.data(), value.size());
+        }
+        else
         {
             const std::string& value = structBase.getValue<std::string>(fieldInfo);
             m_visitor.enterString(field, value.data(), value.size());
         }
         break;
     case TYPE_BYTES:
+        if (StructBase::isZeroCopyField(field))
+        {
+            const BytesView& value = structBase.getValue<BytesView>(fieldInfo);
+            m_visitor.enterBytes(field, value.data(), value.size());
+        }
+        else
         {
             const Bytes& value = structBase.getValue<Bytes>(fieldInfo);
             m_visitor.enterBytes(field, value.data(), value.size());
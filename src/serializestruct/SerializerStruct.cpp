@@ -26,6 +26,7 @@
 
 #include <assert.h>
 
+#include "finalmq/conversions/NumberParser.h"
 #include "finalmq/helpers/ModulenameFinalmq.h"
 #include "finalmq/logger/LogStream.h"
 #include "finalmq/metadata/MetaData.h"
@@ -53,6 +54,11 @@ void SerializerStruct::setExitNotification(std::function<void()> funcExit)
     m_funcExit = std::move(funcExit);
 }
 
+void SerializerStruct::setZeroCopyBuffer(const std::shared_ptr<const std::string>& buffer)
+{
+    m_zeroCopyBuffer = buffer;
+}
+
 // IParserVisitor
 void SerializerStruct::notifyError(const char* /*str*/, const char* /*message*/)
 {
@@ -236,6 +242,10 @@ void SerializerStruct::setValue(StructBase& structBase, const FieldInfo& fieldIn
     {
         *pval = value;
     }
+    else
+    {
+        setValueView(structBase, fieldInfoDest, value);
+    }
 }
 
 template<class T>
@@ -246,6 +256,37 @@ void SerializerStruct::setValue(StructBase& structBase, const FieldInfo& fieldIn
     {
         *pval = std::move(value);
     }
+    else
+    {
+        setValueView(structBase, fieldInfoDest, value);
+    }
+}
+
+void SerializerStruct::setValueView(StructBase& structBase, const FieldInfo& fieldInfoDest, const char* value, ssize_t size)
+{
+    BytesView* view = structBase.getDataView(fieldInfoDest);
+    if (view)
+    {
+        if (m_zeroCopyBuffer && size > 0 &&
+            value >= m_zeroCopyBuffer->data() && value + size <= m_zeroCopyBuffer->data() + m_zeroCopyBuffer->size())
+        {
+            *view = BytesView(m_zeroCopyBuffer, value, size);
+        }
+        else
+        {
+            *view = BytesView(value, size);
+        }
+    }
+}
+
+void SerializerStruct::setValueView(StructBase& structBase, const FieldInfo& fieldInfoDest, const std::string& value)
+{
+    setValueView(structBase, fieldInfoDest, value.data(), value.size());
+}
+
+void SerializerStruct::setValueView(StructBase& structBase, const FieldInfo& fieldInfoDest, const Bytes& value)
+{
+    setValueView(structBase, fieldInfoDest, value.data(), value.size());
 }
 
 const FieldInfo* SerializerStruct::getFieldInfoDest(const MetaField& field)
@@ -439,61 +480,61 @@ void SerializerStruct::convertString(StructBase& structBase, const FieldInfo& fi
         break;
         case MetaTypeId::TYPE_INT8:
         {
-            std::int8_t v = static_cast<std::int8_t>(strtol(str.c_str(), nullptr, 10));
+            std::int8_t v = NumberParser::toNumber<std::int8_t>(value, value + size);
             setValue<std::int8_t>(structBase, fieldInfoDest, v);
         }
         break;
         case MetaTypeId::TYPE_UINT8:
         {
-            std::uint8_t v = static_cast<std::uint8_t>(strtoul(str.c_str(), nullptr, 10));
+            std::uint8_t v = NumberParser::toNumber<std::uint8_t>(value, value + size);
             setValue<std::uint8_t>(structBase, fieldInfoDest, v);
         }
         break;
         case MetaTypeId::TYPE_INT16:
         {
-            std::int16_t v = static_cast<std::int16_t>(strtol(str.c_str(), nullptr, 10));
+            std::int16_t v = NumberParser::toNumber<std::int16_t>(value, value + size);
             setValue<std::int16_t>(structBase, fieldInfoDest, v);
         }
         break;
         case MetaTypeId::TYPE_UINT16:
         {
-            std::uint16_t v = static_cast<std::uint16_t>(strtoul(str.c_str(), nullptr, 10));
+            std::uint16_t v = NumberParser::toNumber<std::uint16_t>(value, value + size);
             setValue<std::uint16_t>(structBase, fieldInfoDest, v);
         }
         break;
         case MetaTypeId::TYPE_INT32:
         {
-            std::int32_t v = static_cast<std::int32_t>(strtol(str.c_str(), nullptr, 10));
+            std::int32_t v = NumberParser::toNumber<std::int32_t>(value, value + size);
             setValue<std::int32_t>(structBase, fieldInfoDest, v);
         }
         break;
         case MetaTypeId::TYPE_UINT32:
         {
-            std::uint32_t v = static_cast<std::uint32_t>(strtoul(str.c_str(), nullptr, 10));
+            std::uint32_t v = NumberParser::toNumber<std::uint32_t>(value, value + size);
             setValue<std::uint32_t>(structBase, fieldInfoDest, v);
         }
         break;
         case MetaTypeId::TYPE_INT64:
         {
-            std::int64_t v = strtoll(str.c_str(), nullptr, 10);
+            std::int64_t v = NumberParser::toNumber<std::int64_t>(value, value + size);
             setValue<std::int64_t>(structBase, fieldInfoDest, v);
         }
         break;
         case MetaTypeId::TYPE_UINT64:
         {
-            std::uint64_t v = strtoull(str.c_str(), nullptr, 10);
+            std::uint64_t v = NumberParser::toNumber<std::uint64_t>(value, value + size);
             setValue<std::uint64_t>(structBase, fieldInfoDest, v);
         }
         break;
         case MetaTypeId::TYPE_FLOAT:
         {
-            float v = strtof32(str.c_str(), nullptr);
+            float v = NumberParser::toNumber<float>(value, value + size);
             setValue<float>(structBase, fieldInfoDest, v);
         }
         break;
         case MetaTypeId::TYPE_DOUBLE:
         {
-            double v = strtof64(str.c_str(), nullptr);
+            double v = NumberParser::toNumber<double>(value, value + size);
             setValue<double>(structBase, fieldInfoDest, v);
         }
         break;
@@ -520,55 +561,55 @@ void SerializerStruct::convertString(StructBase& structBase, const FieldInfo& fi
         break;
         case MetaTypeId::TYPE_ARRAY_INT8:
         {
-            std::int8_t v = static_cast<std::int8_t>(strtol(str.c_str(), nullptr, 10));
+            std::int8_t v = NumberParser::toNumber<std::int8_t>(value, value + size);
             setValue<std::vector<std::int8_t>>(structBase, fieldInfoDest, {v});
         }
         break;
         case MetaTypeId::TYPE_ARRAY_INT16:
         {
-            std::int16_t v = static_cast<std::int16_t>(strtol(str.c_str(), nullptr, 10));
+            std::int16_t v = NumberParser::toNumber<std::int16_t>(value, value + size);
             setValue<std::vector<std::int16_t>>(structBase, fieldInfoDest, {v});
         }
         break;
         case MetaTypeId::TYPE_ARRAY_UINT16:
         {
-            std::uint16_t v = static_cast<std::uint16_t>(strtoul(str.c_str(), nullptr, 10));
+            std::uint16_t v = NumberParser::toNumber<std::uint16_t>(value, value + size);
             setValue<std::vector<std::uint16_t>>(structBase, fieldInfoDest, {v});
         }
         break;
         case MetaTypeId::TYPE_ARRAY_INT32:
         {
-            std::int32_t v = static_cast<std::int32_t>(strtol(str.c_str(), nullptr, 10));
+            std::int32_t v = NumberParser::toNumber<std::int32_t>(value, value + size);
             setValue<std::vector<std::int32_t>>(structBase, fieldInfoDest, {v});
         }
         break;
         case MetaTypeId::TYPE_ARRAY_UINT32:
         {
-            std::uint32_t v = static_cast<std::uint32_t>(strtoul(str.c_str(), nullptr, 10));
+            std::uint32_t v = NumberParser::toNumber<std::uint32_t>(value, value + size);
             setValue<std::vector<std::uint32_t>>(structBase, fieldInfoDest, {v});
         }
         break;
         case MetaTypeId::TYPE_ARRAY_INT64:
         {
-            std::int64_t v = strtoll(str.c_str(), nullptr, 10);
+            std::int64_t v = NumberParser::toNumber<std::int64_t>(value, value + size);
             setValue<std::vector<std::int64_t>>(structBase, fieldInfoDest, {v});
         }
         break;
         case MetaTypeId::TYPE_ARRAY_UINT64:
         {
-            std::uint64_t v = strtoull(str.c_str(), nullptr, 10);
+            std::uint64_t v = NumberParser::toNumber<std::uint64_t>(value, value + size);
             setValue<std::vector<std::uint64_t>>(structBase, fieldInfoDest, {v});
         }
         break;
         case MetaTypeId::TYPE_ARRAY_FLOAT:
         {
-            float v = strtof32(str.c_str(), nullptr);
+            float v = NumberParser::toNumber<float>(value, value + size);
             setValue<std::vector<float>>(structBase, fieldInfoDest, {v});
         }
         break;
         case MetaTypeId::TYPE_ARRAY_DOUBLE:
         {
-            double v = strtof64(str.c_str(), nullptr);
+            double v = NumberParser::toNumber<double>(value, value + size);
             setValue<std::vector<double>>(structBase, fieldInfoDest, {v});
         }
         break;
@@ -869,61 +910,61 @@ void SerializerStruct::convertArrayString(StructBase& structBase, const FieldInf
         case MetaTypeId::TYPE_INT8:
             if (size >= 1)
             {
-                setValue<std::int8_t>(structBase, fieldInfoDest, static_cast<std::int8_t>(strtol(value[0].c_str(), nullptr, 10)));
+                setValue<std::int8_t>(structBase, fieldInfoDest, NumberParser::toNumber<std::int8_t>(value[0].data(), value[0].data() + value[0].size()));
             }
             break;
         case MetaTypeId::TYPE_UINT8:
             if (size >= 1)
             {
-                setValue<std::uint8_t>(structBase, fieldInfoDest, static_cast<std::uint8_t>(strtoul(value[0].c_str(), nullptr, 10)));
+                setValue<std::uint8_t>(structBase, fieldInfoDest, NumberParser::toNumber<std::uint8_t>(value[0].data(), value[0].data() + value[0].size()));
             }
             break;
         case MetaTypeId::TYPE_INT16:
             if (size >= 1)
             {
-                setValue<std::int16_t>(structBase, fieldInfoDest, static_cast<std::int16_t>(strtol(value[0].c_str(), nullptr, 10)));
+                setValue<std::int16_t>(structBase, fieldInfoDest, NumberParser::toNumber<std::int16_t>(value[0].data(), value[0].data() + value[0].size()));
             }
             break;
         case MetaTypeId::TYPE_UINT16:
             if (size >= 1)
             {
-                setValue<std::uint16_t>(structBase, fieldInfoDest, static_cast<std::uint16_t>(strtoul(value[0].c_str(), nullptr, 10)));
+                setValue<std::uint16_t>(structBase, fieldInfoDest, NumberParser::toNumber<std::uint16_t>(value[0].data(), value[0].data() + value[0].size()));
             }
             break;
         case MetaTypeId::TYPE_INT32:
             if (size >= 1)
             {
-                setValue<std::int32_t>(structBase, fieldInfoDest, static_cast<std::int32_t>(strtol(value[0].c_str(), nullptr, 10)));
+                setValue<std::int32_t>(structBase, fieldInfoDest, NumberParser::toNumber<std::int32_t>(value[0].data(), value[0].data() + value[0].size()));
             }
             break;
         case MetaTypeId::TYPE_UINT32:
             if (size >= 1)
             {
-                setValue<std::uint32_t>(structBase, fieldInfoDest, static_cast<std::uint32_t>(strtoul(value[0].c_str(), nullptr, 10)));
+                setValue<std::uint32_t>(structBase, fieldInfoDest, NumberParser::toNumber<std::uint32_t>(value[0].data(), value[0].data() + value[0].size()));
             }
             break;
         case MetaTypeId::TYPE_INT64:
             if (size >= 1)
             {
-                setValue<std::int64_t>(structBase, fieldInfoDest, static_cast<std::int64_t>(strtoll(value[0].c_str(), nullptr, 10)));
+                setValue<std::int64_t>(structBase, fieldInfoDest, NumberParser::toNumber<std::int64_t>(value[0].data(), value[0].data() + value[0].size()));
             }
             break;
         case MetaTypeId::TYPE_UINT64:
             if (size >= 1)
             {
-                setValue<std::uint64_t>(structBase, fieldInfoDest, static_cast<std::uint64_t>(strtoull(value[0].c_str(), nullptr, 10)));
+                setValue<std::uint64_t>(structBase, fieldInfoDest, NumberParser::toNumber<std::uint64_t>(value[0].data(), value[0].data() + value[0].size()));
             }
             break;
         case MetaTypeId::TYPE_FLOAT:
             if (size >= 1)
             {
-                setValue<float>(structBase, fieldInfoDest, strtof32(value[0].c_str(), nullptr));
+                setValue<float>(structBase, fieldInfoDest, NumberParser::toNumber<float>(value[0].data(), value[0].data() + value[0].size()));
             }
             break;
         case MetaTypeId::TYPE_DOUBLE:
             if (size >= 1)
             {
-                setValue<double>(structBase, fieldInfoDest, strtof64(value[0].c_str(), nullptr));
+                setValue<double>(structBase, fieldInfoDest, NumberParser::toNumber<double>(value[0].data(), value[0].data() + value[0].size()));
             }
             break;
         case MetaTypeId::TYPE_STRING:
@@ -966,7 +1007,7 @@ void SerializerStruct::convertArrayString(StructBase& structBase, const FieldInf
             std::vector<std::int8_t> v;
             v.reserve(size);
             std::for_each(value.begin(), value.end(), [&v](const std::string& entry) {
-                v.push_back(static_cast<std::int8_t>(strtol(entry.c_str(), nullptr, 10)));
+                v.push_back(NumberParser::toNumber<std::int8_t>(entry.data(), entry.data() + entry.size()));
             });
             setValue<std::vector<std::int8_t>>(structBase, fieldInfoDest, std::move(v));
         }
@@ -976,7 +1017,7 @@ void SerializerStruct::convertArrayString(StructBase& structBase, const FieldInf
             std::vector<std::int16_t> v;
             v.reserve(size);
             std::for_each(value.begin(), value.end(), [&v](const std::string& entry) {
-                v.push_back(static_cast<std::int16_t>(strtol(entry.c_str(), nullptr, 10)));
+                v.push_back(NumberParser::toNumber<std::int16_t>(entry.data(), entry.data() + entry.size()));
             });
             setValue<std::vector<std::int16_t>>(structBase, fieldInfoDest, std::move(v));
         }
@@ -986,7 +1027,7 @@ void SerializerStruct::convertArrayString(StructBase& structBase, const FieldInf
             std::vector<std::uint16_t> v;
             v.reserve(size);
             std::for_each(value.begin(), value.end(), [&v](const std::string& entry) {
-                v.push_back(static_cast<std::uint16_t>(strtoul(entry.c_str(), nullptr, 10)));
+                v.push_back(NumberParser::toNumber<std::uint16_t>(entry.data(), entry.data() + entry.size()));
             });
             setValue<std::vector<std::uint16_t>>(structBase, fieldInfoDest, std::move(v));
         }
@@ -996,7 +1037,7 @@ void SerializerStruct::convertArrayString(StructBase& structBase, const FieldInf
             std::vector<std::int32_t> v;
             v.reserve(size);
             std::for_each(value.begin(), value.end(), [&v](const std::string& entry) {
-                v.push_back(static_cast<std::int32_t>(strtol(entry.c_str(), nullptr, 10)));
+                v.push_back(NumberParser::toNumber<std::int32_t>(entry.data(), entry.data() + entry.size()));
             });
             setValue<std::vector<std::int32_t>>(structBase, fieldInfoDest, std::move(v));
         }
@@ -1006,7 +1047,7 @@ void SerializerStruct::convertArrayString(StructBase& structBase, const FieldInf
             std::vector<std::uint32_t> v;
             v.reserve(size);
             std::for_each(value.begin(), value.end(), [&v](const std::string& entry) {
-                v.push_back(static_cast<std::uint32_t>(strtoul(entry.c_str(), nullptr, 10)));
+                v.push_back(NumberParser::toNumber<std::uint32_t>(entry.data(), entry.data() + entry.size()));
             });
             setValue<std::vector<std::uint32_t>>(structBase, fieldInfoDest, std::move(v));
         }
@@ -1016,7 +1057,7 @@ void SerializerStruct::convertArrayString(StructBase& structBase, const FieldInf
             std::vector<std::int64_t> v;
             v.reserve(size);
             std::for_each(value.begin(), value.end(), [&v](const std::string& entry) {
-                v.push_back(strtoll(entry.c_str(), nullptr, 10));
+                v.push_back(NumberParser::toNumber<std::int64_t>(entry.data(), entry.data() + entry.size()));
             });
             setValue<std::vector<std::int64_t>>(structBase, fieldInfoDest, std::move(v));
         }
@@ -1026,7 +1067,7 @@ void SerializerStruct::convertArrayString(StructBase& structBase, const FieldInf
             std::vector<std::uint64_t> v;
             v.reserve(size);
             std::for_each(value.begin(), value.end(), [&v](const std::string& entry) {
-                v.push_back(strtoull(entry.c_str(), nullptr, 10));
+                v.push_back(NumberParser::toNumber<std::uint64_t>(entry.data(), entry.data() + entry.size()));
             });
             setValue<std::vector<std::uint64_t>>(structBase, fieldInfoDest, std::move(v));
         }
@@ -1036,7 +1077,7 @@ void SerializerStruct::convertArrayString(StructBase& structBase, const FieldInf
             std::vector<float> v;
             v.reserve(size);
             std::for_each(value.begin(), value.end(), [&v](const std::string& entry) {
-                v.push_back(strtof32(entry.c_str(), nullptr));
+                v.push_back(NumberParser::toNumber<float>(entry.data(), entry.data() + entry.size()));
             });
             setValue<std::vector<float>>(structBase, fieldInfoDest, std::move(v));
         }
@@ -1046,7 +1087,7 @@ void SerializerStruct::convertArrayString(StructBase& structBase, const FieldInf
             std::vector<double> v;
             v.reserve(size);
             std::for_each(value.begin(), value.end(), [&v](const std::string& entry) {
-                v.push_back(strtof64(entry.c_str(), nullptr));
+                v.push_back(NumberParser::toNumber<double>(entry.data(), entry.data() + entry.size()));
             });
             setValue<std::vector<double>>(structBase, fieldInfoDest, std::move(v));
         }
@@ -1130,7 +1171,11 @@ void SerializerStruct::setValueString(const MetaField& field, const char* value,
         return;
     }
 
-    if (fieldDest->typeId == MetaTypeId::TYPE_STRING)
+    if (StructBase::isZeroCopyField(*fieldDest))
+    {
+        setValueView(*structBase, *fieldInfoDest, value, size);
+    }
+    else if (fieldDest->typeId == MetaTypeId::TYPE_STRING)
     {
         setValue<std::string>(*structBase, *fieldInfoDest, std::string(value, size));
     }
@@ -1478,7 +1523,11 @@ void SerializerStruct::enterBytes(const MetaField& field, const BytesElement* va
         return;
     }
 
-    if (fieldDest->typeId == MetaTypeId::TYPE_BYTES)
+    if (StructBase::isZeroCopyField(*fieldDest))
+    {
+        setValueView(*structBase, *fieldInfoDest, value, size);
+    }
+    else if (fieldDest->typeId == MetaTypeId::TYPE_BYTES)
     {
         if (size > 0)
         {
@@ -26,6 +26,8 @@
 #include <errno.h>
 #include <string.h>
 
+#include <algorithm>
+
 #include "finalmq/helpers/ModulenameFinalmq.h"
 #include "finalmq/helpers/OperatingSystem.h"
 #include "finalmq/logger/LogStream.h"
@@ -272,12 +274,71 @@ int Socket::send(const char* buf, int len, int flags)
     return err;
 }
 
+int Socket::sendVector(const BufferRef* buffers, int count, int flags)
+{
+    assert(m_sd);
+#if !defined(WIN32) && !defined(__MINGW32__)
+    if (!m_sslContext)
+    {
+        m_ioVecs.resize(count);
+        for (int i = 0; i < count; ++i)
+        {
+            m_ioVecs[i].iov_base = buffers[i].first;
+            m_ioVecs[i].iov_len = static_cast<size_t>(buffers[i].second);
+        }
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = m_ioVecs.data();
+        msg.msg_iovlen = count;
+        int err = 0;
+        do
+        {
+            err = OperatingSystem::instance().sendmsg(m_sd->getDescriptor(), &msg, flags);
+        } while (err == -1 && getLastError() == SOCKETERROR(EINTR));
+        return handleError(err, "sendmsg");
+    }
+#endif
+
+    int lenWritten = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        const BufferRef& buffer = buffers[i];
+        int err = send(buffer.first, static_cast<int>(buffer.second), flags);
+        if (err < 0)
+        {
+            return (lenWritten > 0) ? lenWritten : err;
+        }
+        lenWritten += err;
+        if (err != buffer.second)
+        {
+            break;
+        }
+    }
+    return lenWritten;
+}
+
 int Socket::receive(char* buf, int len, int flags)
 {
     assert(m_sd);
     int err = 0;
     int lenReceived = 0;
     bool ex = false;
+    if (m_prefetchBegin < m_prefetchEnd)
+    {
+        int size = std::min(len, m_prefetchEnd - m_prefetchBegin);
+        memcpy(buf, m_prefetchBuffer.get() + m_prefetchBegin, size);
+        m_prefetchBegin += size;
+        if (m_prefetchBegin == m_prefetchEnd)
+        {
+            m_prefetchBegin = 0;
+            m_prefetchEnd = 0;
+        }
+        buf += size;
+        len -= size;
+        lenReceived += size;
+        ex = (len == 0);
+    }
+    const int lenReceivedPrefetched = lenReceived;
     while (!ex)
     {
 #ifdef USE_OPENSSL
@@ -324,6 +385,8 @@ int Socket::receive(char* buf, int len, int flags)
             ex = true;
         }
     }
+    // the bytes that were read straight from the socket
+    m_pendingAfterPrefetch = std::max(m_pendingAfterPrefetch - (lenReceived - lenReceivedPrefetched), 0);
     err = handleError(err, "read");
     if (err == 0)
     {
@@ -332,6 +395,63 @@ int Socket::receive(char* buf, int len, int flags)
     return err;
 }
 
+int Socket::prefetch()
+{
+    assert(m_sd);
+    if (!m_prefetchBuffer)
+    {
+        m_prefetchBuffer = std::make_unique<char[]>(PREFETCH_SIZE);
+    }
+    // the buffer does not grow, the bytes that were not received yet are moved to the front
+    if (m_prefetchBegin > 0)
+    {
+        memmove(m_prefetchBuffer.get(), m_prefetchBuffer.get() + m_prefetchBegin, m_prefetchEnd - m_prefetchBegin);
+        m_prefetchEnd -= m_prefetchBegin;
+        m_prefetchBegin = 0;
+    }
+    m_pendingAfterPrefetch = 0;
+    const int len = PREFETCH_SIZE - m_prefetchEnd;
+    if (len == 0)
+    {
+        return m_prefetchEnd;
+    }
+    int err = 0;
+    do
+    {
+        err = OperatingSystem::instance().recv(m_sd->getDescriptor(), m_prefetchBuffer.get() + m_prefetchEnd, len, 0);
+    } while (err == -1 && getLastError() == SOCKETERROR(EINTR));
+
+    if (err > 0)
+    {
+        m_prefetchEnd += err;
+        if (err == len)
+        {
+            // there is probably more data, the receive calls read it straight into the buffer of the caller
+            m_pendingAfterPrefetch = pendingRead();
+        }
+        err = getPrefetched();
+    }
+    else if (err == 0)
+    {
+        // peer closed the connection
+        err = -1;
+    }
+    else if (getLastError() == SOCKETERROR(EWOULDBLOCK))
+    {
+        err = 0;
+    }
+    else
+    {
+        streamError << "read failed with error " << getLastError();
+    }
+    return err;
+}
+
+int Socket::getPrefetched() const
+{
+    return m_prefetchEnd - m_prefetchBegin + m_pendingAfterPrefetch;
+}
+
 void Socket::destroy()
 {
     if (m_sd)
@@ -38,6 +38,9 @@ StreamConnection::~StreamConnection()
 {
 }
 
+// maximum number of buffers that are passed to one gather write (sendmsg)
+static const int MAX_SEND_VECTOR = 64;
+
 // IStreamConnection
 void StreamConnection::sendMessage(const IMessagePtr& msg)
 {
@@ -58,47 +61,84 @@ void StreamConnection::sendMessage(const IMessagePtr& msg)
             }
             else
             {
-#if 0
-                m_pendingMessages.push_back({msg, payloads.begin(), 0});
-                m_poller->enableWrite(m_socketPrivate->getSocketDescriptor());
-#else
-                bool ex = false;
-                for (auto it = payloads.begin(); it != payloads.end() && !ex; )
+                MessageSendState messageSendState{msg, payloads.begin(), 0};
+                m_sendVector.clear();
+                m_sendVectorSize = 0;
+                addSendVector(messageSendState);
+                ssize_t bytesWritten = sendVector();
+                if (!advanceSendState(messageSendState, bytesWritten))
                 {
-                    const BufferRef& payload = *it;
-                    ++it;
-
-#ifdef __QNX__
-                    int flags = 0;
-#else
-                    bool last = (it == payloads.end());
-                    int flags = last ? 0 : MSG_MORE; // win32: MSG_PARTIAL
-#endif
-
-#if !defined WIN32
-                    flags |= MSG_NOSIGNAL; // no sigpipe
-#endif
-                    int err = m_socketPrivate->send(payload.first, static_cast<int>(payload.second), flags);
-                    if (err != payload.second)
-                    {
-                        if (err < 0)
-                        {
-                            err = 0;
-                        }
-                        assert(err < payload.second);
-                        --it;
-                        m_pendingMessages.push_back({msg, it, err});
-                        m_poller->enableWrite(m_socketPrivate->getSocketDescriptor());
-                        ex = true;
-                    }
+                    m_pendingMessages.push_back(std::move(messageSendState));
+                    m_poller->enableWrite(m_socketPrivate->getSocketDescriptor());
                 }
-#endif
             }
         }
     }
     lock.unlock();
 }
 
+bool StreamConnection::addSendVector(const MessageSendState& messageSendState)
+{
+    assert(messageSendState.msg);
+    const auto& payloads = messageSendState.msg->getAllSendBuffers();
+    int offset = messageSendState.offset;
+    for (auto it = messageSendState.it; it != payloads.end(); ++it)
+    {
+        const BufferRef& payload = *it;
+        ssize_t size = payload.second - offset;
+        assert((payload.second == 0 && size == 0) || (size > 0));
+        if (size > 0)
+        {
+            if (static_cast<int>(m_sendVector.size()) >= MAX_SEND_VECTOR)
+            {
+                return false;
+            }
+            m_sendVector.emplace_back(payload.first + offset, size);
+            m_sendVectorSize += size;
+        }
+        offset = 0;
+    }
+    return true;
+}
+
+bool StreamConnection::advanceSendState(MessageSendState& messageSendState, ssize_t& bytesWritten)
+{
+    assert(messageSendState.msg);
+    const auto& payloads = messageSendState.msg->getAllSendBuffers();
+    while (messageSendState.it != payloads.end())
+    {
+        ssize_t size = messageSendState.it->second - messageSendState.offset;
+        if (size > bytesWritten)
+        {
+            messageSendState.offset += static_cast<int>(bytesWritten);
+            bytesWritten = 0;
+            return false;
+        }
+        bytesWritten -= size;
+        ++messageSendState.it;
+        messageSendState.offset = 0;
+    }
+    return true;
+}
+
+int StreamConnection::sendVector()
+{
+    if (m_sendVector.empty())
+    {
+        return 0;
+    }
+    int flags = 0;
+#if !defined WIN32
+    flags |= MSG_NOSIGNAL; // no sigpipe
+#endif
+    int err = m_socketPrivate->sendVector(m_sendVector.data(), static_cast<int>(m_sendVector.size()), flags);
+    if (err < 0)
+    {
+        err = 0;
+    }
+    return err;
+}
+
 ConnectionData StreamConnection::getConnectionData() const
 {
     std::unique_lock<std::mutex> lock(m_mutex);
@@ -164,43 +204,22 @@ bool StreamConnection::sendPendingMessages()
         {
             while (!m_pendingMessages.empty() && !pending)
             {
-                MessageSendState& messageSendState = m_pendingMessages.front();
-                IMessagePtr& msg = messageSendState.msg;
-                assert(msg);
-                const auto& payloads = msg->getAllSendBuffers();
-                for (auto it = messageSendState.it; it != payloads.end() && !pending;)
+                // collect the buffers of as many pending messages as possible for one gather write
+                m_sendVector.clear();
+                m_sendVectorSize = 0;
+                for (auto it = m_pendingMessages.begin(); it != m_pendingMessages.end(); ++it)
                 {
-                    const BufferRef& payload = *it;
-                    ++it;
-#ifdef __QNX__
-                    int flags = 0;
-#else
-                    bool last = ((it == payloads.end()) && (m_pendingMessages.size() == 1));
-                    int flags = last ? 0 : MSG_MORE; // win32: MSG_PARTIAL
-#endif
-#if !defined WIN32
-                    flags |= MSG_NOSIGNAL; // no sigpipe
-#endif
-                    ssize_t size = payload.second - messageSendState.offset;
-                    assert((payload.second == 0 && size == 0) || (size > 0));
-                    int err = m_socketPrivate->send(payload.first + messageSendState.offset, static_cast<int>(size), flags);
-                    if (err == size)
+                    if (!addSendVector(*it))
                     {
-                        messageSendState.it = it;
-                        messageSendState.offset = 0;
-                    }
-                    else if (err > 0)
-                    {
-                        messageSendState.offset += err;
-                        assert(messageSendState.offset < payload.second);
-                        pending = true;
-                    }
-                    else
-                    {
-                        pending = true;
+                        break;
                     }
                 }
-                if (!pending)
+                ssize_t bytesWritten = sendVector();
+                if (bytesWritten < m_sendVectorSize)
+                {
+                    pending = true;
+                }
+                while (!m_pendingMessages.empty() && advanceSendState(m_pendingMessages.front(), bytesWritten))
                 {
                     m_pendingMessages.pop_front();
                 }
@@ -34,6 +34,9 @@
 #else
 #include "finalmq/poller/PollerImplEpoll.h"
 #endif
+#if defined(USE_IO_URING)
+#include "finalmq/poller/PollerImplIoUring.h"
+#endif
 
 #if !defined(WIN32) && !defined(__MINGW32__)
 #include <fcntl.h>
@@ -54,17 +57,10 @@ namespace finalmq
 std::atomic_int64_t StreamConnectionContainer::m_nextConnectionId{1};
 
 StreamConnectionContainer::StreamConnectionContainer()
-#if defined(WIN32) || defined(__MINGW32__) || defined(__QNX__)
-    : m_poller(std::make_shared<PollerImplSelect>())
-#else
-    : m_poller(std::make_shared<PollerImplEpoll>())
-#endif
-      ,
-      m_executorPollerThread(std::make_shared<Executor>()), m_executorWorker(std::make_unique<ExecutorWorker<ExecutorIgnoreOrderOfInstance>>(1))
+    : m_executorWorker(std::make_unique<ExecutorWorker<ExecutorIgnoreOrderOfInstance>>(1))
 {
-    m_executorPollerThread->registerActionNotification([this]() {
-        m_poller->releaseWait(RELEASE_EXECUTEINPOLLERTHREAD);
-    });
+    // the first poller loop is created immediately, because its executor is available before init() is called.
+    m_pollerLoops.push_back(createPollerLoop());
 }
 
 StreamConnectionContainer::~StreamConnectionContainer()
@@ -75,6 +71,68 @@ StreamConnectionContainer::~StreamConnectionContainer()
     {
         m_threadTimer.join();
     }
+    for (auto& pollerLoop : m_pollerLoops)
+    {
+        if (pollerLoop->thread.joinable())
+        {
+            pollerLoop->thread.join();
+        }
+    }
+}
+
+std::unique_ptr<StreamConnectionContainer::PollerLoop> StreamConnectionContainer::createPollerLoop()
+{
+    std::unique_ptr<PollerLoop> pollerLoop = std::make_unique<PollerLoop>();
+#if defined(WIN32) || defined(__MINGW32__) || defined(__QNX__)
+    pollerLoop->poller = std::make_shared<PollerImplSelect>();
+#else
+#if defined(USE_IO_URING)
+    if (PollerImplIoUring::isAvailable())
+    {
+        pollerLoop->poller = std::make_shared<PollerImplIoUring>();
+    }
+    else
+#endif
+    {
+        // fallback, if the kernel does not support io_uring
+        pollerLoop->poller = std::make_shared<PollerImplEpoll>();
+    }
+#endif
+    pollerLoop->executorPollerThread = std::make_shared<Executor>();
+    IPoller* poller = pollerLoop->poller.get();
+    pollerLoop->executorPollerThread->registerActionNotification([poller]() {
+        poller->releaseWait(RELEASE_EXECUTEINPOLLERTHREAD);
+    });
+    return pollerLoop;
+}
+
+StreamConnectionContainer::PollerLoop& StreamConnectionContainer::getLeastLoadedPollerLoop()
+{
+    // mutex already locked
+    assert(!m_pollerLoops.empty());
+    // round robin over the poller loops with the least number of connections
+    size_t ixBest = m_nextPollerLoop % m_pollerLoops.size();
+    for (size_t i = 1; i < m_pollerLoops.size(); ++i)
+    {
+        size_t ix = (m_nextPollerLoop + i) % m_pollerLoops.size();
+        if (m_pollerLoops[ix]->numberOfConnections < m_pollerLoops[ixBest]->numberOfConnections)
+        {
+            ixBest = ix;
+        }
+    }
+    m_nextPollerLoop = ixBest + 1;
+    return *m_pollerLoops[ixBest];
+}
+
+StreamConnectionContainer::PollerLoop* StreamConnectionContainer::findPollerLoop(std::int64_t connectionId) const
+{
+    // mutex already locked
+    auto it = m_connectionId2PollerLoop.find(connectionId);
+    if (it != m_connectionId2PollerLoop.end())
+    {
+        return it->second;
+    }
+    return nullptr;
 }
 
 std::unordered_map<SOCKET, StreamConnectionContainer::BindData>::iterator StreamConnectionContainer::findBindByEndpoint(const std::string& endpoint)
@@ -90,12 +148,12 @@ std::unordered_map<SOCKET, StreamConnectionContainer::BindData>::iterator Stream
     return m_sd2binds.end();
 }
 
-IStreamConnectionPrivatePtr StreamConnectionContainer::findConnectionBySdOnlyForPollerLoop(SOCKET sd)
+IStreamConnectionPrivatePtr StreamConnectionContainer::findConnectionBySdOnlyForPollerLoop(PollerLoop& pollerLoop, SOCKET sd)
 {
-    // m_sd2ConnectionPollerLoop is only used at poller loop thread
+    // sd2ConnectionPollerLoop is only used at poller loop thread
     IStreamConnectionPrivatePtr connection;
-    auto it = m_sd2ConnectionPollerLoop.find(sd);
-    if (it != m_sd2ConnectionPollerLoop.end())
+    auto it = pollerLoop.sd2ConnectionPollerLoop.find(sd);
+    if (it != pollerLoop.sd2ConnectionPollerLoop.end())
     {
         connection = it->second;
     }
@@ -117,27 +175,46 @@ IStreamConnectionPrivatePtr StreamConnectionContainer::findConnectionById(std::i
 
 // IStreamConnectionContainer
 
-void StreamConnectionContainer::init(int cycleTime, FuncPollerLoopTimer funcTimer, int checkReconnectInterval)
+void StreamConnectionContainer::init(int cycleTime, FuncPollerLoopTimer funcTimer, int checkReconnectInterval, int numberOfPollerLoops, ReceiveMode receiveMode)
 {
     std::unique_lock<std::mutex> lock(m_mutex);
     m_funcTimer = std::move(funcTimer);
     m_cycleTime = cycleTime;
     m_checkReconnectInterval = checkReconnectInterval;
-    m_poller->init();
-    m_threadTimer = std::thread([this]() {
+    m_receiveMode = receiveMode;
+    while (static_cast<int>(m_pollerLoops.size()) < numberOfPollerLoops)
+    {
+        m_pollerLoops.push_back(createPollerLoop());
+    }
+    for (auto& pollerLoop : m_pollerLoops)
+    {
+        pollerLoop->poller->init(receiveMode);
+    }
+    std::vector<PollerLoop*> pollerLoops;
+    for (auto& pollerLoop : m_pollerLoops)
+    {
+        pollerLoops.push_back(pollerLoop.get());
+    }
+    m_threadTimer = std::thread([this, pollerLoops]() {
         while (!m_terminatePollerLoop)
         {
-            m_executorPollerThread->addAction([this]() {
-                // this is the poller thread
-                if (isTimerExpired(m_lastReconnectTime, m_checkReconnectInterval))
-                {
-                    doReconnect();
-                }
-                if (m_funcTimer)
-                {
-                    m_funcTimer();
-                }
-            });
+            for (size_t i = 0; i < pollerLoops.size(); ++i)
+            {
+                PollerLoop* pollerLoop = pollerLoops[i];
+                const bool firstPollerLoop = (i == 0);
+                pollerLoop->executorPollerThread->addAction([this, pollerLoop, firstPollerLoop]() {
+                    // this is the poller thread, the reconnect of a connection runs in the thread of its poller loop
+                    if (isTimerExpired(pollerLoop->lastReconnectTime, m_checkReconnectInterval))
+                    {
+                        doReconnect(*pollerLoop);
+                    }
+                    // the timer function is called once per cycle for the whole container
+                    if (firstPollerLoop && m_funcTimer)
+                    {
+                        m_funcTimer();
+                    }
+                });
+            }
             std::this_thread::sleep_for(std::chrono::milliseconds(m_cycleTime));
         }
     });
@@ -177,6 +254,7 @@ void StreamConnectionContainer::getBindPropertiesFromEndpoint(const std::string&
         SerializeBindProperties bp;
         SerializerStruct serializer(bp);
         ParserJson parser(serializer, endpoint.c_str() + pos, endpoint.size() - pos);
+        parser.parseStruct(SerializeBindProperties::structInfo().getTypeName());
 
         bindProperties.certificateData.ssl = bp.certificateData.ssl;
         bindProperties.certificateData.verifyMode = bp.certificateData.verifyMode;
@@ -188,6 +266,7 @@ void StreamConnectionContainer::getBindPropertiesFromEndpoint(const std::string&
         bindProperties.certificateData.clientCaFile = bp.certificateData.clientCaFile;
         bindProperties.protocolData = bp.protocolData;
         bindProperties.formatData = bp.formatData;
+        bindProperties.reusePort = bp.reusePort;
     }
 }
 
@@ -199,64 +278,91 @@ int StreamConnectionContainer::bind(const std::string& endpoint, hybrid_ptr<IStr
 
     ConnectionData connectionData = AddressHelpers::endpoint2ConnectionData(endpoint);
     connectionData.ssl = bindPropertiesToUse.certificateData.ssl;
-    std::shared_ptr<Socket> socket = std::make_shared<Socket>();
 
-    bool ok = false;
-#ifdef USE_OPENSSL
-    if (connectionData.ssl)
-    {
-        ok = socket->createSslServer(connectionData.af, connectionData.type, connectionData.protocol, bindPropertiesToUse.certificateData);
-    }
-    else
-#endif
+    std::unique_lock<std::mutex> locker(m_mutex);
+    if (findBindByEndpoint(endpoint) != m_sd2binds.end())
     {
-        ok = socket->create(connectionData.af, connectionData.type, connectionData.protocol);
+        return -1;
     }
 
-    int err = -1;
-    if (ok)
+    // with SO_REUSEPORT every poller loop listens on its own socket, otherwise the first poller loop accepts all connections.
+    size_t numberOfListeners = 1;
+#if !defined(WIN32) && !defined(__MINGW32__) && defined(SO_REUSEPORT)
+    if (bindPropertiesToUse.reusePort && connectionData.protocol == IPPROTO_TCP)
     {
-        bool doAsyncGetHostByName = false;
-        std::string addr = AddressHelpers::makeSocketAddress(connectionData.hostname, connectionData.port, connectionData.af, false, doAsyncGetHostByName);
-        err = socket->bind(reinterpret_cast<const sockaddr*>(addr.c_str()), static_cast<int>(addr.size()));
+        numberOfListeners = m_pollerLoops.size();
     }
-    if (err == 0)
-    {
-        // listen for incoming connections
-        err = socket->listen(SOMAXCONN);
-    }
-    if (err == 0)
-    {
-        SocketDescriptorPtr sd = socket->getSocketDescriptor();
-        assert(sd);
+#endif
 
-        std::unique_lock<std::mutex> locker(m_mutex);
+    std::vector<BindData> binds;
+    int err = 0;
+    for (size_t i = 0; i < numberOfListeners && err == 0; ++i)
+    {
+        std::shared_ptr<Socket> socket = std::make_shared<Socket>();
 
-        auto it = findBindByEndpoint(endpoint);
-        if (it == m_sd2binds.end())
+        bool ok = false;
+#ifdef USE_OPENSSL
+        if (connectionData.ssl)
         {
-            assert(m_poller);
-            m_sd2binds.emplace(sd->getDescriptor(), BindData{connectionData, socket, callbackDefault});
-            m_poller->addSocketEnableRead(sd);
+            ok = socket->createSslServer(connectionData.af, connectionData.type, connectionData.protocol, bindPropertiesToUse.certificateData);
         }
         else
+#endif
         {
-            err = -1;
+            ok = socket->create(connectionData.af, connectionData.type, connectionData.protocol);
+        }
+
+        err = -1;
+        if (ok)
+        {
+#if !defined(WIN32) && !defined(__MINGW32__) && defined(SO_REUSEPORT)
+            if (numberOfListeners > 1)
+            {
+                int reuse = 1;
+                SocketDescriptorPtr sd = socket->getSocketDescriptor();
+                assert(sd);
+                OperatingSystem::instance().setsockopt(sd->getDescriptor(), SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+            }
+#endif
+            bool doAsyncGetHostByName = false;
+            std::string addr = AddressHelpers::makeSocketAddress(connectionData.hostname, connectionData.port, connectionData.af, false, doAsyncGetHostByName);
+            err = socket->bind(reinterpret_cast<const sockaddr*>(addr.c_str()), static_cast<int>(addr.size()));
+        }
+        if (err == 0)
+        {
+            // listen for incoming connections
+            err = socket->listen(SOMAXCONN);
+        }
+        if (err == 0)
+        {
+            binds.push_back(BindData{connectionData, socket, callbackDefault, m_pollerLoops[i].get(), (numberOfListeners > 1)});
         }
-        locker.unlock();
     }
+
+    if (err == 0)
+    {
+        for (const BindData& bindData : binds)
+        {
+            SocketDescriptorPtr sd = bindData.socket->getSocketDescriptor();
+            assert(sd);
+            assert(bindData.pollerLoop);
+            m_sd2binds.emplace(sd->getDescriptor(), bindData);
+            bindData.pollerLoop->poller->addSocketEnableRead(sd);
+        }
+    }
+    locker.unlock();
     return err;
 }
 
 void StreamConnectionContainer::unbind(const std::string& endpoint)
 {
     std::unique_lock<std::mutex> locker(m_mutex);
-    auto it = findBindByEndpoint(endpoint);
-    if (it != m_sd2binds.end())
+    for (auto it = findBindByEndpoint(endpoint); it != m_sd2binds.end(); it = findBindByEndpoint(endpoint))
     {
         SocketPtr socket = it->second.socket;
         assert(socket);
-        m_poller->removeSocket(socket->getSocketDescriptor());
+        assert(it->second.pollerLoop);
+        it->second.pollerLoop->poller->removeSocket(socket->getSocketDescriptor());
         m_sd2binds.erase(it);
     }
     locker.unlock();
@@ -287,7 +393,10 @@ IStreamConnectionPtr StreamConnectionContainer::createConnection(hybrid_ptr<IStr
 
     IStreamConnectionPrivatePtr connection;
 
-    connection = addConnection(socket, connectionData, callback);
+    std::unique_lock<std::mutex> lock(m_mutex);
+    PollerLoop& pollerLoop = getLeastLoadedPollerLoop();
+    lock.unlock();
+    connection = addConnection(pollerLoop, socket, connectionData, callback);
     assert(connection);
 
     return connection;
@@ -333,8 +442,10 @@ bool StreamConnectionContainer::createSocket(const IStreamConnectionPtr& streamC
             streamConnectionPrivate = it->second;
             assert(streamConnectionPrivate);
             streamConnectionPrivate->updateConnectionData(connectionData);
-            m_sd2Connection[connectionData.sd] = it->second;
-            m_connectionsStable.clear(std::memory_order_release);
+            PollerLoop* pollerLoop = findPollerLoop(connectionData.connectionId);
+            assert(pollerLoop);
+            pollerLoop->sd2Connection[connectionData.sd] = it->second;
+            pollerLoop->connectionsStable.clear(std::memory_order_release);
         }
         else
         {
@@ -458,10 +569,16 @@ IStreamConnectionPtr StreamConnectionContainer::getConnection(std::int64_t conne
 void StreamConnectionContainer::removeConnection(const SocketDescriptorPtr& sd, std::int64_t connectionId)
 {
     std::unique_lock<std::mutex> lock(m_mutex);
-    if (sd)
+    PollerLoop* pollerLoop = findPollerLoop(connectionId);
+    if (pollerLoop)
     {
-        m_sd2Connection.erase(sd->getDescriptor());
-        m_connectionsStable.clear(std::memory_order_release);
+        if (sd)
+        {
+            pollerLoop->sd2Connection.erase(sd->getDescriptor());
+            pollerLoop->connectionsStable.clear(std::memory_order_release);
+        }
+        --pollerLoop->numberOfConnections;
+        m_connectionId2PollerLoop.erase(connectionId);
     }
     m_connectionId2Connection.erase(connectionId);
     lock.unlock();
@@ -481,53 +598,116 @@ void StreamConnectionContainer::disconnectIntern(const IStreamConnectionPrivateP
 
 void StreamConnectionContainer::run()
 {
-    pollerLoop();
+    // the first poller loop runs in the calling thread, all others get their own thread.
+    for (size_t i = 1; i < m_pollerLoops.size(); ++i)
+    {
+        PollerLoop* loop = m_pollerLoops[i].get();
+        loop->thread = std::thread([this, loop]() {
+            pollerLoop(*loop);
+        });
+    }
+    pollerLoop(*m_pollerLoops[0]);
+    for (size_t i = 1; i < m_pollerLoops.size(); ++i)
+    {
+        if (m_pollerLoops[i]->thread.joinable())
+        {
+            m_pollerLoops[i]->thread.join();
+        }
+    }
 }
 
 void StreamConnectionContainer::terminatePollerLoop()
 {
     m_terminatePollerLoop = true;
-    m_poller->releaseWait(RELEASE_TERMINATE);
+    for (auto& pollerLoop : m_pollerLoops)
+    {
+        pollerLoop->poller->releaseWait(RELEASE_TERMINATE);
+    }
 }
 
 IExecutorPtr StreamConnectionContainer::getPollerThreadExecutor() const
 {
-    return m_executorPollerThread;
+    return m_pollerLoops[0]->executorPollerThread;
 }
 
-IStreamConnectionPrivatePtr StreamConnectionContainer::addConnection(const SocketPtr& socket, ConnectionData& connectionData, hybrid_ptr<IStreamConnectionCallback> callback)
+IExecutorPtr StreamConnectionContainer::getPollerThreadExecutor(std::int64_t connectionId) const
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    PollerLoop* pollerLoop = findPollerLoop(connectionId);
+    if (pollerLoop)
+    {
+        return pollerLoop->executorPollerThread;
+    }
+    return m_pollerLoops[0]->executorPollerThread;
+}
+
+IStreamConnectionPrivatePtr StreamConnectionContainer::addConnection(PollerLoop& pollerLoop, const SocketPtr& socket, ConnectionData& connectionData, hybrid_ptr<IStreamConnectionCallback> callback)
 {
     std::unique_lock<std::mutex> lock(m_mutex);
     std::int64_t connectionId = m_nextConnectionId.fetch_add(1);
     connectionData.connectionId = connectionId;
-    IStreamConnectionPrivatePtr connection = std::make_shared<StreamConnection>(connectionData, socket, m_poller, callback);
+    IStreamConnectionPrivatePtr connection = std::make_shared<StreamConnection>(connectionData, socket, pollerLoop.poller, callback);
     m_connectionId2Connection[connectionId] = connection;
+    m_connectionId2PollerLoop[connectionId] = &pollerLoop;
+    ++pollerLoop.numberOfConnections;
     if (connectionData.sd != INVALID_SOCKET)
     {
-        m_sd2Connection[connectionData.sd] = connection;
-        m_connectionsStable.clear(std::memory_order_release);
+        pollerLoop.sd2Connection[connectionData.sd] = connection;
+        pollerLoop.connectionsStable.clear(std::memory_order_release);
     }
     lock.unlock();
 
     return connection;
 }
 
-void StreamConnectionContainer::handleReceive(const IStreamConnectionPrivatePtr& connection, const SocketPtr& socket, int bytesToRead)
+void StreamConnectionContainer::handleReceive(PollerLoop& pollerLoop, const IStreamConnectionPrivatePtr& connection, const SocketPtr& socket, int bytesToRead)
 {
+    // edge triggered sockets are reported only once, so they have to be read until they would block
+    const bool edgeTriggered = (m_receiveMode == ReceiveMode::RECEIVEMODE_EDGETRIGGERED);
+    bool ok = true;
+    int maxloop = edgeTriggered ? -1 : 5;
+
 #ifdef USE_OPENSSL
     if (socket->isSsl())
     {
-        bytesToRead = socket->sslPending();
+        if (bytesToRead < 0)
+        {
+            // the poller did not ask for the pending bytes, but SSL needs them to detect a closed connection
+            bytesToRead = socket->pendingRead();
+            ok = (bytesToRead > 0);
+        }
+        if (ok)
+        {
+            bytesToRead = socket->sslPending();
+        }
     }
 #endif
 
-    bool ok = true;
-    int maxloop = 5;
+    if (bytesToRead < 0)
+    {
+        bytesToRead = 0;
+        int res = 1;
+        while (res > 0 && ok && maxloop != 0)
+        {
+            res = socket->prefetch();
+            if (res > 0)
+            {
+                ok = connection->received(connection, socket, socket->getPrefetched());
+            }
+            else if (res < 0)
+            {
+                // peer closed the connection
+                ok = false;
+            }
+            maxloop--;
+        }
+    }
+
     while (bytesToRead > 0 && ok)
     {
         ok = connection->received(connection, socket, bytesToRead);
         maxloop--;
-        if (maxloop > 0 && ok)
+        if (maxloop != 0 && ok)
         {
             bytesToRead = socket->pendingRead();
 #ifdef USE_OPENSSL
@@ -558,12 +738,12 @@ void StreamConnectionContainer::handleReceive(const IStreamConnectionPrivatePtr&
     {
         SocketDescriptorPtr sd = socket->getSocketDescriptor();
         assert(sd);
-        m_poller->enableWrite(sd);
+        pollerLoop.poller->enableWrite(sd);
     }
 #endif
 }
 
-void StreamConnectionContainer::handleConnectionEvents(const IStreamConnectionPrivatePtr& connection, const SocketPtr& socket, const DescriptorInfo& info)
+void StreamConnectionContainer::handleConnectionEvents(PollerLoop& pollerLoop, const IStreamConnectionPrivatePtr& connection, const SocketPtr& socket, const DescriptorInfo& info)
 {
     bool disconnected = (info.disconnected || (info.readable && info.bytesToRead == 0));
     if (disconnected)
@@ -588,11 +768,11 @@ void StreamConnectionContainer::handleConnectionEvents(const IStreamConnectionPr
                 SslSocket::IoState state = socket->sslConnecting();
                 if (state == SslSocket::IoState::WANT_WRITE)
                 {
-                    m_poller->enableWrite(sd);
+                    pollerLoop.poller->enableWrite(sd);
                 }
                 else if (state == SslSocket::IoState::WANT_READ)
                 {
-                    m_poller->disableWrite(sd);
+                    pollerLoop.poller->disableWrite(sd);
                 }
                 else if (state == SslSocket::IoState::SSL_ERROR)
                 {
@@ -605,7 +785,7 @@ void StreamConnectionContainer::handleConnectionEvents(const IStreamConnectionPr
                     {
                         connection->connected(connection);
                     }
-                    m_poller->enableWrite(sd);
+                    pollerLoop.poller->enableWrite(sd);
                 }
                 return;
             }
@@ -613,7 +793,7 @@ void StreamConnectionContainer::handleConnectionEvents(const IStreamConnectionPr
 
         if (isSsl && writable && socket->isReadWhenWritable())
         {
-            handleReceive(connection, socket, bytesToRead);
+            handleReceive(pollerLoop, connection, socket, bytesToRead);
         }
         else if (isSsl && readable && socket->isWriteWhenReadable())
         {
@@ -639,7 +819,7 @@ void StreamConnectionContainer::handleConnectionEvents(const IStreamConnectionPr
             }
             if (readable)
             {
-                handleReceive(connection, socket, bytesToRead);
+                handleReceive(pollerLoop, connection, socket, bytesToRead);
             }
 #ifdef USE_OPENSSL
         }
@@ -647,7 +827,7 @@ void StreamConnectionContainer::handleConnectionEvents(const IStreamConnectionPr
     }
 }
 
-void StreamConnectionContainer::handleBindEvents(const DescriptorInfo& info)
+void StreamConnectionContainer::handleBindEvents(PollerLoop& pollerLoop, const DescriptorInfo& info)
 {
     if (info.readable)
     {
@@ -662,42 +842,62 @@ void StreamConnectionContainer::handleBindEvents(const DescriptorInfo& info)
 
         if (bindData.socket)
         {
-            std::string addr;
-            addr.resize(400);
-            socklen_t addrlen = static_cast<socklen_t>(addr.size());
-            SocketPtr socketAccept;
-            bindData.socket->accept(reinterpret_cast<sockaddr*>(const_cast<char*>(addr.c_str())), &addrlen, socketAccept);
-            if (socketAccept)
+            // edge triggered listening sockets are reported only once, so all pending connections have to be accepted
+            bool acceptNext = true;
+            while (acceptNext)
             {
-                ConnectionData connectionData = bindData.connectionData;
-                connectionData.incomingConnection = true;
-                connectionData.startTime = std::chrono::steady_clock::now();
-                connectionData.sockaddr = addr;
-                connectionData.connectionState = ConnectionState::CONNECTIONSTATE_CONNECTED;
+                std::string addr;
+                addr.resize(400);
+                socklen_t addrlen = static_cast<socklen_t>(addr.size());
+                SocketPtr socketAccept;
+                bindData.socket->accept(reinterpret_cast<sockaddr*>(const_cast<char*>(addr.c_str())), &addrlen, socketAccept);
+                if (socketAccept)
+                {
+                    ConnectionData connectionData = bindData.connectionData;
+                    connectionData.incomingConnection = true;
+                    connectionData.startTime = std::chrono::steady_clock::now();
+                    connectionData.sockaddr = addr;
+                    connectionData.connectionState = ConnectionState::CONNECTIONSTATE_CONNECTED;
+
+                    // a listening socket of SO_REUSEPORT keeps its connections, otherwise distribute the connections over all poller loops
+                    PollerLoop* pollerLoopConnection = &pollerLoop;
+                    if (!bindData.reusePort && m_pollerLoops.size() > 1)
+                    {
+                        lock.lock();
+                        pollerLoopConnection = &getLeastLoadedPollerLoop();
+                        lock.unlock();
+                    }
 
 #ifdef USE_OPENSSL
-                if (connectionData.ssl)
-                {
-                    SocketDescriptorPtr sd = socketAccept->getSocketDescriptor();
-                    assert(sd);
-                    SslAcceptingData sslAcceptingData{socketAccept, connectionData, bindData.callback};
-                    m_sslAcceptings.emplace(sd->getDescriptor(), sslAcceptingData);
-                    sslAccepting(sslAcceptingData);
-                }
-                else
+                    if (connectionData.ssl)
+                    {
+                        // the SSL handshake runs at the poller loop of the connection
+                        SslAcceptingData sslAcceptingData{socketAccept, connectionData, bindData.callback};
+                        if (pollerLoopConnection == &pollerLoop)
+                        {
+                            startSslAccepting(pollerLoop, sslAcceptingData);
+                        }
+                        else
+                        {
+                            pollerLoopConnection->executorPollerThread->addAction([this, pollerLoopConnection, sslAcceptingData]() {
+                                startSslAccepting(*pollerLoopConnection, sslAcceptingData);
+                            });
+                        }
+                    }
+                    else
 #endif
-                {
-                    SocketDescriptorPtr sd = socketAccept->getSocketDescriptor();
-                    assert(sd);
-                    connectionData.sd = sd->getDescriptor();
-                    AddressHelpers::addr2peer(reinterpret_cast<sockaddr*>(const_cast<char*>(connectionData.sockaddr.c_str())), connectionData);
+                    {
+                        SocketDescriptorPtr sd = socketAccept->getSocketDescriptor();
+                        assert(sd);
+                        connectionData.sd = sd->getDescriptor();
+                        AddressHelpers::addr2peer(reinterpret_cast<sockaddr*>(const_cast<char*>(connectionData.sockaddr.c_str())), connectionData);
 
-                    IStreamConnectionPrivatePtr connection = addConnection(socketAccept, connectionData, bindData.callback);
-                    connection->connected(connection);
+                        IStreamConnectionPrivatePtr connection = addConnection(*pollerLoopConnection, socketAccept, connectionData, bindData.callback);
+                        connection->connected(connection);
+                        pollerLoopConnection->poller->addSocketEnableRead(sd);
+                    }
                 }
-                SocketDescriptorPtr sd = socketAccept->getSocketDescriptor();
-                assert(sd);
-                m_poller->addSocketEnableRead(sd);
+                acceptNext = (socketAccept && m_receiveMode == ReceiveMode::RECEIVEMODE_EDGETRIGGERED);
             }
         }
     }
@@ -721,7 +921,18 @@ void StreamConnectionContainer::handleBindEvents(const DescriptorInfo& info)
 }
 
 #ifdef USE_OPENSSL
-bool StreamConnectionContainer::sslAccepting(SslAcceptingData& sslAcceptingData)
+void StreamConnectionContainer::startSslAccepting(PollerLoop& pollerLoop, const SslAcceptingData& sslAcceptingData)
+{
+    // this is the poller thread of pollerLoop
+    SocketDescriptorPtr sd = sslAcceptingData.socket->getSocketDescriptor();
+    assert(sd);
+    auto it = pollerLoop.sslAcceptings.emplace(sd->getDescriptor(), sslAcceptingData).first;
+    // the socket is added to the poller first, so that the handshake can enable writing or remove it
+    pollerLoop.poller->addSocketEnableRead(sd);
+    sslAccepting(pollerLoop, it->second);
+}
+
+bool StreamConnectionContainer::sslAccepting(PollerLoop& pollerLoop, SslAcceptingData& sslAcceptingData)
 {
     assert(sslAcceptingData.socket);
 
@@ -731,11 +942,11 @@ bool StreamConnectionContainer::sslAccepting(SslAcceptingData& sslAcceptingData)
 
     if (state == SslSocket::IoState::WANT_WRITE)
     {
-        m_poller->enableWrite(sd);
+        pollerLoop.poller->enableWrite(sd);
     }
     else
     {
-        m_poller->disableWrite(sd);
+        pollerLoop.poller->disableWrite(sd);
     }
 
     if (state == SslSocket::IoState::SUCCESS)
@@ -743,31 +954,35 @@ bool StreamConnectionContainer::sslAccepting(SslAcceptingData& sslAcceptingData)
         sslAcceptingData.connectionData.sd = sd->getDescriptor();
         AddressHelpers::addr2peer(reinterpret_cast<sockaddr*>(const_cast<char*>(sslAcceptingData.connectionData.sockaddr.c_str())), sslAcceptingData.connectionData);
 
-        IStreamConnectionPrivatePtr connection = addConnection(sslAcceptingData.socket, sslAcceptingData.connectionData, sslAcceptingData.callback);
+        IStreamConnectionPrivatePtr connection = addConnection(pollerLoop, sslAcceptingData.socket, sslAcceptingData.connectionData, sslAcceptingData.callback);
         connection->connected(connection);
     }
 
     if (state == SslSocket::IoState::SSL_ERROR)
     {
-        m_poller->removeSocket(sd);
+        pollerLoop.poller->removeSocket(sd);
     }
 
     if (state == SslSocket::IoState::SUCCESS || state == SslSocket::IoState::SSL_ERROR)
     {
-        m_sslAcceptings.erase(sd->getDescriptor());
+        pollerLoop.sslAcceptings.erase(sd->getDescriptor());
     }
     return (state == SslSocket::IoState::SUCCESS);
 }
 #endif
 
-void StreamConnectionContainer::doReconnect()
+void StreamConnectionContainer::doReconnect(PollerLoop& pollerLoop)
 {
     std::vector<IStreamConnectionPrivatePtr> connections;
     std::unique_lock<std::mutex> lock(m_mutex);
-    connections.reserve(m_connectionId2Connection.size());
+    connections.reserve(pollerLoop.numberOfConnections);
     for (auto it = m_connectionId2Connection.begin(); it != m_connectionId2Connection.end(); ++it)
     {
-        connections.push_back(it->second);
+        // only the connections of this poller loop
+        if (findPollerLoop(it->first) == &pollerLoop)
+        {
+            connections.push_back(it->second);
+        }
     }
     lock.unlock();
 
@@ -797,24 +1012,24 @@ bool StreamConnectionContainer::isTimerExpired(std::chrono::time_point<std::chro
     return expired;
 }
 
-void StreamConnectionContainer::pollerLoop()
+void StreamConnectionContainer::pollerLoop(PollerLoop& pollerLoop)
 {
-    m_lastReconnectTime = std::chrono::steady_clock::now();
+    pollerLoop.lastReconnectTime = std::chrono::steady_clock::now();
     while (!m_terminatePollerLoop)
     {
-        const PollerResult& result = m_poller->wait(1000);
+        const PollerResult& result = pollerLoop.poller->wait(1000);
 
-        if (m_connectionsStable.test_and_set(std::memory_order_acq_rel))
+        if (!pollerLoop.connectionsStable.test_and_set(std::memory_order_acq_rel))
         {
             std::unique_lock<std::mutex> lock(m_mutex);
-            m_sd2ConnectionPollerLoop = m_sd2Connection;
+            pollerLoop.sd2ConnectionPollerLoop = pollerLoop.sd2Connection;
         }
 
         if (result.releaseWait)
         {
             if (result.releaseWait & RELEASE_EXECUTEINPOLLERTHREAD)
             {
-                m_executorPollerThread->runAvailableActions();
+                pollerLoop.executorPollerThread->runAvailableActions();
             }
 
             if (result.releaseWait & RELEASE_DISCONNECT)
@@ -826,7 +1041,8 @@ void StreamConnectionContainer::pollerLoop()
                 {
                     const IStreamConnectionPrivatePtr& connection = it->second;
                     assert(connection);
-                    if (connection->getDisconnectFlag())
+                    // only the connections of this poller loop
+                    if (connection->getDisconnectFlag() && findPollerLoop(it->first) == &pollerLoop)
                     {
                         connectionsDisconnect.push_back(it->second);
                     }
@@ -861,31 +1077,31 @@ void StreamConnectionContainer::pollerLoop()
             for (size_t i = 0; i < result.descriptorInfos.size(); ++i)
             {
                 const DescriptorInfo& info = result.descriptorInfos[i];
-                IStreamConnectionPrivatePtr connection = findConnectionBySdOnlyForPollerLoop(info.sd);
+                IStreamConnectionPrivatePtr connection = findConnectionBySdOnlyForPollerLoop(pollerLoop, info.sd);
                 if (connection)
                 {
                     SocketPtr socket = connection->getSocketPrivate();
                     if (socket)
                     {
-                        handleConnectionEvents(connection, socket, info);
+                        handleConnectionEvents(pollerLoop, connection, socket, info);
                     }
                 }
                 else
                 {
 #ifdef USE_OPENSSL
-                    auto itSslAccepting = m_sslAcceptings.find(info.sd);
-                    if (itSslAccepting != m_sslAcceptings.end())
+                    auto itSslAccepting = pollerLoop.sslAcceptings.find(info.sd);
+                    if (itSslAccepting != pollerLoop.sslAcceptings.end())
                     {
-                        bool success = sslAccepting(itSslAccepting->second);
+                        bool success = sslAccepting(pollerLoop, itSslAccepting->second);
                         if (success)
                         {
-                            IStreamConnectionPrivatePtr connection1 = findConnectionBySdOnlyForPollerLoop(info.sd);
+                            IStreamConnectionPrivatePtr connection1 = findConnectionBySdOnlyForPollerLoop(pollerLoop, info.sd);
                             if (connection1)
                             {
                                 SocketPtr socket = connection1->getSocketPrivate();
                                 if (socket)
                                 {
-                                    handleConnectionEvents(connection1, socket, info);
+                                    handleConnectionEvents(pollerLoop, connection1, socket, info);
                                 }
                             }
                         }
@@ -893,7 +1109,7 @@ void StreamConnectionContainer::pollerLoop()
                     else
 #endif
                     {
-                        handleBindEvents(info);
+                        handleBindEvents(pollerLoop, info);
                     }
                 }
             }
@@ -34,16 +34,30 @@ Variant::Variant()
 {
 }
 
+Variant::~Variant()
+{
+    reset();
+}
+
 Variant::Variant(std::shared_ptr<IVariantValue> value)
-    : m_value(value)
+    : m_value(value.get())
+    , m_shared(std::move(value))
 {
 
 }
 
 
 Variant::Variant(const Variant& rhs)
-    : m_value((rhs.m_value) ? rhs.m_value->clone() : nullptr)
 {
+    if (rhs.m_value)
+    {
+        m_value = rhs.m_value->cloneInto(&m_storage);
+        if (m_value == nullptr)
+        {
+            m_shared = rhs.m_value->clone();
+            m_value = m_shared.get();
+        }
+    }
 }
 
 const Variant& Variant::operator =(const Variant& rhs)
@@ -52,21 +66,16 @@ const Variant& Variant::operator =(const Variant& rhs)
     {
         return *this;
     }
-    if (rhs.m_value)
-    {
-        m_value = rhs.m_value->clone();
-    }
-    else
-    {
-        m_value = nullptr;
-    }
+    // rhs could be a part of this variant
+    Variant variant(rhs);
+    reset();
+    moveFrom(variant);
     return *this;
 }
 
 Variant::Variant(Variant&& rhs) noexcept
-    : m_value(std::move(rhs.m_value))
 {
-
+    moveFrom(rhs);
 }
 
 Variant& Variant::operator =(Variant&& rhs) noexcept
@@ -75,10 +84,40 @@ Variant& Variant::operator =(Variant&& rhs) noexcept
     {
         return *this;
     }
-    m_value = std::move(rhs.m_value);
+    // rhs could be a part of this variant
+    Variant variant(std::move(rhs));
+    reset();
+    moveFrom(variant);
     return *this;
 }
 
+void Variant::reset() noexcept
+{
+    if (isInline())
+    {
+        m_value->~IVariantValue();
+    }
+    m_shared = nullptr;
+    m_value = nullptr;
+}
+
+void Variant::moveFrom(Variant& rhs) noexcept
+{
+    assert(m_value == nullptr);
+    if (rhs.isInline())
+    {
+        m_value = rhs.m_value->moveInto(&m_storage);
+        assert(m_value);
+        rhs.reset();
+    }
+    else
+    {
+        m_shared = std::move(rhs.m_shared);
+        m_value = rhs.m_value;
+        rhs.m_value = nullptr;
+    }
+}
+
 
 void Variant::accept(IVariantVisitor& visitor, ssize_t index, int level, ssize_t size, const std::string& name, bool parentIsStruct)
 {
@@ -112,7 +151,36 @@ Variant* Variant::getVariant(const std::string& name)
 
 const Variant* Variant::getVariant(const std::string& name) const
 {
-    return const_cast<Variant*>(this)->getVariant(name);
+    if (name.empty())
+    {
+        return this;
+    }
+    if (m_value == nullptr)
+    {
+        return nullptr;
+    }
+
+    return static_cast<const IVariantValue*>(m_value)->getVariant(name);
+}
+
+
+Variant* Variant::getVariant(const Atom& key)
+{
+    if (m_value == nullptr)
+    {
+        return nullptr;
+    }
+    return m_value->getVariantByAtom(key);
+}
+
+
+const Variant* Variant::getVariant(const Atom& key) const
+{
+    if (m_value == nullptr)
+    {
+        return nullptr;
+    }
+    return static_cast<const IVariantValue*>(m_value)->getVariantByAtom(key);
 }
 
 
@@ -172,6 +240,31 @@ Variant* Variant::add(Variant&& variant)
     return nullptr;
 }
 
+Variant* Variant::add(const Atom& key, const Variant& variant)
+{
+    if (m_value)
+    {
+        if (m_value->getType() == VARTYPE_STRUCT)
+        {
+            return m_value->addByAtom(key, variant);
+        }
+        return m_value->add(key.getName(), variant);
+    }
+    return nullptr;
+}
+Variant* Variant::add(const Atom& key, Variant&& variant)
+{
+    if (m_value)
+    {
+        if (m_value->getType() == VARTYPE_STRUCT)
+        {
+            return m_value->addByAtom(key, std::move(variant));
+        }
+        return m_value->add(key.getName(), std::move(variant));
+    }
+    return nullptr;
+}
+
 ssize_t Variant::size() const
 {
     if (m_value)
@@ -214,7 +307,8 @@ Variant& Variant::getOrCreate(const std::string& name)
         assert(sizeNew > 0);
         if (!m_value || m_value->getType() != VARTYPE_LIST)
         {
-            m_value = std::make_shared<VariantValueList>();
+            reset();
+            emplace<VariantValueList>();
         }
         while (m_value->size() < sizeNew)
         {
@@ -233,7 +327,8 @@ Variant& Variant::getOrCreate(const std::string& name)
         }
         if (!m_value || m_value->getType() != VARTYPE_STRUCT)
         {
-            m_value = std::make_shared<VariantValueStruct>();
+            reset();
+            emplace<VariantValueStruct>();
         }
         Variant* varSub = m_value->getVariant(partname);
         if (varSub == nullptr)
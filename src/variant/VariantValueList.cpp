@@ -22,6 +22,7 @@
 
 #include "finalmq/variant/Variant.h"
 #include "finalmq/variant/VariantValueList.h"
+#include <new>
 #include <utility>
 #include <assert.h>
 
@@ -67,7 +68,7 @@ void* VariantValueList::getData()
 
 const void* VariantValueList::getData() const
 {
-    return const_cast<VariantValueList*>(this)->getData();
+    return m_value.get();
 }
 
 
@@ -84,44 +85,52 @@ VariantList::iterator VariantValueList::find(const std::string& name)
 
 
 
-Variant* VariantValueList::getVariant(const std::string& name)
+Variant* VariantValueList::findPart(const std::string& name, std::string& restname)
 {
     if (name.empty())
     {
         return nullptr;
     }
 
-    std::string partname;
-    std::string restname;
-
     //sperate first key ansd second key
     size_t cntp = name.find('.');
     if (cntp != std::string::npos)
     {
-        partname = name.substr(0, cntp);
-        cntp++;
-        restname = name.substr(cntp);
+        restname = name.substr(cntp + 1);
     }
-    else
+
+    // the index ends at the dot
+    auto it = find(name);
+    if (it == m_value->end())
     {
-        partname = name;
+        return nullptr;
     }
+    return &*it;
+}
 
-    // check if next key is in map (if not -> nullptr)
-    auto it = find(partname);   // auto: std::unordered_map<std::string, Variant>::iterator
-    if (it == m_value->end())
+Variant* VariantValueList::getVariant(const std::string& name)
+{
+    std::string restname;
+    Variant* variant = findPart(name, restname);
+    if (variant == nullptr)
     {
         return nullptr;
     }
 
     // m_value[name].getValue( with remaining name )
-    return it->getVariant(restname);
+    return variant->getVariant(restname);
 }
 
 
 const Variant* VariantValueList::getVariant(const std::string& name) const
 {
-    return const_cast<VariantValueList*>(this)->getVariant(name);
+    std::string restname;
+    const Variant* variant = const_cast<VariantValueList*>(this)->findPart(name, restname);
+    if (variant == nullptr)
+    {
+        return nullptr;
+    }
+    return variant->getVariant(restname);
 }
 
 
@@ -196,4 +205,16 @@ void VariantValueList::accept(IVariantVisitor& visitor, Variant& variant, ssize_
     visitor.exitList(variant, VARTYPE_LIST, index, level, size, name, parentIsStruct);
 }
 
+static_assert(VariantValueIsInline<VariantValueList>::value, "VariantValueList shall be stored inline in a Variant");
+
+IVariantValue* VariantValueList::cloneInto(void* storage) const
+{
+    return new (storage) VariantValueList(*this);
+}
+
+IVariantValue* VariantValueList::moveInto(void* storage) noexcept
+{
+    return new (storage) VariantValueList(std::move(*this));
+}
+
 }   // namespace finalmq
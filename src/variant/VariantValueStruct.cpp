@@ -22,6 +22,9 @@
 
 #include "finalmq/variant/Variant.h"
 #include "finalmq/variant/VariantValueStruct.h"
+#include "finalmq/helpers/Atom.h"
+#include <algorithm>
+#include <new>
 #include <utility>
 #include <assert.h>
 
@@ -29,6 +32,9 @@
 namespace finalmq {
 
 
+static const std::size_t INDEX_MIN_SIZE = 16;
+static const std::size_t INDEX_DISABLED = static_cast<std::size_t>(-1);
+
 
 VariantValueStruct::VariantValueStruct()
     : m_value(std::make_unique<VariantStruct>())
@@ -38,10 +44,19 @@ VariantValueStruct::VariantValueStruct()
 VariantValueStruct::VariantValueStruct(const VariantValueStruct& rhs)
     : m_value(std::make_unique<VariantStruct>(*rhs.m_value))
 {
+    if (rhs.m_slots)
+    {
+        const std::uint32_t size = rhs.m_slots[0] + 1;
+        m_slots.reset(new std::uint32_t[size]);
+        std::copy(rhs.m_slots.get(), rhs.m_slots.get() + size, m_slots.get());
+    }
 }
 
 VariantValueStruct::VariantValueStruct(VariantValueStruct&& rhs) noexcept
     : m_value(std::move(rhs.m_value))
+    , m_index(std::move(rhs.m_index))
+    , m_indexSize(rhs.m_indexSize)
+    , m_slots(std::move(rhs.m_slots))
 {
 }
 
@@ -62,68 +77,178 @@ int VariantValueStruct::getType() const
 
 void* VariantValueStruct::getData()
 {
+    // the struct can be modified from outside, afterwards
+    m_index = nullptr;
+    m_indexSize = INDEX_DISABLED;
+    m_slots = nullptr;
     return m_value.get();
 }
 
 const void* VariantValueStruct::getData() const
 {
-    return const_cast<VariantValueStruct*>(this)->getData();
+    return m_value.get();
 }
 
 
-VariantStruct::iterator VariantValueStruct::find(const std::string& name)
+Variant* VariantValueStruct::find(const char* name, ssize_t size, bool buildIndex)
 {
+    const ssize_t index = findIndex(name, size, buildIndex);
+    if (index < 0)
+    {
+        return nullptr;
+    }
+    return &(*m_value)[index].second;
+}
+
+ssize_t VariantValueStruct::findIndex(const char* name, ssize_t size, bool buildIndex)
+{
+    const std::size_t sizeStruct = m_value->size();
+    bool indexValid = (m_index && m_indexSize == sizeStruct);
+    if (!indexValid && buildIndex && sizeStruct >= INDEX_MIN_SIZE && m_indexSize != INDEX_DISABLED)
+    {
+        m_index = std::make_unique<Index>();
+        m_index->reserve(sizeStruct);
+        for (std::size_t i = 0; i < sizeStruct; ++i)
+        {
+            // the first entry wins, like in the linear search
+            m_index->emplace((*m_value)[i].first, i);
+        }
+        m_indexSize = sizeStruct;
+        indexValid = true;
+    }
+
+    if (indexValid)
+    {
+        auto it = m_index->find(std::string(name, size));
+        if (it == m_index->end())
+        {
+            return -1;
+        }
+        const std::string& entryName = (*m_value)[it->second].first;
+        if (entryName.size() == static_cast<std::size_t>(size) && entryName.compare(0, size, name, size) == 0)
+        {
+            return it->second;
+        }
+        // cannot happen, the index is disabled as soon as the names can be modified from outside
+        assert(false);
+    }
+
     for (auto it = m_value->begin(); it != m_value->end(); ++it)
     {
-        if (it->first == name)
+        if (it->first.size() == static_cast<std::size_t>(size) && it->first.compare(0, size, name, size) == 0)
         {
-            return it;
+            return it - m_value->begin();
         }
     }
-    return m_value->end();
+    return -1;
 }
 
+Variant* VariantValueStruct::findAtom(const Atom& key, bool fillSlot)
+{
+    const std::uint32_t id = key.getId();
+    if (m_slots && id < m_slots[0])
+    {
+        const std::uint32_t slot = m_slots[1 + id];
+        if (slot != 0)
+        {
+            std::pair<std::string, Variant>& entry = (*m_value)[slot - 1];
+            // the slots are dropped as soon as the names can be modified from outside
+            assert(entry.first == key.getName());
+            return &entry.second;
+        }
+    }
+    const std::string& name = key.getName();
+    const ssize_t index = findIndex(name.data(), name.size(), fillSlot);
+    if (index < 0)
+    {
+        return nullptr;
+    }
+    if (fillSlot)
+    {
+        setSlot(id, index);
+    }
+    return &(*m_value)[index].second;
+}
 
+void VariantValueStruct::setSlot(std::uint32_t id, std::size_t index)
+{
+    if (m_indexSize == INDEX_DISABLED)
+    {
+        return;
+    }
+    if (!m_slots || id >= m_slots[0])
+    {
+        // make room for all atoms, which exist so far, atoms are usually created at start up
+        const std::uint32_t size = std::max(id + 1, Atom::getNumberOfAtoms());
+        std::unique_ptr<std::uint32_t[]> slots(new std::uint32_t[size + 1]());
+        if (m_slots)
+        {
+            std::copy(m_slots.get() + 1, m_slots.get() + 1 + m_slots[0], slots.get() + 1);
+        }
+        slots[0] = size;
+        m_slots = std::move(slots);
+    }
+    m_slots[1 + id] = static_cast<std::uint32_t>(index + 1);
+}
 
-Variant* VariantValueStruct::getVariant(const std::string& name)
+void VariantValueStruct::addToIndex(const std::string& name)
 {
-    std::string partname;
-    std::string restname;
+    const std::size_t sizeStruct = m_value->size();
+    if (m_index && m_indexSize + 1 == sizeStruct)
+    {
+        m_index->emplace(name, sizeStruct - 1);
+        m_indexSize = sizeStruct;
+    }
+}
 
+
+Variant* VariantValueStruct::findPart(const std::string& name, std::string& restname, bool buildIndex)
+{
     //sperate first key ansd second key
+    const char* partname = name.data();
+    size_t sizePartname = name.size();
     size_t cntp = name.find('.');
     if (cntp != std::string::npos)
     {
-        partname = name.substr(0, cntp);
-        cntp++;
-        restname = name.substr(cntp);
-    }
-    else
-    {
-        partname = name;
+        sizePartname = cntp;
+        restname = name.substr(cntp + 1);
     }
 
     // remove "", if available in partname
-    if ((partname.size() >= 2) && (partname[0] == '\"') && (partname.back() == '\"'))
+    if ((sizePartname >= 2) && (partname[0] == '\"') && (partname[sizePartname - 1] == '\"'))
     {
-        partname = partname.substr(1, partname.size() - 2);
+        ++partname;
+        sizePartname -= 2;
     }
 
-    // check if next key is in map (if not -> nullptr)
-    auto it = find(partname);   // auto: std::unordered_map<std::string, Variant>::iterator
-    if (it == m_value->end())
+    return find(partname, sizePartname, buildIndex);
+}
+
+
+Variant* VariantValueStruct::getVariant(const std::string& name)
+{
+    std::string restname;
+    Variant* variant = findPart(name, restname, true);
+    if (variant == nullptr)
     {
         return nullptr;
     }
 
     // m_value[name].getValue( with remaining name )
-    return it->second.getVariant(restname);
+    return variant->getVariant(restname);
 }
 
 
 const Variant* VariantValueStruct::getVariant(const std::string& name) const
 {
-    return const_cast<VariantValueStruct*>(this)->getVariant(name);
+    // a const lookup does not build the index, so that concurrent readers do not modify the struct
+    std::string restname;
+    const Variant* variant = const_cast<VariantValueStruct*>(this)->findPart(name, restname, false);
+    if (variant == nullptr)
+    {
+        return nullptr;
+    }
+    return variant->getVariant(restname);
 }
 
 
@@ -157,62 +282,44 @@ bool VariantValueStruct::operator ==(const IVariantValue& rhs) const
 
 Variant* VariantValueStruct::add(const std::string& name, const Variant& variant)
 {
-    auto it = find(name);
-    if (it == m_value->end())
+    Variant* entry = find(name.data(), name.size(), true);
+    if (entry == nullptr)
     {
         m_value->emplace_back(name, variant);
+        addToIndex(name);
         return &m_value->back().second;
     }
     else
     {
-        it->second = variant;
-        return &it->second;
+        *entry = variant;
+        return entry;
     }
 }
 
 Variant* VariantValueStruct::add(const std::string& name, Variant&& variant)
 {
-    auto it = find(name);
-    if (it == m_value->end())
+    Variant* entry = find(name.data(), name.size(), true);
+    if (entry == nullptr)
     {
         m_value->emplace_back(name, std::move(variant));
+        addToIndex(name);
         return &m_value->back().second;
     }
     else
     {
-        it->second = variant;
-        return &it->second;
+        *entry = std::move(variant);
+        return entry;
     }
 }
 
 Variant* VariantValueStruct::add(const Variant& variant)
 {
-    auto it = find("");
-    if (it == m_value->end())
-    {
-        m_value->emplace_back("", variant);
-        return &m_value->back().second;
-    }
-    else
-    {
-        it->second = variant;
-        return &it->second;
-    }
+    return add(std::string(), variant);
 }
 
 Variant* VariantValueStruct::add(Variant&& variant)
 {
-    auto it = find("");
-    if (it == m_value->end())
-    {
-        m_value->emplace_back("", std::move(variant));
-        return &m_value->back().second;
-    }
-    else
-    {
-        it->second = variant;
-        return &it->second;
-    }
+    return add(std::string(), std::move(variant));
 }
 
 ssize_t VariantValueStruct::size() const
@@ -236,4 +343,61 @@ void VariantValueStruct::accept(IVariantVisitor& visitor, Variant& variant, ssiz
     visitor.exitStruct(variant, VARTYPE_STRUCT, index, level, size, name, parentIsStruct);
 }
 
+Variant* VariantValueStruct::getVariantByAtom(const Atom& key)
+{
+    return findAtom(key, true);
+}
+
+const Variant* VariantValueStruct::getVariantByAtom(const Atom& key) const
+{
+    // like the const lookup by name, it does not modify the struct for concurrent readers
+    return const_cast<VariantValueStruct*>(this)->findAtom(key, false);
+}
+
+Variant* VariantValueStruct::addByAtom(const Atom& key, const Variant& variant)
+{
+    Variant* entry = findAtom(key, true);
+    if (entry == nullptr)
+    {
+        m_value->emplace_back(key.getName(), variant);
+        addToIndex(key.getName());
+        setSlot(key.getId(), m_value->size() - 1);
+        return &m_value->back().second;
+    }
+    else
+    {
+        *entry = variant;
+        return entry;
+    }
+}
+
+Variant* VariantValueStruct::addByAtom(const Atom& key, Variant&& variant)
+{
+    Variant* entry = findAtom(key, true);
+    if (entry == nullptr)
+    {
+        m_value->emplace_back(key.getName(), std::move(variant));
+        addToIndex(key.getName());
+        setSlot(key.getId(), m_value->size() - 1);
+        return &m_value->back().second;
+    }
+    else
+    {
+        *entry = std::move(variant);
+        return entry;
+    }
+}
+
+static_assert(VariantValueIsInline<VariantValueStruct>::value, "VariantValueStruct shall be stored inline in a Variant");
+
+IVariantValue* VariantValueStruct::cloneInto(void* storage) const
+{
+    return new (storage) VariantValueStruct(*this);
+}
+
+IVariantValue* VariantValueStruct::moveInto(void* storage) noexcept
+{
+    return new (storage) VariantValueStruct(std::move(*this));
+}
+
 }   // namespace finalmq
@@ -0,0 +1,187 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <thread>
+
+#include "finalmq/helpers/BufferPool.h"
+#include "finalmq/helpers/ZeroCopyBuffer.h"
+#include "finalmq/protocolsession/ProtocolMessage.h"
+
+
+using namespace finalmq;
+
+
+
+class TestBufferPool: public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+        // fill the pool of this thread
+        std::list<std::string> buffers;
+        for (int i = 0; i < 4; ++i)
+        {
+            BufferPool::addBuffer(buffers, 100);
+            BufferPool::addBuffer(buffers, 4000);
+        }
+        BufferPool::releaseBuffers(buffers);
+    }
+
+    virtual void TearDown()
+    {
+    }
+
+};
+
+
+TEST_F(TestBufferPool, reuseBuffer)
+{
+    std::list<std::string> buffers;
+    char* buffer = BufferPool::addBuffer(buffers, 1000);
+    ASSERT_EQ(buffers.size(), 1);
+    ASSERT_EQ(buffers.back().size(), 1000);
+    BufferPool::removeLastBuffer(buffers);
+    ASSERT_EQ(buffers.size(), 0);
+
+    BufferPool::resetStatistics();
+    char* bufferAgain = BufferPool::addBuffer(buffers, 900);
+    ASSERT_EQ(bufferAgain, buffer);
+    ASSERT_EQ(buffers.back().size(), 900);
+    BufferPool::Statistics statistics = BufferPool::getStatistics();
+    ASSERT_GE(statistics.hits, 1);
+    BufferPool::releaseBuffers(buffers);
+}
+
+TEST_F(TestBufferPool, sizeClasses)
+{
+    std::list<std::string> buffers;
+    BufferPool::resetStatistics();
+    BufferPool::addBuffer(buffers, 4000);
+    ASSERT_EQ(buffers.back().size(), 4000);
+    ASSERT_GE(buffers.back().capacity(), 4096);
+    ASSERT_EQ(BufferPool::getStatistics().misses, 0);
+
+    // too large to be pooled
+    BufferPool::addBuffer(buffers, 1000000);
+    ASSERT_EQ(buffers.back().size(), 1000000);
+    ASSERT_EQ(BufferPool::getStatistics().misses, 1);
+    BufferPool::removeLastBuffer(buffers);
+
+    BufferPool::addBuffer(buffers, 1000000);
+    ASSERT_EQ(BufferPool::getStatistics().misses, 2);
+    BufferPool::releaseBuffers(buffers);
+}
+
+TEST_F(TestBufferPool, reuseRefs)
+{
+    std::list<BufferPool::Ref> refs;
+    char data[10];
+    BufferPool::addRef(refs, refs.end(), {data, 1});
+    BufferPool::addRef(refs, refs.end(), {data + 2, 3});
+    auto it = BufferPool::addRef(refs, refs.begin(), {data + 1, 2});
+    ASSERT_EQ(it, refs.begin());
+    ASSERT_EQ(refs.size(), 3);
+    auto itRef = refs.begin();
+    ASSERT_EQ(*itRef, BufferPool::Ref(data + 1, 2));
+    ++itRef;
+    ASSERT_EQ(*itRef, BufferPool::Ref(data, 1));
+    ++itRef;
+    ASSERT_EQ(*itRef, BufferPool::Ref(data + 2, 3));
+
+    BufferPool::removeRef(refs, refs.begin());
+    ASSERT_EQ(refs.size(), 2);
+    BufferPool::releaseRefs(refs);
+    ASSERT_EQ(refs.size(), 0);
+
+    BufferPool::resetStatistics();
+    BufferPool::addRef(refs, refs.end(), {data, 4});
+    BufferPool::addRef(refs, refs.end(), {data, 5});
+    BufferPool::addRef(refs, refs.end(), {data, 6});
+    BufferPool::Statistics statistics = BufferPool::getStatistics();
+    ASSERT_EQ(statistics.hits, 3);
+    ASSERT_EQ(statistics.misses, 0);
+    BufferPool::releaseRefs(refs);
+}
+
+TEST_F(TestBufferPool, protocolMessage)
+{
+    {
+        ProtocolMessage message(0, 12, 8);
+        IMessage& imessage = message;
+        imessage.addSendPayload(4, 512);
+        imessage.addSendHeader(12);
+        imessage.prepareMessageToSend();
+    }
+    BufferPool::resetStatistics();
+    ProtocolMessage message(0, 12, 8);
+    IMessage& imessage = message;
+    char* payload = imessage.addSendPayload(4, 512);
+    char* header = imessage.addSendHeader(12);
+    imessage.prepareMessageToSend();
+    BufferPool::Statistics statistics = BufferPool::getStatistics();
+    ASSERT_EQ(statistics.misses, 0);
+    ASSERT_EQ(statistics.hits, 5);  // 2 buffers, 3 refs
+
+    const std::list<BufferRef>& sendBuffers = imessage.getAllSendBuffers();
+    ASSERT_EQ(sendBuffers.size(), 2);
+    ASSERT_EQ(sendBuffers.front().first, header);
+    ASSERT_EQ(sendBuffers.back().first, payload - 12);
+    ASSERT_EQ(sendBuffers.back().second, 12 + 4 + 8);
+}
+
+TEST_F(TestBufferPool, zeroCopyBuffer)
+{
+    {
+        ZeroCopyBuffer buffer;
+        IZeroCopyBuffer& ibuffer = buffer;
+        ibuffer.addBuffer(100);
+    }
+    BufferPool::resetStatistics();
+    ZeroCopyBuffer buffer;
+    IZeroCopyBuffer& ibuffer = buffer;
+    char* data = ibuffer.addBuffer(100);
+    memcpy(data, "hello", 5);
+    ibuffer.downsizeLastBuffer(5);
+    ASSERT_EQ(buffer.getData(), "hello");
+    ASSERT_EQ(BufferPool::getStatistics().hits, 1);
+    ASSERT_EQ(BufferPool::getStatistics().misses, 0);
+}
+
+TEST_F(TestBufferPool, releaseInOtherThread)
+{
+    std::list<std::string> buffers;
+    BufferPool::addBuffer(buffers, 20000);
+    std::thread thread([&buffers] () {
+        BufferPool::releaseBuffers(buffers);
+        BufferPool::resetStatistics();
+        std::list<std::string> buffersThread;
+        BufferPool::addBuffer(buffersThread, 20000);
+        ASSERT_EQ(BufferPool::getStatistics().hits, 1);
+        BufferPool::releaseBuffers(buffersThread);
+    });
+    thread.join();
+    ASSERT_EQ(buffers.size(), 0);
+}
@@ -0,0 +1,186 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "finalmq/remoteentity/CommandRouter.h"
+
+
+using namespace finalmq;
+
+
+
+class TestCommandRouter: public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+    }
+
+    virtual void TearDown()
+    {
+    }
+
+};
+
+
+TEST_F(TestCommandRouter, isVariablePath)
+{
+    ASSERT_EQ(CommandRouter::isVariablePath("a/b"), false);
+    ASSERT_EQ(CommandRouter::isVariablePath("a/{id}"), true);
+    ASSERT_EQ(CommandRouter::isVariablePath("*tail*/b"), true);
+}
+
+TEST_F(TestCommandRouter, var)
+{
+    CommandRouter router;
+    router.addRoute("persons/{id}/PUT", 0);
+    router.addRoute("persons/{id}/DELETE", 1);
+    router.addRoute("persons/{id}/addresses/{index}", 2);
+
+    IMessage::Metainfo keys;
+    std::uint32_t routeId = 99;
+    ASSERT_EQ(router.findRoute("persons/123/DELETE", &keys, routeId), true);
+    ASSERT_EQ(routeId, 1);
+    ASSERT_EQ(keys.size(), 1);
+    ASSERT_EQ(keys["PATH_id"], "123");
+
+    keys.clear();
+    ASSERT_EQ(router.findRoute("persons/5/addresses/2", &keys, routeId), true);
+    ASSERT_EQ(routeId, 2);
+    ASSERT_EQ(keys["PATH_id"], "5");
+    ASSERT_EQ(keys["PATH_index"], "2");
+
+    keys.clear();
+    ASSERT_EQ(router.findRoute("persons/123/GET", &keys, routeId), false);
+    ASSERT_EQ(router.findRoute("persons/123", &keys, routeId), false);
+    ASSERT_EQ(router.findRoute("persons/123/PUT/x", &keys, routeId), false);
+    // no values of routes that do not match
+    ASSERT_EQ(keys.size(), 0);
+}
+
+TEST_F(TestCommandRouter, varFirstAddedWins)
+{
+    CommandRouter router;
+    router.addRoute("{objectid}/b", 0);
+    router.addRoute("a/{method}", 1);
+    router.addRoute("{objectid}/{method}", 2);
+
+    IMessage::Metainfo keys;
+    std::uint32_t routeId = 99;
+    ASSERT_EQ(router.findRoute("a/b", &keys, routeId), true);
+    ASSERT_EQ(routeId, 0);
+    ASSERT_EQ(keys.size(), 1);
+    ASSERT_EQ(keys["PATH_objectid"], "a");
+
+    keys.clear();
+    ASSERT_EQ(router.findRoute("a/c", &keys, routeId), true);
+    ASSERT_EQ(routeId, 1);
+    ASSERT_EQ(keys["PATH_method"], "c");
+
+    keys.clear();
+    ASSERT_EQ(router.findRoute("x/c", &keys, routeId), true);
+    ASSERT_EQ(routeId, 2);
+    ASSERT_EQ(keys["PATH_objectid"], "x");
+    ASSERT_EQ(keys["PATH_method"], "c");
+}
+
+TEST_F(TestCommandRouter, star)
+{
+    CommandRouter router;
+    router.addRoute("*tail*/$write", 0);
+    router.addRoute("*tail*/$ls", 1);
+    router.addRoute("*tail*", 2);
+
+    IMessage::Metainfo keys;
+    std::uint32_t routeId = 99;
+    ASSERT_EQ(router.findRoute("dir/sub/file.txt/$write", &keys, routeId), true);
+    ASSERT_EQ(routeId, 0);
+    ASSERT_EQ(keys["PATH_tail"], "dir/sub/file.txt");
+
+    keys.clear();
+    ASSERT_EQ(router.findRoute("$ls", &keys, routeId), true);
+    ASSERT_EQ(routeId, 1);
+    ASSERT_EQ(keys["PATH_tail"], "");
+
+    keys.clear();
+    ASSERT_EQ(router.findRoute("dir/sub/file.txt", &keys, routeId), true);
+    ASSERT_EQ(routeId, 2);
+    ASSERT_EQ(keys["PATH_tail"], "dir/sub/file.txt");
+
+    // the star ends at the first "$write", the remaining entries do not match
+    keys.clear();
+    ASSERT_EQ(router.findRoute("dir/$write/x/$write", &keys, routeId), true);
+    ASSERT_EQ(routeId, 2);
+    ASSERT_EQ(keys["PATH_tail"], "dir/$write/x/$write");
+
+    ASSERT_EQ(router.findRoute("", &keys, routeId), false);
+}
+
+TEST_F(TestCommandRouter, starInTheMiddle)
+{
+    CommandRouter router;
+    router.addRoute("files/*path*/content/GET", 0);
+
+    IMessage::Metainfo keys;
+    std::uint32_t routeId = 99;
+    ASSERT_EQ(router.findRoute("files/a/b/content/GET", &keys, routeId), true);
+    ASSERT_EQ(routeId, 0);
+    ASSERT_EQ(keys["PATH_path"], "a/b");
+    ASSERT_EQ(router.findRoute("files/a/b/content/PUT", &keys, routeId), false);
+    ASSERT_EQ(router.findRoute("files/a/b", &keys, routeId), false);
+}
+
+TEST_F(TestCommandRouter, varBeforeStar)
+{
+    CommandRouter router;
+    router.addRoute("*", 0);
+    router.addRoute("items/{id}", 1);
+
+    IMessage::Metainfo keys;
+    std::uint32_t routeId = 99;
+    ASSERT_EQ(router.findRoute("items/7", &keys, routeId), true);
+    ASSERT_EQ(routeId, 1);
+    ASSERT_EQ(keys["PATH_id"], "7");
+    ASSERT_EQ(router.findRoute("items/7/x", &keys, routeId), true);
+    ASSERT_EQ(routeId, 0);
+    // "*" has no name
+    ASSERT_EQ(keys.size(), 1);
+}
+
+TEST_F(TestCommandRouter, manyRoutes)
+{
+    CommandRouter router;
+    for (std::uint32_t i = 0; i < 400; ++i)
+    {
+        router.addRoute("service" + std::to_string(i) + "/{id}/resource" + std::to_string(i % 7) + "/{sub}", i);
+    }
+
+    IMessage::Metainfo keys;
+    std::uint32_t routeId = 0;
+    ASSERT_EQ(router.findRoute("service321/abc/resource6/def", &keys, routeId), true);
+    ASSERT_EQ(routeId, 321);
+    ASSERT_EQ(keys["PATH_id"], "abc");
+    ASSERT_EQ(keys["PATH_sub"], "def");
+    ASSERT_EQ(router.findRoute("service321/abc/resource5/def", &keys, routeId), false);
+}
@@ -0,0 +1,282 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+#include "finalmq/serializeproto/SerializerProto.h"
+#include "finalmq/serializeproto/ParserProto.h"
+#include "finalmq/serializejson/SerializerJson.h"
+#include "finalmq/serializejson/ParserJson.h"
+#include "finalmq/serializestruct/SerializerStruct.h"
+#include "finalmq/serializestruct/ParserStruct.h"
+#include "finalmq/helpers/ZeroCopyBuffer.h"
+#include "test.fmq.h"
+
+#include <limits>
+
+
+using namespace finalmq;
+
+
+static std::string serializeProtoReflective(const StructBase& structBase)
+{
+    ZeroCopyBuffer buffer;
+    SerializerProto serializer(buffer);
+    ParserStruct parser(serializer, structBase);
+    parser.parseStruct();
+    return buffer.getData();
+}
+
+static std::string serializeProtoDirect(const StructBase& structBase)
+{
+    ZeroCopyBuffer buffer;
+    EXPECT_TRUE(structBase.serializeProto(buffer));
+    return buffer.getData();
+}
+
+static std::string serializeJsonReflective(const StructBase& structBase, bool enumAsString = true)
+{
+    ZeroCopyBuffer buffer;
+    SerializerJson serializer(buffer, 512, enumAsString, false);
+    ParserStruct parser(serializer, structBase);
+    parser.parseStruct();
+    return buffer.getData();
+}
+
+static std::string serializeJsonDirect(const StructBase& structBase, bool enumAsString = true)
+{
+    ZeroCopyBuffer buffer;
+    EXPECT_TRUE(structBase.serializeJson(buffer, 512, enumAsString, false));
+    return buffer.getData();
+}
+
+static void parseProtoReflective(StructBase& structBase, const std::string& data)
+{
+    SerializerStruct serializer(structBase);
+    ParserProto parser(serializer, data.data(), data.size());
+    EXPECT_TRUE(parser.parseStruct(structBase.getStructInfo().getTypeName()));
+}
+
+static void parseJsonReflective(StructBase& structBase, const std::string& data)
+{
+    SerializerStruct serializer(structBase);
+    ParserJson parser(serializer, data.data(), data.size());
+    EXPECT_NE(parser.parseStruct(structBase.getStructInfo().getTypeName()), nullptr);
+}
+
+template<class T>
+static void checkDirectSerializers(const T& root)
+{
+    const std::string proto = serializeProtoReflective(root);
+    ASSERT_EQ(serializeProtoDirect(root), proto);
+    T resultProto;
+    ASSERT_TRUE(resultProto.parseProto(proto.data(), proto.size()));
+    ASSERT_EQ(resultProto, root);
+
+    for (bool enumAsString : {true, false})
+    {
+        const std::string json = serializeJsonReflective(root, enumAsString);
+        ASSERT_EQ(serializeJsonDirect(root, enumAsString), json);
+        T resultJson;
+        ASSERT_EQ(resultJson.parseJson(json.data(), json.size()), json.data() + json.size());
+        T cmpJson;
+        parseJsonReflective(cmpJson, json);
+        ASSERT_EQ(resultJson, cmpJson);
+    }
+}
+
+
+class TestDirectSerialize : public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+    }
+
+    virtual void TearDown()
+    {
+    }
+};
+
+
+
+TEST_F(TestDirectSerialize, testScalars)
+{
+    checkDirectSerializers(test::TestBool(true));
+    checkDirectSerializers(test::TestInt8(-100));
+    checkDirectSerializers(test::TestInt8ZigZag(-100));
+    checkDirectSerializers(test::TestUInt8(200));
+    checkDirectSerializers(test::TestInt16(-30000));
+    checkDirectSerializers(test::TestInt16ZigZag(-30000));
+    checkDirectSerializers(test::TestUInt16(60000));
+    checkDirectSerializers(test::TestInt32(-2));
+    checkDirectSerializers(test::TestInt32ZigZag(-100000));
+    checkDirectSerializers(test::TestUInt32(std::numeric_limits<std::uint32_t>::max()));
+    checkDirectSerializers(test::TestInt64(std::numeric_limits<std::int64_t>::min()));
+    checkDirectSerializers(test::TestUInt64(std::numeric_limits<std::uint64_t>::max()));
+    checkDirectSerializers(test::TestFloat(-1.5f));
+    checkDirectSerializers(test::TestDouble(1e300));
+    checkDirectSerializers(test::TestString("Hello World"));
+    checkDirectSerializers(test::TestBytes({0, 1, 2, -1, 'a'}));
+    checkDirectSerializers(test::TestEnum(test::Foo::FOO_HELLO));
+    checkDirectSerializers(test::TestEnum(test::Foo::FOO_WORLD2));
+}
+
+TEST_F(TestDirectSerialize, testDefaultValues)
+{
+    checkDirectSerializers(test::TestInt32());
+    checkDirectSerializers(test::TestString());
+    checkDirectSerializers(test::TestStruct());
+    checkDirectSerializers(test::TestArrayStruct());
+}
+
+TEST_F(TestDirectSerialize, testStructs)
+{
+    checkDirectSerializers(test::TestStruct({-2}, {"Hello"}, 12));
+    checkDirectSerializers(test::TestStructBlockSize({-2}, {"Hello"}, 12));
+
+    test::TestStructNullable nullable;
+    nullable.struct_string.value = "Hello";
+    nullable.last_value = 5;
+    checkDirectSerializers(nullable);
+    nullable.struct_int32 = std::make_shared<test::TestInt32>(-7);
+    checkDirectSerializers(nullable);
+
+    test::TestArrayStruct arrayStruct;
+    arrayStruct.value.push_back(test::TestStruct({-2}, {"Hello"}, 12));
+    arrayStruct.value.push_back(test::TestStruct());
+    arrayStruct.value.push_back(test::TestStruct({5}, {""}, 0));
+    arrayStruct.last_value = 7;
+    checkDirectSerializers(arrayStruct);
+}
+
+TEST_F(TestDirectSerialize, testArrays)
+{
+    checkDirectSerializers(test::TestArrayBool({true, false, true}));
+    checkDirectSerializers(test::TestArrayInt8({-1, 0, 127}));
+    checkDirectSerializers(test::TestArrayInt16({-1, 0, 32767}));
+    checkDirectSerializers(test::TestArrayUInt16({1, 0, 65535}));
+    checkDirectSerializers(test::TestArrayInt32({-1, 0, std::numeric_limits<std::int32_t>::max()}));
+    checkDirectSerializers(test::TestArrayUInt32({1, 0, std::numeric_limits<std::uint32_t>::max()}));
+    checkDirectSerializers(test::TestArrayInt64({-1, 0, std::numeric_limits<std::int64_t>::max()}));
+    checkDirectSerializers(test::TestArrayUInt64({1, 0, std::numeric_limits<std::uint64_t>::max()}));
+    checkDirectSerializers(test::TestArrayFloat({-1.5f, 0, 2.25f}));
+    checkDirectSerializers(test::TestArrayDouble({-1.5, 0, 1e-300}));
+    checkDirectSerializers(test::TestArrayString({"Hello", "", "World"}));
+    checkDirectSerializers(test::TestArrayBytes({{'a', 0}, {}, {-1}}));
+    checkDirectSerializers(test::TestArrayEnum({test::Foo::FOO_HELLO, test::Foo::FOO_WORLD, test::Foo::FOO_WORLD2}));
+}
+
+TEST_F(TestDirectSerialize, testLargeArrays)
+{
+    // the packed arrays contain runs of one byte varints and multi byte varints, the json arrays are written in chunks
+    test::TestArrayInt32 arrayInt32;
+    test::TestArrayUInt64 arrayUInt64;
+    test::TestArrayDouble arrayDouble;
+    for (int i = 0; i < 10000; ++i)
+    {
+        arrayInt32.value.push_back(((i / 16) % 2 == 0) ? (i % 100) : (i * 1000 - 5000000));
+        arrayUInt64.value.push_back(static_cast<std::uint64_t>(i) << (i % 60));
+        arrayDouble.value.push_back(i * 0.25 - 100.0);
+    }
+    checkDirectSerializers(arrayInt32);
+    checkDirectSerializers(arrayUInt64);
+    checkDirectSerializers(arrayDouble);
+
+    test::TestArrayInt32 resultProto;
+    parseProtoReflective(resultProto, serializeProtoReflective(arrayInt32));
+    ASSERT_EQ(resultProto, arrayInt32);
+    test::TestArrayUInt64 resultJson;
+    parseJsonReflective(resultJson, serializeJsonReflective(arrayUInt64));
+    ASSERT_EQ(resultJson, arrayUInt64);
+}
+
+TEST_F(TestDirectSerialize, testParseProtoUnknownField)
+{
+    // field 2 (varint) is not known by TestInt32, it is skipped
+    const std::string data = {0x08, 0x05, 0x10, 0x07};
+    test::TestInt32 root;
+    ASSERT_TRUE(root.parseProto(data.data(), data.size()));
+    ASSERT_EQ(root.value, 5);
+}
+
+TEST_F(TestDirectSerialize, testParseProtoInvalid)
+{
+    // length of the string exceeds the buffer
+    const std::string data = {0x0a, 0x10, 'a'};
+    test::TestString root;
+    ASSERT_FALSE(root.parseProto(data.data(), data.size()));
+}
+
+TEST_F(TestDirectSerialize, testParseJsonUnknownKeyAndWhiteSpace)
+{
+    const std::string data = " { \"unknown\" : [1, {\"a\":null}], \"value\" : \"Hello\" , } ";
+    test::TestString root;
+    ASSERT_NE(root.parseJson(data.data(), data.size()), nullptr);
+    ASSERT_EQ(root.value, "Hello");
+}
+
+TEST_F(TestDirectSerialize, testParseJsonEnum)
+{
+    test::TestArrayEnum root;
+    const std::string data = "{\"value\":[\"FOO_HELLO\",\"world2\",\"blabla\"]}";
+    ASSERT_NE(root.parseJson(data.data(), data.size()), nullptr);
+    test::TestArrayEnum cmp;
+    parseJsonReflective(cmp, data);
+    ASSERT_EQ(root, cmp);
+}
+
+TEST_F(TestDirectSerialize, testParseJsonFallback)
+{
+    // escaped strings are not handled by the direct parser, the caller falls back to ParserJson
+    const std::string data = "{\"value\":\"Hello\\nWorld\"}";
+    test::TestString root;
+    ASSERT_EQ(root.parseJson(data.data(), data.size()), nullptr);
+    parseJsonReflective(root, data);
+    ASSERT_EQ(root.value, "Hello\nWorld");
+}
+
+TEST_F(TestDirectSerialize, testNotSupported)
+{
+    test::TestVariant root;
+    ZeroCopyBuffer buffer;
+    ASSERT_FALSE(root.serializeProto(buffer));
+    ASSERT_FALSE(root.serializeJson(buffer, 512, true, false));
+    ASSERT_FALSE(root.parseProto("", 0));
+    ASSERT_EQ(root.parseJson("{}", 2), nullptr);
+
+    test::TestInt32 skipDefault(5);
+    ASSERT_FALSE(skipDefault.serializeJson(buffer, 512, true, true));
+}
+
+TEST_F(TestDirectSerialize, testProtoParsedByReflective)
+{
+    test::TestArrayStruct root;
+    root.value.push_back(test::TestStruct({-2}, {"Hello"}, 12));
+    root.last_value = 7;
+    const std::string data = serializeProtoDirect(root);
+    test::TestArrayStruct cmp;
+    parseProtoReflective(cmp, data);
+    ASSERT_EQ(root, cmp);
+}
@@ -0,0 +1,199 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <algorithm>
+#include <array>
+#include <thread>
+
+#include "finalmq/helpers/ExecutorWorkStealing.h"
+
+
+using namespace finalmq;
+
+
+
+class TestExecutorWorkStealing: public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+    }
+
+    virtual void TearDown()
+    {
+    }
+
+};
+
+
+TEST_F(TestExecutorWorkStealing, executorTask)
+{
+    int counter = 0;
+    ExecutorTask task;
+    ASSERT_FALSE(task);
+    task.set([&counter] () { ++counter; });
+    ASSERT_TRUE(task);
+    task();
+    ASSERT_EQ(counter, 1);
+
+    // too large for the inline storage
+    std::array<int, 64> large{};
+    large[63] = 5;
+    ExecutorTask taskLarge;
+    taskLarge.set([&counter, large] () { counter += large[63]; });
+    ExecutorTask taskMoved = std::move(taskLarge);
+    ASSERT_FALSE(taskLarge);
+    taskMoved();
+    ASSERT_EQ(counter, 6);
+
+    // the destructor of the callable is called
+    std::shared_ptr<int> shared = std::make_shared<int>(1);
+    task.set([shared] () {});
+    ASSERT_EQ(shared.use_count(), 2);
+    task.reset();
+    ASSERT_EQ(shared.use_count(), 1);
+}
+
+TEST_F(TestExecutorWorkStealing, runAvailableActions)
+{
+    std::shared_ptr<ExecutorWorkStealing> executor = std::make_shared<ExecutorWorkStealing>();
+    IExecutor& iexecutor = *executor;
+    int notifications = 0;
+    iexecutor.registerActionNotification([&notifications] () { ++notifications; });
+
+    std::vector<int> result;
+    for (int i = 0; i < 10; ++i)
+    {
+        executor->addAction([&result, i] () { result.push_back(i); }, 7);
+    }
+    iexecutor.addAction([&result] () { result.push_back(100); });
+    ASSERT_EQ(notifications, 1);
+
+    ASSERT_TRUE(iexecutor.runAvailableActions());
+    ASSERT_EQ(result.size(), 11);
+    result.erase(std::remove(result.begin(), result.end(), 100), result.end());
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_EQ(result[i], i);
+    }
+    ASSERT_FALSE(iexecutor.runAvailableActions());
+}
+
+TEST_F(TestExecutorWorkStealing, manyWorkersKeepOrderOfInstance)
+{
+    static const int NUMBER_OF_INSTANCES = 50;
+    static const int NUMBER_OF_ACTIONS = 2000;
+    static const int NUMBER_OF_PRODUCERS = 4;
+
+    std::vector<std::int64_t> lastValues(NUMBER_OF_INSTANCES * NUMBER_OF_PRODUCERS, -1);
+    std::unique_ptr<std::atomic_int[]> running(new std::atomic_int[NUMBER_OF_INSTANCES]());
+    std::atomic_int errors{0};
+    std::atomic_int counter{0};
+    std::atomic_int counterNoInstance{0};
+    {
+        ExecutorWorker<ExecutorWorkStealing> worker(16);
+        IExecutorWorker& iworker = worker;
+        std::vector<std::thread> producers;
+        for (int p = 0; p < NUMBER_OF_PRODUCERS; ++p)
+        {
+            producers.emplace_back([&, p] () {
+                for (int i = 0; i < NUMBER_OF_ACTIONS; ++i)
+                {
+                    for (int instance = 0; instance < NUMBER_OF_INSTANCES; ++instance)
+                    {
+                        iworker.addAction([&, p, i, instance] () {
+                            if (running[instance].fetch_add(1) != 0)
+                            {
+                                ++errors;   // actions of the same instance run in parallel
+                            }
+                            std::int64_t& lastValue = lastValues[instance * NUMBER_OF_PRODUCERS + p];
+                            if (lastValue + 1 != i)
+                            {
+                                ++errors;   // wrong order
+                            }
+                            lastValue = i;
+                            --running[instance];
+                            ++counter;
+                        }, instance + 1);
+                    }
+                    iworker.addAction([&] () {
+                        ++counterNoInstance;
+                    });
+                }
+            });
+        }
+        for (auto& producer : producers)
+        {
+            producer.join();
+        }
+        for (int i = 0; i < 1000 && (counter < NUMBER_OF_INSTANCES * NUMBER_OF_ACTIONS * NUMBER_OF_PRODUCERS || counterNoInstance < NUMBER_OF_ACTIONS * NUMBER_OF_PRODUCERS); ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    ASSERT_EQ(errors, 0);
+    ASSERT_EQ(counter, NUMBER_OF_INSTANCES * NUMBER_OF_ACTIONS * NUMBER_OF_PRODUCERS);
+    ASSERT_EQ(counterNoInstance, NUMBER_OF_ACTIONS * NUMBER_OF_PRODUCERS);
+}
+
+TEST_F(TestExecutorWorkStealing, terminateWithPendingActions)
+{
+    std::shared_ptr<int> shared = std::make_shared<int>(1);
+    {
+        ExecutorWorkStealing executor;
+        executor.addAction([shared] () {}, 3);
+        executor.addAction([shared] () {});
+        ASSERT_EQ(shared.use_count(), 3);
+    }
+    ASSERT_EQ(shared.use_count(), 1);
+}
+
+TEST_F(TestExecutorWorkStealing, globalExecutorWorker)
+{
+    GlobalExecutorWorker::setConfig(ExecutorWorkerType::EXECUTORWORKER_WORKSTEALING, 2);
+    GlobalExecutorWorker::setInstance(nullptr);
+
+    IExecutorWorker& worker = GlobalExecutorWorker::instance();
+    ASSERT_NE(std::dynamic_pointer_cast<ExecutorWorkStealing>(worker.getExecutor()), nullptr);
+
+    std::atomic<int> counter{0};
+    for (int i = 0; i < 100; ++i)
+    {
+        worker.addAction([&counter] () {
+            ++counter;
+        }, i % 3);
+    }
+    for (int i = 0; i < 1000 && counter < 100; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(counter, 100);
+
+    // back to the default executor for the other tests
+    GlobalExecutorWorker::setConfig(ExecutorWorkerType::EXECUTORWORKER_DEFAULT);
+    GlobalExecutorWorker::setInstance(nullptr);
+    ASSERT_NE(std::dynamic_pointer_cast<Executor>(GlobalExecutorWorker::instance().getExecutor()), nullptr);
+}
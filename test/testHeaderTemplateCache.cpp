@@ -0,0 +1,197 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+#include "finalmq/remoteentity/HeaderTemplateCache.h"
+#include "finalmq/helpers/ZeroCopyBuffer.h"
+#include "finalmq/serializejson/SerializerJson.h"
+#include "finalmq/serializeproto/SerializerProto.h"
+#include "finalmq/serializestruct/ParserStruct.h"
+
+
+using namespace finalmq;
+
+
+static void serializeHeaderProto(IZeroCopyBuffer& buffer, const Header& header)
+{
+    SerializerProto serializer(buffer);
+    ParserStruct parser(serializer, header);
+    parser.parseStruct();
+}
+
+static void serializeCorridProto(std::uint64_t corrid, std::string& field)
+{
+    field.clear();
+    if (corrid != 0)
+    {
+        // tag of field 8 (corrid), wire type varint
+        field += static_cast<char>(8 << 3);
+        while (corrid >= 0x80)
+        {
+            field += static_cast<char>(corrid | 0x80);
+            corrid >>= 7;
+        }
+        field += static_cast<char>(corrid);
+    }
+}
+
+static void serializeHeaderJson(IZeroCopyBuffer& buffer, const Header& header)
+{
+    SerializerJson serializer(buffer);
+    ParserStruct parser(serializer, header);
+    parser.parseStruct();
+}
+
+static void serializeCorridJson(std::uint64_t corrid, std::string& field)
+{
+    field.clear();
+    if (corrid != 0)
+    {
+        field = ",\"corrid\":\"" + std::to_string(corrid) + "\"";
+    }
+}
+
+
+class TestHeaderTemplateCache : public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+    }
+
+    virtual void TearDown()
+    {
+    }
+
+    static std::string serialize(HeaderTemplateCache& cache, const Header& header, HeaderTemplateCache::FuncSerializeHeader funcSerializeHeader = serializeHeaderProto, HeaderTemplateCache::FuncSerializeCorrid funcSerializeCorrid = serializeCorridProto)
+    {
+        ZeroCopyBuffer buffer;
+        cache.serialize(buffer, header, funcSerializeHeader, funcSerializeCorrid);
+        return buffer.getData();
+    }
+
+    static std::string serialize(HeaderTemplateCache::FuncSerializeHeader funcSerializeHeader, const Header& header)
+    {
+        ZeroCopyBuffer buffer;
+        funcSerializeHeader(buffer, header);
+        return buffer.getData();
+    }
+
+    static std::vector<Header> getHeaders()
+    {
+        std::vector<Header> headers;
+        for (std::uint64_t corrid : {1ull, 2ull, 0ull, 300ull, 0xffffffffffffffffull})
+        {
+            headers.push_back({12, "MyServer", 3, MsgMode::MSG_REQUEST, Status::STATUS_OK, "test.TestRequest", "test.TestRequest", corrid, {}});
+            headers.push_back({3, "", 12, MsgMode::MSG_REPLY, Status::STATUS_REQUEST_NOT_FOUND, "", "", corrid, {}});
+            headers.push_back({12, "MyServer", 3, MsgMode::MSG_REQUEST, Status::STATUS_OK, "path", "test.TestRequest", corrid, {"key", "value"}});
+            // the correlation ID is the first field
+            headers.push_back({0, "", 0, MsgMode::MSG_REQUEST, Status::STATUS_OK, "", "", corrid, {"key", "value"}});
+        }
+        return headers;
+    }
+};
+
+
+
+TEST_F(TestHeaderTemplateCache, testProto)
+{
+    HeaderTemplateCache cache;
+    for (const Header& header : getHeaders())
+    {
+        ASSERT_EQ(serialize(cache, header), serialize(serializeHeaderProto, header));
+    }
+    ASSERT_EQ(cache.getMisses(), 4u);
+    ASSERT_EQ(cache.getHits(), 16u);
+}
+
+TEST_F(TestHeaderTemplateCache, testJson)
+{
+    HeaderTemplateCache cache;
+    for (const Header& header : getHeaders())
+    {
+        ASSERT_EQ(serialize(cache, header, serializeHeaderJson, serializeCorridJson), serialize(serializeHeaderJson, header));
+    }
+    ASSERT_EQ(cache.getMisses(), 4u);
+    ASSERT_EQ(cache.getHits(), 16u);
+}
+
+TEST_F(TestHeaderTemplateCache, testFormatsAreSeparated)
+{
+    HeaderTemplateCache cache;
+    Header header{12, "MyServer", 3, MsgMode::MSG_REQUEST, Status::STATUS_OK, "path", "test.TestRequest", 1, {}};
+    ASSERT_EQ(serialize(cache, header), serialize(serializeHeaderProto, header));
+    header.corrid = 2;
+    ASSERT_EQ(serialize(cache, header, serializeHeaderJson, serializeCorridJson), serialize(serializeHeaderJson, header));
+    header.corrid = 3;
+    ASSERT_EQ(serialize(cache, header), serialize(serializeHeaderProto, header));
+    header.corrid = 4;
+    ASSERT_EQ(serialize(cache, header, serializeHeaderJson, serializeCorridJson), serialize(serializeHeaderJson, header));
+    ASSERT_EQ(cache.getMisses(), 2u);
+    ASSERT_EQ(cache.getHits(), 2u);
+}
+
+TEST_F(TestHeaderTemplateCache, testEviction)
+{
+    HeaderTemplateCache cache;
+    for (int loop = 0; loop < 2; ++loop)
+    {
+        for (std::uint64_t destid = 1; destid <= 9; ++destid)
+        {
+            Header header{destid, "", 3, MsgMode::MSG_REQUEST, Status::STATUS_OK, "path", "type", destid + 100, {}};
+            ASSERT_EQ(serialize(cache, header), serialize(serializeHeaderProto, header));
+        }
+    }
+    // the 9 headers do not fit into the cache, each header evicts the oldest entry
+    ASSERT_EQ(cache.getMisses(), 18u);
+    ASSERT_EQ(cache.getHits(), 0u);
+
+    // the last 8 headers are in the cache
+    Header header{2, "", 3, MsgMode::MSG_REQUEST, Status::STATUS_OK, "path", "type", 5, {}};
+    ASSERT_EQ(serialize(cache, header), serialize(serializeHeaderProto, header));
+    ASSERT_EQ(cache.getMisses(), 18u);
+    ASSERT_EQ(cache.getHits(), 1u);
+}
+
+TEST_F(TestHeaderTemplateCache, testManyPeers)
+{
+    // each peer has its own cache, so the peers do not evict the templates of each other
+    static const std::uint64_t NUMBER_OF_PEERS = 100;
+    static const std::uint64_t NUMBER_OF_ROUNDS = 10;
+    std::vector<HeaderTemplateCache> caches(NUMBER_OF_PEERS);
+    for (std::uint64_t round = 0; round < NUMBER_OF_ROUNDS; ++round)
+    {
+        for (std::uint64_t peer = 0; peer < NUMBER_OF_PEERS; ++peer)
+        {
+            Header header{peer + 1, "", 3, MsgMode::MSG_REQUEST, Status::STATUS_OK, "path", "type", round * NUMBER_OF_PEERS + peer + 1, {}};
+            ASSERT_EQ(serialize(caches[peer], header), serialize(serializeHeaderProto, header));
+        }
+    }
+    for (const HeaderTemplateCache& cache : caches)
+    {
+        ASSERT_EQ(cache.getMisses(), 1u);
+        ASSERT_EQ(cache.getHits(), NUMBER_OF_ROUNDS - 1);
+    }
+}
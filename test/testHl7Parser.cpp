@@ -1019,3 +1019,41 @@ TEST_F(TestHl7Parser, testParseTokenEscapeWrong6)
     EXPECT_EQ(-1, level);
     EXPECT_EQ(token, "");
 }
+
+TEST_F(TestHl7Parser, testParseTokenLongWithoutCopy)
+{
+    // longer than the blocks of the SIMD scan
+    const std::string text(100, 'a');
+    std::string hl7 = "MSH|^~\\&|" + text + "^" + text + "\\F\\" + text + "~" + text + "\x0d";
+    bool res = m_parser->startParse(hl7.c_str(), hl7.size());
+    EXPECT_EQ(true, res);
+
+    std::string token;
+    bool isarray;
+    int level;
+    level = m_parser->parseToken(1, token, isarray);
+    level = m_parser->parseToken(1, token, isarray);
+    level = m_parser->parseToken(1, token, isarray);
+    EXPECT_EQ(1, level);
+    EXPECT_EQ(token, "^~\\&");
+
+    std::string buffer;
+    const char* value = nullptr;
+    ssize_t size = 0;
+    level = m_parser->parseToken(2, value, size, buffer, isarray);
+    EXPECT_EQ(2, level);
+    EXPECT_EQ(false, isarray);
+    // without escape sequence the token points into the message
+    EXPECT_EQ(value, hl7.c_str() + 9);
+    EXPECT_EQ(std::string(value, size), text);
+
+    level = m_parser->parseToken(2, value, size, buffer, isarray);
+    EXPECT_EQ(1, level);
+    EXPECT_EQ(true, isarray);
+    EXPECT_EQ(value, buffer.data());
+    EXPECT_EQ(std::string(value, size), text + "|" + text);
+
+    level = m_parser->parseToken(1, token, isarray);
+    EXPECT_EQ(0, level);
+    EXPECT_EQ(token, text);
+}
@@ -0,0 +1,96 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+#include "finalmq/hl7/Hl7Scan.h"
+
+#include <string>
+
+
+using namespace finalmq;
+
+
+class TestHl7Scan : public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+        const char delimiters[Hl7Scan::NUMBER_OF_DELIMITERS] = {'\r', '|', '^', '&', '~'};
+        m_scan.setDelimiters(delimiters);
+    }
+
+    virtual void TearDown()
+    {
+    }
+
+    Hl7Scan m_scan{};
+};
+
+
+
+TEST_F(TestHl7Scan, testFindDelimiter)
+{
+    for (char delimiter : {'\r', '|', '^', '&', '~', '\0'})
+    {
+        for (size_t pos = 0; pos < 100; ++pos)
+        {
+            std::string str(100, 'a');
+            str[pos] = delimiter;
+            if (pos + 1 < str.size())
+            {
+                // only the first one shall be found
+                str[pos + 1] = '|';
+            }
+            const char* begin = str.data();
+            const char* end = str.data() + str.size();
+            ASSERT_EQ(m_scan.findDelimiter(begin, end), begin + pos);
+            ASSERT_EQ(m_scan.findDelimiter(begin, begin + pos), begin + pos);
+        }
+    }
+}
+
+TEST_F(TestHl7Scan, testFindDelimiterNotFound)
+{
+    // the escape character and characters with the highest bit set (utf8) shall not be found
+    std::string str;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        str += "\\\xc3x"[i % 3];
+    }
+    for (size_t size = 0; size <= str.size(); ++size)
+    {
+        ASSERT_EQ(m_scan.findDelimiter(str.data(), str.data() + size), str.data() + size);
+    }
+}
+
+TEST_F(TestHl7Scan, testChangeDelimiters)
+{
+    const char delimiters[Hl7Scan::NUMBER_OF_DELIMITERS] = {'\r', '#', '^', '&', '~'};
+    m_scan.setDelimiters(delimiters);
+    std::string str = std::string(40, 'a') + "|" + std::string(40, 'a') + "#";
+    ASSERT_EQ(m_scan.isDelimiter('|'), false);
+    ASSERT_EQ(m_scan.isDelimiter('#'), true);
+    ASSERT_EQ(m_scan.findDelimiter(str.data(), str.data() + str.size()), str.data() + 81);
+}
@@ -86,6 +86,73 @@ TEST(TestIntegrationEpoll, testAddSocketReadableBeforeWait)
 }
 
 
+TEST(TestIntegrationEpoll, testReadUntilWouldBlockWithoutPendingRead)
+{
+    std::unique_ptr<IPoller> poller = std::make_unique<Poller>();
+    poller->init(ReceiveMode::RECEIVEMODE_READUNTILWOULDBLOCK);
+
+    SocketDescriptorPtr controlSocketInside;
+    SocketDescriptorPtr controlSocketOutside;
+
+    int res = OperatingSystem::instance().makeSocketPair(controlSocketInside, controlSocketOutside);
+    EXPECT_EQ(res, 0);
+
+    poller->addSocketEnableRead(controlSocketInside);
+    OperatingSystem::instance().send(controlSocketOutside->getDescriptor(), BUFFER.c_str(), BUFFER.size(), 0);
+
+    const PollerResult& result = poller->wait(10);
+    EXPECT_EQ(result.error, false);
+    EXPECT_EQ(result.timeout, false);
+    EXPECT_EQ(result.descriptorInfos.size(), 1);
+    EXPECT_EQ(result.descriptorInfos[0].sd, controlSocketInside->getDescriptor());
+    EXPECT_EQ(result.descriptorInfos[0].readable, true);
+    EXPECT_EQ(result.descriptorInfos[0].bytesToRead, -1);
+    EXPECT_EQ(poller->getSyscallsSaved(), 1);
+
+    // level triggered: the socket is reported again, as long as the data is not read
+    const PollerResult& result2 = poller->wait(10);
+    EXPECT_EQ(result2.descriptorInfos.size(), 1);
+    EXPECT_EQ(poller->getSyscallsSaved(), 2);
+}
+
+
+TEST(TestIntegrationEpoll, testEdgeTriggered)
+{
+    std::unique_ptr<IPoller> poller = std::make_unique<Poller>();
+    poller->init(ReceiveMode::RECEIVEMODE_EDGETRIGGERED);
+
+    SocketDescriptorPtr controlSocketInside;
+    SocketDescriptorPtr controlSocketOutside;
+
+    int res = OperatingSystem::instance().makeSocketPair(controlSocketInside, controlSocketOutside);
+    EXPECT_EQ(res, 0);
+
+    poller->addSocketEnableRead(controlSocketInside);
+    OperatingSystem::instance().send(controlSocketOutside->getDescriptor(), BUFFER.c_str(), BUFFER.size(), 0);
+
+    const PollerResult& result = poller->wait(10);
+    EXPECT_EQ(result.timeout, false);
+    EXPECT_EQ(result.descriptorInfos.size(), 1);
+    EXPECT_EQ(result.descriptorInfos[0].readable, true);
+    EXPECT_EQ(result.descriptorInfos[0].bytesToRead, -1);
+
+    // edge triggered: the socket is not reported again, until new data arrives
+    const PollerResult& result2 = poller->wait(10);
+    EXPECT_EQ(result2.timeout, true);
+    EXPECT_EQ(result2.descriptorInfos.size(), 0);
+
+    OperatingSystem::instance().send(controlSocketOutside->getDescriptor(), BUFFER.c_str(), BUFFER.size(), 0);
+    const PollerResult& result3 = poller->wait(10);
+    EXPECT_EQ(result3.descriptorInfos.size(), 1);
+    EXPECT_EQ(poller->getSyscallsSaved(), 2);
+
+    // the control socket stays level triggered
+    poller->releaseWait(1);
+    const PollerResult& result4 = poller->wait(10);
+    EXPECT_EQ(result4.releaseWait, 1);
+}
+
+
 TEST(TestIntegrationEpoll, testAddSocketReadableInsideWait)
 {
     std::shared_ptr<IPoller> poller = std::make_shared<Poller>();
@@ -30,6 +30,10 @@
 #include "matchers.h"
 
 #include <thread>
+#include <future>
+#include <mutex>
+#include <set>
+#include <unordered_map>
 //#include <chrono>
 
 
@@ -418,3 +422,76 @@ TEST_F(TestIntegrationProtocolStreamSessionContainer, testCreateConnectionWithou
 
     EXPECT_EQ(m_sessionContainer->getSession(connection->getSessionId()), nullptr);
 }
+
+
+
+TEST_F(TestIntegrationProtocolStreamSessionContainer, testMultiplePollerLoops)
+{
+    std::shared_ptr<IProtocolSessionContainer> sessionContainer = std::make_shared<ProtocolSessionContainer>();
+    sessionContainer->init(nullptr, 1, nullptr, 1, 4);
+    std::thread thread([sessionContainer] () {
+        sessionContainer->run();
+    });
+
+    static const int NUMBER_OF_SESSIONS = 4;
+
+    std::mutex mutex;
+    std::unordered_map<IProtocolSessionPtr, std::thread::id> threadOfSession;
+    auto funcReceived = [&mutex, &threadOfSession] (const IProtocolSessionPtr& session, const IMessagePtr& /*message*/) {
+        std::unique_lock<std::mutex> lock(mutex);
+        threadOfSession[session] = std::this_thread::get_id();
+    };
+
+    EXPECT_CALL(*m_mockServerCallback, connected(_)).Times(NUMBER_OF_SESSIONS);
+    EXPECT_CALL(*m_mockClientCallback, connected(_)).Times(NUMBER_OF_SESSIONS);
+    EXPECT_CALL(*m_mockServerCallback, received(_, _)).Times(NUMBER_OF_SESSIONS)
+                                            .WillRepeatedly(testing::Invoke([&funcReceived] (const IProtocolSessionPtr& session, const IMessagePtr& message) {
+        funcReceived(session, message);
+        // reply, so that the client session receives as well
+        IMessagePtr reply = session->createMessage();
+        reply->addSendPayload(MESSAGE1_BUFFER);
+        session->sendMessage(reply);
+    }));
+    auto& expectReceive = EXPECT_CALL(*m_mockClientCallback, received(_, _)).Times(NUMBER_OF_SESSIONS)
+                                            .WillRepeatedly(testing::Invoke(funcReceived));
+
+    int res = sessionContainer->bind("tcp://*:3333:stream", m_mockServerCallback);
+    EXPECT_EQ(res, 0);
+
+    for (int i = 0; i < NUMBER_OF_SESSIONS; ++i)
+    {
+        IProtocolSessionPtr connection = sessionContainer->connect("tcp://localhost:3333:stream", m_mockClientCallback);
+        IMessagePtr message = connection->createMessage();
+        message->addSendPayload(MESSAGE1_BUFFER);
+        connection->sendMessage(message);
+    }
+
+    waitTillDone(expectReceive, 5000);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    std::unordered_map<IProtocolSessionPtr, std::thread::id> threadOfSessionCopy = threadOfSession;
+    lock.unlock();
+    EXPECT_EQ(threadOfSessionCopy.size(), 2 * NUMBER_OF_SESSIONS);
+
+    // the executor of a session runs in the poller loop, which calls the callbacks of the session
+    std::set<std::thread::id> threads;
+    for (const auto& entry : threadOfSessionCopy)
+    {
+        std::shared_ptr<std::promise<std::thread::id>> threadOfExecutor = std::make_shared<std::promise<std::thread::id>>();
+        std::future<std::thread::id> future = threadOfExecutor->get_future();
+        entry.first->getExecutor()->addAction([threadOfExecutor] () {
+            threadOfExecutor->set_value(std::this_thread::get_id());
+        });
+        ASSERT_EQ(future.wait_for(std::chrono::milliseconds(5000)), std::future_status::ready);
+        EXPECT_EQ(future.get(), entry.second);
+        threads.insert(entry.second);
+    }
+
+    // the sessions are distributed over the poller loops
+    EXPECT_GT(threads.size(), 1);
+
+    EXPECT_CALL(*m_mockClientCallback, disconnected(_)).WillRepeatedly(Return());
+    EXPECT_CALL(*m_mockServerCallback, disconnected(_)).WillRepeatedly(Return());
+    sessionContainer->terminatePollerLoop();
+    thread.join();
+}
@@ -31,6 +31,7 @@
 
 #include "testHelper.h"
 
+#include <chrono>
 #include <thread>
 
 using ::testing::_;
@@ -50,6 +51,7 @@ public:
     MOCK_METHOD(void, peerEvent, (PeerId peerId, const SessionInfo& session, EntityId entityId, PeerEvent peerEvent, bool incoming));
     MOCK_METHOD(void, connEvent, (const IProtocolSessionPtr& session, ConnectionEvent connectionEvent));
     MOCK_METHOD(void, connectReply, (PeerId peerId, Status status));
+    MOCK_METHOD(void, replyEvent, (CorrelationId correlationId, Status status));
 };
 
 
@@ -349,5 +351,267 @@ TEST_F(TestIntegrationRemoteEntity, testProtoLateConnect)
 
 
 
+class EntityEventReceiver : public RemoteEntity
+{
+public:
+    EntityEventReceiver(MockEvents& mockEvents)
+        : m_mockEvents(mockEvents)
+    {
+        registerCommand<TestRequest>([this] (const RequestContextPtr& requestContext, const std::shared_ptr<TestRequest>& request) {
+            assert(request);
+            ASSERT_EQ(request->datarequest, DATA_REQUEST);
+            const std::string* value = requestContext->getMetainfo("key");
+            ASSERT_NE(value, nullptr);
+            ASSERT_EQ(*value, "value");
+            m_mockEvents.testRequest(requestContext, request);
+        });
+    }
+
+    MockEvents& m_mockEvents;
+};
+
+TEST_F(TestIntegrationRemoteEntity, testSendEventToAllPeers)
+{
+    MockEvents mockEventsServer;
+    MockEvents mockEventsClientProto;
+    MockEvents mockEventsClientJson;
+    RemoteEntityContainer entityContainerServer;
+    RemoteEntityContainer entityContainerClient;
+    RemoteEntity entityServer;
+    EntityEventReceiver entityClientProto(mockEventsClientProto);
+    EntityEventReceiver entityClientJson(mockEventsClientJson);
+
+    entityContainerServer.init(nullptr, 1, nullptr, false, 1);
+    entityContainerClient.init(nullptr, 1, nullptr, false, 1);
+
+    std::thread thread1 = std::thread([&entityContainerServer] () {
+        entityContainerServer.run();
+    });
+    std::thread thread2 = std::thread([&entityContainerClient] () {
+        entityContainerClient.run();
+    });
+
+    entityServer.registerPeerEvent([&mockEventsServer] (PeerId peerId, const SessionInfo& session, EntityId entityId, PeerEvent peerEvent, bool incoming) {
+        mockEventsServer.peerEvent(peerId, session, entityId, peerEvent, incoming);
+    });
+
+    entityContainerServer.registerEntity(&entityServer, "MyServer");
+    entityContainerClient.registerEntity(&entityClientProto);
+    entityContainerClient.registerEntity(&entityClientJson);
+
+    entityContainerServer.bind("tcp://*:7788:headersize:protobuf");
+    entityContainerServer.bind("tcp://*:7789:headersize:json");
+    SessionInfo sessionClientProto = entityContainerClient.connect("tcp://localhost:7788:headersize:protobuf");
+    SessionInfo sessionClientJson = entityContainerClient.connect("tcp://localhost:7789:headersize:json");
+
+    auto& expectConnected = EXPECT_CALL(mockEventsServer, peerEvent(_, _, _, PeerEvent(PeerEvent::PEER_CONNECTED), true)).Times(2);
+    EXPECT_CALL(mockEventsServer, peerEvent(_, _, _, PeerEvent(PeerEvent::PEER_DISCONNECTED), true)).Times(2);
+    entityClientProto.connect(sessionClientProto, "MyServer");
+    entityClientJson.connect(sessionClientJson, "MyServer");
+    waitTillDone(expectConnected, 15000);
+
+    static const int LOOP = 3;
+    auto& expectEventProto = EXPECT_CALL(mockEventsClientProto, testRequest(_, _)).Times(LOOP);
+    auto& expectEventJson = EXPECT_CALL(mockEventsClientJson, testRequest(_, _)).Times(LOOP);
+    for (int i = 0; i < LOOP; ++i)
+    {
+        entityServer.sendEventToAllPeers({{"key", "value"}}, TestRequest{DATA_REQUEST});
+    }
+
+    waitTillDone(expectEventProto, 15000);
+    waitTillDone(expectEventJson, 15000);
+    entityContainerServer.terminatePollerLoop();
+    entityContainerClient.terminatePollerLoop();
+    thread1.join();
+    thread2.join();
+}
+
+
+
+class EntityServerDelayedReply : public RemoteEntity
+{
+public:
+    EntityServerDelayedReply(MockEvents& mockEvents)
+        : m_mockEvents(mockEvents)
+    {
+        registerCommand<TestRequest>([this] (const RequestContextPtr& requestContext, const std::shared_ptr<TestRequest>& request) {
+            assert(request);
+            m_mockEvents.testRequest(requestContext, request);
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_requestContexts.push_back(requestContext);
+        });
+    }
+
+    void replyAll()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (size_t i = 0; i < m_requestContexts.size(); ++i)
+        {
+            m_requestContexts[i]->reply(TestReply(DATA_REPLY));
+        }
+        m_requestContexts.clear();
+    }
+
+    MockEvents& m_mockEvents;
+    std::vector<RequestContextPtr> m_requestContexts;
+    std::mutex m_mutex;
+};
+
+TEST_F(TestIntegrationRemoteEntity, testRequestTimeout)
+{
+    MockEvents mockEventsServer;
+    MockEvents mockEventsClient;
+    RemoteEntityContainer entityContainerServer;
+    RemoteEntityContainer entityContainerClient;
+    EntityServerDelayedReply entityServer(mockEventsServer);
+    RemoteEntity entityClient;
+
+    entityContainerServer.init(nullptr, 1, nullptr, false, 1);
+    entityContainerClient.init(nullptr, 1, nullptr, false, 1);
+
+    std::thread thread1 = std::thread([&entityContainerServer] () {
+        entityContainerServer.run();
+    });
+    std::thread thread2 = std::thread([&entityContainerClient] () {
+        entityContainerClient.run();
+    });
+
+    entityClient.registerReplyEvent([&mockEventsClient] (CorrelationId correlationId, Status status, IMessage::Metainfo& /*metainfo*/, const StructBasePtr& /*structBase*/) {
+        mockEventsClient.replyEvent(correlationId, status);
+        return false;
+    });
+
+    entityContainerServer.registerEntity(&entityServer, "MyServer");
+    entityContainerClient.registerEntity(&entityClient);
+
+    entityContainerServer.bind("tcp://*:7788:headersize:protobuf");
+    SessionInfo sessionClient = entityContainerClient.connect("tcp://localhost:7788:headersize:protobuf");
+
+    auto& expectConnectReply = EXPECT_CALL(mockEventsClient, connectReply(_, Status(Status::STATUS_OK))).Times(1);
+    EXPECT_CALL(mockEventsClient, replyEvent(_, Status(Status::STATUS_OK))).Times(testing::AnyNumber());
+    PeerId peerId = entityClient.connect(sessionClient, "MyServer", [&mockEventsClient] (PeerId peerId, Status status) {
+        mockEventsClient.connectReply(peerId, status);
+    });
+    waitTillDone(expectConnectReply, 15000);
+
+    auto& expectRequest = EXPECT_CALL(mockEventsServer, testRequest(_, _)).Times(1);
+    auto& expectReply = EXPECT_CALL(mockEventsClient, testReply(peerId, Status(Status::STATUS_REQUEST_TIMEOUT), _)).Times(1);
+    auto start = std::chrono::steady_clock::now();
+    CorrelationId correlationId = entityClient.requestReply<TestReply>(peerId, "", TestRequest{DATA_REQUEST}, 50, [&mockEventsClient] (PeerId peerId, Status status, const std::shared_ptr<TestReply>& reply) {
+        ASSERT_EQ(reply, nullptr);
+        mockEventsClient.testReply(peerId, status, reply);
+    });
+    waitTillDone(expectRequest, 15000);
+    waitTillDone(expectReply, 15000);
+    ASSERT_GE(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count(), 50);
+    ASSERT_EQ(entityClient.cancelReply(correlationId), false);
+
+    // the late reply is not passed to the reply callback
+    auto& expectLateReply = EXPECT_CALL(mockEventsClient, replyEvent(correlationId, Status(Status::STATUS_OK))).Times(1);
+    entityServer.replyAll();
+    waitTillDone(expectLateReply, 15000);
+
+    entityContainerServer.terminatePollerLoop();
+    entityContainerClient.terminatePollerLoop();
+    thread1.join();
+    thread2.join();
+}
+
+
+
+class EntityServerLazy : public RemoteEntity
+{
+public:
+    EntityServerLazy(MockEvents& mockEvents)
+        : m_mockEvents(mockEvents)
+    {
+        registerCommandLazy<TestRequestExtended>(TestRequestExtended::structInfo().getTypeName(), [this] (const RequestContextPtr& requestContext) {
+            // the data is not parsed, yet
+            BufferRef rawData = requestContext->getRawData();
+            ASSERT_NE(rawData.first, nullptr);
+            ASSERT_GT(rawData.second, 0);
+
+            // TestRequest is a reduced TestRequestExtended, the trailing fields are skipped
+            std::shared_ptr<TestRequest> projection = requestContext->getDataAs<TestRequest>();
+            ASSERT_NE(projection, nullptr);
+            ASSERT_EQ(projection->datarequest, DATA_REQUEST);
+
+            std::shared_ptr<TestRequestExtended> request = requestContext->getData<TestRequestExtended>();
+            ASSERT_NE(request, nullptr);
+            ASSERT_EQ(request->datarequest, DATA_REQUEST);
+            ASSERT_EQ(request->extradata, Bytes({'a', 'b', 'c'}));
+            ASSERT_EQ(request->extravalue, 123);
+            ASSERT_EQ(request, requestContext->getData());
+            ASSERT_EQ(requestContext->getData<TestRequest>(), nullptr);
+            m_mockEvents.testRequest(requestContext, projection);
+            requestContext->reply(TestReply(DATA_REPLY));
+        });
+    }
+
+    MockEvents& m_mockEvents;
+};
+
+void testLazyCommand(const std::string& protocol)
+{
+    MockEvents mockEventsServer;
+    MockEvents mockEventsClient;
+    RemoteEntityContainer entityContainerServer;
+    RemoteEntityContainer entityContainerClient;
+    EntityServerLazy entityServer(mockEventsServer);
+    RemoteEntity entityClient;
+
+    entityContainerServer.init(nullptr, 1, nullptr, false, 1);
+    entityContainerClient.init(nullptr, 1, nullptr, false, 1);
+
+    std::thread thread1 = std::thread([&entityContainerServer] () {
+        entityContainerServer.run();
+    });
+    std::thread thread2 = std::thread([&entityContainerClient] () {
+        entityContainerClient.run();
+    });
+
+    entityContainerServer.registerEntity(&entityServer, "MyServer");
+    entityContainerClient.registerEntity(&entityClient);
+
+    entityContainerServer.bind("tcp://*:7788:headersize:" + protocol);
+    SessionInfo sessionClient = entityContainerClient.connect("tcp://localhost:7788:headersize:" + protocol);
+
+    PeerId peerId = entityClient.connect(sessionClient, "MyServer");
+
+    EXPECT_CALL(mockEventsServer, testRequest(_, _)).Times(1);
+    auto& expectReply = EXPECT_CALL(mockEventsClient, testReply(peerId, Status(Status::STATUS_OK), _)).Times(1);
+    entityClient.requestReply<TestReply>(peerId, TestRequestExtended{DATA_REQUEST, {'a', 'b', 'c'}, 123}, [&mockEventsClient] (PeerId peerId, Status status, const std::shared_ptr<TestReply>& reply) {
+        ASSERT_NE(reply, nullptr);
+        ASSERT_EQ(reply->datareply, DATA_REPLY);
+        mockEventsClient.testReply(peerId, status, reply);
+    });
+
+    // unknown paths are rejected without parsing the data
+    auto& expectNotFound = EXPECT_CALL(mockEventsClient, testReply(peerId, Status(Status::STATUS_REQUEST_NOT_FOUND), _)).Times(1);
+    entityClient.requestReply<TestReply>(peerId, "unknown", TestRequest{DATA_REQUEST}, [&mockEventsClient] (PeerId peerId, Status status, const std::shared_ptr<TestReply>& reply) {
+        ASSERT_EQ(reply, nullptr);
+        mockEventsClient.testReply(peerId, status, reply);
+    });
+
+    waitTillDone(expectReply, 15000);
+    waitTillDone(expectNotFound, 15000);
+    entityContainerServer.terminatePollerLoop();
+    entityContainerClient.terminatePollerLoop();
+    thread1.join();
+    thread2.join();
+}
+
+TEST_F(TestIntegrationRemoteEntity, testLazyCommandProto)
+{
+    testLazyCommand("protobuf");
+}
+
+TEST_F(TestIntegrationRemoteEntity, testLazyCommandJson)
+{
+    testLazyCommand("json");
+}
+
+
+
 
 #endif
@@ -31,6 +31,8 @@
 #include "testHelper.h"
 
 #include <thread>
+#include <mutex>
+#include <set>
 //#include <chrono>
 
 
@@ -53,6 +55,7 @@ public:
         std::string message;
         message.resize(bytesToRead);
         socket->receive((char*)message.data(), static_cast<int>(message.size()));
+        std::unique_lock<std::mutex> lock(m_mutex);
         m_messagesServer.push_back(std::move(message));
         return true;
     }
@@ -88,6 +91,7 @@ protected:
     std::unique_ptr<std::thread>                            m_thread;
 //    std::vector<std::string>                                m_messagesClient;
     std::vector<std::string>                                m_messagesServer;
+    std::mutex                                              m_mutex;
 };
 
 
@@ -339,6 +343,346 @@ TEST_F(TestIntegrationStreamConnectionContainer, testSendLateConnectBind)
     EXPECT_EQ(m_messagesServer[0], MESSAGE1_BUFFER);
 }
 
+TEST_F(TestIntegrationStreamConnectionContainer, testSendMultiplePendingMessages)
+{
+    EXPECT_CALL(*m_mockBindCallback, connected(_)).Times(1)
+                                            .WillOnce(Return(m_mockServerCallback));
+    EXPECT_CALL(*m_mockClientCallback, connected(_)).Times(1)
+                                            .WillOnce(Return(nullptr));
+    EXPECT_CALL(*m_mockServerCallback, connected(_)).Times(1);
+    EXPECT_CALL(*m_mockServerCallback, received(_, _, _)).Times(testing::AtLeast(1))
+                                                   .WillRepeatedly(Invoke(this, &TestIntegrationStreamConnectionContainer::receivedServer));
+
+    IStreamConnectionPtr connection = m_connectionContainer->createConnection(m_mockClientCallback);
+
+    // the messages are queued, because the connection is not yet connected, and will be sent with one gather write
+    std::string expected;
+    for (int i = 0; i < 100; ++i)
+    {
+        IMessagePtr message = std::make_shared<ProtocolMessage>(0);
+        std::string payload = MESSAGE1_BUFFER + std::to_string(i);
+        message->addSendPayload(payload);
+        message->addSendPayload(MESSAGE1_BUFFER);
+        expected += payload + MESSAGE1_BUFFER;
+        connection->sendMessage(message);
+    }
+
+    bool res2 = m_connectionContainer->connect("tcp://localhost:3333", connection, { {}, {1} });
+    ASSERT_EQ(res2, true);
+
+    int res = m_connectionContainer->bind("tcp://*:3333", m_mockBindCallback);
+    EXPECT_EQ(res, 0);
+
+    std::string received;
+    for (int i = 0; i < 500 && received.size() < expected.size(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        received.clear();
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (const auto& message : m_messagesServer)
+        {
+            received += message;
+        }
+    }
+
+    EXPECT_EQ(received, expected);
+}
+
+TEST_F(TestIntegrationStreamConnectionContainer, testMultiplePollerLoops)
+{
+    std::shared_ptr<IStreamConnectionContainer> connectionContainer = std::make_shared<StreamConnectionContainer>();
+    connectionContainer->init(1, nullptr, 1, 4);
+    std::thread thread([connectionContainer] () {
+        connectionContainer->run();
+    });
+
+    static const int NUMBER_OF_CONNECTIONS = 4;
+
+    EXPECT_CALL(*m_mockBindCallback, connected(_)).Times(NUMBER_OF_CONNECTIONS)
+                                            .WillRepeatedly(Return(m_mockServerCallback));
+    EXPECT_CALL(*m_mockClientCallback, connected(_)).Times(NUMBER_OF_CONNECTIONS)
+                                            .WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(*m_mockServerCallback, connected(_)).Times(NUMBER_OF_CONNECTIONS);
+    EXPECT_CALL(*m_mockServerCallback, received(_, _, _)).Times(testing::AtLeast(1))
+                                                   .WillRepeatedly(Invoke(this, &TestIntegrationStreamConnectionContainer::receivedServer));
+
+    int res = connectionContainer->bind("tcp://*:3334", m_mockBindCallback);
+    EXPECT_EQ(res, 0);
+
+    std::vector<IStreamConnectionPtr> connections;
+    std::set<IExecutorPtr> executors;
+    for (int i = 0; i < NUMBER_OF_CONNECTIONS; ++i)
+    {
+        IStreamConnectionPtr connection = connectionContainer->connect("tcp://localhost:3334", m_mockClientCallback);
+        ASSERT_NE(connection, nullptr);
+        IMessagePtr message = std::make_shared<ProtocolMessage>(0);
+        message->addSendPayload(MESSAGE1_BUFFER);
+        connection->sendMessage(message);
+        executors.insert(connectionContainer->getPollerThreadExecutor(connection->getConnectionId()));
+        connections.push_back(connection);
+    }
+
+    // the connections are distributed over the poller loops
+    EXPECT_GT(executors.size(), 1);
+
+    std::string received;
+    for (int i = 0; i < 500 && received.size() < NUMBER_OF_CONNECTIONS * MESSAGE1_BUFFER.size(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        received.clear();
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (const auto& message : m_messagesServer)
+        {
+            received += message;
+        }
+    }
+    EXPECT_EQ(received.size(), NUMBER_OF_CONNECTIONS * MESSAGE1_BUFFER.size());
+
+    EXPECT_CALL(*m_mockClientCallback, disconnected(_)).WillRepeatedly(Return());
+    EXPECT_CALL(*m_mockServerCallback, disconnected(_)).WillRepeatedly(Return());
+    connectionContainer->terminatePollerLoop();
+    thread.join();
+}
+
+TEST_F(TestIntegrationStreamConnectionContainer, testMultiplePollerLoopsReusePort)
+{
+    std::shared_ptr<IStreamConnectionContainer> connectionContainer = std::make_shared<StreamConnectionContainer>();
+    connectionContainer->init(1, nullptr, 1, 2);
+    std::thread thread([connectionContainer] () {
+        connectionContainer->run();
+    });
+
+    EXPECT_CALL(*m_mockBindCallback, connected(_)).Times(1)
+                                            .WillOnce(Return(m_mockServerCallback));
+    auto& expectConnectedClient = EXPECT_CALL(*m_mockClientCallback, connected(_)).Times(1)
+                                            .WillOnce(Return(nullptr));
+    EXPECT_CALL(*m_mockServerCallback, connected(_)).Times(1);
+    auto& expectReceive = EXPECT_CALL(*m_mockServerCallback, received(_, _, _)).Times(1)
+                                                   .WillRepeatedly(Invoke(this, &TestIntegrationStreamConnectionContainer::receivedServer));
+
+    BindProperties bindProperties;
+    bindProperties.reusePort = true;
+    int res = connectionContainer->bind("tcp://*:3334", m_mockBindCallback, bindProperties);
+    EXPECT_EQ(res, 0);
+
+    IStreamConnectionPtr connection = connectionContainer->connect("tcp://localhost:3334", m_mockClientCallback);
+    IMessagePtr message = std::make_shared<ProtocolMessage>(0);
+    message->addSendPayload(MESSAGE1_BUFFER);
+    connection->sendMessage(message);
+
+    waitTillDone(expectConnectedClient, 5000);
+    waitTillDone(expectReceive, 5000);
+
+    EXPECT_EQ(m_messagesServer.size(), 1);
+    EXPECT_EQ(m_messagesServer[0], MESSAGE1_BUFFER);
+
+    connectionContainer->unbind("tcp://*:3334");
+    res = connectionContainer->bind("tcp://*:3334", m_mockBindCallback, bindProperties);
+    EXPECT_EQ(res, 0);
+
+    EXPECT_CALL(*m_mockClientCallback, disconnected(_)).WillRepeatedly(Return());
+    EXPECT_CALL(*m_mockServerCallback, disconnected(_)).WillRepeatedly(Return());
+    connectionContainer->terminatePollerLoop();
+    thread.join();
+}
+
+TEST_F(TestIntegrationStreamConnectionContainer, testGetBindPropertiesFromEndpoint)
+{
+    BindProperties bindProperties;
+    StreamConnectionContainer::getBindPropertiesFromEndpoint("tcp://*:3334{\"reusePort\":true,\"certificateData\":{\"certificateFile\":\"ssltest.cert.pem\"}}", bindProperties);
+    EXPECT_EQ(bindProperties.reusePort, true);
+    EXPECT_EQ(bindProperties.certificateData.certificateFile, "ssltest.cert.pem");
+
+    BindProperties bindPropertiesDefault;
+    StreamConnectionContainer::getBindPropertiesFromEndpoint("tcp://*:3334", bindPropertiesDefault);
+    EXPECT_EQ(bindPropertiesDefault.reusePort, false);
+}
+
+TEST_F(TestIntegrationStreamConnectionContainer, testMultiplePollerLoopsReusePortFromEndpoint)
+{
+    std::shared_ptr<IStreamConnectionContainer> connectionContainer = std::make_shared<StreamConnectionContainer>();
+    connectionContainer->init(1, nullptr, 1, 2);
+    std::shared_ptr<IStreamConnectionContainer> connectionContainer2 = std::make_shared<StreamConnectionContainer>();
+    connectionContainer2->init(1, nullptr, 1, 2);
+
+    // the port can be bound a second time, because both binds set SO_REUSEPORT
+    int res = connectionContainer->bind("tcp://*:3334{\"reusePort\":true}", m_mockBindCallback);
+    EXPECT_EQ(res, 0);
+    res = connectionContainer2->bind("tcp://*:3334{\"reusePort\":true}", m_mockBindCallback);
+    EXPECT_EQ(res, 0);
+
+    connectionContainer->terminatePollerLoop();
+    connectionContainer2->terminatePollerLoop();
+}
+
+TEST_F(TestIntegrationStreamConnectionContainer, testReconnectMultiplePollerLoops)
+{
+    std::mutex mutexTimer;
+    std::set<std::thread::id> threadsTimer;
+    std::shared_ptr<IStreamConnectionContainer> connectionContainer = std::make_shared<StreamConnectionContainer>();
+    connectionContainer->init(1, [&mutexTimer, &threadsTimer] () {
+        std::unique_lock<std::mutex> lock(mutexTimer);
+        threadsTimer.insert(std::this_thread::get_id());
+    }, 1, 4);
+    std::thread thread([connectionContainer] () {
+        connectionContainer->run();
+    });
+
+    static const int NUMBER_OF_CONNECTIONS = 4;
+
+    EXPECT_CALL(*m_mockBindCallback, connected(_)).Times(NUMBER_OF_CONNECTIONS)
+                                            .WillRepeatedly(Return(m_mockServerCallback));
+    auto& expectConnectedClient = EXPECT_CALL(*m_mockClientCallback, connected(_)).Times(NUMBER_OF_CONNECTIONS)
+                                            .WillRepeatedly(Return(nullptr));
+    auto& expectConnectedServer = EXPECT_CALL(*m_mockServerCallback, connected(_)).Times(NUMBER_OF_CONNECTIONS);
+
+    // the connections are distributed over the poller loops, each poller loop reconnects its own connections
+    std::vector<IStreamConnectionPtr> connections;
+    std::set<IExecutorPtr> executors;
+    for (int i = 0; i < NUMBER_OF_CONNECTIONS; ++i)
+    {
+        IStreamConnectionPtr connection = connectionContainer->connect("tcp://localhost:3334", m_mockClientCallback, { {}, {1} });
+        ASSERT_NE(connection, nullptr);
+        executors.insert(connectionContainer->getPollerThreadExecutor(connection->getConnectionId()));
+        connections.push_back(connection);
+    }
+    EXPECT_GT(executors.size(), 1);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    int res = connectionContainer->bind("tcp://*:3334", m_mockBindCallback);
+    EXPECT_EQ(res, 0);
+
+    waitTillDone(expectConnectedClient, 5000);
+    waitTillDone(expectConnectedServer, 5000);
+
+    for (const IStreamConnectionPtr& connection : connections)
+    {
+        EXPECT_EQ(connection->getConnectionData().connectionState, ConnectionState::CONNECTIONSTATE_CONNECTED);
+    }
+
+    EXPECT_CALL(*m_mockClientCallback, disconnected(_)).WillRepeatedly(Return());
+    EXPECT_CALL(*m_mockServerCallback, disconnected(_)).WillRepeatedly(Return());
+    const std::thread::id threadIdFirstPollerLoop = thread.get_id();
+    connectionContainer->terminatePollerLoop();
+    thread.join();
+
+    // the timer function of the container is only called by the first poller loop
+    std::unique_lock<std::mutex> lock(mutexTimer);
+    ASSERT_EQ(threadsTimer.size(), 1);
+    EXPECT_EQ(*threadsTimer.begin(), threadIdFirstPollerLoop);
+}
+
+TEST_F(TestIntegrationStreamConnectionContainer, testEdgeTriggeredReceiveMode)
+{
+    std::shared_ptr<IStreamConnectionContainer> connectionContainer = std::make_shared<StreamConnectionContainer>();
+    connectionContainer->init(1, nullptr, 1, 1, ReceiveMode::RECEIVEMODE_EDGETRIGGERED);
+    std::thread thread([connectionContainer] () {
+        connectionContainer->run();
+    });
+
+    static const int NUMBER_OF_MESSAGES = 100;
+
+    EXPECT_CALL(*m_mockBindCallback, connected(_)).Times(1)
+                                            .WillOnce(Return(m_mockServerCallback));
+    EXPECT_CALL(*m_mockClientCallback, connected(_)).Times(1)
+                                            .WillOnce(Return(nullptr));
+    EXPECT_CALL(*m_mockServerCallback, connected(_)).Times(1);
+    EXPECT_CALL(*m_mockServerCallback, received(_, _, _)).Times(testing::AtLeast(1))
+                                                   .WillRepeatedly(Invoke(this, &TestIntegrationStreamConnectionContainer::receivedServer));
+    auto& expectDisconnectedServer = EXPECT_CALL(*m_mockServerCallback, disconnected(_)).Times(1);
+
+    int res = connectionContainer->bind("tcp://*:3335", m_mockBindCallback);
+    EXPECT_EQ(res, 0);
+
+    IStreamConnectionPtr connection = connectionContainer->connect("tcp://localhost:3335", m_mockClientCallback);
+    std::string expected;
+    for (int i = 0; i < NUMBER_OF_MESSAGES; ++i)
+    {
+        IMessagePtr message = std::make_shared<ProtocolMessage>(0);
+        std::string payload = MESSAGE1_BUFFER + std::to_string(i);
+        message->addSendPayload(payload);
+        connection->sendMessage(message);
+        expected += payload;
+    }
+
+    std::string received;
+    for (int i = 0; i < 500 && received.size() < expected.size(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        received.clear();
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (const auto& message : m_messagesServer)
+        {
+            received += message;
+        }
+    }
+    EXPECT_EQ(received, expected);
+
+    // the closed connection is detected without asking for the pending bytes
+    EXPECT_CALL(*m_mockClientCallback, disconnected(_)).WillRepeatedly(Return());
+    connection->disconnect();
+    waitTillDone(expectDisconnectedServer, 5000);
+
+    connectionContainer->terminatePollerLoop();
+    thread.join();
+}
+
+TEST_F(TestIntegrationStreamConnectionContainer, testReadUntilWouldBlockLargeMessage)
+{
+    std::shared_ptr<IStreamConnectionContainer> connectionContainer = std::make_shared<StreamConnectionContainer>();
+    connectionContainer->init(1, nullptr, 1, 1, ReceiveMode::RECEIVEMODE_READUNTILWOULDBLOCK);
+    std::thread thread([connectionContainer] () {
+        connectionContainer->run();
+    });
+
+    int bytesToReadMax = 0;
+    EXPECT_CALL(*m_mockBindCallback, connected(_)).Times(1)
+                                            .WillOnce(Return(m_mockServerCallback));
+    EXPECT_CALL(*m_mockClientCallback, connected(_)).Times(1)
+                                            .WillOnce(Return(nullptr));
+    EXPECT_CALL(*m_mockServerCallback, connected(_)).Times(1);
+    EXPECT_CALL(*m_mockServerCallback, received(_, _, _)).Times(testing::AtLeast(1))
+                                                   .WillRepeatedly(testing::Invoke([this, &bytesToReadMax] (const IStreamConnectionPtr& connection, const SocketPtr& socket, int bytesToRead) {
+                                                       bytesToReadMax = std::max(bytesToReadMax, bytesToRead);
+                                                       return receivedServer(connection, socket, bytesToRead);
+                                                   }));
+
+    int res = connectionContainer->bind("tcp://*:3335", m_mockBindCallback);
+    EXPECT_EQ(res, 0);
+
+    IStreamConnectionPtr connection = connectionContainer->connect("tcp://localhost:3335", m_mockClientCallback);
+    std::string expected;
+    for (int i = 0; expected.size() < 1000000; ++i)
+    {
+        expected += MESSAGE1_BUFFER + std::to_string(i);
+    }
+    IMessagePtr message = std::make_shared<ProtocolMessage>(0);
+    message->addSendPayload(expected);
+    connection->sendMessage(message);
+
+    std::string received;
+    for (int i = 0; i < 500 && received.size() < expected.size(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        received.clear();
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (const auto& message : m_messagesServer)
+        {
+            received += message;
+        }
+    }
+    EXPECT_EQ(received, expected);
+
+    // the bytes behind the small prefetch buffer are read straight into the buffer of the receiver
+    EXPECT_GT(bytesToReadMax, 2048);
+
+    EXPECT_CALL(*m_mockClientCallback, disconnected(_)).WillRepeatedly(Return());
+    EXPECT_CALL(*m_mockServerCallback, disconnected(_)).WillRepeatedly(Return());
+    connectionContainer->terminatePollerLoop();
+    thread.join();
+}
+
 TEST_F(TestIntegrationStreamConnectionContainer, testCreateConnectionDisconnect)
 {
     auto& expectDisconnectedClient = EXPECT_CALL(*m_mockClientCallback, disconnected(_)).Times(1);
@@ -33,6 +33,8 @@
 #include "testHelper.h"
 
 #include <thread>
+#include <mutex>
+#include <set>
 //#include <chrono>
 
 
@@ -348,4 +350,49 @@ TEST_F(TestIntegrationStreamConnectionContainerSsl, testSendLateConnectBind)
 }
 
 
+TEST_F(TestIntegrationStreamConnectionContainerSsl, testMultiplePollerLoops)
+{
+    std::mutex mutex;
+    std::set<IExecutorPtr> executorsServer;
+    std::shared_ptr<IStreamConnectionContainer> connectionContainer = std::make_shared<StreamConnectionContainer>();
+    connectionContainer->init(1, nullptr, 1, 4);
+    std::thread thread([connectionContainer] () {
+        connectionContainer->run();
+    });
+
+    static const int NUMBER_OF_CONNECTIONS = 4;
+
+    EXPECT_CALL(*m_mockBindCallback, connected(_)).Times(NUMBER_OF_CONNECTIONS)
+                                            .WillRepeatedly(testing::Invoke([this, &mutex, &executorsServer, &connectionContainer] (const IStreamConnectionPtr& connection) {
+                                                std::unique_lock<std::mutex> lock(mutex);
+                                                executorsServer.insert(connectionContainer->getPollerThreadExecutor(connection->getConnectionId()));
+                                                return hybrid_ptr<IStreamConnectionCallback>(m_mockServerCallback);
+                                            }));
+    auto& expectConnectedClient = EXPECT_CALL(*m_mockClientCallback, connected(_)).Times(NUMBER_OF_CONNECTIONS)
+                                            .WillRepeatedly(Return(nullptr));
+    auto& expectConnectedServer = EXPECT_CALL(*m_mockServerCallback, connected(_)).Times(NUMBER_OF_CONNECTIONS);
+
+    int res = connectionContainer->bind("tcp://*:3334", m_mockBindCallback, {{true, SSL_VERIFY_NONE, "ssltest.cert.pem", "ssltest.key.pem"}});
+    EXPECT_EQ(res, 0);
+
+    for (int i = 0; i < NUMBER_OF_CONNECTIONS; ++i)
+    {
+        IStreamConnectionPtr connection = connectionContainer->connect("tcp://localhost:3334", m_mockClientCallback, {{true, SSL_VERIFY_NONE}});
+        ASSERT_NE(connection, nullptr);
+    }
+
+    waitTillDone(expectConnectedClient, 5000);
+    waitTillDone(expectConnectedServer, 5000);
+
+    // the accepted SSL connections are distributed over the poller loops
+    std::unique_lock<std::mutex> lock(mutex);
+    EXPECT_GT(executorsServer.size(), 1);
+    lock.unlock();
+
+    EXPECT_CALL(*m_mockClientCallback, disconnected(_)).WillRepeatedly(Return());
+    EXPECT_CALL(*m_mockServerCallback, disconnected(_)).WillRepeatedly(Return());
+    connectionContainer->terminatePollerLoop();
+    thread.join();
+}
+
 #endif
@@ -368,6 +368,28 @@ TEST_F(TestJsonParser, testStringSimpleEscape)
     EXPECT_EQ(size, json.size());
 }
 
+TEST_F(TestJsonParser, testStringLongWithEscapes)
+{
+    // longer than the blocks of the SIMD scan, escapes at different positions
+    const std::string text(100, 'a');
+    std::string json = "\"" + text + "\\n" + text + "\\\"" + text.substr(0, 33) + "\"";
+    EXPECT_CALL(m_mockJsonParserVisitor, enterString(text + "\n" + text + "\"" + text.substr(0, 33))).Times(1);
+    EXPECT_CALL(m_mockJsonParserVisitor, finished()).Times(1);
+    const char* res = m_parser->parse(json.c_str());
+    EXPECT_NE(res, nullptr);
+    ssize_t size = res - json.c_str();
+    EXPECT_EQ(size, json.size());
+}
+
+TEST_F(TestJsonParser, testStringLongEarlyEnd)
+{
+    std::string json = "\"" + std::string(100, 'a');
+    EXPECT_CALL(m_mockJsonParserVisitor, syntaxError(json.c_str()+json.size(), _)).Times(1);
+    EXPECT_CALL(m_mockJsonParserVisitor, finished()).Times(1);
+    const char* res = m_parser->parse(json.c_str());
+    EXPECT_EQ(res, nullptr);
+}
+
 TEST_F(TestJsonParser, testStringSimpleEscapeEarlyEnd)
 {
     std::string json = "\"\\t";
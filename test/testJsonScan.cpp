@@ -0,0 +1,103 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+#include "finalmq/json/JsonScan.h"
+
+#include <string>
+
+
+using namespace finalmq;
+
+
+class TestJsonScan : public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+    }
+
+    virtual void TearDown()
+    {
+    }
+};
+
+
+
+TEST_F(TestJsonScan, testFindStringSpecial)
+{
+    for (char special : {'\"', '\\', '\0'})
+    {
+        for (size_t pos = 0; pos < 100; ++pos)
+        {
+            std::string str(100, 'a');
+            str[pos] = special;
+            if (pos + 1 < str.size())
+            {
+                // only the first one shall be found
+                str[pos + 1] = '\"';
+            }
+            const char* begin = str.data();
+            const char* end = str.data() + str.size();
+            ASSERT_EQ(JsonScan::findStringSpecial(begin, end), begin + pos);
+            ASSERT_EQ(JsonScan::findStringSpecial(begin, begin + pos), begin + pos);
+        }
+    }
+}
+
+TEST_F(TestJsonScan, testFindStringSpecialNotFound)
+{
+    // characters with the highest bit set (utf8) shall not be found
+    std::string str(100, '\xc3');
+    for (size_t size = 0; size <= str.size(); ++size)
+    {
+        ASSERT_EQ(JsonScan::findStringSpecial(str.data(), str.data() + size), str.data() + size);
+    }
+}
+
+TEST_F(TestJsonScan, testSkipWhiteSpace)
+{
+    for (size_t pos = 0; pos < 100; ++pos)
+    {
+        std::string str;
+        for (size_t i = 0; i < pos; ++i)
+        {
+            str += " \t\n\r"[i % 4];
+        }
+        str += "x";
+        str += std::string(50, ' ');
+        const char* begin = str.data();
+        const char* end = str.data() + str.size();
+        ASSERT_EQ(JsonScan::skipWhiteSpace(begin, end), begin + pos);
+        ASSERT_EQ(JsonScan::skipWhiteSpace(begin, begin + pos), begin + pos);
+    }
+}
+
+TEST_F(TestJsonScan, testSkipWhiteSpaceEmpty)
+{
+    const char* str = "";
+    ASSERT_EQ(JsonScan::skipWhiteSpace(str, str), str);
+    ASSERT_EQ(JsonScan::findStringSpecial(str, str), str);
+}
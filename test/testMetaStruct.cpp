@@ -0,0 +1,115 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+#include "finalmq/metadata/MetaStruct.h"
+
+#include <string>
+
+
+using namespace finalmq;
+
+
+class TestMetaStruct : public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+    }
+
+    virtual void TearDown()
+    {
+    }
+};
+
+
+
+TEST_F(TestMetaStruct, testEmpty)
+{
+    MetaStruct stru;
+    ASSERT_EQ(stru.getFieldByName("value"), nullptr);
+    ASSERT_EQ(stru.getFieldByName("", 0), nullptr);
+}
+
+TEST_F(TestMetaStruct, testWideStruct)
+{
+    static const int NUMBER_OF_FIELDS = 1000;
+    std::vector<MetaField> fields;
+    for (int i = 0; i < NUMBER_OF_FIELDS; ++i)
+    {
+        fields.emplace_back(MetaTypeId::TYPE_INT32, "", "field" + std::to_string(i), "", 0);
+    }
+    MetaStruct stru("test.Wide", "", fields);
+    ASSERT_EQ(stru.getFieldsSize(), NUMBER_OF_FIELDS);
+
+    for (int i = 0; i < NUMBER_OF_FIELDS; ++i)
+    {
+        const std::string name = "field" + std::to_string(i);
+        const MetaField* field = stru.getFieldByName(name.data(), name.size());
+        ASSERT_NE(field, nullptr);
+        ASSERT_EQ(field->name, name);
+        ASSERT_EQ(field->index, i);
+    }
+    for (int i = NUMBER_OF_FIELDS; i < 2 * NUMBER_OF_FIELDS; ++i)
+    {
+        ASSERT_EQ(stru.getFieldByName("field" + std::to_string(i)), nullptr);
+    }
+    ASSERT_EQ(stru.getFieldByName("field", 5), nullptr);
+    ASSERT_EQ(stru.getFieldByName("field12", 6), stru.getFieldByName("field1"));
+}
+
+TEST_F(TestMetaStruct, testAddField)
+{
+    MetaStruct stru("test.Add", "", {{MetaTypeId::TYPE_INT32, "", "a", "", 0}, {MetaTypeId::TYPE_STRING, "", "a", "", 0}});
+    ASSERT_EQ(stru.getFieldsSize(), 1);
+    ASSERT_EQ(stru.getFieldByName("a")->typeId, MetaTypeId::TYPE_INT32);
+
+    stru.addField({MetaTypeId::TYPE_STRING, "", "b", "", 0});
+    stru.addField({MetaTypeId::TYPE_STRING, "", "a", "", 0});
+    ASSERT_EQ(stru.getFieldsSize(), 2);
+    ASSERT_EQ(stru.getFieldByName("a")->index, 0);
+    ASSERT_EQ(stru.getFieldByName("b")->index, 1);
+    ASSERT_EQ(stru.getFieldByName("c"), nullptr);
+}
+
+TEST_F(TestMetaStruct, testAddFieldOneByOne)
+{
+    MetaStruct stru;
+    for (int i = 0; i < 100; ++i)
+    {
+        const std::string name = "field" + std::to_string(i);
+        stru.addField({MetaTypeId::TYPE_INT32, "", name, "", 0});
+        stru.addField({MetaTypeId::TYPE_STRING, "", name, "", 0});
+        ASSERT_EQ(stru.getFieldsSize(), i + 1);
+        for (int n = 0; n <= i; ++n)
+        {
+            const MetaField* field = stru.getFieldByName("field" + std::to_string(n));
+            ASSERT_NE(field, nullptr);
+            ASSERT_EQ(field->index, n);
+            ASSERT_EQ(field->typeId, MetaTypeId::TYPE_INT32);
+        }
+        ASSERT_EQ(stru.getFieldByName("field" + std::to_string(i + 1)), nullptr);
+    }
+}
@@ -0,0 +1,180 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+#include "finalmq/helpers/MonotonicArena.h"
+#include "finalmq/helpers/ZeroCopyBuffer.h"
+#include "finalmq/serializeproto/ParserProto.h"
+#include "finalmq/serializeproto/SerializerProto.h"
+#include "finalmq/serializestruct/ParserStruct.h"
+#include "finalmq/serializestruct/SerializerStruct.h"
+#include "finalmq/serializestruct/StructFactoryRegistry.h"
+#include "test.fmq.h"
+
+
+using namespace finalmq;
+
+
+class TestMonotonicArena : public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+    }
+
+    virtual void TearDown()
+    {
+    }
+
+    std::string serializeNullable()
+    {
+        test::TestStructNullable root;
+        root.struct_int32 = std::make_shared<test::TestInt32>(-3);
+        root.struct_string.value = "Hello";
+        root.last_value = 5;
+
+        ZeroCopyBuffer buffer;
+        SerializerProto serializer(buffer);
+        ParserStruct parser(serializer, root);
+        parser.parseStruct();
+        return buffer.getData();
+    }
+};
+
+
+
+TEST_F(TestMonotonicArena, testAllocate)
+{
+    MonotonicArena arena;
+    char* p1 = static_cast<char*>(arena.allocate(3, 1));
+    char* p2 = static_cast<char*>(arena.allocate(8, 8));
+    ASSERT_EQ(p1 + 3 <= p2, true);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(p2) % 8, 0u);
+    ASSERT_EQ(arena.getNumberOfBlocks(), 0);
+    ASSERT_EQ(arena.getBytesAllocated(), 11u);
+
+    // exceeds the initial buffer
+    for (int i = 0; i < 100; ++i)
+    {
+        void* p = arena.allocate(100, 16);
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(p) % 16, 0u);
+        memset(p, i, 100);
+    }
+    ASSERT_GT(arena.getNumberOfBlocks(), 0);
+
+    // a large allocation gets its own block
+    int blocks = arena.getNumberOfBlocks();
+    void* large = arena.allocate(1000000, 8);
+    memset(large, 0, 1000000);
+    ASSERT_EQ(arena.getNumberOfBlocks(), blocks + 1);
+    ASSERT_EQ(arena.getBytesAllocated(), 11u + 100 * 100 + 1000000);
+}
+
+TEST_F(TestMonotonicArena, testNoScope)
+{
+    ASSERT_EQ(MonotonicArena::current(), nullptr);
+    std::shared_ptr<test::TestInt32> value = makeSharedInArena<test::TestInt32>(5);
+    ASSERT_EQ(value->value, 5);
+}
+
+TEST_F(TestMonotonicArena, testScope)
+{
+    std::shared_ptr<MonotonicArena> arena = std::make_shared<MonotonicArena>();
+    std::shared_ptr<MonotonicArena> arenaInner = std::make_shared<MonotonicArena>();
+    {
+        ArenaScope scope(arena);
+        ASSERT_EQ(MonotonicArena::current(), arena);
+        {
+            ArenaScope scopeInner(arenaInner);
+            ASSERT_EQ(MonotonicArena::current(), arenaInner);
+        }
+        ASSERT_EQ(MonotonicArena::current(), arena);
+    }
+    ASSERT_EQ(MonotonicArena::current(), nullptr);
+}
+
+TEST_F(TestMonotonicArena, testLazyScopeReleasedWithLastObject)
+{
+    std::weak_ptr<MonotonicArena> arenaWeak;
+    std::shared_ptr<test::TestInt32> value1;
+    std::shared_ptr<test::TestString> value2;
+    {
+        ArenaScope scope;
+        value1 = makeSharedInArena<test::TestInt32>(5);
+        value2 = makeSharedInArena<test::TestString>("Hello");
+        arenaWeak = MonotonicArena::current();
+        ASSERT_NE(arenaWeak.lock(), nullptr);
+        ASSERT_GE(arenaWeak.lock()->getBytesAllocated(), sizeof(test::TestInt32) + sizeof(test::TestString));
+    }
+    ASSERT_EQ(MonotonicArena::current(), nullptr);
+    ASSERT_FALSE(arenaWeak.expired());
+    value1 = nullptr;
+    ASSERT_FALSE(arenaWeak.expired());
+    ASSERT_EQ(value2->value, "Hello");
+    value2 = nullptr;
+    ASSERT_TRUE(arenaWeak.expired());
+}
+
+TEST_F(TestMonotonicArena, testParseIntoArena)
+{
+    std::string data = serializeNullable();
+
+    std::shared_ptr<MonotonicArena> arena = std::make_shared<MonotonicArena>();
+    std::shared_ptr<StructBase> root;
+    {
+        ArenaScope scope(arena);
+        root = StructFactoryRegistry::instance().createStruct(test::TestStructNullable::structInfo().getTypeName());
+        ASSERT_NE(root, nullptr);
+        std::size_t bytesRoot = arena->getBytesAllocated();
+        ASSERT_GE(bytesRoot, sizeof(test::TestStructNullable));
+
+        SerializerStruct serializer(*root);
+        ParserProto parser(serializer, data.data(), data.size());
+        ASSERT_TRUE(parser.parseStruct(test::TestStructNullable::structInfo().getTypeName()));
+        ASSERT_GE(arena->getBytesAllocated(), bytesRoot + sizeof(test::TestInt32));
+    }
+
+    test::TestStructNullable& result = static_cast<test::TestStructNullable&>(*root);
+    ASSERT_NE(result.struct_int32, nullptr);
+    ASSERT_EQ(result.struct_int32->value, -3);
+    ASSERT_EQ(result.struct_string.value, "Hello");
+    ASSERT_EQ(result.last_value, 5u);
+}
+
+TEST_F(TestMonotonicArena, testGeneratedParseIntoArena)
+{
+    std::string data = serializeNullable();
+
+    std::shared_ptr<MonotonicArena> arena = std::make_shared<MonotonicArena>();
+    test::TestStructNullable result;
+    {
+        ArenaScope scope(arena);
+        ASSERT_TRUE(result.parseProto(data.data(), data.size()));
+    }
+    ASSERT_GE(arena->getBytesAllocated(), sizeof(test::TestInt32));
+    ASSERT_NE(result.struct_int32, nullptr);
+    ASSERT_EQ(result.struct_int32->value, -3);
+    ASSERT_EQ(result.struct_string.value, "Hello");
+}
@@ -0,0 +1,202 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+#include "finalmq/conversions/NumberParser.h"
+
+#include <cmath>
+#include <random>
+#include <string>
+
+#include <stdio.h>
+#include <string.h>
+
+
+using namespace finalmq;
+
+
+class TestNumberParser : public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+    }
+
+    virtual void TearDown()
+    {
+    }
+
+    static bool sameBits(double a, double b)
+    {
+        return (memcmp(&a, &b, sizeof(double)) == 0);
+    }
+
+    static void checkLikeStrtod(const std::string& str)
+    {
+        double value = 0;
+        const char* res = NumberParser::parseDouble(str.data(), str.data() + str.size(), value);
+        char* resStrtod = nullptr;
+        double valueStrtod = strtod(str.c_str(), &resStrtod);
+        ASSERT_EQ(res, str.data() + (resStrtod - str.c_str())) << str;
+        ASSERT_TRUE(sameBits(value, valueStrtod)) << str;
+
+        float valueFloat = 0;
+        NumberParser::parseFloat(str.data(), str.data() + str.size(), valueFloat);
+        float valueStrtof = strtof(str.c_str(), nullptr);
+        ASSERT_EQ(memcmp(&valueFloat, &valueStrtof, sizeof(float)), 0) << str;
+    }
+};
+
+
+
+TEST_F(TestNumberParser, testDoubleSpecialValues)
+{
+    for (const char* str : {"0", "-0", "0.0", "1", "-1.5E+3", "00012.5", "0.1", "0.2", "0.3", "3.14159", "1e308",
+                            "1.7976931348623157e308", "1.7976931348623158e308", "1.7976931348623159e308", "1e400",
+                            "2.2250738585072014e-308", "4.9406564584124654e-324", "2.4703282292062327e-324",
+                            "2.4703282292062328e-324", "1e-400", "9007199254740993", "9007199254740992.5",
+                            "123456789012345678901234567890", "0.000000000000000000000000000001", "1.", "1e", "1e+", "12e-5x",
+                            "1.5e-45", "3.4028235e38", "3.4028236e38"})
+    {
+        checkLikeStrtod(str);
+    }
+}
+
+TEST_F(TestNumberParser, testDoubleRandom)
+{
+    std::mt19937_64 random(42);
+    char buffer[64];
+    for (int i = 0; i < 100000; ++i)
+    {
+        const std::uint64_t bits = random();
+        double value = 0;
+        memcpy(&value, &bits, sizeof(double));
+        if (std::isnan(value) || std::isinf(value))
+        {
+            continue;
+        }
+        snprintf(buffer, sizeof(buffer), "%.17g", value);
+        checkLikeStrtod(buffer);
+        snprintf(buffer, sizeof(buffer), "%.*g", static_cast<int>(random() % 17) + 1, value);
+        checkLikeStrtod(buffer);
+        snprintf(buffer, sizeof(buffer), "%llue%d", static_cast<unsigned long long>(random() % 10000000000000000000ull), static_cast<int>(random() % 700) - 350);
+        checkLikeStrtod(buffer);
+    }
+}
+
+TEST_F(TestNumberParser, testFloatRandom)
+{
+    std::mt19937_64 random(43);
+    char buffer[64];
+    for (int i = 0; i < 100000; ++i)
+    {
+        const std::uint32_t bits = static_cast<std::uint32_t>(random());
+        float value = 0;
+        memcpy(&value, &bits, sizeof(float));
+        if (std::isnan(value) || std::isinf(value))
+        {
+            continue;
+        }
+        snprintf(buffer, sizeof(buffer), "%.9g", static_cast<double>(value));
+        checkLikeStrtod(buffer);
+        snprintf(buffer, sizeof(buffer), "%.*g", static_cast<int>(random() % 9) + 1, static_cast<double>(value));
+        checkLikeStrtod(buffer);
+        snprintf(buffer, sizeof(buffer), "%llue%d", static_cast<unsigned long long>(random() % 10000000000ull), static_cast<int>(random() % 90) - 55);
+        checkLikeStrtod(buffer);
+    }
+}
+
+TEST_F(TestNumberParser, testLongMantissa)
+{
+    std::mt19937_64 random(44);
+    for (int i = 0; i < 20000; ++i)
+    {
+        std::string str = std::to_string(random() % 9 + 1);
+        const int digits = static_cast<int>(random() % 40) + 19;
+        for (int d = 0; d < digits; ++d)
+        {
+            // many zeros or nines to get close to the middle between two doubles
+            const std::uint64_t r = random() % 4;
+            str += (r == 0) ? static_cast<char>('0' + random() % 10) : ((r == 1) ? '9' : '0');
+        }
+        if (random() % 2)
+        {
+            str.insert(str.size() - static_cast<std::size_t>(random() % digits), ".");
+        }
+        str += "e" + std::to_string(static_cast<int>(random() % 700) - 380);
+        checkLikeStrtod(str);
+    }
+    checkLikeStrtod("9007199254740993000000000000000000001");
+    checkLikeStrtod("1.000000000000000000000000000000000000000000001");
+    checkLikeStrtod("0.00000000000000000000000000000000000000000000140129846432481707092372958328991613128026194187651577175706828388979108268586060148663818836212158203125");
+}
+
+TEST_F(TestNumberParser, testNoDigits)
+{
+    double value = 0;
+    for (const char* str : {"", "-", ".", "-.", "e5", "x"})
+    {
+        ASSERT_EQ(NumberParser::parseDouble(str, str + strlen(str), value), nullptr);
+    }
+    std::uint64_t valueUInt = 0;
+    const char* negative = "-1";
+    ASSERT_EQ(NumberParser::parseUInt64(negative, negative + strlen(negative), valueUInt), nullptr);
+}
+
+TEST_F(TestNumberParser, testIntegers)
+{
+    for (const char* str : {"0", "123", "-123", "9223372036854775807", "9223372036854775808", "-9223372036854775808",
+                            "-9223372036854775809", "18446744073709551615", "18446744073709551616", "99999999999999999999999",
+                            " 42", "+42", "-1", "  -7x", "x", "0x10", ""})
+    {
+        const char* end = str + strlen(str);
+        ASSERT_EQ(NumberParser::toNumber<std::int64_t>(str, end), strtoll(str, nullptr, 10)) << str;
+        ASSERT_EQ(NumberParser::toNumber<std::uint64_t>(str, end), strtoull(str, nullptr, 10)) << str;
+        ASSERT_EQ(NumberParser::toNumber<std::int32_t>(str, end), static_cast<std::int32_t>(strtoll(str, nullptr, 10))) << str;
+        ASSERT_EQ(NumberParser::toNumber<std::uint16_t>(str, end), static_cast<std::uint16_t>(strtoull(str, nullptr, 10))) << str;
+    }
+}
+
+TEST_F(TestNumberParser, testParseInt64)
+{
+    std::int64_t value = 0;
+    const std::string str = "-12345,";
+    ASSERT_EQ(NumberParser::parseInt64(str.data(), str.data() + str.size(), value), str.data() + 6);
+    ASSERT_EQ(value, -12345);
+}
+
+TEST_F(TestNumberParser, testToNumberFloat)
+{
+    for (const char* str : {" 1.5", "+2.5", "-3e2", ".5", "-.5", "0x10", "  +.25e1", "", "abc"})
+    {
+        const char* end = str + strlen(str);
+        ASSERT_TRUE(sameBits(NumberParser::toNumber<double>(str, end), strtod(str, nullptr))) << str;
+    }
+    const std::string inf = "-inf";
+    ASSERT_TRUE(std::isinf(NumberParser::toNumber<double>(inf.data(), inf.data() + inf.size())));
+    const std::string nan = "nan";
+    ASSERT_TRUE(std::isnan(NumberParser::toNumber<float>(nan.data(), nan.data() + nan.size())));
+    ASSERT_TRUE(sameBits(NumberParser::toNumber<double>(nullptr, nullptr), 0.0));
+}
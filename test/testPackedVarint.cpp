@@ -0,0 +1,127 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+#include "finalmq/serializeproto/PackedVarint.h"
+
+#include <limits>
+
+
+using namespace finalmq;
+
+
+static std::uint64_t toVarint(std::uint64_t value)
+{
+    return value;
+}
+
+static std::uint64_t fromVarint(std::uint64_t value)
+{
+    return value;
+}
+
+static std::string writeArray(const std::vector<std::uint64_t>& value)
+{
+    std::string data;
+    data.resize(PackedVarint::sizeArray(value.data(), value.size(), toVarint));
+    char* end = PackedVarint::writeArray(&data[0], value.data(), value.size(), toVarint);
+    EXPECT_EQ(end, data.data() + data.size());
+    return data;
+}
+
+
+class TestPackedVarint : public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+    }
+
+    virtual void TearDown()
+    {
+    }
+};
+
+
+
+TEST_F(TestPackedVarint, testSizeVarint)
+{
+    ASSERT_EQ(PackedVarint::sizeVarint(0), 1u);
+    ASSERT_EQ(PackedVarint::sizeVarint(127), 1u);
+    ASSERT_EQ(PackedVarint::sizeVarint(128), 2u);
+    ASSERT_EQ(PackedVarint::sizeVarint(16383), 2u);
+    ASSERT_EQ(PackedVarint::sizeVarint(16384), 3u);
+    ASSERT_EQ(PackedVarint::sizeVarint(0xffffffffull), 5u);
+    ASSERT_EQ(PackedVarint::sizeVarint(std::numeric_limits<std::uint64_t>::max()), 10u);
+}
+
+TEST_F(TestPackedVarint, testWriteArray)
+{
+    ASSERT_EQ(writeArray({1, 300, 0}), std::string("\x01\xac\x02\x00", 4));
+}
+
+TEST_F(TestPackedVarint, testRoundTrip)
+{
+    std::vector<std::uint64_t> value;
+    for (std::uint64_t i = 0; i < 1000; ++i)
+    {
+        // runs of one byte varints are decoded 8 at once
+        value.push_back(((i / 20) % 2 == 0) ? (i % 128) : (i << (i % 57)));
+    }
+    value.push_back(std::numeric_limits<std::uint64_t>::max());
+    const std::string data = writeArray(value);
+
+    ASSERT_EQ(PackedVarint::countVarints(data.data(), data.size()), value.size());
+    std::vector<std::uint64_t> result = {7};
+    ASSERT_TRUE(PackedVarint::readArray(data.data(), data.size(), result, fromVarint));
+    ASSERT_EQ(result.size(), value.size() + 1);
+    ASSERT_EQ(result[0], 7u);
+    ASSERT_EQ(std::vector<std::uint64_t>(result.begin() + 1, result.end()), value);
+}
+
+TEST_F(TestPackedVarint, testBool)
+{
+    const std::string data = writeArray({1, 0, 0, 1, 1, 0, 1, 1, 1, 0});
+    std::vector<bool> result;
+    ASSERT_TRUE(PackedVarint::readArray(data.data(), data.size(), result, [](std::uint64_t value) {
+        return value != 0;
+    }));
+    ASSERT_EQ(result, std::vector<bool>({true, false, false, true, true, false, true, true, true, false}));
+}
+
+TEST_F(TestPackedVarint, testTruncated)
+{
+    const std::string data = writeArray({1, 2, 3, 4, 5, 6, 7, 8, 9, 300});
+    std::vector<std::uint64_t> result;
+    ASSERT_FALSE(PackedVarint::readArray(data.data(), data.size() - 1, result, fromVarint));
+    ASSERT_TRUE(result.empty());
+}
+
+TEST_F(TestPackedVarint, testTooLong)
+{
+    const std::string data(11, '\x80');
+    std::vector<std::uint64_t> result;
+    ASSERT_FALSE(PackedVarint::readArray((data + '\x01').data(), data.size() + 1, result, fromVarint));
+}
@@ -25,6 +25,7 @@
 
 
 #include "finalmq/serializehl7/ParserHl7.h"
+#include "finalmq/serializehl7/Hl7Schema.h"
 #include "finalmq/serializestruct/SerializerStruct.h"
 #include "finalmq/metadata/MetaData.h"
 #include "MockIParserVisitor.h"
@@ -99,6 +100,44 @@ TEST_F(TestParserHl7, testSSU_U03)
 }
 
 
+TEST_F(TestParserHl7, testSchema)
+{
+    const MetaStruct* stru = MetaDataGlobal::instance().getStruct("testhl7.SSU_U03");
+    ASSERT_NE(stru, nullptr);
+    const Hl7Schema::Struct& plan = Hl7Schema::getStruct(*stru);
+    ASSERT_EQ(&plan, &Hl7Schema::getStruct(*stru));
+    ASSERT_EQ(plan.metaStruct, stru);
+    ASSERT_EQ(plan.isSegment, false);
+    ASSERT_EQ(plan.typeNameParts, std::vector<std::string>({"SSU", "U03"}));
+    ASSERT_EQ(plan.fields.size(), 6);
+    ASSERT_EQ(plan.segmentIdsFrom.size(), 7);
+
+    // MSH is required, the search stops there
+    ASSERT_EQ(plan.matches("MSH", 0), true);
+    ASSERT_EQ(plan.matches("SFT", 0), false);
+    // SFT[] and UAC are optional, EQU is required
+    ASSERT_EQ(plan.matches("SFT", 1), true);
+    ASSERT_EQ(plan.matches("UAC", 1), true);
+    ASSERT_EQ(plan.matches("EQU", 1), true);
+    ASSERT_EQ(plan.matches("SAC", 1), false);
+    // segments inside of the groups
+    ASSERT_EQ(plan.matches("SAC", 4), true);
+    ASSERT_EQ(plan.matches("SPM", 4), false);
+    ASSERT_EQ(plan.matches("ROL", 5), true);
+    ASSERT_EQ(plan.matches("ROL", 6), false);
+
+    const Hl7Schema::Struct* container = plan.fields[4].subStruct;
+    ASSERT_NE(container, nullptr);
+    ASSERT_EQ(container->matches("SPM", 1), true);
+    ASSERT_EQ(container->matches("OBX", 2), false);
+    const Hl7Schema::Struct* msh = plan.fields[0].subStruct;
+    ASSERT_NE(msh, nullptr);
+    ASSERT_EQ(msh->isSegment, true);
+    ASSERT_EQ(msh->isMsh, true);
+    ASSERT_EQ(msh->matches("MSH", 0), false);
+}
+
+
 TEST_F(TestParserHl7, testMSG_001)
 {
     testhl7::MSG_001 cmp;
@@ -0,0 +1,180 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+#include "finalmq/serializeproto/SerializerProtoSized.h"
+#include "finalmq/serializeproto/SerializerProto.h"
+#include "finalmq/serializeproto/ParserProto.h"
+#include "finalmq/serializestruct/SerializerStruct.h"
+#include "finalmq/serializestruct/ParserStruct.h"
+#include "finalmq/helpers/ZeroCopyBuffer.h"
+#include "test.fmq.h"
+
+#include <limits>
+
+
+using namespace finalmq;
+
+
+static std::string serializeProtoReflective(const StructBase& structBase)
+{
+    ZeroCopyBuffer buffer;
+    SerializerProto serializer(buffer);
+    ParserStruct parser(serializer, structBase);
+    parser.parseStruct();
+    return buffer.getData();
+}
+
+static std::string serializeProtoSized(const StructBase& structBase)
+{
+    ZeroCopyBuffer buffer;
+    SerializerProtoSized serializer(buffer);
+    EXPECT_TRUE(serializer.serializeStruct(structBase));
+    return buffer.getData();
+}
+
+template<class T>
+static void checkSized(const T& root)
+{
+    const std::string proto = serializeProtoSized(root);
+    ASSERT_EQ(proto, serializeProtoReflective(root));
+    T result;
+    SerializerStruct serializer(result);
+    ParserProto parser(serializer, proto.data(), proto.size());
+    ASSERT_TRUE(parser.parseStruct(root.getStructInfo().getTypeName()));
+    ASSERT_EQ(result, root);
+}
+
+
+class TestSerializerProtoSized : public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+    }
+
+    virtual void TearDown()
+    {
+    }
+};
+
+
+
+TEST_F(TestSerializerProtoSized, testScalars)
+{
+    checkSized(test::TestBool(true));
+    checkSized(test::TestInt8(-100));
+    checkSized(test::TestInt8ZigZag(-100));
+    checkSized(test::TestUInt8(200));
+    checkSized(test::TestInt16(-30000));
+    checkSized(test::TestInt16ZigZag(-30000));
+    checkSized(test::TestUInt16(60000));
+    checkSized(test::TestInt32(-2));
+    checkSized(test::TestInt32ZigZag(-100000));
+    checkSized(test::TestUInt32(std::numeric_limits<std::uint32_t>::max()));
+    checkSized(test::TestInt64(std::numeric_limits<std::int64_t>::min()));
+    checkSized(test::TestUInt64(std::numeric_limits<std::uint64_t>::max()));
+    checkSized(test::TestFloat(-1.5f));
+    checkSized(test::TestDouble(1e300));
+    checkSized(test::TestString("Hello World"));
+    checkSized(test::TestBytes({0, 1, 2, -1, 'a'}));
+    checkSized(test::TestEnum(test::Foo::FOO_WORLD2));
+    checkSized(test::TestInt32());
+}
+
+TEST_F(TestSerializerProtoSized, testJson)
+{
+    test::TestJson root;
+    root.value = VariantStruct{{"a", 1}, {"b", "Hello"}};
+    ASSERT_EQ(serializeProtoSized(root), serializeProtoReflective(root));
+}
+
+TEST_F(TestSerializerProtoSized, testStructs)
+{
+    checkSized(test::TestStruct());
+    checkSized(test::TestStruct({-2}, {"Hello"}, 12));
+    checkSized(test::TestStructBlockSize({-2}, {"Hello"}, 12));
+
+    test::TestStructNullable nullable;
+    nullable.struct_string.value = "Hello";
+    nullable.last_value = 5;
+    checkSized(nullable);
+    nullable.struct_int32 = std::make_shared<test::TestInt32>(-7);
+    checkSized(nullable);
+
+    test::TestArrayStruct arrayStruct;
+    arrayStruct.value.push_back(test::TestStruct({-2}, {"Hello"}, 12));
+    arrayStruct.value.push_back(test::TestStruct());
+    arrayStruct.value.push_back(test::TestStruct({5}, {""}, 0));
+    arrayStruct.last_value = 7;
+    checkSized(arrayStruct);
+}
+
+TEST_F(TestSerializerProtoSized, testLargeNestedStruct)
+{
+    // SerializerProto pads the length of large sub structs with a dummy field,
+    // the sized serializer writes the exact length.
+    test::TestArrayStruct root;
+    for (int i = 0; i < 100; ++i)
+    {
+        root.value.push_back(test::TestStruct({i}, {std::string(i * 10, 'a')}, i));
+    }
+    root.last_value = 7;
+    const std::string proto = serializeProtoSized(root);
+    ASSERT_LT(proto.size(), serializeProtoReflective(root).size());
+
+    test::TestArrayStruct result;
+    SerializerStruct serializer(result);
+    ParserProto parser(serializer, proto.data(), proto.size());
+    ASSERT_TRUE(parser.parseStruct(root.getStructInfo().getTypeName()));
+    ASSERT_EQ(result, root);
+}
+
+TEST_F(TestSerializerProtoSized, testArrays)
+{
+    checkSized(test::TestArrayBool({true, false, true}));
+    checkSized(test::TestArrayInt8({-1, 0, 127}));
+    checkSized(test::TestArrayInt16({-1, 0, 32767}));
+    checkSized(test::TestArrayUInt16({1, 0, 65535}));
+    checkSized(test::TestArrayInt32({-1, 0, std::numeric_limits<std::int32_t>::max()}));
+    checkSized(test::TestArrayUInt32({1, 0, std::numeric_limits<std::uint32_t>::max()}));
+    checkSized(test::TestArrayInt64({-1, 0, std::numeric_limits<std::int64_t>::max()}));
+    checkSized(test::TestArrayUInt64({1, 0, std::numeric_limits<std::uint64_t>::max()}));
+    checkSized(test::TestArrayFloat({-1.5f, 0, 2.25f}));
+    checkSized(test::TestArrayDouble({-1.5, 0, 1e-300}));
+    checkSized(test::TestArrayString({"Hello", "", "World"}));
+    checkSized(test::TestArrayBytes({{'a', 0}, {}, {-1}}));
+    checkSized(test::TestArrayEnum({test::Foo::FOO_HELLO, test::Foo::FOO_WORLD, test::Foo::FOO_WORLD2}));
+}
+
+TEST_F(TestSerializerProtoSized, testNotSupported)
+{
+    test::TestVariant root;
+    root.valueInt32 = 5;
+    ZeroCopyBuffer buffer;
+    SerializerProtoSized serializer(buffer);
+    ASSERT_FALSE(serializer.serializeStruct(root));
+    ASSERT_EQ(buffer.getData(), "");
+}
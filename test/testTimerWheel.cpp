@@ -0,0 +1,185 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <algorithm>
+
+#include "finalmq/helpers/TimerWheel.h"
+
+
+using namespace finalmq;
+
+
+
+class TestTimerWheel: public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+    }
+
+    virtual void TearDown()
+    {
+    }
+
+};
+
+
+TEST_F(TestTimerWheel, expireAtDeadline)
+{
+    TimerWheel wheel(1000, 10);
+    wheel.add(1050, 1);
+    ASSERT_EQ(wheel.size(), 1);
+
+    std::vector<std::uint64_t> expired;
+    wheel.advance(1049, expired);
+    ASSERT_EQ(expired.size(), 0);
+    wheel.advance(1050, expired);
+    ASSERT_EQ(expired.size(), 1);
+    ASSERT_EQ(expired[0], 1);
+    ASSERT_EQ(wheel.size(), 0);
+}
+
+TEST_F(TestTimerWheel, neverBeforeDeadline)
+{
+    TimerWheel wheel(1000, 10);
+    // the deadline is not a multiple of the resolution
+    wheel.add(1055, 1);
+
+    std::vector<std::uint64_t> expired;
+    wheel.advance(1050, expired);
+    ASSERT_EQ(expired.size(), 0);
+    wheel.advance(1060, expired);
+    ASSERT_EQ(expired.size(), 1);
+}
+
+TEST_F(TestTimerWheel, deadlineInThePast)
+{
+    TimerWheel wheel(1000, 10);
+    wheel.add(500, 1);
+
+    std::vector<std::uint64_t> expired;
+    wheel.advance(1000, expired);
+    ASSERT_EQ(expired.size(), 0);
+    wheel.advance(1010, expired);
+    ASSERT_EQ(expired.size(), 1);
+}
+
+TEST_F(TestTimerWheel, remove)
+{
+    TimerWheel wheel(0, 1);
+    TimerWheel::Handle handle1 = wheel.add(100, 1);
+    wheel.add(100, 2);
+    TimerWheel::Handle handle3 = wheel.add(100000, 3);
+    ASSERT_EQ(wheel.size(), 3);
+    wheel.remove(handle1);
+    wheel.remove(handle3);
+    ASSERT_EQ(wheel.size(), 1);
+
+    std::vector<std::uint64_t> expired;
+    wheel.advance(200000, expired);
+    ASSERT_EQ(expired.size(), 1);
+    ASSERT_EQ(expired[0], 2);
+}
+
+TEST_F(TestTimerWheel, cascade)
+{
+    // deadlines on all levels and across the slot boundaries of the levels
+    static const std::int64_t START = 12345;
+    TimerWheel wheel(START, 1);
+    std::vector<std::int64_t> deadlines;
+    for (std::int64_t delta = 1; delta < 20000000; delta = delta * 3 + 1)
+    {
+        deadlines.push_back(START + delta);
+        deadlines.push_back(START + delta + 63);
+        deadlines.push_back(START + delta + 64);
+    }
+    for (size_t i = 0; i < deadlines.size(); ++i)
+    {
+        wheel.add(deadlines[i], i);
+    }
+    // a removed timer on a higher level must not expire after cascading
+    TimerWheel::Handle handle = wheel.add(START + 5000, 9999);
+
+    std::vector<std::int64_t> sorted = deadlines;
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<std::uint64_t> expired;
+    std::int64_t now = START;
+    for (size_t i = 0; i < sorted.size(); ++i)
+    {
+        if (now < START + 5000 && sorted[i] >= START + 5000)
+        {
+            wheel.remove(handle);
+        }
+        // just before the deadline
+        size_t countBefore = expired.size();
+        wheel.advance(sorted[i] - 1, expired);
+        for (size_t n = countBefore; n < expired.size(); ++n)
+        {
+            ASSERT_LT(deadlines[expired[n]], sorted[i]);
+        }
+        wheel.advance(sorted[i], expired);
+        now = sorted[i];
+    }
+    ASSERT_EQ(expired.size(), deadlines.size());
+    for (size_t i = 0; i < expired.size(); ++i)
+    {
+        ASSERT_NE(expired[i], 9999);
+        ASSERT_LE(deadlines[expired[i]], now);
+    }
+    ASSERT_EQ(wheel.size(), 0);
+}
+
+TEST_F(TestTimerWheel, exactExpiration)
+{
+    // every timer expires exactly at its tick
+    TimerWheel wheel(0, 1);
+    std::vector<std::int64_t> deadlines = {1, 63, 64, 65, 127, 128, 4095, 4096, 4097, 262143, 262144, 262145, 300000};
+    for (size_t i = 0; i < deadlines.size(); ++i)
+    {
+        wheel.add(deadlines[i], i);
+    }
+    std::vector<std::uint64_t> expired;
+    for (std::int64_t now = 1; now <= 300000; ++now)
+    {
+        size_t countBefore = expired.size();
+        wheel.advance(now, expired);
+        for (size_t n = countBefore; n < expired.size(); ++n)
+        {
+            ASSERT_EQ(deadlines[expired[n]], now);
+        }
+    }
+    ASSERT_EQ(expired.size(), deadlines.size());
+}
+
+TEST_F(TestTimerWheel, clampDeadline)
+{
+    TimerWheel wheel(0, 1);
+    wheel.add(static_cast<std::int64_t>(1) << 40, 1);
+    std::vector<std::uint64_t> expired;
+    wheel.advance((static_cast<std::int64_t>(1) << 24) - 2, expired);
+    ASSERT_EQ(expired.size(), 0);
+    wheel.advance((static_cast<std::int64_t>(1) << 24), expired);
+    ASSERT_EQ(expired.size(), 1);
+}
@@ -0,0 +1,117 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+#include "finalmq/helpers/Utf16.h"
+
+#include <string>
+
+
+using namespace finalmq;
+
+
+class TestUtf16 : public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+    }
+
+    virtual void TearDown()
+    {
+    }
+
+    static std::string toUtf16Be(const std::string& utf8, ssize_t maxCount = -1)
+    {
+        std::string utf16(2 * utf8.size(), '\0');
+        const ssize_t count = Utf16::utf8ToUtf16Be(utf8.data(), utf8.size(), &utf16[0], (maxCount == -1) ? utf8.size() : maxCount);
+        utf16.resize(2 * count);
+        return utf16;
+    }
+
+    static std::string toUtf8(const std::string& utf16)
+    {
+        std::string utf8;
+        Utf16::utf16BeToUtf8(utf16.data(), utf16.size() / 2, utf8);
+        return utf8;
+    }
+};
+
+
+
+TEST_F(TestUtf16, testAscii)
+{
+    // longer than the blocks of the SSE2 conversion, all lengths
+    for (size_t size = 0; size < 100; ++size)
+    {
+        std::string utf8;
+        std::string utf16;
+        for (size_t i = 0; i < size; ++i)
+        {
+            const char c = static_cast<char>('!' + (i % 90));
+            utf8 += c;
+            utf16 += '\0';
+            utf16 += c;
+        }
+        ASSERT_EQ(toUtf16Be(utf8), utf16);
+        ASSERT_EQ(toUtf8(utf16), utf8);
+    }
+}
+
+TEST_F(TestUtf16, testMultiByte)
+{
+    // 2, 3 and 4 bytes in utf8, the last one is a surrogate pair in utf16
+    const std::string utf8 = "a\xC3\xA4" "b\xE2\x82\xAC" "c\xF0\x9F\x98\x80";
+    const std::string utf16("\x00" "a" "\x00\xE4" "\x00" "b" "\x20\xAC" "\x00" "c" "\xD8\x3D\xDE\x00", 14);
+    ASSERT_EQ(toUtf16Be(utf8), utf16);
+    ASSERT_EQ(toUtf8(utf16), utf8);
+
+    // non ascii characters in the middle of long ascii texts
+    const std::string text(40, 'x');
+    ASSERT_EQ(toUtf8(toUtf16Be(text + utf8 + text + utf8)), text + utf8 + text + utf8);
+}
+
+TEST_F(TestUtf16, testInvalid)
+{
+    // a lonely continuation byte, a truncated sequence, an overlong encoding and an encoded surrogate
+    ASSERT_EQ(toUtf16Be("a\x80" "b"), std::string("\x00" "a" "\xFF\xFD" "\x00" "b", 6));
+    ASSERT_EQ(toUtf16Be("a\xE2\x82"), std::string("\x00" "a" "\xFF\xFD" "\xFF\xFD", 6));
+    ASSERT_EQ(toUtf16Be("\xC0\xAF"), std::string("\xFF\xFD" "\xFF\xFD", 4));
+    ASSERT_EQ(toUtf16Be("\xED\xA0\x80"), std::string("\xFF\xFD" "\xFF\xFD" "\xFF\xFD", 6));
+
+    // unpaired surrogates
+    ASSERT_EQ(toUtf8(std::string("\xD8\x3D" "\x00" "a", 4)), "\xEF\xBF\xBD" "a");
+    ASSERT_EQ(toUtf8(std::string("\xDE\x00", 2)), "\xEF\xBF\xBD");
+    ASSERT_EQ(toUtf8(std::string("\xD8\x3D", 2)), "\xEF\xBF\xBD");
+}
+
+TEST_F(TestUtf16, testMaxCount)
+{
+    const std::string text(40, 'x');
+    ASSERT_EQ(toUtf16Be(text, 33), toUtf16Be(text.substr(0, 33)));
+    // the surrogate pair is cut
+    ASSERT_EQ(toUtf16Be("a\xF0\x9F\x98\x80", 2), std::string("\x00" "a" "\xD8\x3D", 4));
+    ASSERT_EQ(toUtf16Be("a\xF0\x9F\x98\x80", 0), "");
+}
@@ -572,3 +572,141 @@ TEST_F(TestVariant, testGetOrCreate)
     ASSERT_EQ(std::string("Hello"), variant.getDataValue<std::string>("aaa.3.bbb"));
 }
 
+
+TEST_F(TestVariant, testCopyAndMove)
+{
+    Variant variant = VariantStruct{{"a", 1}, {"b", std::string("a string that does not fit into the short string buffer")}, {"c", VariantList{1, 2, 3}}};
+    Variant copy = variant;
+    *copy.getData<std::int32_t>("a") = 5;
+    ASSERT_EQ(variant.getDataValue<std::int32_t>("a"), 1);
+    ASSERT_EQ(copy.getDataValue<std::int32_t>("a"), 5);
+
+    Variant moved = std::move(copy);
+    ASSERT_EQ(copy.getType(), VARTYPE_NONE);
+    ASSERT_EQ(moved.getDataValue<std::int32_t>("a"), 5);
+
+    // assign a part of the variant to the variant itself
+    moved = *moved.getVariant("c");
+    ASSERT_EQ(moved == VariantList({1, 2, 3}), true);
+    variant = std::move(*variant.getVariant("b"));
+    ASSERT_EQ(variant.getDataValue<std::string>(""), "a string that does not fit into the short string buffer");
+}
+
+TEST_F(TestVariant, testWideStruct)
+{
+    Variant variant = VariantStruct();
+    for (int i = 0; i < 100; ++i)
+    {
+        variant.add("key" + std::to_string(i), i);
+    }
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(variant.getDataValue<std::int32_t>("key" + std::to_string(i)), i);
+    }
+    variant.add("key3", 33);
+    ASSERT_EQ(variant.size(), 100);
+    ASSERT_EQ(variant.getDataValue<std::int32_t>("key3"), 33);
+    ASSERT_EQ(variant.getVariant("key100"), nullptr);
+
+    // modification of the struct from outside
+    VariantStruct* data = variant;
+    ASSERT_NE(data, nullptr);
+    (*data)[5].first = "renamed";
+    data->emplace_back("appended", 7);
+    ASSERT_EQ(variant.getVariant("key5"), nullptr);
+    ASSERT_EQ(variant.getDataValue<std::int32_t>("renamed"), 5);
+    ASSERT_EQ(variant.getDataValue<std::int32_t>("appended"), 7);
+
+    const Variant& variantConst = variant;
+    ASSERT_EQ(*variantConst.getData<std::int32_t>("key99"), 99);
+}
+
+TEST_F(TestVariant, testWideStructModifiedAfterLookup)
+{
+    Variant variant = VariantStruct();
+    for (int i = 0; i < 100; ++i)
+    {
+        variant.add("key" + std::to_string(i), i);
+    }
+
+    // the struct is handed out, looked up and modified afterwards without changing its size
+    VariantStruct* data = variant;
+    ASSERT_NE(data, nullptr);
+    // the non-const lookup would build the index
+    ASSERT_EQ(*variant.getData<std::int32_t>("key5"), 5);
+    ASSERT_EQ(*variant.getData<std::int32_t>("key6"), 6);
+    (*data)[5].first = "renamed";
+    (*data)[6] = {"replaced", 66};
+    ASSERT_EQ(variant.getVariant("key5"), nullptr);
+    ASSERT_EQ(variant.getVariant("key6"), nullptr);
+    ASSERT_EQ(variant.getDataValue<std::int32_t>("renamed"), 5);
+    ASSERT_EQ(variant.getDataValue<std::int32_t>("replaced"), 66);
+    ASSERT_EQ(variant.getDataValue<std::int32_t>("key99"), 99);
+}
+
+TEST_F(TestVariant, testAtom)
+{
+    const Atom atomA("fmq_atom_a");
+    const Atom atomA2(std::string("fmq_atom_a"));
+    const Atom atomB("fmq_atom.b");
+    // interned: the same name is the same ID and the same instance of the name
+    ASSERT_EQ(atomA, atomA2);
+    ASSERT_EQ(atomA.getId(), atomA2.getId());
+    ASSERT_EQ(&atomA.getName(), &atomA2.getName());
+    ASSERT_NE(atomA, atomB);
+    ASSERT_EQ(atomA.getName(), "fmq_atom_a");
+    ASSERT_LT(atomB.getId(), Atom::getNumberOfAtoms());
+
+    Variant variant = VariantStruct({{"fmq_atom_a", std::string("hello")}, {"fmq_atom.b", 5}, {"fmq_atom", VariantStruct({{"b", 6}})}});
+    ASSERT_EQ(*variant.getData<std::string>(atomA), "hello");
+    // the key of an atom is not a path
+    ASSERT_EQ(variant.getDataValue<std::int32_t>(atomB), 5);
+    ASSERT_EQ(variant.getDataValue<std::int32_t>("fmq_atom.b"), 6);
+    ASSERT_EQ(variant.getData<std::int32_t>(atomA), nullptr);
+    ASSERT_EQ(variant.getVariant(Atom("fmq_atom_c")), nullptr);
+
+    const Variant& variantConst = variant;
+    ASSERT_EQ(*variantConst.getData<std::string>(atomA), "hello");
+
+    Variant notAStruct = 5;
+    ASSERT_EQ(notAStruct.getVariant(atomA), nullptr);
+}
+
+TEST_F(TestVariant, testAtomSlots)
+{
+    const Atom atomA("fmq_slot_a");
+    const Atom atomB("fmq_slot_b");
+    Variant variant = VariantStruct();
+    variant.add(atomA, 1);
+    for (int i = 0; i < 100; ++i)
+    {
+        variant.add("key" + std::to_string(i), i);
+    }
+    variant.add(atomB, 2);
+    variant.add(atomA, 3);
+    ASSERT_EQ(variant.size(), 102);
+
+    // the positions are remembered by the atom IDs
+    const Variant& variantConst = variant;
+    ASSERT_EQ(variantConst.getDataValue<std::int32_t>(atomA), 3);
+    ASSERT_EQ(variantConst.getDataValue<std::int32_t>(atomB), 2);
+    ASSERT_EQ(variantConst.getDataValue<std::int32_t>("fmq_slot_b"), 2);
+
+    // an atom created later gets its slot on the first lookup
+    const Atom atomC("key50");
+    ASSERT_EQ(variant.getDataValue<std::int32_t>(atomC), 50);
+    ASSERT_EQ(*variant.getData<std::int32_t>(atomC), 50);
+
+    // copies keep the slots
+    const Variant copy = variant;
+    ASSERT_EQ(copy.getDataValue<std::int32_t>(atomA), 3);
+    ASSERT_EQ(copy.getDataValue<std::int32_t>(atomC), 50);
+
+    // the struct is handed out and modified, the slots are not used anymore
+    VariantStruct* data = variant;
+    (*data)[0].first = "renamed";
+    ASSERT_EQ(variant.getVariant(atomA), nullptr);
+    ASSERT_EQ(variantConst.getVariant(atomA), nullptr);
+    ASSERT_EQ(variant.getDataValue<std::int32_t>("renamed"), 3);
+    ASSERT_EQ(variant.getDataValue<std::int32_t>(atomB), 2);
+}
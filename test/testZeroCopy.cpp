@@ -0,0 +1,158 @@
+//MIT License
+
+//Copyright (c) 2020 bexoft GmbH (mail@bexoft.de)
+
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files (the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions:
+
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+#include "finalmq/serializeproto/SerializerProto.h"
+#include "finalmq/serializeproto/SerializerProtoSized.h"
+#include "finalmq/serializeproto/ParserProto.h"
+#include "finalmq/serializejson/ParserJson.h"
+#include "finalmq/serializestruct/SerializerStruct.h"
+#include "finalmq/serializestruct/ParserStruct.h"
+#include "finalmq/helpers/ZeroCopyBuffer.h"
+#include "test.fmq.h"
+
+
+using namespace finalmq;
+
+
+class TestZeroCopy : public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+        m_root.value = "Hello World";
+        m_root.data = BytesView(std::string({0, 1, 2, -1, 'a'}));
+        m_root.last_value = 7;
+
+        ZeroCopyBuffer buffer;
+        SerializerProto serializer(buffer);
+        ParserStruct parser(serializer, m_root);
+        parser.parseStruct();
+        m_buffer = std::make_shared<std::string>(buffer.getData());
+    }
+
+    virtual void TearDown()
+    {
+    }
+
+    bool isInBuffer(const BytesView& view) const
+    {
+        return (view.getBuffer() == m_buffer && view.data() >= m_buffer->data() && view.data() + view.size() <= m_buffer->data() + m_buffer->size());
+    }
+
+    test::TestZeroCopy m_root;
+    std::shared_ptr<const std::string> m_buffer;
+};
+
+
+
+TEST_F(TestZeroCopy, testBytesView)
+{
+    BytesView empty;
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ(empty.str(), "");
+    ASSERT_EQ(empty.getBuffer(), nullptr);
+
+    BytesView view("Hello");
+    ASSERT_EQ(view.size(), 5);
+    ASSERT_EQ(view.str(), "Hello");
+    BytesView copy = view;
+    ASSERT_EQ(copy.data(), view.data());
+    ASSERT_EQ(copy, view);
+    ASSERT_NE(view, empty);
+    ASSERT_EQ(BytesView(""), empty);
+}
+
+TEST_F(TestZeroCopy, testParseProtoReferencesBuffer)
+{
+    test::TestZeroCopy result;
+    SerializerStruct serializer(result);
+    serializer.setZeroCopyBuffer(m_buffer);
+    ParserProto parser(serializer, m_buffer->data(), m_buffer->size());
+    ASSERT_TRUE(parser.parseStruct(test::TestZeroCopy::structInfo().getTypeName()));
+
+    ASSERT_EQ(result, m_root);
+    ASSERT_TRUE(isInBuffer(result.value));
+    ASSERT_TRUE(isInBuffer(result.data));
+    ASSERT_EQ(result.value.str(), "Hello World");
+}
+
+TEST_F(TestZeroCopy, testParseProtoWithoutBuffer)
+{
+    test::TestZeroCopy result;
+    SerializerStruct serializer(result);
+    ParserProto parser(serializer, m_buffer->data(), m_buffer->size());
+    ASSERT_TRUE(parser.parseStruct(test::TestZeroCopy::structInfo().getTypeName()));
+
+    ASSERT_EQ(result, m_root);
+    ASSERT_FALSE(isInBuffer(result.value));
+    ASSERT_NE(result.value.getBuffer(), nullptr);
+}
+
+TEST_F(TestZeroCopy, testViewKeepsBufferAlive)
+{
+    test::TestZeroCopy result;
+    {
+        std::shared_ptr<const std::string> buffer = std::make_shared<std::string>(*m_buffer);
+        SerializerStruct serializer(result);
+        serializer.setZeroCopyBuffer(buffer);
+        ParserProto parser(serializer, buffer->data(), buffer->size());
+        ASSERT_TRUE(parser.parseStruct(test::TestZeroCopy::structInfo().getTypeName()));
+    }
+    ASSERT_EQ(result.value.getBuffer().use_count(), 2);
+    ASSERT_EQ(result.value.str(), "Hello World");
+}
+
+TEST_F(TestZeroCopy, testParseJson)
+{
+    // the unescaped string is referenced, the escaped string and the base64 decoded bytes are copied
+    const std::shared_ptr<const std::string> json = std::make_shared<std::string>("{\"value\":\"Hello\",\"data\":\"AAEC/2E=\",\"last_value\":7}");
+    test::TestZeroCopy result;
+    SerializerStruct serializer(result);
+    serializer.setZeroCopyBuffer(json);
+    ParserJson parser(serializer, json->data(), json->size());
+    ASSERT_NE(parser.parseStruct(test::TestZeroCopy::structInfo().getTypeName()), nullptr);
+    ASSERT_EQ(result.value.getBuffer(), json);
+    ASSERT_EQ(result.value.str(), "Hello");
+    ASSERT_EQ(result.data, m_root.data);
+    ASSERT_EQ(result.last_value, 7u);
+
+    const std::shared_ptr<const std::string> jsonEscaped = std::make_shared<std::string>("{\"value\":\"Hello\\nWorld\"}");
+    SerializerStruct serializerEscaped(result);
+    serializerEscaped.setZeroCopyBuffer(jsonEscaped);
+    ParserJson parserEscaped(serializerEscaped, jsonEscaped->data(), jsonEscaped->size());
+    ASSERT_NE(parserEscaped.parseStruct(test::TestZeroCopy::structInfo().getTypeName()), nullptr);
+    ASSERT_NE(result.value.getBuffer(), jsonEscaped);
+    ASSERT_EQ(result.value.str(), "Hello\nWorld");
+    ASSERT_TRUE(result.data.empty());
+}
+
+TEST_F(TestZeroCopy, testSerializeProtoSized)
+{
+    ZeroCopyBuffer buffer;
+    SerializerProtoSized serializer(buffer);
+    ASSERT_TRUE(serializer.serializeStruct(m_root));
+    ASSERT_EQ(buffer.getData(), *m_buffer);
+}